@@ -16,6 +16,7 @@
 
 #include <stdlib.h>
 #include <iostream>
+#include <memory>
 #include <typeinfo>
 
 // Need to override adaptor classes for toolkit test harness, so include
@@ -645,6 +646,39 @@ int UtcDaliPhysics2DAdaptorGetIntegrationState(void)
   END_TEST;
 }
 
+int UtcDaliPhysics2DAdaptorSetThreadingMode(void)
+{
+  tet_infoline("Test that changing the threading mode is reflected, and that the worker thread can be started and stopped");
+
+  ToolkitTestApplication application;
+  Matrix                 transform(false);
+  transform.SetIdentityAndScale(Vector3(2.0f, 2.0f, 1.0f));
+  Uint16Pair     size(640, 480);
+  auto           scene     = application.GetScene();
+  PhysicsAdaptor adaptor   = PhysicsAdaptor::New(transform, size);
+  Actor          rootActor = adaptor.GetRootActor();
+  scene.Add(rootActor);
+
+  DALI_TEST_CHECK(adaptor.GetThreadingMode() == PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::WORKER_THREAD);
+  DALI_TEST_CHECK(adaptor.GetThreadingMode() == PhysicsAdaptor::ThreadingMode::WORKER_THREAD);
+
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+  application.Render(16);
+
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+  DALI_TEST_CHECK(adaptor.GetThreadingMode() == PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+
+  // Leave the worker running to check it is stopped when the adaptor is destroyed
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::WORKER_THREAD);
+  adaptor.Reset();
+
+  END_TEST;
+}
+
 int UtcDaliPhysics2DAdaptorSetDebugState(void)
 {
   tet_infoline("Test that changing the debug state is reflected");
@@ -941,6 +975,154 @@ int UtcDaliPhysics2DAdaptorQueue(void)
   END_TEST;
 }
 
+int UtcDaliPhysics2DAdaptorQueueBatch(void)
+{
+  tet_infoline("Test that QueueBatch executes callbacks in order, and that queue metrics are reported");
+
+  ToolkitTestApplication application;
+  Matrix                 transform(false);
+  transform.SetIdentityAndScale(Vector3(2.0f, 2.0f, 1.0f));
+  Uint16Pair     size(640, 480);
+  PhysicsAdaptor adaptor   = PhysicsAdaptor::New(transform, size);
+  Actor          rootActor = adaptor.GetRootActor();
+  auto           scene     = application.GetScene();
+  scene.Add(rootActor);
+
+  cpBody* body{nullptr};
+  {
+    auto accessor            = adaptor.GetPhysicsAccessor();
+    auto space               = accessor->GetNative().Get<cpSpace*>();
+    body                     = CreateBody(space);
+    Dali::Actor ballActor    = Toolkit::ImageView::New(BALL_IMAGE);
+    auto        physicsActor = adaptor.AddActorBody(ballActor, body);
+  }
+
+  std::vector<UniquePtr<CallbackBase>> batch;
+  batch.push_back(MakePhysicsCallback([body]() { cpBodySetPosition(body, cpv(50.0f, 10.0f)); }));
+  batch.push_back(MakePhysicsCallback([body]() { cpBodySetPosition(body, cpv(100.0f, 20.0f)); }));
+  adaptor.QueueBatch(std::move(batch));
+  adaptor.Queue(MakePhysicsCallback([body]() { cpBodySetPosition(body, cpv(cpBodyGetPosition(body).x, 30.0f)); }));
+
+  PhysicsAdaptor::QueueMetrics metrics = adaptor.GetQueueMetrics();
+  DALI_TEST_EQUALS(metrics.depth, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(metrics.peakDepth, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(metrics.executedCount, 0u, TEST_LOCATION);
+
+  adaptor.CreateSyncPoint();
+  application.SendNotification();
+  application.Render();
+
+  {
+    auto   accessor = adaptor.GetPhysicsAccessor();
+    cpVect origin   = cpBodyGetPosition(body);
+
+    DALI_TEST_EQUALS(origin.x, cpFloat(100.0f), 0.001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(origin.y, cpFloat(30.0f), 0.001f, TEST_LOCATION);
+  }
+
+  metrics = adaptor.GetQueueMetrics();
+  DALI_TEST_EQUALS(metrics.depth, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(metrics.executedCount, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(metrics.overflowCount, 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(metrics.maxLatency >= metrics.averageLatency);
+
+  adaptor.ResetQueueMetrics();
+  metrics = adaptor.GetQueueMetrics();
+  DALI_TEST_EQUALS(metrics.peakDepth, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(metrics.executedCount, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPhysics2DAdaptorQueueOverflow(void)
+{
+  tet_infoline("Test that callbacks beyond the ring capacity are still executed in order");
+
+  ToolkitTestApplication application;
+  Matrix                 transform(false);
+  transform.SetIdentityAndScale(Vector3(2.0f, 2.0f, 1.0f));
+  Uint16Pair     size(640, 480);
+  PhysicsAdaptor adaptor   = PhysicsAdaptor::New(transform, size);
+  Actor          rootActor = adaptor.GetRootActor();
+  auto           scene     = application.GetScene();
+  scene.Add(rootActor);
+
+  const uint32_t count = 5000u;
+  auto           order = std::make_shared<std::vector<uint32_t>>();
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    adaptor.Queue(MakePhysicsCallback([order, i]() { order->push_back(i); }));
+  }
+  DALI_TEST_CHECK(adaptor.GetQueueMetrics().overflowCount > 0u);
+
+  adaptor.CreateSyncPoint();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(order->size(), size_t(count), TEST_LOCATION);
+  bool inOrder = true;
+  for(uint32_t i = 0u; i < order->size(); ++i)
+  {
+    inOrder = inOrder && (*order)[i] == i;
+  }
+  DALI_TEST_CHECK(inOrder);
+  DALI_TEST_EQUALS(adaptor.GetQueueMetrics().depth, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPhysics2DAdaptorQueueOverflowWhilstExecuting(void)
+{
+  tet_infoline("Test that a callback queued in the ring whilst executing runs before a later one that overflowed");
+
+  ToolkitTestApplication application;
+  Matrix                 transform(false);
+  transform.SetIdentityAndScale(Vector3(2.0f, 2.0f, 1.0f));
+  Uint16Pair     size(640, 480);
+  PhysicsAdaptor adaptor   = PhysicsAdaptor::New(transform, size);
+  Actor          rootActor = adaptor.GetRootActor();
+  auto           scene     = application.GetScene();
+  scene.Add(rootActor);
+
+  // Fill the ring exactly. The first callback then takes the slot it frees, which fills the ring
+  // again, and the callback after that overflows.
+  const uint32_t ringCapacity = 4096u;
+  auto           order        = std::make_shared<std::vector<uint32_t>>();
+  auto           adaptorPtr   = &adaptor;
+  adaptor.Queue(MakePhysicsCallback([order, adaptorPtr, ringCapacity]() {
+    order->push_back(0u);
+    adaptorPtr->Queue(MakePhysicsCallback([order, ringCapacity]() { order->push_back(ringCapacity); }));
+    adaptorPtr->Queue(MakePhysicsCallback([order, ringCapacity]() { order->push_back(ringCapacity + 1u); }));
+  }));
+  for(uint32_t i = 1u; i < ringCapacity; ++i)
+  {
+    adaptor.Queue(MakePhysicsCallback([order, i]() { order->push_back(i); }));
+  }
+  DALI_TEST_EQUALS(adaptor.GetQueueMetrics().overflowCount, 0u, TEST_LOCATION);
+
+  adaptor.CreateSyncPoint();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(order->size(), size_t(ringCapacity), TEST_LOCATION);
+  DALI_TEST_CHECK(adaptor.GetQueueMetrics().overflowCount > 0u);
+
+  adaptor.CreateSyncPoint();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(order->size(), size_t(ringCapacity + 2u), TEST_LOCATION);
+  bool inOrder = true;
+  for(uint32_t i = 0u; i < order->size(); ++i)
+  {
+    inOrder = inOrder && (*order)[i] == i;
+  }
+  DALI_TEST_CHECK(inOrder);
+  DALI_TEST_EQUALS(adaptor.GetQueueMetrics().depth, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliPhysics2DAdaptorCreateSyncPoint(void)
 {
   tet_infoline("Test that a delayed CreateSyncPoint delays update");
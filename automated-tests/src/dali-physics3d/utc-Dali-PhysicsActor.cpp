@@ -16,6 +16,7 @@
 
 #include <bullet/btBulletDynamicsCommon.h>
 #include <stdlib.h>
+#include <cmath>
 #include <iostream>
 
 // Need to override adaptor classes for toolkit test harness, so include
@@ -24,6 +25,8 @@
 #include <toolkit-event-thread-callback.h>
 
 #include <dali-physics/dali-physics.h>
+#include <dali-physics/internal/physics-adaptor-impl.h>
+#include <dali-physics/internal/physics-world-impl.h>
 #include <dali-toolkit/dali-toolkit.h>
 
 using namespace Dali;
@@ -678,3 +681,63 @@ int UtcDaliPhysics3DActorGetPhysicsRotation(void)
 
   END_TEST;
 }
+
+int UtcDaliPhysics3DActorWorkerThreadInterpolation(void)
+{
+  tet_infoline("Test that the actors keep moving between the integration steps of the worker thread");
+
+  ToolkitTestApplication application;
+  Matrix                 transform(false);
+  transform.SetIdentityAndScale(Vector3(2.0f, 2.0f, 2.0f));
+  Uint16Pair     size(640, 480);
+  PhysicsAdaptor adaptor   = PhysicsAdaptor::New(transform, size);
+  Actor          rootActor = adaptor.GetRootActor();
+  auto           scene     = application.GetScene();
+  scene.Add(rootActor);
+
+  Dali::Actor ballActor = Toolkit::ImageView::New(BALL_IMAGE);
+
+  btRigidBody* body{nullptr};
+  PhysicsActor physicsActor;
+  {
+    auto accessor    = adaptor.GetPhysicsAccessor();
+    auto bulletWorld = accessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+    body             = CreateBody(bulletWorld);
+    physicsActor     = adaptor.AddActorBody(ballActor, body);
+    body->setLinearVelocity(btVector3(100.0f, 0.0f, 0.0f));
+  }
+
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::WORKER_THREAD);
+
+  // The first frame hands time over to the worker thread, which publishes the first snapshot.
+  application.SendNotification();
+  application.Render(16);
+
+  // Let the worker thread finish each batch before the next frame, so the test doesn't depend on timing.
+  auto& physicsWorld = GetImplementation(adaptor).GetPhysicsWorld();
+  physicsWorld->WaitForWorkerThread();
+
+  auto    actor            = rootActor.FindChildById(physicsActor.GetId());
+  Vector3 previousPosition = actor.GetCurrentProperty<Vector3>(Actor::Property::POSITION);
+  for(int frame = 0; frame < 3; ++frame)
+  {
+    application.SendNotification();
+    application.Render(16);
+
+    // Each frame bakes the transforms interpolated from the latest snapshot of the worker thread.
+    Vector3 position = actor.GetCurrentProperty<Vector3>(Actor::Property::POSITION);
+    DALI_TEST_CHECK(std::abs(position.x - previousPosition.x) > 0.001f);
+    previousPosition = position;
+
+    physicsWorld->WaitForWorkerThread();
+  }
+
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+  {
+    auto accessor    = adaptor.GetPhysicsAccessor();
+    auto bulletWorld = accessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+    DeleteBody(bulletWorld, body);
+  }
+
+  END_TEST;
+}
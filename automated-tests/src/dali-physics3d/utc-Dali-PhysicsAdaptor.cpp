@@ -598,6 +598,39 @@ int UtcDaliPhysics3DAdaptorGetIntegrationState(void)
   END_TEST;
 }
 
+int UtcDaliPhysics3DAdaptorSetThreadingMode(void)
+{
+  tet_infoline("Test that changing the threading mode is reflected, and that the worker thread can be started and stopped");
+
+  ToolkitTestApplication application;
+  Matrix                 transform(false);
+  transform.SetIdentityAndScale(Vector3(2.0f, 2.0f, 2.0f));
+  Uint16Pair     size(640, 480);
+  auto           scene     = application.GetScene();
+  PhysicsAdaptor adaptor   = PhysicsAdaptor::New(transform, size);
+  Actor          rootActor = adaptor.GetRootActor();
+  scene.Add(rootActor);
+
+  DALI_TEST_CHECK(adaptor.GetThreadingMode() == PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::WORKER_THREAD);
+  DALI_TEST_CHECK(adaptor.GetThreadingMode() == PhysicsAdaptor::ThreadingMode::WORKER_THREAD);
+
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+  application.Render(16);
+
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+  DALI_TEST_CHECK(adaptor.GetThreadingMode() == PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+
+  // Leave the worker running to check it is stopped when the adaptor is destroyed
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::WORKER_THREAD);
+  adaptor.Reset();
+
+  END_TEST;
+}
+
 int UtcDaliPhysics3DAdaptorSetDebugState(void)
 {
   tet_infoline("Test that changing the debug state is reflected");
@@ -984,6 +1017,59 @@ int UtcDaliPhysics3DAdaptorCreateSyncPoint(void)
   END_TEST;
 }
 
+int UtcDaliPhysics3DAdaptorSetThreadingModeFlushesQueue(void)
+{
+  tet_infoline("Test that switching back from the worker thread runs the commands of a sync point already seen");
+
+  ToolkitTestApplication application;
+  Matrix                 transform(false);
+  transform.SetIdentityAndScale(Vector3(2.0f, 2.0f, 2.0f));
+  Uint16Pair     size(640, 480);
+  PhysicsAdaptor adaptor   = PhysicsAdaptor::New(transform, size);
+  Actor          rootActor = adaptor.GetRootActor();
+  auto           scene     = application.GetScene();
+  scene.Add(rootActor);
+
+  btRigidBody* body{nullptr};
+  {
+    auto accessor            = adaptor.GetPhysicsAccessor();
+    auto bulletWorld         = accessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+    body                     = CreateBody(bulletWorld);
+    Dali::Actor ballActor    = Toolkit::ImageView::New(BALL_IMAGE);
+    auto        physicsActor = adaptor.AddActorBody(ballActor, body);
+  }
+
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::WORKER_THREAD);
+  adaptor.Queue(MakePhysicsCallback([body]()
+  {
+    body->getWorldTransform().setOrigin(btVector3(100.0f, 20.0f, 20.0f));
+  }));
+
+  // The update thread consumes the sync point and hands the commands over to the worker thread
+  adaptor.CreateSyncPoint();
+  application.SendNotification();
+  application.Render();
+
+  // Whether or not the worker thread has run them yet, they are not dropped
+  adaptor.SetThreadingMode(PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+  {
+    auto accessor = adaptor.GetPhysicsAccessor();
+
+    // The body may have fallen since, so only check the other axes
+    btVector3 origin = body->getWorldTransform().getOrigin();
+    DALI_TEST_EQUALS(origin.x(), 100.0f, 0.001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(origin.z(), 20.0f, 0.001f, TEST_LOCATION);
+  }
+
+  {
+    auto accessor    = adaptor.GetPhysicsAccessor();
+    auto bulletWorld = accessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+    DeleteBody(bulletWorld, body);
+  }
+
+  END_TEST;
+}
+
 int UtcDaliPhysics3DAdaptorHitTestP(void)
 {
   tet_infoline("Test that hit testing finds a body");
@@ -26,6 +26,9 @@
 #include <dali-test-suite-utils.h>
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali/integration-api/string-utils.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <string_view>
 
 using namespace Dali;
@@ -926,3 +929,111 @@ int UtcDaliGltfLoaderTextureTransform(void)
 
   END_TEST;
 }
+
+int UtcDaliGltfLoaderLoadRawResourcesInParallel(void)
+{
+  ToolkitTestApplication app;
+  Context                ctx;
+
+  auto& resources = ctx.resources;
+
+  ctx.loader.LoadModel(TEST_RESOURCE_DIR "/MRendererTest.gltf", ctx.loadResult);
+
+  auto& scene = ctx.scene;
+  auto& roots = scene.GetRoots();
+  DALI_TEST_CHECK(roots.Size() > 0u);
+
+  Customization::Choices choices;
+
+  auto resourceRefs = resources.CreateRefCounter();
+  for(auto iRoot : roots)
+  {
+    scene.CountResourceRefs(iRoot, choices, resourceRefs);
+  }
+  resources.mReferenceCounts = std::move(resourceRefs);
+  resources.CountEnvironmentReferences();
+
+  uint32_t numberOfReferencedResources = 0u;
+  for(const auto& refCounts : resources.mReferenceCounts)
+  {
+    numberOfReferencedResources += std::count_if(refCounts.Begin(), refCounts.End(), [](uint32_t refCount) { return refCount > 0u; });
+  }
+
+  ResourceBundle::RawResourceLoadStatistics statistics;
+  resources.LoadRawResources(ctx.pathProvider, ResourceBundle::Options::None, statistics);
+  DALI_TEST_CHECK(resources.mRawResourcesLoaded);
+  DALI_TEST_CHECK(!resources.mRawResourcesLoading);
+
+  // Every referenced resource has been loaded, and timed once.
+  DALI_TEST_EQUAL(statistics.mLoadTimes.Count(), numberOfReferencedResources);
+  uint32_t numberOfMeshes = 0u;
+  for(const auto& loadTime : statistics.mLoadTimes)
+  {
+    DALI_TEST_CHECK(resources.mReferenceCounts[loadTime.mType][loadTime.mIndex] > 0u);
+    if(loadTime.mType == ResourceType::Mesh)
+    {
+      DALI_TEST_CHECK(resources.mMeshes[loadTime.mIndex].first.mRawData);
+      ++numberOfMeshes;
+    }
+    else if(loadTime.mType == ResourceType::Material)
+    {
+      DALI_TEST_CHECK(resources.mMaterials[loadTime.mIndex].first.mRawData);
+    }
+  }
+  DALI_TEST_CHECK(numberOfMeshes > 0u);
+
+  resources.GenerateResources();
+  for(uint32_t i = 0u, iEnd = resources.mMeshes.Count(); i < iEnd; ++i)
+  {
+    if(resources.mReferenceCounts[ResourceType::Mesh][i] > 0u)
+    {
+      DALI_TEST_CHECK(resources.mMeshes[i].second.geometry);
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliGltfLoaderMeshAttributesFromMappedBuffer(void)
+{
+  ToolkitTestApplication app;
+  Context                ctx;
+
+  auto& resources = ctx.resources;
+
+  ctx.loader.LoadModel(TEST_RESOURCE_DIR "/AnimatedCube.gltf", ctx.loadResult);
+  DALI_TEST_CHECK(resources.mMeshes.Size() > 0u);
+  DALI_TEST_EQUAL(resources.mBuffers.Size(), 1u);
+
+  // The buffer file is in memory.
+  DALI_TEST_CHECK(resources.mBuffers[0].GetData());
+  DALI_TEST_EQUAL(resources.mBuffers[0].GetDataSize(), 1860u);
+
+  auto& mesh = resources.mMeshes[0].first;
+  auto  raw  = mesh.LoadRaw(ToDaliString(ctx.pathProvider(ResourceType::Mesh)), resources.mBuffers);
+  DALI_TEST_CHECK(!raw.mIndices.Empty());
+
+  auto iPositions = std::find_if(raw.mAttribs.Begin(), raw.mAttribs.End(), [](const MeshDefinition::RawData::Attrib& attrib) { return attrib.mName == "aPosition"; });
+  DALI_TEST_CHECK(iPositions != raw.mAttribs.End());
+  DALI_TEST_CHECK(iPositions->mMappedData);
+  DALI_TEST_CHECK(iPositions->mData.Empty());
+  DALI_TEST_EQUAL(iPositions->mNumElements, 36u);
+
+  // The positions are used from the buffer as they are in the file.
+  const uint32_t    positionsSize = iPositions->mNumElements * sizeof(Vector3);
+  std::vector<char> expected(positionsSize);
+  std::ifstream     file(TEST_RESOURCE_DIR "/AnimatedCube.bin", std::ios::binary);
+  file.seekg(mesh.mPositions.mBlob.mOffset);
+  file.read(expected.data(), positionsSize);
+  DALI_TEST_CHECK(file.good());
+  DALI_TEST_EQUAL(memcmp(iPositions->GetData(), expected.data(), positionsSize), 0);
+
+  // They outlive the buffer definitions.
+  resources.mBuffers.Clear();
+  DALI_TEST_EQUAL(memcmp(iPositions->GetData(), expected.data(), positionsSize), 0);
+
+  resources.mMeshes[0].second = mesh.Load(std::move(raw));
+  DALI_TEST_CHECK(resources.mMeshes[0].second.geometry);
+
+  END_TEST;
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Enable debug log for test coverage
+#define DEBUG_ENABLED 1
+
+#include <dali-scene3d/internal/common/parallel-job-runner.h>
+#include <dali-scene3d/internal/loader/mesh-attribute-generator.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::Scene3D::Loader;
+
+namespace
+{
+constexpr uint32_t NUMBER_OF_HELPERS = 3u;
+
+/**
+ * @brief A bumpy grid of (size + 1)^2 vertices and 2 * size^2 triangles.
+ */
+struct Grid
+{
+  Grid(uint32_t size)
+  {
+    uint32_t random = 1u;
+    for(uint32_t y = 0u; y <= size; ++y)
+    {
+      for(uint32_t x = 0u; x <= size; ++x)
+      {
+        random = random * 1664525u + 1013904223u;
+        mPositions.push_back(Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(random >> 8) / 16777216.0f));
+        mUvs.push_back(Vector2(static_cast<float>(x) / size, static_cast<float>(y) / size));
+      }
+    }
+
+    for(uint32_t y = 0u; y < size; ++y)
+    {
+      for(uint32_t x = 0u; x < size; ++x)
+      {
+        const uint32_t corner = y * (size + 1u) + x;
+        mIndices.insert(mIndices.end(), {corner, corner + 1u, corner + size + 1u, corner + 1u, corner + size + 2u, corner + size + 1u});
+      }
+    }
+  }
+
+  uint32_t GetNumberOfVertices() const
+  {
+    return static_cast<uint32_t>(mPositions.size());
+  }
+
+  uint32_t GetNumberOfIndices() const
+  {
+    return static_cast<uint32_t>(mIndices.size());
+  }
+
+  std::vector<Vector3>  mPositions;
+  std::vector<Vector2>  mUvs;
+  std::vector<uint32_t> mIndices;
+};
+
+template<typename T>
+bool IsSame(const std::vector<T>& lhs, const std::vector<T>& rhs)
+{
+  return lhs.size() == rhs.size() && memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0;
+}
+} // namespace
+
+int UtcDaliMeshAttributeGeneratorNormals(void)
+{
+  ToolkitTestApplication app;
+
+  // A quad facing +z, and a degenerate triangle.
+  const Vector3  positions[]{Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(1.0f, 1.0f, 0.0f), Vector3(5.0f, 5.0f, 5.0f)};
+  const uint16_t indices[]{0u, 1u, 2u, 1u, 3u, 2u, 4u, 4u, 4u};
+
+  Vector3 normals[5];
+  Dali::Scene3D::Loader::Internal::GenerateNormals(positions, 5u, indices, 9u, normals, NUMBER_OF_HELPERS);
+  for(uint32_t i = 0u; i < 4u; ++i)
+  {
+    DALI_TEST_EQUALS(normals[i], Vector3::ZAXIS, Math::MACHINE_EPSILON_10, TEST_LOCATION);
+  }
+  DALI_TEST_EQUALS(normals[4], Vector3::ZERO, TEST_LOCATION);
+
+  // Without indices, the vertices are the triangles in order.
+  Vector3 flatNormals[3];
+  Dali::Scene3D::Loader::Internal::GenerateNormals<uint32_t>(positions, 3u, nullptr, 3u, flatNormals, NUMBER_OF_HELPERS);
+  for(const auto& normal : flatNormals)
+  {
+    DALI_TEST_EQUALS(normal, Vector3::ZAXIS, Math::MACHINE_EPSILON_10, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliMeshAttributeGeneratorTangents(void)
+{
+  ToolkitTestApplication app;
+
+  const Vector3  positions[]{Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(1.0f, 1.0f, 0.0f)};
+  const Vector3  normals[]{Vector3::ZAXIS, Vector3::ZAXIS, Vector3::ZAXIS, Vector3::ZAXIS};
+  const Vector2  uvs[]{Vector2(0.0f, 0.0f), Vector2(1.0f, 0.0f), Vector2(0.0f, 1.0f), Vector2(1.0f, 1.0f)};
+  const uint32_t indices[]{0u, 1u, 2u, 1u, 3u, 2u};
+
+  // The tangents follow u.
+  Vector4 tangents[4];
+  Dali::Scene3D::Loader::Internal::GenerateTangents(positions, normals, uvs, 4u, indices, 6u, tangents, NUMBER_OF_HELPERS);
+  for(const auto& tangent : tangents)
+  {
+    DALI_TEST_EQUALS(tangent, Vector4(1.0f, 0.0f, 0.0f, 1.0f), Math::MACHINE_EPSILON_10, TEST_LOCATION);
+  }
+
+  // Without texture coordinates, the tangents are only orthogonal to the normals.
+  Vector3 tangentsFromNormals[4];
+  Dali::Scene3D::Loader::Internal::GenerateTangents<uint32_t, Vector3>(positions, normals, nullptr, 4u, indices, 6u, tangentsFromNormals, NUMBER_OF_HELPERS);
+  for(const auto& tangent : tangentsFromNormals)
+  {
+    DALI_TEST_EQUALS(tangent.Length(), 1.0f, Math::MACHINE_EPSILON_10, TEST_LOCATION);
+    DALI_TEST_EQUALS(tangent.Dot(Vector3::ZAXIS), 0.0f, Math::MACHINE_EPSILON_10, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliMeshAttributeGeneratorParallelSameAsSerial(void)
+{
+  ToolkitTestApplication app;
+
+  // Enough triangles for several jobs, with an invalid one.
+  Grid grid(200u);
+  grid.mIndices[7] = grid.GetNumberOfVertices();
+
+  const uint32_t numVertices = grid.GetNumberOfVertices();
+  const uint32_t numIndices  = grid.GetNumberOfIndices();
+
+  std::vector<Vector3> serialNormals(numVertices), parallelNormals(numVertices);
+  Dali::Scene3D::Loader::Internal::GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, serialNormals.data(), 0u);
+  Dali::Scene3D::Loader::Internal::GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, parallelNormals.data(), NUMBER_OF_HELPERS);
+  DALI_TEST_CHECK(IsSame(serialNormals, parallelNormals));
+
+  std::vector<Vector4> serialTangents(numVertices), parallelTangents(numVertices);
+  Dali::Scene3D::Loader::Internal::GenerateTangents(grid.mPositions.data(), serialNormals.data(), grid.mUvs.data(), numVertices, grid.mIndices.data(), numIndices, serialTangents.data(), 0u);
+  Dali::Scene3D::Loader::Internal::GenerateTangents(grid.mPositions.data(), serialNormals.data(), grid.mUvs.data(), numVertices, grid.mIndices.data(), numIndices, parallelTangents.data(), NUMBER_OF_HELPERS);
+  DALI_TEST_CHECK(IsSame(serialTangents, parallelTangents));
+
+  // Triangles in any order still add up the same.
+  uint32_t random = 7u;
+  for(uint32_t triangle = numIndices / 3u - 1u; triangle > 0u; --triangle)
+  {
+    random               = random * 1664525u + 1013904223u;
+    const uint32_t other = random % (triangle + 1u);
+    std::swap_ranges(grid.mIndices.begin() + triangle * 3u, grid.mIndices.begin() + triangle * 3u + 3u, grid.mIndices.begin() + other * 3u);
+  }
+  std::fill(serialNormals.begin(), serialNormals.end(), Vector3::ZERO);
+  std::fill(parallelNormals.begin(), parallelNormals.end(), Vector3::ZERO);
+  Dali::Scene3D::Loader::Internal::GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, serialNormals.data(), 0u);
+  Dali::Scene3D::Loader::Internal::GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, parallelNormals.data(), NUMBER_OF_HELPERS);
+  DALI_TEST_CHECK(IsSame(serialNormals, parallelNormals));
+
+  END_TEST;
+}
+
+int UtcDaliMeshAttributeGeneratorDefaultNumberOfHelpers(void)
+{
+  ToolkitTestApplication app;
+
+  // The loaders use the default number of helpers, which must give the same attributes as the serial path.
+  Grid           grid(100u);
+  const uint32_t numVertices     = grid.GetNumberOfVertices();
+  const uint32_t numIndices      = grid.GetNumberOfIndices();
+  const uint32_t numberOfHelpers = Scene3D::Internal::GetDefaultNumberOfJobHelpers();
+
+  std::vector<Vector3> serialNormals(numVertices), parallelNormals(numVertices);
+  std::vector<Vector4> serialTangents(numVertices), parallelTangents(numVertices);
+
+  Dali::Scene3D::Loader::Internal::GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, serialNormals.data(), 0u);
+  Dali::Scene3D::Loader::Internal::GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, parallelNormals.data(), numberOfHelpers);
+  Dali::Scene3D::Loader::Internal::GenerateTangents(grid.mPositions.data(), serialNormals.data(), grid.mUvs.data(), numVertices, grid.mIndices.data(), numIndices, serialTangents.data(), 0u);
+  Dali::Scene3D::Loader::Internal::GenerateTangents(grid.mPositions.data(), serialNormals.data(), grid.mUvs.data(), numVertices, grid.mIndices.data(), numIndices, parallelTangents.data(), numberOfHelpers);
+
+  DALI_TEST_CHECK(IsSame(serialNormals, parallelNormals));
+  DALI_TEST_CHECK(IsSame(serialTangents, parallelTangents));
+
+  END_TEST;
+}
+
+int UtcDaliMeshAttributeGeneratorNestedParallelJobs(void)
+{
+  ToolkitTestApplication app;
+
+  // Attributes generated from a job, as the loaders do for each mesh, must run in the job's thread.
+  DALI_TEST_CHECK(!Scene3D::Internal::IsRunningParallelJob());
+
+  constexpr uint32_t   NUMBER_OF_JOBS = 4u;
+  Grid                 grid(50u);
+  const uint32_t       numVertices = grid.GetNumberOfVertices();
+  const uint32_t       numIndices  = grid.GetNumberOfIndices();
+  std::vector<Vector3> serialNormals(numVertices);
+  Dali::Scene3D::Loader::Internal::GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, serialNormals.data(), 0u);
+
+  std::vector<std::vector<Vector3>> normals(NUMBER_OF_JOBS, std::vector<Vector3>(numVertices));
+  std::atomic<uint32_t>             numberOfJobsInside{0u};
+  Scene3D::Internal::RunParallelJobs(
+    NUMBER_OF_JOBS,
+    [&](uint32_t jobIndex)
+    {
+      if(Scene3D::Internal::IsRunningParallelJob())
+      {
+        ++numberOfJobsInside;
+      }
+      Dali::Scene3D::Loader::Internal::GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, normals[jobIndex].data(), 0u);
+    },
+    Scene3D::Internal::GetDefaultNumberOfJobHelpers());
+
+  DALI_TEST_EQUALS(numberOfJobsInside.load(), NUMBER_OF_JOBS, TEST_LOCATION);
+  DALI_TEST_CHECK(!Scene3D::Internal::IsRunningParallelJob());
+  for(const auto& jobNormals : normals)
+  {
+    DALI_TEST_CHECK(IsSame(serialNormals, jobNormals));
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Enable debug log for test coverage
+#define DEBUG_ENABLED 1
+
+#include <dali-scene3d/internal/loader/mesh-simplifier.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-environment-variable.h>
+#include <algorithm>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::Scene3D::Loader;
+
+namespace
+{
+/**
+ * @brief A gently bumpy grid of (size + 1)^2 vertices and 2 * size^2 triangles, facing +z.
+ */
+struct Grid
+{
+  Grid(uint32_t size)
+  : mSize(size)
+  {
+    uint32_t random = 1u;
+    for(uint32_t y = 0u; y <= size; ++y)
+    {
+      for(uint32_t x = 0u; x <= size; ++x)
+      {
+        random = random * 1664525u + 1013904223u;
+        mPositions.push_back(Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(random >> 8) / 167772160.0f));
+      }
+    }
+
+    for(uint32_t y = 0u; y < size; ++y)
+    {
+      for(uint32_t x = 0u; x < size; ++x)
+      {
+        const uint32_t corner = y * (size + 1u) + x;
+        mIndices.insert(mIndices.end(), {corner, corner + 1u, corner + size + 1u, corner + 1u, corner + size + 2u, corner + size + 1u});
+      }
+    }
+  }
+
+  bool IsOnBorder(uint32_t vertex) const
+  {
+    const uint32_t x = vertex % (mSize + 1u);
+    const uint32_t y = vertex / (mSize + 1u);
+    return x == 0u || y == 0u || x == mSize || y == mSize;
+  }
+
+  uint32_t GetNumberOfVertices() const
+  {
+    return static_cast<uint32_t>(mPositions.size());
+  }
+
+  uint32_t GetNumberOfIndices() const
+  {
+    return static_cast<uint32_t>(mIndices.size());
+  }
+
+  uint32_t              mSize;
+  std::vector<Vector3>  mPositions;
+  std::vector<uint32_t> mIndices;
+};
+
+bool IsUsed(const std::vector<uint32_t>& indices, uint32_t vertex)
+{
+  return std::find(indices.begin(), indices.end(), vertex) != indices.end();
+}
+
+uint32_t CountFlippedTriangles(const std::vector<Vector3>& positions, const std::vector<uint32_t>& indices)
+{
+  uint32_t count = 0u;
+  for(size_t i = 0u; i < indices.size(); i += 3u)
+  {
+    const Vector3 normal = (positions[indices[i + 1u]] - positions[indices[i]]).Cross(positions[indices[i + 2u]] - positions[indices[i]]);
+    count += normal.z <= 0.0f ? 1u : 0u;
+  }
+  return count;
+}
+} // namespace
+
+int UtcDaliMeshSimplifierGrid(void)
+{
+  ToolkitTestApplication app;
+
+  Grid           grid(32u);
+  const uint32_t targetNumIndices = grid.GetNumberOfIndices() / 2u;
+
+  auto indices = Dali::Scene3D::Loader::Internal::SimplifyMesh(grid.mPositions.data(), grid.GetNumberOfVertices(), grid.mIndices.data(), grid.GetNumberOfIndices(), targetNumIndices);
+  DALI_TEST_EQUALS(indices.size() % 3u, 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(indices.size() <= targetNumIndices);
+  DALI_TEST_CHECK(!indices.empty());
+  DALI_TEST_EQUALS(CountFlippedTriangles(grid.mPositions, indices), 0u, TEST_LOCATION);
+
+  for(const auto index : indices)
+  {
+    DALI_TEST_CHECK(index < grid.GetNumberOfVertices());
+  }
+
+  // The border keeps its shape.
+  for(uint32_t vertex = 0u; vertex < grid.GetNumberOfVertices(); ++vertex)
+  {
+    if(grid.IsOnBorder(vertex))
+    {
+      DALI_TEST_CHECK(IsUsed(indices, vertex));
+    }
+  }
+
+  // Simplifying further keeps going down.
+  auto moreIndices = Dali::Scene3D::Loader::Internal::SimplifyMesh(grid.mPositions.data(), grid.GetNumberOfVertices(), indices.data(), static_cast<uint32_t>(indices.size()), targetNumIndices / 2u);
+  DALI_TEST_CHECK(moreIndices.size() < indices.size());
+  DALI_TEST_EQUALS(CountFlippedTriangles(grid.mPositions, moreIndices), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliMeshSimplifierSeam(void)
+{
+  ToolkitTestApplication app;
+
+  // A duplicate of a vertex in the middle, e.g. for a texture seam, used by half of its triangles.
+  Grid           grid(8u);
+  const uint32_t seamVertex = 4u * 9u + 4u;
+  const uint32_t duplicate  = grid.GetNumberOfVertices();
+  grid.mPositions.push_back(grid.mPositions[seamVertex]);
+  uint32_t numReplaced = 0u;
+  for(auto& index : grid.mIndices)
+  {
+    if(index == seamVertex && (numReplaced++ % 2u) == 0u)
+    {
+      index = duplicate;
+    }
+  }
+
+  auto indices = Dali::Scene3D::Loader::Internal::SimplifyMesh(grid.mPositions.data(), grid.GetNumberOfVertices(), grid.mIndices.data(), grid.GetNumberOfIndices(), 6u);
+  DALI_TEST_CHECK(indices.size() < grid.mIndices.size());
+  DALI_TEST_CHECK(IsUsed(indices, seamVertex));
+  DALI_TEST_CHECK(IsUsed(indices, duplicate));
+
+  END_TEST;
+}
+
+int UtcDaliMeshSimplifierInvalidTriangles(void)
+{
+  ToolkitTestApplication app;
+
+  const Vector3  positions[]{Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)};
+  const uint32_t indices[]{0u, 1u, 2u, 0u, 0u, 1u, 0u, 1u, 7u, 2u};
+
+  // The degenerate triangle, the one out of range and the incomplete one are dropped.
+  auto result = Dali::Scene3D::Loader::Internal::SimplifyMesh(positions, 3u, indices, 10u, 0u);
+  DALI_TEST_EQUALS(result.size(), 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(result[0], 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(result[1], 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(result[2], 2u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliMeshSimplifierNumberOfLevels(void)
+{
+  ToolkitTestApplication app;
+
+  // Clamped to the maximum.
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_SCENE3D_MESH_LOD_LEVELS", "100");
+  DALI_TEST_EQUALS(Dali::Scene3D::Loader::Internal::GetNumberOfGeneratedLevelsOfDetail(), 8u, TEST_LOCATION);
+
+  END_TEST;
+}
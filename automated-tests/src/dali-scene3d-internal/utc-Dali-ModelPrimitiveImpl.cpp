@@ -20,8 +20,11 @@
 #include <stdlib.h>
 #include <iostream>
 
+#include <dali-scene3d/internal/model-components/model-node-impl.h>
 #include <dali-scene3d/internal/model-components/model-primitive-impl.h>
 #include <dali-scene3d/public-api/common/scene-depth-index-ranges.h>
+#include <dali-scene3d/public-api/controls/model/model.h>
+#include <dali-scene3d/public-api/model-components/model-node.h>
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -38,6 +41,25 @@ void model_components_model_primitive_impl_cleanup(void)
 
 namespace
 {
+Scene3D::ModelPrimitive CreateLevelOfDetailPrimitive(float boundingRadius)
+{
+  Scene3D::ModelPrimitive modelPrimitive = Scene3D::ModelPrimitive::New();
+  modelPrimitive.SetGeometry(Dali::Geometry::New());
+  modelPrimitive.SetMaterial(Dali::Scene3D::Material::New());
+
+  Dali::Vector<uint32_t> lodIndexCounts;
+  lodIndexCounts.PushBack(12u);
+  lodIndexCounts.PushBack(6u);
+  lodIndexCounts.PushBack(3u);
+  GetImplementation(modelPrimitive).SetLevelsOfDetail(lodIndexCounts, boundingRadius);
+  return modelPrimitive;
+}
+
+void CheckIndexRange(Dali::Renderer renderer, int32_t first, int32_t count, const char* location)
+{
+  DALI_TEST_EQUALS(renderer.GetProperty<int32_t>(Dali::Renderer::Property::INDEX_RANGE_FIRST), first, location);
+  DALI_TEST_EQUALS(renderer.GetProperty<int32_t>(Dali::Renderer::Property::INDEX_RANGE_COUNT), count, location);
+}
 } // namespace
 
 // Method test
@@ -91,4 +113,245 @@ int UtcDaliModelPrimitiveMaterialDepthIndex(void)
   DALI_TEST_CHECK(renderer.GetProperty<int32_t>(Dali::Renderer::Property::DEPTH_INDEX) == 50);
 
   END_TEST;
-}
\ No newline at end of file
+}
+
+int UtcDaliModelPrimitiveImplLevelsOfDetail(void)
+{
+  ToolkitTestApplication application;
+
+  Scene3D::ModelPrimitive modelPrimitive = CreateLevelOfDetailPrimitive(2.0f);
+  auto&                   primitiveImpl  = GetImplementation(modelPrimitive);
+  DALI_TEST_EQUALS(primitiveImpl.GetNumberOfLevelsOfDetail(), 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(primitiveImpl.GetBoundingRadius(), 2.0f, TEST_LOCATION);
+
+  // The renderer draws the indices of the selected level only.
+  Dali::Renderer renderer = primitiveImpl.GetRenderer();
+  CheckIndexRange(renderer, 0, 12, TEST_LOCATION);
+
+  primitiveImpl.SetLevelOfDetail(1u);
+  DALI_TEST_EQUALS(primitiveImpl.GetLevelOfDetail(), 1u, TEST_LOCATION);
+  CheckIndexRange(renderer, 12, 6, TEST_LOCATION);
+
+  // The level is clamped to the available ones.
+  primitiveImpl.SetLevelOfDetail(5u);
+  DALI_TEST_EQUALS(primitiveImpl.GetLevelOfDetail(), 2u, TEST_LOCATION);
+  CheckIndexRange(renderer, 18, 3, TEST_LOCATION);
+
+  // A new geometry doesn't have the levels of detail.
+  modelPrimitive.SetGeometry(Dali::Geometry::New());
+  DALI_TEST_EQUALS(primitiveImpl.GetNumberOfLevelsOfDetail(), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(primitiveImpl.GetLevelOfDetail(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliModelPrimitiveImplLevelOfDetailSelectedByModel(void)
+{
+  ToolkitTestApplication application;
+
+  Scene3D::Model model = Scene3D::Model::New();
+  application.GetScene().Add(model);
+
+  // Large enough to cover the view.
+  Scene3D::ModelPrimitive modelPrimitive = CreateLevelOfDetailPrimitive(1000.0f);
+  Scene3D::ModelNode      modelNode      = Scene3D::ModelNode::New();
+  modelNode.AddModelPrimitive(modelPrimitive);
+  model.AddModelNode(modelNode);
+
+  auto renderFrames = [&application]()
+  {
+    for(uint32_t i = 0u; i < 3u; ++i)
+    {
+      application.SendNotification();
+      application.Render();
+    }
+  };
+
+  // Without thresholds, the original mesh is used.
+  renderFrames();
+  DALI_TEST_EQUALS(GetImplementation(modelPrimitive).GetLevelOfDetail(), 0u, TEST_LOCATION);
+
+  Property::Array thresholds;
+  thresholds.PushBack(0.5f);
+  thresholds.PushBack(0.25f);
+  model.SetProperty(Scene3D::Model::Property::LOD_THRESHOLDS, thresholds);
+  renderFrames();
+  DALI_TEST_EQUALS(GetImplementation(modelPrimitive).GetLevelOfDetail(), 0u, TEST_LOCATION);
+
+  // Smaller on the screen, it switches to the last level.
+  modelNode.SetProperty(Dali::Actor::Property::SCALE, Vector3::ONE * 0.0001f);
+  renderFrames();
+  DALI_TEST_EQUALS(GetImplementation(modelPrimitive).GetLevelOfDetail(), 2u, TEST_LOCATION);
+
+  // And back to the original mesh, without thresholds.
+  model.SetProperty(Scene3D::Model::Property::LOD_THRESHOLDS, Property::Array());
+  renderFrames();
+  DALI_TEST_EQUALS(GetImplementation(modelPrimitive).GetLevelOfDetail(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliModelPrimitiveImplLevelOfDetailAddRemoveModelNode(void)
+{
+  ToolkitTestApplication application;
+
+  Scene3D::Model model = Scene3D::Model::New();
+  application.GetScene().Add(model);
+
+  Property::Array thresholds;
+  thresholds.PushBack(0.5f);
+  thresholds.PushBack(0.25f);
+  model.SetProperty(Scene3D::Model::Property::LOD_THRESHOLDS, thresholds);
+
+  auto renderFrames = [&application]()
+  {
+    for(uint32_t i = 0u; i < 3u; ++i)
+    {
+      application.SendNotification();
+      application.Render();
+    }
+  };
+
+  auto createSmallNode = [](Scene3D::ModelPrimitive modelPrimitive)
+  {
+    Scene3D::ModelNode modelNode = Scene3D::ModelNode::New();
+    modelNode.AddModelPrimitive(modelPrimitive);
+    modelNode.SetProperty(Dali::Actor::Property::SCALE, Vector3::ONE * 0.0001f);
+    return modelNode;
+  };
+
+  Scene3D::ModelPrimitive firstPrimitive = CreateLevelOfDetailPrimitive(1000.0f);
+  Scene3D::ModelNode      firstNode      = createSmallNode(firstPrimitive);
+  model.AddModelNode(firstNode);
+  renderFrames();
+  DALI_TEST_EQUALS(GetImplementation(firstPrimitive).GetLevelOfDetail(), 2u, TEST_LOCATION);
+
+  // The added node gets its level too, and the first one keeps its own.
+  Scene3D::ModelPrimitive secondPrimitive = CreateLevelOfDetailPrimitive(1000.0f);
+  Scene3D::ModelNode      secondNode      = createSmallNode(secondPrimitive);
+  model.AddModelNode(secondNode);
+  renderFrames();
+  DALI_TEST_EQUALS(GetImplementation(firstPrimitive).GetLevelOfDetail(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetImplementation(secondPrimitive).GetLevelOfDetail(), 2u, TEST_LOCATION);
+
+  // Without a bounding radius, the primitive keeps drawing the most detailed level only.
+  Scene3D::ModelPrimitive unboundedPrimitive = CreateLevelOfDetailPrimitive(0.0f);
+  model.AddModelNode(createSmallNode(unboundedPrimitive));
+  renderFrames();
+  DALI_TEST_EQUALS(GetImplementation(unboundedPrimitive).GetLevelOfDetail(), 0u, TEST_LOCATION);
+  CheckIndexRange(GetImplementation(unboundedPrimitive).GetRenderer(), 0, 12, TEST_LOCATION);
+
+  // The removed node goes back to the original mesh, and the other one keeps its level.
+  model.RemoveModelNode(firstNode);
+  renderFrames();
+  DALI_TEST_EQUALS(GetImplementation(firstPrimitive).GetLevelOfDetail(), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetImplementation(secondPrimitive).GetLevelOfDetail(), 2u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliModelPrimitiveImplFrustumCullingAddRemoveModelNode(void)
+{
+  ToolkitTestApplication application;
+
+  Scene3D::Model model = Scene3D::Model::New();
+  model.SetProperty(Scene3D::Model::Property::FRUSTUM_CULLING, true);
+  application.GetScene().Add(model);
+
+  // The visibility is computed in one frame and applied in the next one, so render a few frames.
+  auto renderFrames = [&application]()
+  {
+    for(uint32_t i = 0u; i < 3u; ++i)
+    {
+      application.SendNotification();
+      application.Render();
+    }
+  };
+
+  auto createBoundedNode = [](const Vector3& position)
+  {
+    Scene3D::ModelPrimitive modelPrimitive = Scene3D::ModelPrimitive::New();
+    modelPrimitive.SetGeometry(Dali::Geometry::New());
+    modelPrimitive.SetMaterial(Dali::Scene3D::Material::New());
+    GetImplementation(modelPrimitive).SetBoundingBox(-Vector3::ONE, Vector3::ONE);
+
+    Scene3D::ModelNode modelNode = Scene3D::ModelNode::New();
+    modelNode.AddModelPrimitive(modelPrimitive);
+    modelNode.SetProperty(Dali::Actor::Property::POSITION, position);
+    return modelNode;
+  };
+
+  Scene3D::ModelNode farNode = createBoundedNode(Vector3(100000.0f, 0.0f, 0.0f));
+  model.AddModelNode(farNode);
+  renderFrames();
+  DALI_TEST_CHECK(GetImplementation(farNode).IsCulled());
+
+  // The added node is culled on its own, and the first one stays culled.
+  Scene3D::ModelNode nearNode = createBoundedNode(Vector3::ZERO);
+  model.AddModelNode(nearNode);
+  renderFrames();
+  DALI_TEST_CHECK(GetImplementation(farNode).IsCulled());
+  DALI_TEST_CHECK(!GetImplementation(nearNode).IsCulled());
+
+  // The removed node is rendered again, and the other one is still culled by the model.
+  model.RemoveModelNode(farNode);
+  renderFrames();
+  DALI_TEST_CHECK(!GetImplementation(farNode).IsCulled());
+  DALI_TEST_CHECK(!GetImplementation(nearNode).IsCulled());
+
+  nearNode.SetProperty(Dali::Actor::Property::POSITION, Vector3(100000.0f, 0.0f, 0.0f));
+  renderFrames();
+  DALI_TEST_CHECK(GetImplementation(nearNode).IsCulled());
+
+  END_TEST;
+}
+
+int UtcDaliModelPrimitiveImplInstanceCount(void)
+{
+  ToolkitTestApplication application;
+
+  Scene3D::ModelPrimitive modelPrimitive = Scene3D::ModelPrimitive::New();
+  modelPrimitive.SetGeometry(Dali::Geometry::New());
+  modelPrimitive.SetMaterial(Dali::Scene3D::Material::New());
+
+  auto& primitiveImpl = GetImplementation(modelPrimitive);
+  DALI_TEST_EQUALS(primitiveImpl.GetInstanceCount(), 0u, TEST_LOCATION);
+
+  Dali::Renderer renderer = primitiveImpl.GetRenderer();
+  DALI_TEST_CHECK(renderer);
+  Dali::Shader shader = renderer.GetShader();
+
+  // The renderer draws the geometry once per instance, with the instancing shader.
+  primitiveImpl.SetInstanceCount(5u);
+  DALI_TEST_EQUALS(primitiveImpl.GetInstanceCount(), 5u, TEST_LOCATION);
+  DALI_TEST_EQUALS(renderer.GetProperty<int32_t>(Dali::Renderer::Property::INSTANCE_COUNT), 5, TEST_LOCATION);
+  DALI_TEST_CHECK(renderer.GetShader() != shader);
+
+  // A new geometry isn't instanced.
+  modelPrimitive.SetGeometry(Dali::Geometry::New());
+  DALI_TEST_EQUALS(primitiveImpl.GetInstanceCount(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliModelPrimitiveImplBoundingBox(void)
+{
+  ToolkitTestApplication application;
+
+  Scene3D::ModelPrimitive modelPrimitive = Scene3D::ModelPrimitive::New();
+  auto&                   primitiveImpl  = GetImplementation(modelPrimitive);
+
+  Vector3 min, max;
+  DALI_TEST_CHECK(!primitiveImpl.GetBoundingBox(min, max));
+
+  primitiveImpl.SetBoundingBox(-Vector3::ONE, Vector3(1.0f, 2.0f, 3.0f));
+  DALI_TEST_CHECK(primitiveImpl.GetBoundingBox(min, max));
+  DALI_TEST_EQUALS(min, -Vector3::ONE, TEST_LOCATION);
+  DALI_TEST_EQUALS(max, Vector3(1.0f, 2.0f, 3.0f), TEST_LOCATION);
+
+  // A new geometry doesn't have the box.
+  modelPrimitive.SetGeometry(Dali::Geometry::New());
+  DALI_TEST_CHECK(!primitiveImpl.GetBoundingBox(min, max));
+
+  END_TEST;
+}
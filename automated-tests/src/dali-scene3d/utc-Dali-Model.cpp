@@ -1377,6 +1377,61 @@ int UtcDaliModelMultiplePrimitives(void)
   END_TEST;
 }
 
+int UtcDaliModelFrustumCulling(void)
+{
+  ToolkitTestApplication application;
+
+  Scene3D::Model model = Scene3D::Model::New(TEST_GLTF_MULTIPLE_PRIMITIVE_FILE_NAME);
+  model.SetProperty(Dali::Actor::Property::SIZE, Vector2(50, 50));
+  application.GetScene().Add(model);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+  application.SendNotification();
+  application.Render();
+
+  Actor actor = model.FindChildByName("rootNode");
+  DALI_TEST_EQUALS(2, actor.GetRendererCount(), TEST_LOCATION);
+
+  // The visibility is computed in one frame and applied in the next one, so render a few frames.
+  auto renderFrames = [&application]()
+  {
+    for(uint32_t i = 0u; i < 3u; ++i)
+    {
+      application.SendNotification();
+      application.Render();
+    }
+  };
+
+  // Without frustum culling, the node is rendered wherever it is.
+  DALI_TEST_EQUALS(model.GetProperty<bool>(Scene3D::Model::Property::FRUSTUM_CULLING), false, TEST_LOCATION);
+  model.SetProperty(Dali::Actor::Property::POSITION, Vector3(100000.0f, 0.0f, 0.0f));
+  renderFrames();
+  DALI_TEST_EQUALS(2, actor.GetRendererCount(), TEST_LOCATION);
+
+  // Out of view, its renderers are removed.
+  model.SetProperty(Scene3D::Model::Property::FRUSTUM_CULLING, true);
+  DALI_TEST_EQUALS(model.GetProperty<bool>(Scene3D::Model::Property::FRUSTUM_CULLING), true, TEST_LOCATION);
+  renderFrames();
+  DALI_TEST_EQUALS(0, actor.GetRendererCount(), TEST_LOCATION);
+
+  // And added again back in view.
+  model.SetProperty(Dali::Actor::Property::POSITION, Vector3::ZERO);
+  renderFrames();
+  DALI_TEST_EQUALS(2, actor.GetRendererCount(), TEST_LOCATION);
+
+  // Disabling the culling renders every node at once.
+  model.SetProperty(Dali::Actor::Property::POSITION, Vector3(100000.0f, 0.0f, 0.0f));
+  renderFrames();
+  DALI_TEST_EQUALS(0, actor.GetRendererCount(), TEST_LOCATION);
+  model.SetProperty(Scene3D::Model::Property::FRUSTUM_CULLING, false);
+  DALI_TEST_EQUALS(2, actor.GetRendererCount(), TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliModelColorMode(void)
 {
   ToolkitTestApplication application;
@@ -554,6 +554,53 @@ int UtcDaliNavigationFindFloor0P(void)
   END_TEST;
 }
 
+int UtcDaliNavigationFindFloorsP(void)
+{
+  tet_infoline("UtcDaliNavigationFindFloorsP: Finds floor for many positions in one call");
+
+  auto navmesh = NavigationMeshFactory::CreateFromFile("resources/navmesh-test.bin");
+
+  // All calculations in the navmesh local space
+  navmesh->SetSceneTransform(Matrix(Matrix::IDENTITY));
+
+  // Lift slightly over the floor level
+  auto upFromGravity = navmesh->GetGravityVector() * (0.05f);
+
+  Dali::Vector<Vector3> inPositions;
+  auto                  size = navmesh->GetFaceCount();
+  for(auto i = 0u; i < size; ++i)
+  {
+    const auto* face = navmesh->GetFace(i);
+    inPositions.PushBack(Vector3(face->center) - Vector3(upFromGravity));
+  }
+
+  // Outside area
+  inPositions.PushBack(Vector3(0.77197f, -3.8596f, 0.13085f));
+
+  Dali::Vector<Vector3>   outPositions;
+  Dali::Vector<FaceIndex> outFaceIndices;
+  auto                    foundCount = navmesh->FindFloors(inPositions, outPositions, outFaceIndices);
+
+  DALI_TEST_EQUALS(foundCount, size, TEST_LOCATION);
+  DALI_TEST_EQUALS(outPositions.Count(), inPositions.Count(), TEST_LOCATION);
+  DALI_TEST_EQUALS(outFaceIndices.Count(), inPositions.Count(), TEST_LOCATION);
+
+  // Results must match single FindFloor() queries
+  for(auto i = 0u; i < size; ++i)
+  {
+    Vector3   outPosition;
+    FaceIndex faceIndex{NavigationMesh::NULL_FACE};
+    DALI_TEST_EQUALS(navmesh->FindFloor(inPositions[i], outPosition, faceIndex), true, TEST_LOCATION);
+    DALI_TEST_EQUALS(outFaceIndices[i], faceIndex, TEST_LOCATION);
+    DALI_TEST_EQUALS(outPositions[i], outPosition, TEST_LOCATION);
+  }
+
+  DALI_TEST_EQUALS(outFaceIndices[size], NavigationMesh::NULL_FACE, TEST_LOCATION);
+  DALI_TEST_EQUALS(outPositions[size], inPositions[size], TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliNavigationFindFloorForFace1P(void)
 {
   tet_infoline("UtcDaliNavigationFindFloorForFace1P: Finds floor for selected face");
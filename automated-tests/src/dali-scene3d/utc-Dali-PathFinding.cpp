@@ -24,6 +24,21 @@ using namespace Dali;
 using namespace Dali::Scene3D::Algorithm;
 using namespace Dali::Scene3D::Loader;
 
+/**
+ * Sum of the distances between the centers of consecutive faces, the cost the path finders minimise
+ */
+float GetPathCost(const NavigationMesh& navmesh, const WayPointList& waypoints)
+{
+  float cost = 0.0f;
+  for(auto i = 1u; i < waypoints.Count(); ++i)
+  {
+    const Vector3 c0(navmesh.GetFace(waypoints[i - 1].GetNavigationMeshFaceIndex())->center);
+    const Vector3 c1(navmesh.GetFace(waypoints[i].GetNavigationMeshFaceIndex())->center);
+    cost += (c1 - c0).Length();
+  }
+  return cost;
+}
+
 bool CompareResults(const std::vector<FaceIndex>& nodes, const WayPointList& waypoints)
 {
   if(nodes.size() != waypoints.Count())
@@ -217,4 +232,96 @@ int UtcDaliPathFinderFindShortestPath1(void)
   }
 
   END_TEST;
-}
\ No newline at end of file
+}
+
+int UtcDaliPathFinderAStarP(void)
+{
+  auto navmesh = NavigationMeshFactory::CreateFromFile("resources/navmesh-test.bin");
+  // All coordinates in navmesh local space
+  navmesh->SetSceneTransform(Matrix(Matrix::IDENTITY));
+
+  auto pathfinder = PathFinder::New(*navmesh, PathFinderAlgorithm::A_STAR);
+
+  DALI_TEST_CHECK(navmesh);
+  DALI_TEST_CHECK(pathfinder);
+
+  // Repeated queries reuse the search state, results must not depend on previous queries
+  for(auto repeat = 0u; repeat < 3u; ++repeat)
+  {
+    auto waypoints = pathfinder->FindPath(18, 157);
+    DALI_TEST_NOT_EQUALS(int(waypoints.Count()), 0, 0, TEST_LOCATION);
+    DALI_TEST_EQUALS(waypoints[0].GetNavigationMeshFaceIndex(), FaceIndex(18), TEST_LOCATION);
+    DALI_TEST_EQUALS(waypoints[waypoints.Count() - 1].GetNavigationMeshFaceIndex(), FaceIndex(157), TEST_LOCATION);
+
+    waypoints = pathfinder->FindPath(18, 139);
+    DALI_TEST_NOT_EQUALS(int(waypoints.Count()), 0, 0, TEST_LOCATION);
+    DALI_TEST_EQUALS(waypoints[0].GetNavigationMeshFaceIndex(), FaceIndex(18), TEST_LOCATION);
+    DALI_TEST_EQUALS(waypoints[waypoints.Count() - 1].GetNavigationMeshFaceIndex(), FaceIndex(139), TEST_LOCATION);
+  }
+
+  // The path must be as short as the one found by Dijkstra, so a wrong heuristic fails here
+  auto dijkstra = PathFinder::New(*navmesh, PathFinderAlgorithm::DIJKSTRA_SHORTEST_PATH);
+  DALI_TEST_CHECK(dijkstra);
+
+  const auto faceCount = navmesh->GetFaceCount();
+  for(FaceIndex source = 0u; source < faceCount; source += 17u)
+  {
+    for(FaceIndex target = 3u; target < faceCount; target += 23u)
+    {
+      auto expected = dijkstra->FindPath(source, target);
+      auto result   = pathfinder->FindPath(source, target);
+      DALI_TEST_EQUALS(result.Count() == 0u, expected.Count() == 0u, TEST_LOCATION);
+      DALI_TEST_EQUALS(GetPathCost(*navmesh, result), GetPathCost(*navmesh, expected), 0.0001f, TEST_LOCATION);
+    }
+  }
+
+  // Invalid face index
+  auto waypoints = pathfinder->FindPath(18, FaceIndex(navmesh->GetFaceCount()));
+  DALI_TEST_EQUALS(int(waypoints.Count()), 0, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPathFinderFindPathsP(void)
+{
+  auto navmesh = NavigationMeshFactory::CreateFromFile("resources/navmesh-test.bin");
+  // All coordinates in navmesh local space
+  navmesh->SetSceneTransform(Matrix(Matrix::IDENTITY));
+
+  std::vector<PathFinderAlgorithm> testAlgorithms = {
+    PathFinderAlgorithm::DIJKSTRA_SHORTEST_PATH,
+    PathFinderAlgorithm::A_STAR,
+  };
+
+  Dali::Vector<Vector3> from;
+  Dali::Vector<Vector3> to;
+  from.PushBack(Vector3(-6.0767, -1.7268, 0.1438)); // ground floor
+  to.PushBack(Vector3(-6.0767, -1.7268, 4.287));    // first floor
+  from.PushBack(Vector3(-6.0767, -1.7268, 4.287));
+  to.PushBack(Vector3(-6.0767, -1.7268, 0.1438));
+  from.PushBack(Vector3(0.77197f, -3.8596f, 0.13085f)); // Outside area
+  to.PushBack(Vector3(-6.0767, -1.7268, 0.1438));
+
+  for(const auto& algorithm : testAlgorithms)
+  {
+    tet_printf("Test algorithm type : %d\n", static_cast<int>(algorithm));
+    auto pathfinder = PathFinder::New(*navmesh, algorithm);
+    DALI_TEST_CHECK(pathfinder);
+
+    auto paths = pathfinder->FindPaths(from, to);
+    DALI_TEST_EQUALS(paths.size(), static_cast<size_t>(from.Count()), TEST_LOCATION);
+
+    for(auto i = 0u; i < paths.size(); ++i)
+    {
+      auto waypoints = pathfinder->FindPath(from[i], to[i]);
+      DALI_TEST_EQUALS(paths[i].Count(), waypoints.Count(), TEST_LOCATION);
+      for(auto j = 0u; j < waypoints.Count(); ++j)
+      {
+        DALI_TEST_EQUALS(paths[i][j].GetNavigationMeshFaceIndex(), waypoints[j].GetNavigationMeshFaceIndex(), TEST_LOCATION);
+      }
+    }
+    DALI_TEST_EQUALS(int(paths[2].Count()), 0, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
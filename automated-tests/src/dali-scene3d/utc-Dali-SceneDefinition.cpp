@@ -475,3 +475,104 @@ int UtcDaliSceneDefinitionReparentNode(void)
 
   END_TEST;
 }
+
+namespace
+{
+struct InstancingContext
+{
+  SceneDefinition sceneDef;
+  ResourceBundle  resources;
+
+  InstancingContext()
+  {
+    resources.mMeshes.PushBack({MeshDefinition{}, MeshGeometry{}});
+    resources.mMeshes.PushBack({MeshDefinition{}, MeshGeometry{}});
+    resources.mMaterials.PushBack({MaterialDefinition{}, TextureSet()});
+
+    sceneDef.AddNode(UniquePtr<NodeDefinition>{new NodeDefinition{"Root"}});
+    sceneDef.AddRootNode(0);
+  }
+
+  Index AddLeaf(Index meshIdx, const Vector3& position)
+  {
+    auto modelRenderable          = new ModelRenderable();
+    modelRenderable->mMeshIdx     = meshIdx;
+    modelRenderable->mMaterialIdx = 0;
+
+    auto node        = new NodeDefinition{"Leaf"};
+    node->mParentIdx = 0;
+    node->mPosition  = position;
+    node->mRenderables.PushBack(UniquePtr<NodeDefinition::Renderable>{modelRenderable});
+    sceneDef.AddNode(UniquePtr<NodeDefinition>{node});
+    return sceneDef.GetNodeCount() - 1u;
+  }
+};
+} // namespace
+
+int UtcDaliSceneDefinitionInstanceRepeatedNodes(void)
+{
+  InstancingContext ctx;
+  for(uint32_t i = 0u; i < 4u; ++i)
+  {
+    ctx.AddLeaf(0u, Vector3::XAXIS * static_cast<float>(i));
+  }
+  const Index other = ctx.AddLeaf(1u, Vector3::ZERO);
+
+  // Not enough of them.
+  Dali::Vector<AnimationDefinition> animations;
+  DALI_TEST_EQUAL(ctx.sceneDef.InstanceRepeatedNodes(ctx.resources, animations, 5u), 0u);
+  DALI_TEST_EQUAL(ctx.sceneDef.GetNode(0)->mChildren.Size(), 5u);
+
+  DALI_TEST_EQUAL(ctx.sceneDef.InstanceRepeatedNodes(ctx.resources, animations, 3u), 3u);
+
+  // The first one draws all of them, in the space of the parent.
+  auto instanced = ctx.sceneDef.GetNode(1);
+  DALI_TEST_EQUAL(instanced->mInstanceTransforms.Count(), 4u);
+  for(uint32_t i = 0u; i < 4u; ++i)
+  {
+    DALI_TEST_EQUAL(instanced->mInstanceTransforms[i].GetTranslation3(), Vector3::XAXIS * static_cast<float>(i));
+  }
+  DALI_TEST_EQUAL(instanced->mPosition, Vector3::ZERO);
+
+  // The others are detached.
+  auto& children = ctx.sceneDef.GetNode(0)->mChildren;
+  DALI_TEST_EQUAL(children.Size(), 2u);
+  DALI_TEST_EQUAL(children[0], 1u);
+  DALI_TEST_EQUAL(children[1], other);
+  for(Index i = 2u; i < 5u; ++i)
+  {
+    DALI_TEST_EQUAL(ctx.sceneDef.GetNode(i)->mParentIdx, INVALID_INDEX);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliSceneDefinitionInstanceRepeatedNodesReferenced(void)
+{
+  InstancingContext ctx;
+  for(uint32_t i = 0u; i < 4u; ++i)
+  {
+    ctx.AddLeaf(0u, Vector3::XAXIS * static_cast<float>(i));
+  }
+
+  // An animated node keeps its actor, and so does its mesh, which the instances can't share then.
+  AnimatedProperty property;
+  property.mNodeIndex = 2u;
+
+  Dali::Vector<AnimationDefinition> animations;
+  animations.PushBack(AnimationDefinition{});
+  animations[0].SetProperty(0u, std::move(property));
+
+  DALI_TEST_EQUAL(ctx.sceneDef.InstanceRepeatedNodes(ctx.resources, animations, 2u), 0u);
+  DALI_TEST_EQUAL(ctx.sceneDef.GetNode(0)->mChildren.Size(), 4u);
+  DALI_TEST_CHECK(ctx.sceneDef.GetNode(1)->mInstanceTransforms.Empty());
+
+  // Nor can a node that draws something else than the default shader.
+  InstancingContext ctx2;
+  ctx2.AddLeaf(0u, Vector3::ZERO);
+  ctx2.AddLeaf(0u, Vector3::XAXIS);
+  static_cast<ModelRenderable*>(ctx2.sceneDef.GetNode(2)->mRenderables[0].Get())->mShaderIdx = 0u;
+  DALI_TEST_EQUAL(ctx2.sceneDef.InstanceRepeatedNodes(ctx2.resources, Dali::Vector<AnimationDefinition>{}, 2u), 0u);
+
+  END_TEST;
+}
@@ -56,7 +56,7 @@ int UtcDaliShaderOptionAddOption(void)
   Scene3D::Loader::ShaderOption option;
   DALI_TEST_EQUALS(option.GetOptionHash(), 0u, TEST_LOCATION);
 
-  Scene3D::Loader::ShaderOption::Type types[19] = {
+  Scene3D::Loader::ShaderOption::Type types[20] = {
     Scene3D::Loader::ShaderOption::Type::GLTF_CHANNELS,
     Scene3D::Loader::ShaderOption::Type::THREE_TEXTURE,
     Scene3D::Loader::ShaderOption::Type::BASE_COLOR_TEXTURE,
@@ -75,10 +75,11 @@ int UtcDaliShaderOptionAddOption(void)
     Scene3D::Loader::ShaderOption::Type::MORPH_POSITION,
     Scene3D::Loader::ShaderOption::Type::MORPH_NORMAL,
     Scene3D::Loader::ShaderOption::Type::MORPH_TANGENT,
-    Scene3D::Loader::ShaderOption::Type::MORPH_VERSION_2_0};
+    Scene3D::Loader::ShaderOption::Type::MORPH_VERSION_2_0,
+    Scene3D::Loader::ShaderOption::Type::INSTANCING};
 
   uint64_t hash = 0u;
-  for(uint32_t i = 0; i < 19; ++i)
+  for(uint32_t i = 0; i < 20; ++i)
   {
     hash |= (1 << static_cast<uint32_t>(types[i]));
     option.AddOption(types[i]);
@@ -93,7 +94,7 @@ int UtcDaliShaderOptionGetDefines(void)
   Scene3D::Loader::ShaderOption option;
   DALI_TEST_EQUALS(option.GetOptionHash(), 0u, TEST_LOCATION);
 
-  Scene3D::Loader::ShaderOption::Type types[19] = {
+  Scene3D::Loader::ShaderOption::Type types[20] = {
     Scene3D::Loader::ShaderOption::Type::GLTF_CHANNELS,
     Scene3D::Loader::ShaderOption::Type::THREE_TEXTURE,
     Scene3D::Loader::ShaderOption::Type::BASE_COLOR_TEXTURE,
@@ -112,10 +113,11 @@ int UtcDaliShaderOptionGetDefines(void)
     Scene3D::Loader::ShaderOption::Type::MORPH_POSITION,
     Scene3D::Loader::ShaderOption::Type::MORPH_NORMAL,
     Scene3D::Loader::ShaderOption::Type::MORPH_TANGENT,
-    Scene3D::Loader::ShaderOption::Type::MORPH_VERSION_2_0};
+    Scene3D::Loader::ShaderOption::Type::MORPH_VERSION_2_0,
+    Scene3D::Loader::ShaderOption::Type::INSTANCING};
 
   uint64_t hash = 0u;
-  for(uint32_t i = 0; i < 19; ++i)
+  for(uint32_t i = 0; i < 20; ++i)
   {
     hash |= (1 << static_cast<uint32_t>(types[i]));
     option.AddOption(types[i]);
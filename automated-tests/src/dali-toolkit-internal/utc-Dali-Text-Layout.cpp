@@ -22,6 +22,7 @@
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/internal/text/layouts/layout-engine.h>
+#include <dali-toolkit/internal/text/layouts/layout-paragraph-cache.h>
 #include <dali-toolkit/internal/text/layouts/layout-parameters.h>
 #include <dali-toolkit/internal/text/text-run-container.h>
 #include <toolkit-text-utils.h>
@@ -461,6 +462,7 @@ bool AlignTest(const AlignData& data)
 // UtcDaliTextAlign07
 // UtcDaliTextAlign08
 // UtcDaliTextAlign09
+// UtcDaliTextLayoutParagraphCache
 //
 //////////////////////////////////////////////////////////
 
@@ -5320,3 +5322,133 @@ int UtcDaliTextLayoutGetGlyphMetrics(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextLayoutParagraphCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextLayoutParagraphCache");
+
+  // Lays out a text with several paragraphs twice. The second time, all the paragraphs but the last one are copied from the cache.
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi(96u, 96u);
+  TextAbstraction::BidirectionalSupport bidirectionalSupport = TextAbstraction::BidirectionalSupport::Get();
+
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  fontClient.GetFontId(pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf");
+
+  const std::string text("Hello world demo\nThe quick brown fox jumps\nover the lazy dog\nlast paragraph");
+  const std::string fontFamily("TizenSans");
+
+  // Set a known font description
+  FontDescriptionRun fontDescriptionRun;
+  fontDescriptionRun.characterRun.characterIndex     = 0u;
+  fontDescriptionRun.characterRun.numberOfCharacters = text.size();
+  fontDescriptionRun.familyLength                    = fontFamily.size();
+  fontDescriptionRun.familyName                      = new char[fontDescriptionRun.familyLength];
+  memcpy(fontDescriptionRun.familyName, fontFamily.c_str(), fontDescriptionRun.familyLength);
+  fontDescriptionRun.familyDefined = true;
+  fontDescriptionRun.weightDefined = false;
+  fontDescriptionRun.widthDefined  = false;
+  fontDescriptionRun.slantDefined  = false;
+  fontDescriptionRun.sizeDefined   = false;
+
+  Vector<FontDescriptionRun> fontDescriptionRuns;
+  fontDescriptionRuns.PushBack(fontDescriptionRun);
+
+  Size       textArea(100.f, 300.f);
+  Size       layoutSize;
+  ModelPtr   textModel;
+  MetricsPtr metrics;
+
+  LayoutOptions options;
+  options.align = false;
+  CreateTextModel(text,
+                  textArea,
+                  fontDescriptionRuns,
+                  options,
+                  layoutSize,
+                  textModel,
+                  metrics,
+                  false,
+                  LineWrap::WORD,
+                  false,
+                  Toolkit::DevelText::EllipsisPosition::END,
+                  0.0f, // lineSpacing
+                  0.0f  // characterSpacing
+  );
+
+  Layout::Engine engine;
+  engine.SetMetrics(metrics);
+  engine.SetLayout(Layout::Engine::MULTI_LINE_BOX);
+  DALI_TEST_CHECK(engine.IsParagraphCacheEnabled());
+
+  Layout::Parameters layoutParameters(textArea,
+                                      textModel,
+                                      fontClient,
+                                      bidirectionalSupport);
+
+  layoutParameters.startGlyphIndex        = 0u;
+  layoutParameters.numberOfGlyphs         = textModel->mVisualModel->mGlyphs.Count();
+  layoutParameters.startLineIndex         = 0u;
+  layoutParameters.estimatedNumberOfLines = textModel->mLogicalModel->mParagraphInfo.Count();
+
+  bool isAutoScroll = false;
+
+  Size firstLayoutSize;
+  DALI_TEST_CHECK(engine.LayoutText(layoutParameters, firstLayoutSize, false, isAutoScroll, false, false, DevelText::EllipsisPosition::END));
+  DALI_TEST_EQUALS(engine.GetParagraphCacheHitCount(), 0u, TEST_LOCATION);
+
+  const Vector<LineRun> firstLines(textModel->mVisualModel->mLines);
+  const Vector<Vector2> firstPositions(textModel->mVisualModel->mGlyphPositions);
+
+  Size secondLayoutSize;
+  DALI_TEST_CHECK(engine.LayoutText(layoutParameters, secondLayoutSize, false, isAutoScroll, false, false, DevelText::EllipsisPosition::END));
+  DALI_TEST_EQUALS(engine.GetParagraphCacheHitCount(), 3u, TEST_LOCATION);
+
+  // The cached paragraphs are laid-out as before.
+  DALI_TEST_EQUALS(secondLayoutSize, firstLayoutSize, TEST_LOCATION);
+
+  const Vector<LineRun>& lines = textModel->mVisualModel->mLines;
+  DALI_TEST_EQUALS(lines.Count(), firstLines.Count(), TEST_LOCATION);
+  for(unsigned int index = 0u; index < lines.Count(); ++index)
+  {
+    DALI_TEST_EQUALS(lines[index].glyphRun.glyphIndex, firstLines[index].glyphRun.glyphIndex, TEST_LOCATION);
+    DALI_TEST_EQUALS(lines[index].glyphRun.numberOfGlyphs, firstLines[index].glyphRun.numberOfGlyphs, TEST_LOCATION);
+    DALI_TEST_EQUALS(lines[index].characterRun.characterIndex, firstLines[index].characterRun.characterIndex, TEST_LOCATION);
+    DALI_TEST_EQUALS(lines[index].characterRun.numberOfCharacters, firstLines[index].characterRun.numberOfCharacters, TEST_LOCATION);
+    DALI_TEST_EQUALS(lines[index].width, firstLines[index].width, TEST_LOCATION);
+    DALI_TEST_EQUALS(lines[index].ascender, firstLines[index].ascender, TEST_LOCATION);
+    DALI_TEST_EQUALS(lines[index].descender, firstLines[index].descender, TEST_LOCATION);
+  }
+
+  const Vector<Vector2>& positions = textModel->mVisualModel->mGlyphPositions;
+  DALI_TEST_EQUALS(positions.Count(), firstPositions.Count(), TEST_LOCATION);
+  for(unsigned int index = 0u; index < positions.Count(); ++index)
+  {
+    DALI_TEST_EQUALS(positions[index], firstPositions[index], TEST_LOCATION);
+  }
+
+  // Disabling the cache discards it.
+  engine.SetParagraphCacheEnabled(false);
+  DALI_TEST_CHECK(!engine.IsParagraphCacheEnabled());
+
+  Size thirdLayoutSize;
+  DALI_TEST_CHECK(engine.LayoutText(layoutParameters, thirdLayoutSize, false, isAutoScroll, false, false, DevelText::EllipsisPosition::END));
+  DALI_TEST_EQUALS(engine.GetParagraphCacheHitCount(), 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(thirdLayoutSize, firstLayoutSize, TEST_LOCATION);
+
+  // An entry is only found for the characters and glyphs it was laid-out from, even if the keys collide.
+  // "Hello" and "world" have the same number of characters and glyphs.
+  Layout::ParagraphLayoutCache cache;
+  cache.Begin(0u);
+  cache.Add(1u, textModel, 0u, 5u, 0u, 5u, Layout::ParagraphLayoutCache::Entry());
+  DALI_TEST_CHECK(nullptr == cache.Find(1u, textModel, 6u, 5u, 6u, 5u));
+  DALI_TEST_CHECK(nullptr != cache.Find(1u, textModel, 0u, 5u, 0u, 5u));
+  DALI_TEST_EQUALS(cache.GetHitCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -22,6 +22,7 @@
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/internal/text/shaper.h>
+#include <dali-toolkit/internal/text/shaping-cache.h>
 #include <toolkit-text-utils.h>
 
 using namespace Dali;
@@ -1061,3 +1062,167 @@ int UtcDaliTextShapeEmojiSequences(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextShapingCache(void)
+{
+  tet_infoline(" UtcDaliTextShapingCache");
+
+  // Shapes the same text twice. The second time the glyphs are retrieved from the shaping cache.
+  ToolkitTestApplication application;
+
+  ShapingCache& shapingCache = ShapingCache::Get();
+  shapingCache.Clear();
+  shapingCache.ResetCounters();
+
+  ModelPtr   textModel;
+  MetricsPtr metrics;
+  Size       textArea(100.f, 60.f);
+  Size       layoutSize;
+
+  const Vector<FontDescriptionRun> fontDescriptions;
+  const LayoutOptions              options;
+
+  CreateTextModel("Hello world",
+                  textArea,
+                  fontDescriptions,
+                  options,
+                  layoutSize,
+                  textModel,
+                  metrics,
+                  false,
+                  LineWrap::WORD,
+                  false,
+                  Toolkit::DevelText::EllipsisPosition::END,
+                  0.0f, // lineSpacing
+                  0.0f  // characterSpacing
+  );
+
+  const uint32_t numberOfRuns = shapingCache.GetNumberOfRuns();
+  const uint32_t hitCount     = shapingCache.GetHitCount();
+  const uint32_t missCount    = shapingCache.GetMissCount();
+  DALI_TEST_CHECK(numberOfRuns > 0u);
+  DALI_TEST_CHECK(missCount > 0u);
+
+  LogicalModelPtr logicalModel = textModel->mLogicalModel;
+  VisualModelPtr  visualModel  = textModel->mVisualModel;
+
+  TextAbstraction::Shaping    shaping    = TextAbstraction::Shaping::Get();
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  Vector<GlyphInfo>      glyphs;
+  Vector<CharacterIndex> glyphToCharacter;
+  Vector<Length>         charactersPerGlyph;
+  Vector<GlyphIndex>     newParagraphGlyphs;
+
+  ShapeText(shaping,
+            fontClient,
+            logicalModel->mText,
+            logicalModel->mLineBreakInfo,
+            logicalModel->mScriptRuns,
+            logicalModel->mFontRuns,
+            0u,
+            0u,
+            logicalModel->mText.Count(),
+            glyphs,
+            glyphToCharacter,
+            charactersPerGlyph,
+            newParagraphGlyphs);
+
+  DALI_TEST_EQUALS(shapingCache.GetHitCount(), hitCount + numberOfRuns, TEST_LOCATION);
+  DALI_TEST_EQUALS(shapingCache.GetMissCount(), missCount, TEST_LOCATION);
+  DALI_TEST_EQUALS(shapingCache.GetNumberOfRuns(), numberOfRuns, TEST_LOCATION);
+
+  // The cached glyphs are the ones of the model.
+  DALI_TEST_EQUALS(glyphs.Count(), visualModel->mGlyphs.Count(), TEST_LOCATION);
+  for(unsigned int index = 0u; index < glyphs.Count(); ++index)
+  {
+    DALI_TEST_EQUALS(glyphs[index].fontId, visualModel->mGlyphs[index].fontId, TEST_LOCATION);
+    DALI_TEST_EQUALS(glyphs[index].index, visualModel->mGlyphs[index].index, TEST_LOCATION);
+    DALI_TEST_EQUALS(glyphToCharacter[index], visualModel->mGlyphsToCharacters[index], TEST_LOCATION);
+    DALI_TEST_EQUALS(charactersPerGlyph[index], visualModel->mCharactersPerGlyph[index], TEST_LOCATION);
+  }
+
+  // Disable the cache.
+  const uint32_t maximumNumberOfRuns = shapingCache.GetMaximumNumberOfRuns();
+  shapingCache.SetMaximumNumberOfRuns(0u);
+  DALI_TEST_EQUALS(shapingCache.GetNumberOfRuns(), 0u, TEST_LOCATION);
+
+  glyphs.Clear();
+  glyphToCharacter.Clear();
+  charactersPerGlyph.Clear();
+
+  ShapeText(shaping,
+            fontClient,
+            logicalModel->mText,
+            logicalModel->mLineBreakInfo,
+            logicalModel->mScriptRuns,
+            logicalModel->mFontRuns,
+            0u,
+            0u,
+            logicalModel->mText.Count(),
+            glyphs,
+            glyphToCharacter,
+            charactersPerGlyph,
+            newParagraphGlyphs);
+
+  DALI_TEST_EQUALS(shapingCache.GetHitCount(), hitCount + numberOfRuns, TEST_LOCATION);
+  DALI_TEST_EQUALS(glyphs.Count(), visualModel->mGlyphs.Count(), TEST_LOCATION);
+
+  shapingCache.SetMaximumNumberOfRuns(maximumNumberOfRuns);
+
+  END_TEST;
+}
+
+int UtcDaliTextShapingCacheClearFontClient(void)
+{
+  tet_infoline(" UtcDaliTextShapingCacheClearFontClient");
+
+  // Clearing the runs of a font client keeps the runs of the other font clients.
+  ToolkitTestApplication application;
+
+  ShapingCache& shapingCache = ShapingCache::Get();
+  shapingCache.Clear();
+
+  TextAbstraction::FontClient fontClient      = TextAbstraction::FontClient::Get();
+  TextAbstraction::FontClient otherFontClient = TextAbstraction::FontClient::New();
+
+  const Character text[] = {'H', 'e', 'l', 'l', 'o'};
+  const Length    length = sizeof(text) / sizeof(Character);
+
+  Vector<GlyphInfo>      glyphs;
+  Vector<CharacterIndex> glyphToCharacterMap;
+  for(Length index = 0u; index < length; ++index)
+  {
+    GlyphInfo glyph;
+    glyph.fontId = 1u;
+    glyph.index  = index + 1u;
+    glyphs.PushBack(glyph);
+    glyphToCharacterMap.PushBack(index);
+  }
+
+  shapingCache.Add(fontClient, text, length, 1u, TextAbstraction::LATIN, false, false, glyphs, glyphToCharacterMap);
+  shapingCache.Add(otherFontClient, text, length, 1u, TextAbstraction::LATIN, false, false, glyphs, glyphToCharacterMap);
+  DALI_TEST_EQUALS(shapingCache.GetNumberOfRuns(), 2u, TEST_LOCATION);
+
+  shapingCache.Clear(otherFontClient);
+  DALI_TEST_EQUALS(shapingCache.GetNumberOfRuns(), 1u, TEST_LOCATION);
+
+  Vector<GlyphInfo>      cachedGlyphs;
+  Vector<CharacterIndex> cachedGlyphToCharacterMap;
+  DALI_TEST_CHECK(shapingCache.Find(fontClient, text, length, 1u, TextAbstraction::LATIN, false, false, cachedGlyphs, cachedGlyphToCharacterMap));
+  DALI_TEST_EQUALS(cachedGlyphs.Count(), length, TEST_LOCATION);
+  DALI_TEST_CHECK(!shapingCache.Find(otherFontClient, text, length, 1u, TextAbstraction::LATIN, false, false, cachedGlyphs, cachedGlyphToCharacterMap));
+
+  // The font client gets a new generation id, so its new runs are cached again.
+  shapingCache.Add(otherFontClient, text, length, 1u, TextAbstraction::LATIN, false, false, glyphs, glyphToCharacterMap);
+  DALI_TEST_CHECK(shapingCache.Find(otherFontClient, text, length, 1u, TextAbstraction::LATIN, false, false, cachedGlyphs, cachedGlyphToCharacterMap));
+
+  shapingCache.Clear(fontClient);
+  DALI_TEST_EQUALS(shapingCache.GetNumberOfRuns(), 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(!shapingCache.Find(fontClient, text, length, 1u, TextAbstraction::LATIN, false, false, cachedGlyphs, cachedGlyphToCharacterMap));
+
+  shapingCache.Clear();
+  DALI_TEST_EQUALS(shapingCache.GetNumberOfRuns(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
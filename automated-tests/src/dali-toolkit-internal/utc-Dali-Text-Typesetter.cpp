@@ -20,12 +20,14 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <limits>
+#include <vector>
 
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/text/bitmap-font.h>
 #include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
 #include <dali-toolkit/internal/text/controller/text-controller.h>
+#include <dali-toolkit/internal/text/rendering/text-typesetter-blending.h>
 #include <dali-toolkit/internal/text/rendering/text-typesetter.h>
 #include <dali-toolkit/internal/text/rendering/view-model.h>
 #include <dali/devel-api/text-abstraction/bitmap-font.h>
@@ -42,6 +44,26 @@ const std::string     DEFAULT_FONT_DIR("/resources/fonts");
 const PointSize26Dot6 EMOJI_FONT_SIZE = 3840u; // 60 * 64
 
 constexpr auto DALI_RENDERED_GLYPH_COMPRESS_POLICY = "DALI_RENDERED_GLYPH_COMPRESS_POLICY";
+
+/**
+ * @brief Creates a pseudo-random pre-multiplied RGBA8888 pixel, with plenty of fully transparent and opaque ones.
+ */
+uint32_t CreatePremultipliedPixel(uint32_t& seed)
+{
+  seed = seed * 1664525u + 1013904223u;
+
+  const uint32_t alphaType = (seed >> 8) & 3u;
+  const uint32_t alpha     = (alphaType == 0u) ? 0u : (alphaType == 1u) ? 255u
+                                                                       : (seed >> 24);
+
+  uint32_t pixel = alpha << 24;
+  for(uint32_t channel = 0u; channel < 3u; ++channel)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    pixel |= ((seed >> 16) % (alpha + 1u)) << (8u * channel);
+  }
+  return pixel;
+}
 } // namespace
 
 int UtcDaliTextTypesetter(void)
@@ -462,3 +484,66 @@ int UtcDaliTextTypesetterBitmapFont(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextTypesetterBlendingKernels(void)
+{
+  tet_infoline(" UtcDaliTextTypesetterBlendingKernels");
+  ToolkitTestApplication application;
+
+  using namespace Blending;
+
+  const KernelType defaultType = GetKernelType();
+  DALI_TEST_CHECK(IsSimdAvailable() || (KernelType::SCALAR == defaultType));
+
+  // An odd number of pixels so the vector kernels process a tail too.
+  const uint32_t numberOfPixels = 1027u;
+
+  uint32_t              seed = 7u;
+  std::vector<uint32_t> top(numberOfPixels);
+  std::vector<uint32_t> bottom(numberOfPixels);
+  std::vector<uint8_t>  coverage(numberOfPixels * 4u);
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    top[index]    = CreatePremultipliedPixel(seed);
+    bottom[index] = CreatePremultipliedPixel(seed);
+  }
+  for(uint8_t& alpha : coverage)
+  {
+    alpha = static_cast<uint8_t>(CreatePremultipliedPixel(seed) >> 24);
+  }
+  const uint32_t color = 0xC0803010;
+
+  std::vector<uint32_t> scalarCombined(numberOfPixels), simdCombined(numberOfPixels);
+  std::vector<uint32_t> scalarMasked(bottom), simdMasked(bottom);
+  std::vector<uint32_t> scalarBlit(bottom), simdBlit(bottom);
+  std::vector<uint32_t> scalarStridedBlit(bottom), simdStridedBlit(bottom);
+
+  SetKernelType(KernelType::SCALAR);
+  DALI_TEST_CHECK(KernelType::SCALAR == GetKernelType());
+  CombinePixels(top.data(), bottom.data(), scalarCombined.data(), numberOfPixels);
+  MaskPixels(top.data(), scalarMasked.data(), numberOfPixels, 200u);
+  BlitGlyphRow(coverage.data(), 1u, scalarBlit.data(), numberOfPixels, color);
+  BlitGlyphRow(coverage.data() + 3u, 4u, scalarStridedBlit.data(), numberOfPixels, color);
+
+  SetKernelType(KernelType::SIMD);
+  CombinePixels(top.data(), bottom.data(), simdCombined.data(), numberOfPixels);
+  MaskPixels(top.data(), simdMasked.data(), numberOfPixels, 200u);
+  BlitGlyphRow(coverage.data(), 1u, simdBlit.data(), numberOfPixels, color);
+  BlitGlyphRow(coverage.data() + 3u, 4u, simdStridedBlit.data(), numberOfPixels, color);
+
+  // The vector kernels must give exactly the same pixels as the scalar ones.
+  DALI_TEST_CHECK(scalarCombined == simdCombined);
+  DALI_TEST_CHECK(scalarMasked == simdMasked);
+  DALI_TEST_CHECK(scalarBlit == simdBlit);
+  DALI_TEST_CHECK(scalarStridedBlit == simdStridedBlit);
+
+  // The result can be stored into the top buffer.
+  std::vector<uint32_t> inPlace(top);
+  CombinePixels(inPlace.data(), bottom.data(), inPlace.data(), numberOfPixels);
+  DALI_TEST_CHECK(scalarCombined == inPlace);
+
+  SetKernelType(defaultType);
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
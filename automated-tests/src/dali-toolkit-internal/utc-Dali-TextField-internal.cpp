@@ -16,6 +16,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <iostream>
 
 #include <dali-toolkit-test-suite-utils.h>
@@ -989,6 +990,177 @@ int UtcDaliTextFieldFontPointSizeLargerThanAtlasPlaceholderCase(void)
   END_TEST;
 }
 
+int UtcDaliTextFieldAtlasGlyphManagerTextureMemoryLimit(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextFieldAtlasGlyphManagerTextureMemoryLimit ");
+
+  AtlasGlyphManager glyphManager = AtlasGlyphManager::Get();
+  glyphManager.SetTextureMemoryLimit(4u * 1024u * 1024u);
+  DALI_TEST_EQUALS(glyphManager.GetTextureMemoryLimit(), 4u * 1024u * 1024u, TEST_LOCATION);
+
+  TextField textField = TextField::New();
+  textField.SetProperty(Actor::Property::SIZE, Vector2(300.f, 50.f));
+  textField.SetProperty(TextField::Property::TEXT, "Hello");
+  application.GetScene().Add(textField);
+
+  application.SendNotification();
+  application.Render();
+
+  const uint32_t glyphCount = glyphManager.GetMetrics().mGlyphCount;
+  DALI_TEST_CHECK(glyphCount > 0u);
+  DALI_TEST_EQUALS(glyphManager.GetMetrics().mUnusedGlyphCount, 0u, TEST_LOCATION);
+
+  // Unreferenced glyphs are kept in the atlas
+  textField.SetProperty(TextField::Property::TEXT, "");
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(glyphManager.GetMetrics().mUnusedGlyphCount > 0u);
+  DALI_TEST_EQUALS(glyphManager.GetMetrics().mGlyphCount, glyphCount, TEST_LOCATION);
+
+  // And reused when they are shown again
+  textField.SetProperty(TextField::Property::TEXT, "Hello");
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(glyphManager.GetMetrics().mUnusedGlyphCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(glyphManager.GetMetrics().mGlyphCount, glyphCount, TEST_LOCATION);
+
+  // Compaction evicts unused glyphs
+  textField.SetProperty(TextField::Property::TEXT, "");
+  application.SendNotification();
+  application.Render();
+  glyphManager.Compact();
+
+  DALI_TEST_EQUALS(glyphManager.GetMetrics().mUnusedGlyphCount, 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(glyphManager.GetMetrics().mEvictedGlyphCount > 0u);
+  DALI_TEST_CHECK(glyphManager.GetMetrics().mGlyphCount < glyphCount);
+
+  glyphManager.SetTextureMemoryLimit(0u);
+  DALI_TEST_EQUALS(glyphManager.GetTextureMemoryLimit(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTextFieldAtlasGlyphManagerTrimKeepsAtlasInUse(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextFieldAtlasGlyphManagerTrimKeepsAtlasInUse ");
+
+  AtlasGlyphManager glyphManager = AtlasGlyphManager::Get();
+  glyphManager.SetTextureMemoryLimit(4u * 1024u * 1024u);
+
+  TextField textField = TextField::New();
+  textField.SetProperty(Actor::Property::SIZE, Vector2(300.f, 50.f));
+  textField.SetProperty(TextField::Property::TEXT, "Hello");
+  application.GetScene().Add(textField);
+
+  TextField otherTextField = TextField::New();
+  otherTextField.SetProperty(Actor::Property::SIZE, Vector2(300.f, 50.f));
+  otherTextField.SetProperty(TextField::Property::TEXT, "H");
+  application.GetScene().Add(otherTextField);
+
+  application.SendNotification();
+  application.Render();
+
+  textField.SetProperty(TextField::Property::TEXT, "");
+  application.SendNotification();
+  application.Render();
+
+  const uint32_t unusedGlyphCount  = glyphManager.GetMetrics().mUnusedGlyphCount;
+  const uint32_t evictedGlyphCount = glyphManager.GetMetrics().mEvictedGlyphCount;
+  DALI_TEST_CHECK(unusedGlyphCount > 0u);
+
+  // The atlas still holds a glyph in use, so evicting its unused glyphs would not give any memory back
+  glyphManager.SetTextureMemoryLimit(1u);
+  DALI_TEST_EQUALS(glyphManager.GetMetrics().mUnusedGlyphCount, unusedGlyphCount, TEST_LOCATION);
+  DALI_TEST_EQUALS(glyphManager.GetMetrics().mEvictedGlyphCount, evictedGlyphCount, TEST_LOCATION);
+
+  // Once nothing uses the atlas, it is drained
+  otherTextField.SetProperty(TextField::Property::TEXT, "");
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(glyphManager.GetMetrics().mUnusedGlyphCount, 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(glyphManager.GetMetrics().mEvictedGlyphCount > evictedGlyphCount);
+
+  glyphManager.SetTextureMemoryLimit(0u);
+
+  END_TEST;
+}
+
+int UtcDaliTextFieldAtlasManagerSkylinePacking(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextFieldAtlasManagerSkylinePacking ");
+
+  auto createImage = [](uint32_t width, uint32_t height) {
+    const uint32_t bufferSize = width * height;
+    unsigned char* buffer     = new unsigned char[bufferSize];
+    memset(buffer, 0xFF, bufferSize);
+    return PixelData::New(buffer, bufferSize, width, height, Pixel::L8, PixelData::DELETE_ARRAY);
+  };
+
+  Toolkit::AtlasManager atlasManager = Toolkit::AtlasManager::New();
+  atlasManager.SetPackingMode(Toolkit::AtlasManager::PACK_SKYLINE);
+  DALI_TEST_EQUALS(atlasManager.GetPackingMode(), Toolkit::AtlasManager::PACK_SKYLINE, TEST_LOCATION);
+
+  Toolkit::AtlasManager::AtlasSize size;
+  size.mWidth       = 64u;
+  size.mHeight      = 64u;
+  size.mBlockWidth  = 16u;
+  size.mBlockHeight = 16u;
+  atlasManager.SetNewAtlasSize(size);
+
+  // Images larger than a block still fit, as they are stored at their own size
+  std::vector<Toolkit::AtlasManager::AtlasSlot> slots;
+  Toolkit::AtlasManager::AtlasSlot              slot;
+  DALI_TEST_CHECK(atlasManager.Add(createImage(4u, 20u), slot));
+  slots.push_back(slot);
+  atlasManager.Add(createImage(20u, 4u), slot);
+  slots.push_back(slot);
+
+  // Many more small images fit than there would be blocks
+  for(uint32_t i = 0u; i < 30u; ++i)
+  {
+    atlasManager.Add(createImage(4u, 4u), slot);
+    slots.push_back(slot);
+  }
+  DALI_TEST_EQUALS(atlasManager.GetAtlasCount(), 1u, TEST_LOCATION);
+
+  Toolkit::AtlasManager::Metrics metrics;
+  atlasManager.GetMetrics(metrics);
+  DALI_TEST_EQUALS(metrics.mAtlasCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(metrics.mAtlasMetrics[0].mImageCount, 32u, TEST_LOCATION);
+  DALI_TEST_EQUALS(metrics.mAtlasMetrics[0].mOccupancy, (80.0f + 80.0f + 30.0f * 16.0f) / (64.0f * 64.0f), Math::MACHINE_EPSILON_100, TEST_LOCATION);
+  DALI_TEST_CHECK(atlasManager.GetOccupancy(1u) > metrics.mAtlasMetrics[0].mOccupancy);
+
+  // The first image is placed below the filled pixel row, after its padding
+  Toolkit::AtlasManager::Mesh2D mesh;
+  atlasManager.GenerateMeshData(slots[0].mImageId, Vector2::ZERO, mesh, false);
+  DALI_TEST_EQUALS(mesh.mVertices.Size(), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(mesh.mVertices[0].mTexCoords, Vector2(1.5f / 64.0f, 2.5f / 64.0f), Math::MACHINE_EPSILON_100, TEST_LOCATION);
+  DALI_TEST_EQUALS(mesh.mVertices[3].mTexCoords, Vector2(6.5f / 64.0f, 23.5f / 64.0f), Math::MACHINE_EPSILON_100, TEST_LOCATION);
+
+  for(auto& added : slots)
+  {
+    DALI_TEST_CHECK(atlasManager.Remove(added.mImageId));
+  }
+
+  atlasManager.GetMetrics(metrics);
+  DALI_TEST_EQUALS(metrics.mAtlasMetrics[0].mImageCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(metrics.mAtlasMetrics[0].mOccupancy, 0.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(atlasManager.GetOccupancy(1u), 0.0f, TEST_LOCATION);
+
+  // Removed space is reused
+  atlasManager.Add(createImage(4u, 20u), slot);
+  DALI_TEST_EQUALS(slot.mAtlasId, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(atlasManager.ReleaseEmptyAtlases(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliTextFieldBackgroundTag(void)
 {
   ToolkitTestApplication application;
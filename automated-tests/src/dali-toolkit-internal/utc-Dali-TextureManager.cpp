@@ -24,9 +24,11 @@
 #include <toolkit-event-thread-callback.h>
 #include <toolkit-timer.h>
 
+#include <dali-toolkit/internal/texture-manager/animated-image-frame-ring.h>
 #include <dali-toolkit/internal/texture-manager/texture-async-loading-helper.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
 #include <dali-toolkit/internal/texture-manager/texture-upload-observer.h>
+#include <dali-toolkit/internal/image-loader/loading-task.h>
 #include <dali-toolkit/internal/image-loader/remote-decode-task.h>
 #include <dali-toolkit/internal/visuals/visual-factory-impl.h> ///< For VisualFactory's member TextureManager.
 #include <dali-toolkit/public-api/image-loader/image-url-utils.h>
@@ -73,6 +75,7 @@ const char* TEST_MASK_FILE_NAME    = TEST_RESOURCE_DIR "/mask.png";
 const char* TEST_COMPRESSED_ALPHA_IMAGE_FILE_NAME = TEST_RESOURCE_DIR "/RGBA_ASTC_4x4.ktx";
 
 const char* TEST_SVG_FILE_NAME                   = TEST_RESOURCE_DIR "/svg1.svg";
+const char* TEST_GIF_FILE_NAME                   = TEST_RESOURCE_DIR "/anim.gif";
 const char* TEST_ANIMATED_VECTOR_IMAGE_FILE_NAME = TEST_RESOURCE_DIR "/insta_camera.json";
 
 class TestObserver : public Dali::Toolkit::TextureUploadObserver
@@ -201,6 +204,31 @@ public:
   bool                                    mKeepSignal;
 };
 
+class TestObserverWithLoadingPriority : public TestObserver
+{
+public:
+  TestObserverWithLoadingPriority()
+  : TestObserver(),
+    mLoadingPriority(Toolkit::DevelVisual::LoadingPriority::DEFAULT),
+    mCompleteCount(0)
+  {
+  }
+
+  virtual void LoadComplete(bool loadSuccess, TextureInformation textureInformation) override
+  {
+    TestObserver::LoadComplete(loadSuccess, textureInformation);
+    ++mCompleteCount;
+  }
+
+  virtual Toolkit::DevelVisual::LoadingPriority::Type GetTextureLoadingPriority() const override
+  {
+    return mLoadingPriority;
+  }
+
+  Toolkit::DevelVisual::LoadingPriority::Type mLoadingPriority;
+  int                                mCompleteCount;
+};
+
 } // namespace
 
 int UtcTextureManagerRequestLoad(void)
@@ -2628,3 +2656,319 @@ int UtcTextureManagerMaskByExternalTexture02(void)
 
   END_TEST;
 }
+
+int UtcTextureManagerReleasedTextureCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerReleasedTextureCache");
+
+  TextureManager textureManager; // Create new texture manager
+
+  std::string filename(TEST_IMAGE_FILE_NAME);
+
+  TextureManager::MaskingDataPointer maskInfo = nullptr;
+
+  bool loadingStatus(false);
+  auto preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+
+  // Keep released textures up to 16MB.
+  textureManager.SetReleasedTextureCacheBudget(16u * 1024u * 1024u);
+  DALI_TEST_EQUALS(textureManager.GetReleasedTextureCacheBudget(), 16u * 1024u * 1024u, TEST_LOCATION);
+
+  TestObserver observer;
+  auto         textureId(TextureManager::INVALID_TEXTURE_ID);
+  TextureSet   textureSet = textureManager.LoadTexture(filename, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR, maskInfo, true, textureId, loadingStatus, &observer, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_CHECK(textureSet);
+  DALI_TEST_CHECK(textureManager.GetTexture(textureId));
+
+  auto statistics = textureManager.GetReleasedTextureCacheStatistics();
+  DALI_TEST_EQUALS(statistics.missCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.textureCount, 0u, TEST_LOCATION);
+
+  // Release the texture. It should be kept.
+  textureManager.RequestRemove(textureId, &observer);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(textureManager.GetTexture(textureId));
+
+  statistics = textureManager.GetReleasedTextureCacheStatistics();
+  DALI_TEST_EQUALS(statistics.textureCount, 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(statistics.usedBytes > 0u);
+
+  // Load same image again. It should be revived without loading.
+  TestObserver observer2;
+  auto         textureId2(TextureManager::INVALID_TEXTURE_ID);
+  TextureSet   textureSet2 = textureManager.LoadTexture(filename, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR, maskInfo, false, textureId2, loadingStatus, &observer2, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_CHECK(textureSet2);
+  DALI_TEST_EQUALS(textureId2, textureId, TEST_LOCATION);
+  DALI_TEST_EQUALS(loadingStatus, false, TEST_LOCATION);
+
+  statistics = textureManager.GetReleasedTextureCacheStatistics();
+  DALI_TEST_EQUALS(statistics.hitCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.textureCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.usedBytes, 0u, TEST_LOCATION);
+
+  // Release again, and reduce the budget. It should be evicted.
+  textureManager.RequestRemove(textureId2, &observer2);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(textureManager.GetReleasedTextureCacheStatistics().textureCount, 1u, TEST_LOCATION);
+
+  textureManager.SetReleasedTextureCacheBudget(0u);
+  statistics = textureManager.GetReleasedTextureCacheStatistics();
+  DALI_TEST_EQUALS(statistics.textureCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.evictionCount, 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(!textureManager.GetTexture(textureId));
+
+  textureManager.ResetReleasedTextureCacheStatistics();
+  statistics = textureManager.GetReleasedTextureCacheStatistics();
+  DALI_TEST_EQUALS(statistics.hitCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.missCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.evictionCount, 0u, TEST_LOCATION);
+
+  // Without budget, a request that finds nothing is not a miss of the released texture cache.
+  TestObserver observer3;
+  auto         textureId3(TextureManager::INVALID_TEXTURE_ID);
+  TextureSet   textureSet3 = textureManager.LoadTexture(filename, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR, maskInfo, true, textureId3, loadingStatus, &observer3, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_CHECK(textureSet3);
+  DALI_TEST_EQUALS(textureManager.GetReleasedTextureCacheStatistics().missCount, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTextureManagerReleasedTextureCacheDoubleRemove(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerReleasedTextureCacheDoubleRemove");
+
+  TextureManager textureManager; // Create new texture manager
+
+  std::string filename(TEST_IMAGE_FILE_NAME);
+
+  TextureManager::MaskingDataPointer maskInfo = nullptr;
+
+  bool loadingStatus(false);
+  auto preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+
+  textureManager.SetReleasedTextureCacheBudget(16u * 1024u * 1024u);
+
+  TestObserver observer;
+  auto         textureId(TextureManager::INVALID_TEXTURE_ID);
+  TextureSet   textureSet = textureManager.LoadTexture(filename, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR, maskInfo, true, textureId, loadingStatus, &observer, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_CHECK(textureSet);
+
+  textureManager.RequestRemove(textureId, &observer);
+
+  application.SendNotification();
+  application.Render();
+
+  auto statistics = textureManager.GetReleasedTextureCacheStatistics();
+  DALI_TEST_EQUALS(statistics.textureCount, 1u, TEST_LOCATION);
+  const uint32_t usedBytes = statistics.usedBytes;
+  DALI_TEST_CHECK(usedBytes > 0u);
+
+  // Removing the released texture again must not keep it twice.
+  textureManager.RequestRemove(textureId, nullptr);
+
+  application.SendNotification();
+  application.Render();
+
+  statistics = textureManager.GetReleasedTextureCacheStatistics();
+  DALI_TEST_EQUALS(statistics.textureCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.usedBytes, usedBytes, TEST_LOCATION);
+  DALI_TEST_CHECK(textureManager.GetTexture(textureId));
+
+  // It is still evicted once, and then really removed.
+  textureManager.SetReleasedTextureCacheBudget(0u);
+  statistics = textureManager.GetReleasedTextureCacheStatistics();
+  DALI_TEST_EQUALS(statistics.textureCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.usedBytes, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.evictionCount, 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(!textureManager.GetTexture(textureId));
+
+  END_TEST;
+}
+
+int UtcTextureManagerAnimatedImageFrameRing(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerAnimatedImageFrameRing");
+
+  TextureManager textureManager; // Create new texture manager
+
+  VisualUrl                  url(TEST_GIF_FILE_NAME);
+  Dali::AnimatedImageLoading animatedImageLoading = Dali::AnimatedImageLoading::New(url.GetUrl(), url.IsLocalResource());
+
+  TextureManager::MaskingDataPointer maskInfo = nullptr;
+
+  auto preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+
+  // No ring is shared while the budget is 0.
+  DALI_TEST_EQUALS(textureManager.GetAnimatedImageFrameBudget(), 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(!textureManager.GetAnimatedImageFrameRing(url, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR));
+
+  textureManager.SetAnimatedImageFrameBudget(16u * 1024u * 1024u);
+  DALI_TEST_EQUALS(textureManager.GetAnimatedImageFrameBudget(), 16u * 1024u * 1024u, TEST_LOCATION);
+
+  AnimatedImageFrameRingPtr ring = textureManager.GetAnimatedImageFrameRing(url, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR);
+  DALI_TEST_CHECK(ring);
+  DALI_TEST_CHECK(ring == textureManager.GetAnimatedImageFrameRing(url, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR));
+  DALI_TEST_CHECK(ring != textureManager.GetAnimatedImageFrameRing(url, ImageDimensions(32u, 32u), SamplingMode::BOX_THEN_LINEAR));
+
+  TestObserver observer;
+  auto         textureId(TextureManager::INVALID_TEXTURE_ID);
+  TextureSet   textureSet = textureManager.LoadAnimatedImageTexture(url, animatedImageLoading, 0u, textureId, maskInfo, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR, false, &observer, preMultiply, TextureManager::ReloadPolicy::CACHED);
+  DALI_TEST_CHECK(!textureSet);
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(observer.mLoaded, true, TEST_LOCATION);
+
+  // Keep the first frame in the ring.
+  const uint32_t frameCount = animatedImageLoading.GetImageCount();
+  DALI_TEST_CHECK(frameCount > 1u);
+  DALI_TEST_EQUALS(ring->Retain(0u, frameCount, textureId), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(ring->IsResident(0u), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(ring->IsResident(1u), false, TEST_LOCATION);
+  DALI_TEST_EQUALS(ring->IsLoopResident(), false, TEST_LOCATION);
+  DALI_TEST_CHECK(textureManager.GetAnimatedImageFrameBytes() > 0u);
+
+  // Release the frame. The ring keeps it.
+  textureManager.RequestRemove(textureId, &observer);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(textureManager.GetTexture(textureId));
+
+  // Load the frame again. It is ready without decoding.
+  TestObserver observer2;
+  auto         textureId2(TextureManager::INVALID_TEXTURE_ID);
+  TextureSet   textureSet2 = textureManager.LoadAnimatedImageTexture(url, animatedImageLoading, 0u, textureId2, maskInfo, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR, false, &observer2, preMultiply, TextureManager::ReloadPolicy::CACHED);
+  DALI_TEST_CHECK(textureSet2);
+  DALI_TEST_EQUALS(textureId2, textureId, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer2.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, 1), false, TEST_LOCATION);
+
+  textureManager.RequestRemove(textureId2, &observer2);
+
+  application.SendNotification();
+  application.Render();
+
+  // The look ahead covers the decoding time with the frame interval.
+  DALI_TEST_EQUALS(ring->GetLookAhead(100u, 2u, 8u), 2u, TEST_LOCATION);
+  ring->AddDecodeTime(250u);
+  DALI_TEST_EQUALS(ring->GetLookAhead(100u, 2u, 8u), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(ring->GetLookAhead(10u, 2u, 8u), 8u, TEST_LOCATION);
+  DALI_TEST_EQUALS(ring->GetLookAhead(0u, 2u, 8u), 2u, TEST_LOCATION);
+
+  // Reduce the budget. The frame is released.
+  textureManager.SetAnimatedImageFrameBudget(1u);
+  DALI_TEST_EQUALS(ring->IsResident(0u), false, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetAnimatedImageFrameBytes(), 0u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(!textureManager.GetTexture(textureId));
+
+  ring.Reset();
+  animatedImageLoading.Reset();
+
+  END_TEST;
+}
+
+int UtcTextureManagerLoadingPriorityMapping(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerLoadingPriorityMapping");
+
+  using Toolkit::DevelVisual::LoadingPriority::DEFAULT;
+  using Toolkit::DevelVisual::LoadingPriority::OFF_SCREEN;
+  using Toolkit::DevelVisual::LoadingPriority::VISIBLE;
+
+  DALI_TEST_EQUALS(GetLoadingTaskPriorityType(VisualUrl("image.png"), DEFAULT), AsyncTask::PriorityType::HIGH, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetLoadingTaskPriorityType(VisualUrl("image.png"), OFF_SCREEN), AsyncTask::PriorityType::LOW, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetLoadingTaskPriorityType(VisualUrl("https://dali.test/image.png"), DEFAULT), AsyncTask::PriorityType::LOW, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetLoadingTaskPriorityType(VisualUrl("https://dali.test/image.png"), VISIBLE), AsyncTask::PriorityType::HIGH, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(GetMoreUrgentLoadingPriority(VISIBLE, OFF_SCREEN), VISIBLE, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetMoreUrgentLoadingPriority(DEFAULT, VISIBLE), VISIBLE, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetMoreUrgentLoadingPriority(OFF_SCREEN, OFF_SCREEN), OFF_SCREEN, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetMoreUrgentLoadingPriority(OFF_SCREEN, DEFAULT), DEFAULT, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTextureManagerUpdateLoadingPriority(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerUpdateLoadingPriority");
+
+  TextureManager textureManager; // Create new texture manager
+
+  std::string filename(TEST_IMAGE_FILE_NAME);
+
+  TextureManager::MaskingDataPointer maskInfo = nullptr;
+
+  bool loadingStatus(false);
+  auto preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+
+  TestObserverWithLoadingPriority observer;
+  observer.mLoadingPriority = Toolkit::DevelVisual::LoadingPriority::OFF_SCREEN;
+
+  auto       textureId(TextureManager::INVALID_TEXTURE_ID);
+  TextureSet textureSet = textureManager.LoadTexture(filename, ImageDimensions(), SamplingMode::BOX_THEN_LINEAR, maskInfo, false, textureId, loadingStatus, &observer, true, TextureManager::ReloadPolicy::CACHED, preMultiply);
+  DALI_TEST_CHECK(textureId != TextureManager::INVALID_TEXTURE_ID);
+  DALI_TEST_EQUALS(loadingStatus, true, TEST_LOCATION);
+
+  // The item scrolled into view. The queued task should be replaced, not duplicated.
+  observer.mLoadingPriority = Toolkit::DevelVisual::LoadingPriority::VISIBLE;
+  textureManager.UpdateLoadingPriority(textureId);
+
+  // Nothing changed. It should do nothing.
+  textureManager.UpdateLoadingPriority(textureId);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(observer.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer.mCompleteCount, 1, TEST_LOCATION);
+
+  // The texture is loaded. It should be ignored.
+  observer.mLoadingPriority = Toolkit::DevelVisual::LoadingPriority::OFF_SCREEN;
+  textureManager.UpdateLoadingPriority(textureId);
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, 1), false, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer.mCompleteCount, 1, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTextureManagerLoadingTaskStarted(void)
+{
+  tet_infoline("UtcTextureManagerLoadingTaskStarted");
+
+  // A started task is not re-prioritised, so that its decoding is not thrown away.
+  LoadingTaskPtr loadingTask = new LoadingTask(1u, VisualUrl(TEST_IMAGE_FILE_NAME), ImageDimensions(), SamplingMode::BOX_THEN_LINEAR, true, Dali::Toolkit::DevelAsyncImageLoader::PreMultiplyOnLoad::OFF, false, nullptr, Toolkit::DevelVisual::LoadingPriority::OFF_SCREEN);
+  DALI_TEST_EQUALS(loadingTask->IsStarted(), false, TEST_LOCATION);
+
+  loadingTask->Process();
+
+  DALI_TEST_EQUALS(loadingTask->IsStarted(), true, TEST_LOCATION);
+  DALI_TEST_CHECK(!loadingTask->pixelBuffers.empty());
+
+  END_TEST;
+}
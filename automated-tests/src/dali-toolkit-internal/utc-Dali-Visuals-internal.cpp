@@ -15,7 +15,10 @@
  *
  */
 
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <stdlib.h>
 
@@ -27,6 +30,7 @@
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali-toolkit/devel-api/visuals/arc-visual-properties-devel.h>
 #include <dali-toolkit/internal/visuals/color/color-visual.h>
+#include <dali-toolkit/internal/visuals/npatch/npatch-loader.h>
 #include <dali-toolkit/internal/visuals/npatch/npatch-visual.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
 
@@ -447,3 +451,126 @@ int UtcDaliVisualCreateWithoutCoreN(void)
 
   END_TEST;
 }
+
+int UtcDaliNPatchLoaderCacheById(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Check that the n-patch data keep their ids when other data are removed");
+
+  Toolkit::Internal::TextureManager textureManager;
+  Toolkit::Internal::NPatchLoader   npatchLoader;
+
+  const Toolkit::Internal::VisualUrl urlA(TEST_RESOURCE_DIR "/invalid-a.9.png");
+  const Toolkit::Internal::VisualUrl urlB(TEST_RESOURCE_DIR "/invalid-b.9.png");
+  const Toolkit::Internal::VisualUrl urlC(TEST_RESOURCE_DIR "/invalid-c.9.png");
+  const Extents                      border(1u, 1u, 1u, 1u);
+  bool                               preMultiplyOnLoad = true;
+
+  auto idA  = npatchLoader.Load(textureManager, nullptr, urlA, Extents(), preMultiplyOnLoad, true);
+  auto idB  = npatchLoader.Load(textureManager, nullptr, urlB, Extents(), preMultiplyOnLoad, true);
+  auto idA2 = npatchLoader.Load(textureManager, nullptr, urlA, Extents(), preMultiplyOnLoad, true);
+  auto idC  = npatchLoader.Load(textureManager, nullptr, urlC, border, preMultiplyOnLoad, true);
+
+  // Same url and border share the data
+  DALI_TEST_EQUALS(idA, idA2, TEST_LOCATION);
+  DALI_TEST_CHECK(idA != idB);
+  DALI_TEST_CHECK(idB != idC);
+
+  // Remove B. The other data should still be found by their ids.
+  npatchLoader.RequestRemove(idB, nullptr);
+
+  application.SendNotification();
+  application.Render();
+
+  Toolkit::Internal::NPatchDataPtr data;
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(idB, data), false, TEST_LOCATION);
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(idA, data), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(data->GetUrl().GetUrl(), urlA.GetUrl(), TEST_LOCATION);
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(idC, data), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(data->GetUrl().GetUrl(), urlC.GetUrl(), TEST_LOCATION);
+  DALI_TEST_EQUALS(data->GetId(), idC, TEST_LOCATION);
+
+  // A is still referenced once after one removal
+  npatchLoader.RequestRemove(idA, nullptr);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(idA, data), true, TEST_LOCATION);
+
+  npatchLoader.RequestRemove(idA, nullptr);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(idA, data), false, TEST_LOCATION);
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(idC, data), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(data->GetId(), idC, TEST_LOCATION);
+
+  // Loading B again creates new data
+  auto idB2 = npatchLoader.Load(textureManager, nullptr, urlB, Extents(), preMultiplyOnLoad, true);
+  DALI_TEST_CHECK(idB2 != idB);
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(idB2, data), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(data->GetUrl().GetUrl(), urlB.GetUrl(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliNPatchLoaderCacheManyAssets(void)
+{
+  ToolkitTestApplication application;
+
+  // Visuals of a theme, sharing their assets with two borders per asset, as the controls of a theme often do.
+  const int numberOfVisuals = 400;
+  const int numberOfAssets  = 100;
+
+  Toolkit::Internal::TextureManager textureManager;
+  Toolkit::Internal::NPatchLoader   npatchLoader;
+
+  std::vector<Toolkit::Internal::VisualUrl> urls;
+  for(int i = 0; i < numberOfAssets; ++i)
+  {
+    urls.emplace_back(std::string(TEST_RESOURCE_DIR "/invalid-") + std::to_string(i) + ".9.png");
+  }
+
+  std::vector<Toolkit::Internal::NPatchData::NPatchDataId> ids;
+  bool                                                     preMultiplyOnLoad = true;
+  for(int i = 0; i < numberOfVisuals; ++i)
+  {
+    const Extents border = (i / numberOfAssets) % 2 ? Extents(1u, 1u, 1u, 1u) : Extents();
+    ids.push_back(npatchLoader.Load(textureManager, nullptr, urls[i % numberOfAssets], border, preMultiplyOnLoad, true));
+  }
+
+  // One data per url and border
+  std::vector<Toolkit::Internal::NPatchData::NPatchDataId> uniqueIds(ids);
+  std::sort(uniqueIds.begin(), uniqueIds.end());
+  uniqueIds.erase(std::unique(uniqueIds.begin(), uniqueIds.end()), uniqueIds.end());
+  DALI_TEST_EQUALS(uniqueIds.size(), static_cast<size_t>(numberOfAssets * 2), TEST_LOCATION);
+
+  Toolkit::Internal::NPatchDataPtr data;
+  for(int i = 0; i < numberOfVisuals; ++i)
+  {
+    DALI_TEST_EQUALS(ids[i], ids[i % (numberOfAssets * 2)], TEST_LOCATION);
+    DALI_TEST_CHECK(npatchLoader.GetNPatchData(ids[i], data));
+    DALI_TEST_EQUALS(data->GetUrl().GetUrl(), urls[i % numberOfAssets].GetUrl(), TEST_LOCATION);
+  }
+
+  // The data stay until every visual has removed them
+  for(int i = 0; i < numberOfVisuals - 1; ++i)
+  {
+    npatchLoader.RequestRemove(ids[i], nullptr);
+  }
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(ids.front(), data), false, TEST_LOCATION);
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(ids.back(), data), true, TEST_LOCATION);
+
+  npatchLoader.RequestRemove(ids.back(), nullptr);
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(npatchLoader.GetNPatchData(ids.back(), data), false, TEST_LOCATION);
+
+  END_TEST;
+}
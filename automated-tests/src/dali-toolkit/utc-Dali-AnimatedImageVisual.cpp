@@ -25,6 +25,7 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali-toolkit/devel-api/visuals/animated-image-visual-actions-devel.h>
 #include <dali-toolkit/devel-api/visuals/animated-image-visual-signals-devel.h>
@@ -1557,6 +1558,101 @@ int UtcDaliAnimatedImageVisualAnimatedImage01(void)
   END_TEST;
 }
 
+int UtcDaliAnimatedImageVisualAnimatedImageSharedFrames(void)
+{
+  ToolkitTestApplication application;
+  TestGlAbstraction&     gl = application.GetGlAbstraction();
+
+  tet_infoline("Keep the decoded frames, and check that the next loop and another visual don't decode them again");
+  Dali::Toolkit::TextureManager::SetAnimatedImageFrameBudget(16u * 1024u * 1024u);
+  {
+    Property::Map propertyMap;
+    propertyMap.Insert(Visual::Property::TYPE, Visual::ANIMATED_IMAGE);
+    propertyMap.Insert(ImageVisual::Property::URL, TEST_GIF_FILE_NAME);
+    propertyMap.Insert(ImageVisual::Property::BATCH_SIZE, 2);
+    propertyMap.Insert(ImageVisual::Property::CACHE_SIZE, 2);
+    propertyMap.Insert(ImageVisual::Property::FRAME_DELAY, 20);
+
+    VisualFactory factory = VisualFactory::Get();
+    Visual::Base  visual  = factory.CreateVisual(propertyMap);
+
+    DummyControl        dummyControl = DummyControl::New(true);
+    Impl::DummyControl& dummyImpl    = static_cast<Impl::DummyControl&>(dummyControl.GetImplementation());
+    dummyImpl.RegisterVisual(DummyControl::Property::TEST_VISUAL, visual);
+    DevelActor::SetResizePolicy(dummyControl, ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    application.GetScene().Add(dummyControl);
+
+    application.SendNotification();
+    application.Render();
+
+    tet_infoline("Play the first loop, which decodes each of the 4 frames");
+    for(int frame = 0; frame < 4; ++frame)
+    {
+      while(Test::WaitForEventThreadTrigger(1, 0))
+      {
+        application.SendNotification();
+        application.Render(20);
+      }
+      Test::EmitGlobalTimerSignal();
+      application.SendNotification();
+      application.Render(20);
+    }
+    while(Test::WaitForEventThreadTrigger(1, 0))
+    {
+      application.SendNotification();
+      application.Render(20);
+    }
+
+    const auto lastGenTextureId = gl.GetLastGenTextureId();
+    DALI_TEST_CHECK(lastGenTextureId >= 4);
+
+    tet_infoline("Play the second loop, which starts no new decode");
+    for(int frame = 0; frame < 4; ++frame)
+    {
+      Test::EmitGlobalTimerSignal();
+      application.SendNotification();
+      application.Render(20);
+    }
+    DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, 0), false, TEST_LOCATION);
+    DALI_TEST_EQUALS(gl.GetLastGenTextureId(), lastGenTextureId, TEST_LOCATION);
+
+    tet_infoline("Add another visual of the same url, which shares the frames");
+    Visual::Base        visual2       = factory.CreateVisual(propertyMap);
+    DummyControl        dummyControl2 = DummyControl::New(true);
+    Impl::DummyControl& dummyImpl2    = static_cast<Impl::DummyControl&>(dummyControl2.GetImplementation());
+    dummyImpl2.RegisterVisual(DummyControl::Property::TEST_VISUAL, visual2);
+    DevelActor::SetResizePolicy(dummyControl2, ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    application.GetScene().Add(dummyControl2);
+
+    application.SendNotification();
+    application.Render();
+
+    for(int frame = 0; frame < 4; ++frame)
+    {
+      Test::EmitGlobalTimerSignal();
+      application.SendNotification();
+      application.Render(20);
+    }
+    DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, 0), false, TEST_LOCATION);
+    DALI_TEST_EQUALS(gl.GetLastGenTextureId(), lastGenTextureId, TEST_LOCATION);
+
+    dummyControl.Unparent();
+    dummyControl2.Unparent();
+  }
+  Dali::Toolkit::TextureManager::SetAnimatedImageFrameBudget(0u);
+
+  tet_infoline("Test that removing the visuals from stage deletes all textures");
+  application.RunIdles();
+  application.SendNotification();
+  application.Render(20);
+  application.RunIdles();
+  application.SendNotification();
+  application.Render(20);
+  DALI_TEST_EQUALS(gl.GetNumGeneratedTextures(), 0, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliAnimatedImageVisualAnimatedImageWithAlphaMask01(void)
 {
   ToolkitTestApplication application;
@@ -2892,3 +2892,45 @@ int UtcDaliControlAccessibilityStateApi(void)
 
   END_TEST;
 }
+
+int UtcDaliControlLoadingPriority(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Check that the loading priority is applied to the control and its descendants");
+
+  Control parent = Control::New();
+  Actor   actor  = Actor::New();
+  Control child  = Control::New();
+  actor.Add(child);
+  parent.Add(actor);
+  application.GetScene().Add(parent);
+
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(parent), DevelVisual::LoadingPriority::DEFAULT, TEST_LOCATION);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(child), DevelVisual::LoadingPriority::DEFAULT, TEST_LOCATION);
+
+  DevelControl::SetLoadingPriority(parent, DevelVisual::LoadingPriority::OFF_SCREEN);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(parent), DevelVisual::LoadingPriority::OFF_SCREEN, TEST_LOCATION);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(child), DevelVisual::LoadingPriority::OFF_SCREEN, TEST_LOCATION);
+
+  // A visual registered later still loads, with the priority of its control
+  Property::Map map;
+  map[Visual::Property::TYPE]     = Visual::IMAGE;
+  map[ImageVisual::Property::URL] = TEST_IMAGE_FILE_NAME;
+  child.SetProperty(Control::Property::BACKGROUND, map);
+
+  DevelControl::SetLoadingPriority(child, DevelVisual::LoadingPriority::VISIBLE);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(parent), DevelVisual::LoadingPriority::OFF_SCREEN, TEST_LOCATION);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(child), DevelVisual::LoadingPriority::VISIBLE, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(child.IsResourceReady(), true, TEST_LOCATION);
+
+  END_TEST;
+}
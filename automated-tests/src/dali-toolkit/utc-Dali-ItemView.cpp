@@ -23,6 +23,7 @@
 // test harness headers before dali headers.
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali/integration-api/events/touch-event-integ.h>
 #include <dali/integration-api/events/wheel-event-integ.h>
 
@@ -1368,3 +1369,45 @@ int UtcDaliItemViewWheelEvent(void)
 
   END_TEST;
 }
+
+int UtcDaliItemViewLoadingPriority(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Check that the items on screen are loaded before the reserved items");
+
+  // Create the ItemView actor
+  TestItemFactory factory;
+  ItemView        view = ItemView::New(factory);
+  application.GetScene().Add(view);
+
+  ItemLayoutPtr gridLayout = DefaultItemLayout::New(DefaultItemLayout::GRID);
+  view.AddLayout(*gridLayout);
+
+  // Activate the grid layout so that only the visible items will be created
+  Vector3 stageSize(application.GetScene().GetSize());
+  view.ActivateLayout(0, stageSize, 0.0f);
+
+  ItemRange visibleRange(0, 0);
+  view.GetItemsRange(visibleRange);
+  DALI_TEST_CHECK(visibleRange.Within(0));
+
+  Control firstItem = Control::DownCast(view.GetItem(0));
+  DALI_TEST_CHECK(firstItem);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(firstItem), DevelVisual::LoadingPriority::VISIBLE, TEST_LOCATION);
+
+  // Refresh reserves extra items around the visible ones
+  view.Refresh();
+
+  ItemRange reservedRange(0, 0);
+  view.GetItemsRange(reservedRange);
+  DALI_TEST_CHECK(reservedRange.Within(visibleRange.end));
+
+  firstItem = Control::DownCast(view.GetItem(0));
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(firstItem), DevelVisual::LoadingPriority::VISIBLE, TEST_LOCATION);
+
+  Control reservedItem = Control::DownCast(view.GetItem(visibleRange.end));
+  DALI_TEST_CHECK(reservedItem);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(reservedItem), DevelVisual::LoadingPriority::OFF_SCREEN, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -19,7 +19,11 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/builder/json-parser.h>
 #include <stdlib.h>
+#include <algorithm>
+#include <cctype>
 #include <iostream>
+#include <sstream>
+#include <vector>
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -97,6 +101,29 @@ void CompareTrees(const TreeNode& a, const TreeNode& b)
   }
 }
 
+/**
+ * A styles object with the given number of styles, named "style0" to "styleN"
+ */
+std::string CreateStyles(int numberOfStyles, int firstStyle = 0)
+{
+  std::ostringstream stream;
+  stream << "{\"styles\":{";
+  for(int i = firstStyle; i < firstStyle + numberOfStyles; ++i)
+  {
+    stream << (i > firstStyle ? "," : "") << "\"Style" << i << "\":{\"value\":" << i << "}";
+  }
+  stream << "}}";
+  return stream.str();
+}
+
+bool IsSameIgnoringCase(const std::string& a, const std::string& b)
+{
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y)
+  {
+    return std::tolower(x) == std::tolower(y);
+  });
+}
+
 } // namespace
 
 int UtcDaliJsonParserMethod01(void)
@@ -822,3 +849,86 @@ int UtcDaliJsonParserTreeNodeFind(void)
 
   END_TEST;
 }
+
+int UtcDaliJsonParserTreeNodeIndexedChild(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Child look-up in an object with many children");
+
+  JsonParser parser = JsonParser::New();
+  parser.Parse(CreateStyles(100));
+
+  const TreeNode* styles = parser.GetRoot()->GetChild("styles");
+  DALI_TEST_CHECK(styles);
+  DALI_TEST_EQUALS(styles->Size(), 100u, TEST_LOCATION);
+
+  for(int i = 0; i < 100; ++i)
+  {
+    const std::string name = "Style" + std::to_string(i);
+    const TreeNode*   node = styles->GetChild(name);
+    DALI_TEST_CHECK(node);
+    DALI_TEST_EQUALS(std::string(node->GetName()), name, TEST_LOCATION);
+    DALI_TEST_EQUALS(node->GetChild("value")->GetInteger(), i, TEST_LOCATION);
+
+    std::string lowerCaseName = "style" + std::to_string(i);
+    DALI_TEST_EQUALS(styles->GetChildIgnoreCase(lowerCaseName), node, TEST_LOCATION);
+    DALI_TEST_CHECK(!styles->GetChild(lowerCaseName));
+  }
+  DALI_TEST_CHECK(!styles->GetChild("Style100"));
+  DALI_TEST_CHECK(!styles->GetChildIgnoreCase("style100"));
+  DALI_TEST_CHECK(!styles->GetChild(""));
+
+  // Merging adds children, which are found as well
+  parser.Parse(CreateStyles(20, 90));
+  styles = parser.GetRoot()->GetChild("styles");
+  DALI_TEST_EQUALS(styles->Size(), 110u, TEST_LOCATION);
+  DALI_TEST_EQUALS(styles->GetChild("Style109")->GetChild("value")->GetInteger(), 109, TEST_LOCATION);
+  DALI_TEST_EQUALS(styles->GetChildIgnoreCase("STYLE95")->GetChild("value")->GetInteger(), 95, TEST_LOCATION);
+
+  // As well as in a copy of the tree
+  JsonParser copy = JsonParser::New(*parser.GetRoot());
+  DALI_TEST_EQUALS(copy.GetRoot()->GetChild("styles")->GetChild("Style42")->GetChild("value")->GetInteger(), 42, TEST_LOCATION);
+
+  // And after packing
+  parser.Pack();
+  DALI_TEST_EQUALS(std::string(parser.GetRoot()->GetChild("styles")->GetChild("Style7")->GetName()), "Style7", TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliJsonParserTreeNodeIndexedChildFirstMatch(void)
+{
+  ToolkitTestApplication application;
+
+  // Styles whose names only differ by case, after enough styles to be indexed
+  std::string json = CreateStyles(20);
+  json.insert(json.size() - 2u, ",\"STYLE3\":{\"value\":100},\"style3\":{\"value\":101}");
+
+  JsonParser parser = JsonParser::New();
+  parser.Parse(json);
+  DALI_TEST_CHECK(!parser.ParseError());
+  const TreeNode* styles = parser.GetRoot()->GetChild("styles");
+  DALI_TEST_EQUALS(styles->Size(), 22u, TEST_LOCATION);
+
+  // The look-up finds the same style as walking the siblings, as the themes did without the index
+  for(const std::string name : {"style3", "STYLE3", "Style3", "sTyLe19", "style20"})
+  {
+    const TreeNode* expected = NULL;
+    for(TreeNode::ConstIterator iter = styles->CBegin(); iter != styles->CEnd(); ++iter)
+    {
+      if(IsSameIgnoringCase((*iter).first, name))
+      {
+        expected = &(*iter).second;
+        break;
+      }
+    }
+    DALI_TEST_EQUALS(styles->GetChildIgnoreCase(name), expected, TEST_LOCATION);
+  }
+  DALI_TEST_EQUALS(styles->GetChildIgnoreCase("style3")->GetChild("value")->GetInteger(), 3, TEST_LOCATION);
+
+  // Exact look-ups still tell the names apart
+  DALI_TEST_EQUALS(styles->GetChild("STYLE3")->GetChild("value")->GetInteger(), 100, TEST_LOCATION);
+  DALI_TEST_EQUALS(styles->GetChild("style3")->GetChild("value")->GetInteger(), 101, TEST_LOCATION);
+
+  END_TEST;
+}
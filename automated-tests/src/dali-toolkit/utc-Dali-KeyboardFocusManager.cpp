@@ -25,6 +25,7 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
+#include <dali-toolkit/devel-api/focus-manager/focus-finder.h>
 #include <dali-toolkit/devel-api/focus-manager/keyboard-focus-manager-devel.h>
 #include <dali-toolkit/devel-api/focus-manager/keyinput-focus-manager.h>
 #include <dali/devel-api/actors/actor-devel.h>
@@ -296,6 +297,35 @@ struct CallbackFunctor
   }
 };
 
+// Moves the focus from each control in each direction, and checks it reaches the actor the traversal of FocusFinder chooses
+bool CheckFocusIndexNavigation(KeyboardFocusManager& manager, Actor rootActor, const std::vector<Control>& controls)
+{
+  const Control::KeyboardFocus::Direction directions[] = {Control::KeyboardFocus::LEFT, Control::KeyboardFocus::RIGHT, Control::KeyboardFocus::UP, Control::KeyboardFocus::DOWN};
+
+  bool matched = true;
+  for(auto& control : controls)
+  {
+    if(!control.GetProperty<bool>(Actor::Property::CONNECTED_TO_SCENE) || !control.GetProperty<bool>(Actor::Property::VISIBLE) ||
+       !control.GetProperty<bool>(Actor::Property::FOCUSABLE))
+    {
+      continue;
+    }
+    for(auto direction : directions)
+    {
+      manager.SetCurrentFocusActor(control);
+      Actor expected = FocusFinder::GetNearestFocusableActor(rootActor, control, direction);
+      manager.MoveFocus(direction);
+      Actor expectedFocus = expected ? expected : Actor(control);
+      if(manager.GetCurrentFocusActor() != expectedFocus)
+      {
+        tet_printf("Focus mismatch from %d in direction %d\n", control.GetProperty<int>(Actor::Property::ID), static_cast<int>(direction));
+        matched = false;
+      }
+    }
+  }
+  return matched;
+}
+
 } // namespace
 
 int UtcDaliKeyboardFocusManagerLastFocusChangeContext(void)
@@ -3295,3 +3325,104 @@ int UtcDaliKeyboardFocusManagerClearFocusWithCurrentActor(void)
 
   END_TEST;
 }
+
+int UtcDaliKeyboardFocusManagerFocusIndex(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline(" UtcDaliKeyboardFocusManagerFocusIndex - The focus index moves the focus as the traversal does");
+
+  KeyboardFocusManager manager = KeyboardFocusManager::Get();
+  DALI_TEST_CHECK(manager);
+
+  // Some controls are added before the index is enabled, the others after
+  std::vector<Control> controls;
+  for(int row = 0; row < 6; ++row)
+  {
+    for(int column = 0; column < 8; ++column)
+    {
+      Control control = Control::New();
+      control.SetProperty(Actor::Property::SIZE, Vector2(60.0f + (row * 7 + column * 3) % 40, 40.0f + (row * 5 + column * 11) % 30));
+      control.SetProperty(Actor::Property::POSITION, Vector2(column * 110.0f + (row % 3) * 17.0f, row * 90.0f + (column % 2) * 23.0f));
+      control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+      control.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+      control.SetProperty(Actor::Property::FOCUSABLE, true);
+      controls.push_back(control);
+      if(row < 3)
+      {
+        application.GetScene().Add(control);
+      }
+    }
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableDefaultAlgorithm(manager, true);
+  DALI_TEST_CHECK(!Dali::Toolkit::DevelKeyboardFocusManager::IsFocusIndexEnabled(manager));
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableFocusIndex(manager, true);
+  DALI_TEST_CHECK(Dali::Toolkit::DevelKeyboardFocusManager::IsFocusIndexEnabled(manager));
+
+  for(int i = 24; i < 48; ++i)
+  {
+    application.GetScene().Add(controls[i]);
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  Actor rootActor = application.GetScene().GetRootLayer();
+  DALI_TEST_CHECK(CheckFocusIndexNavigation(manager, rootActor, controls));
+
+  // Move some controls, directly and through their parent
+  controls[9].SetProperty(Actor::Property::POSITION, Vector2(700.0f, 500.0f));
+  controls[30].SetProperty(Actor::Property::POSITION, Vector2(5.0f, 5.0f));
+  Actor parent = Actor::New();
+  parent.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  parent.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  application.GetScene().Add(parent);
+  parent.Add(controls[20]);
+  parent.SetProperty(Actor::Property::POSITION, Vector2(300.0f, 260.0f));
+  controls[41].SetProperty(Actor::Property::SIZE, Vector2(400.0f, 20.0f));
+
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(CheckFocusIndexNavigation(manager, rootActor, controls));
+
+  // Remove, hide and disable some controls
+  controls[12].Unparent();
+  controls[13].SetProperty(Actor::Property::VISIBLE, false);
+  controls[27].SetProperty(Actor::Property::FOCUSABLE, false);
+  parent.SetProperty(Actor::Property::VISIBLE, false);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(CheckFocusIndexNavigation(manager, rootActor, controls));
+  for(auto actor : {controls[12], controls[13], controls[20], controls[27]})
+  {
+    manager.SetCurrentFocusActor(controls[11]);
+    manager.MoveFocus(Control::KeyboardFocus::RIGHT);
+    DALI_TEST_CHECK(manager.GetCurrentFocusActor() != actor);
+  }
+
+  // Make them focusable again
+  application.GetScene().Add(controls[12]);
+  controls[13].SetProperty(Actor::Property::VISIBLE, true);
+  controls[27].SetProperty(Actor::Property::FOCUSABLE, true);
+  parent.SetProperty(Actor::Property::VISIBLE, true);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(CheckFocusIndexNavigation(manager, rootActor, controls));
+
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableFocusIndex(manager, false);
+  DALI_TEST_CHECK(!Dali::Toolkit::DevelKeyboardFocusManager::IsFocusIndexEnabled(manager));
+  DALI_TEST_CHECK(CheckFocusIndexNavigation(manager, rootActor, controls));
+
+  END_TEST;
+}
@@ -16,6 +16,10 @@
  */
 
 #include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/devel-api/particle-system/particle-batch-modifier.h>
+#include <dali-toolkit/internal/particle-system/particle-list-impl.h>
+#include <dali-toolkit/internal/particle-system/particle-modifier-impl.h>
+#include <dali-toolkit/internal/particle-system/particle-renderer-impl.h>
 #include <dali-toolkit/public-api/particle-system/particle-domain.h>
 #include <dali-toolkit/public-api/particle-system/particle-emitter.h>
 #include <dali-toolkit/public-api/particle-system/particle-list.h>
@@ -25,8 +29,13 @@
 #include <dali-toolkit/public-api/particle-system/particle.h>
 
 #include <dlfcn.h>
+#include <toolkit-environment-variable.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <future>
+#include <vector>
 
 using namespace Dali;
 using namespace Dali::Toolkit::ParticleSystem;
@@ -280,6 +289,43 @@ ParticleEmitter CreateEmitter(EmitterGroup* output = nullptr)
 
   return emitter;
 }
+
+/**
+ * Fills the particle list of the emitter with particles at distinct positions
+ */
+void FillParticles(ParticleEmitter& emitter, uint32_t particleCount)
+{
+  auto& list = emitter.GetParticleList();
+  for(auto i = 0u; i < particleCount; ++i)
+  {
+    auto particle = list.NewParticle(1.0f);
+    DALI_TEST_CHECK(particle);
+    particle.Get<Vector3>(ParticleStream::POSITION_STREAM_BIT) = Vector3(float(i), 1.0f, 2.0f);
+  }
+}
+
+/**
+ * Creates an initialized renderer for the emitter, and the stream buffer it writes the particles to
+ */
+ParticleRenderer CreateStreamRenderer(ParticleEmitter& emitter, std::vector<uint8_t>& streamData, bool instancing)
+{
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_PARTICLE_SYSTEM_INSTANCING", instancing ? "1" : "0");
+
+  auto renderer = ParticleRenderer::New();
+  emitter.SetRenderer(renderer);
+
+  auto& rendererImpl = GetImplementation(renderer);
+  rendererImpl.Initialize();
+
+  auto& list = GetImplementation(emitter.GetParticleList());
+  streamData.resize(list.GetParticleCount() * list.GetStreamElementSize(false) * rendererImpl.GetNumberOfRecordsPerParticle());
+  return renderer;
+}
+
+uint32_t UpdateStreamBuffer(ParticleRenderer& renderer, std::vector<uint8_t>& streamData)
+{
+  return GetImplementation(renderer).OnStreamBufferUpdate(streamData.data(), streamData.size());
+}
 } // namespace
 
 int UtcDaliParticleSystemEmitterNew(void)
@@ -1073,4 +1119,291 @@ int UtcDaliParticleSystemReplaceEmitter(void)
   DALI_TEST_EQUALS(bool(emitter.GetObjectPtr() != oldEmitter), true, TEST_LOCATION);
 
   END_TEST;
-}
\ No newline at end of file
+}
+
+int UtcDaliParticleSystemReleaseParticles(void)
+{
+  ToolkitTestApplication application;
+
+  auto list = ParticleList::New(10, ParticleStream::DEFAULT_STREAMS);
+
+  std::vector<uint32_t> slots;
+  for(auto i = 0u; i < 10u; ++i)
+  {
+    slots.push_back(list.NewParticle(1.0f).GetIndex());
+  }
+
+  GetImplementation(list).ReleaseParticles({1u, 4u, 5u, 9u});
+  DALI_TEST_EQUALS(list.GetActiveParticleCount(), 6u, TEST_LOCATION);
+
+  // The remaining particles keep their order
+  const uint32_t remaining[] = {0u, 2u, 3u, 6u, 7u, 8u};
+  auto&          particles   = list.GetActiveParticles();
+  for(auto i = 0u; i < 6u; ++i)
+  {
+    DALI_TEST_EQUALS(particles[i].GetIndex(), slots[remaining[i]], TEST_LOCATION);
+  }
+
+  // The slots of the released particles are reused
+  std::vector<uint32_t> reused;
+  for(auto i = 0u; i < 4u; ++i)
+  {
+    auto particle = list.NewParticle(1.0f);
+    DALI_TEST_CHECK(particle);
+    reused.push_back(particle.GetIndex());
+  }
+  std::sort(reused.begin(), reused.end());
+  DALI_TEST_CHECK(reused == std::vector<uint32_t>({slots[1], slots[4], slots[5], slots[9]}));
+
+  // The list is full again
+  DALI_TEST_CHECK(!list.NewParticle(1.0f));
+
+  // Nothing to release
+  GetImplementation(list).ReleaseParticles({});
+  DALI_TEST_EQUALS(list.GetActiveParticleCount(), 10u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliParticleSystemStreamBufferInstancing(void)
+{
+  ToolkitTestApplication application;
+
+  auto emitter = CreateEmitter<TestSource, TestModifier>();
+  emitter.SetParticleCount(100);
+  FillParticles(emitter, 40);
+
+  const auto elementByte = GetImplementation(emitter.GetParticleList()).GetStreamElementSize(false);
+
+  std::vector<uint8_t> instancedData;
+  std::vector<uint8_t> duplicatedData;
+  auto                 instancedRenderer  = CreateStreamRenderer(emitter, instancedData, true);
+  auto                 duplicatedRenderer = CreateStreamRenderer(emitter, duplicatedData, false);
+  DALI_TEST_EQUALS(UpdateStreamBuffer(instancedRenderer, instancedData), 40u * elementByte, TEST_LOCATION);
+  DALI_TEST_EQUALS(UpdateStreamBuffer(duplicatedRenderer, duplicatedData), 40u * elementByte * 6u, TEST_LOCATION);
+
+  // The buffer sizes must match
+  std::vector<uint8_t> smallData(instancedData.size() / 2u);
+  DALI_TEST_EQUALS(UpdateStreamBuffer(instancedRenderer, smallData), 0u, TEST_LOCATION);
+
+  // One record per particle with instancing, the same record for each vertex otherwise
+  for(auto i = 0u; i < 40u; ++i)
+  {
+    for(auto vertex = 0u; vertex < 6u; ++vertex)
+    {
+      DALI_TEST_CHECK(!memcmp(instancedData.data() + i * elementByte, duplicatedData.data() + (i * 6u + vertex) * elementByte, elementByte));
+    }
+  }
+
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_PARTICLE_SYSTEM_INSTANCING", "1");
+
+  END_TEST;
+}
+
+int UtcDaliParticleSystemStreamBufferInstancingNotSupported(void)
+{
+  ToolkitTestApplication application;
+
+  // GLES 2.0 has no attribute divisor, so the stream data is duplicated per vertex even though instancing is enabled
+  auto originalShaderVersion = application.GetGlAbstraction().GetShaderLanguageVersion();
+  application.GetGlAbstraction().mShaderLanguageVersion = 100;
+
+  auto emitter = CreateEmitter<TestSource, TestModifier>();
+  emitter.SetParticleCount(100);
+  FillParticles(emitter, 40);
+
+  const auto elementByte = GetImplementation(emitter.GetParticleList()).GetStreamElementSize(false);
+
+  std::vector<uint8_t> streamData;
+  auto                 renderer = CreateStreamRenderer(emitter, streamData, true);
+  DALI_TEST_EQUALS(GetImplementation(renderer).GetNumberOfRecordsPerParticle(), 6u, TEST_LOCATION);
+  DALI_TEST_EQUALS(UpdateStreamBuffer(renderer, streamData), 40u * elementByte * 6u, TEST_LOCATION);
+
+  application.GetGlAbstraction().mShaderLanguageVersion = originalShaderVersion;
+
+  END_TEST;
+}
+
+int UtcDaliParticleSystemReleaseParticlesInOnePass(void)
+{
+  ToolkitTestApplication application;
+
+  const uint32_t particleCount = 1000u;
+
+  auto emitter = CreateEmitter<TestSource, TestModifier>();
+  emitter.SetParticleCount(particleCount);
+  FillParticles(emitter, particleCount);
+
+  // Release every other particle
+  std::vector<uint32_t> eraseIndices;
+  for(auto i = 0u; i < particleCount; i += 2u)
+  {
+    eraseIndices.push_back(i);
+  }
+  auto& list = GetImplementation(emitter.GetParticleList());
+  list.ReleaseParticles(eraseIndices);
+  DALI_TEST_EQUALS(list.GetActiveParticleCount(), particleCount / 2u, TEST_LOCATION);
+
+  // The remaining particles keep their order
+  auto& particles = list.GetParticles();
+  auto  i         = 0u;
+  for(auto& particle : particles)
+  {
+    DALI_TEST_EQUALS(particle.Get<Vector3>(ParticleStream::POSITION_STREAM_BIT).x, float(i * 2u + 1u), TEST_LOCATION);
+    ++i;
+  }
+  DALI_TEST_EQUALS(i, particleCount / 2u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliParticleSystemBatchModifiers(void)
+{
+  ToolkitTestApplication application;
+
+  auto list = ParticleList::New(8, ParticleStream::DEFAULT_STREAMS);
+  for(auto i = 0u; i < 8u; ++i)
+  {
+    auto particle = list.NewParticle(2.0f);
+    particle.Get<Vector3>(ParticleStream::VELOCITY_STREAM_BIT) = Vector3(1.0f, 0.0f, 0.0f);
+    particle.Get<float>(ParticleStream::LIFETIME_STREAM_BIT)   = 1.0f;
+  }
+
+  auto batch = GetImplementation(list).GetBatch(0u, 8u, 0.5f);
+  DALI_TEST_EQUALS(batch.count, 8u, TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.isContiguous, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.firstSlot, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.deltaSeconds, 0.5f, TEST_LOCATION);
+
+  auto gravity = ParticleModifier::New<GravityModifier>(Vector3(0.0f, -10.0f, 0.0f));
+  auto drag    = ParticleModifier::New<DragModifier>(1.0f);
+  auto color   = ParticleModifier::New<ColorOverLifeModifier>(Color::WHITE, Vector4::ZERO);
+  auto scale   = ParticleModifier::New<ScaleOverLifeModifier>(Vector3::ONE, Vector3(3.0f, 3.0f, 3.0f));
+  DALI_TEST_EQUALS(gravity.GetModifierCallback().IsMultiThreaded(), true, TEST_LOCATION);
+
+  for(auto* modifier : {&gravity, &drag, &color, &scale})
+  {
+    GetImplementation(*modifier).Update(list, 0u, 8u, 0.5f);
+  }
+
+  // Half way through their life
+  for(auto& particle : list.GetActiveParticles())
+  {
+    DALI_TEST_EQUALS(particle.Get<Vector3>(ParticleStream::VELOCITY_STREAM_BIT), Vector3(0.5f, -2.5f, 0.0f), TEST_LOCATION);
+    DALI_TEST_EQUALS(particle.Get<Vector4>(ParticleStream::COLOR_STREAM_BIT), Vector4(0.5f, 0.5f, 0.5f, 0.5f), TEST_LOCATION);
+    DALI_TEST_EQUALS(particle.Get<Vector3>(ParticleStream::SCALE_STREAM_BIT), Vector3(2.0f, 2.0f, 2.0f), TEST_LOCATION);
+  }
+
+  // Without any elapsed time, the velocity doesn't change
+  gravity.GetModifierCallback().Update(list, 0u, 8u);
+  DALI_TEST_EQUALS(list.GetActiveParticles()[0].Get<Vector3>(ParticleStream::VELOCITY_STREAM_BIT), Vector3(0.5f, -2.5f, 0.0f), TEST_LOCATION);
+
+  // The slots of the remaining particles have gaps
+  GetImplementation(list).ReleaseParticles({1u, 3u});
+  batch = GetImplementation(list).GetBatch(0u, 8u, 0.5f);
+  DALI_TEST_EQUALS(batch.count, 6u, TEST_LOCATION);
+  DALI_TEST_EQUALS(batch.isContiguous, false, TEST_LOCATION);
+
+  GetImplementation(gravity).Update(list, 0u, 6u, 0.1f);
+  GetImplementation(drag).Update(list, 0u, 6u, 0.5f);
+  for(auto& particle : list.GetActiveParticles())
+  {
+    DALI_TEST_EQUALS(particle.Get<Vector3>(ParticleStream::VELOCITY_STREAM_BIT), Vector3(0.25f, -1.75f, 0.0f), TEST_LOCATION);
+  }
+
+  // A range past the end is empty
+  batch = GetImplementation(list).GetBatch(6u, 2u, 0.5f);
+  DALI_TEST_EQUALS(batch.count, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliParticleSystemVelocityIntegratorModifier(void)
+{
+  ToolkitTestApplication application;
+
+  Actor actor = Actor::New();
+  application.GetScene().Add(actor);
+
+  auto emitter = CreateEmitter<TestSource, TestModifier>();
+  emitter.AddModifier(ParticleModifier::New<GravityModifier>(Vector3(0.0f, -10.0f, 0.0f)));
+  emitter.AddModifier(ParticleModifier::New<VelocityIntegratorModifier>());
+  emitter.SetInitialParticleCount(10);
+  emitter.SetActiveParticlesLimit(100);
+  emitter.AttachTo(actor);
+  emitter.Start();
+
+  auto& sourceCallback = dynamic_cast<TestSource&>(emitter.GetSource().GetSourceCallback());
+
+  sourceCallback.NewFrame();
+  application.SendNotification();
+  application.Render();
+
+  auto& list = emitter.GetParticleList();
+  DALI_TEST_CHECK(list.GetActiveParticleCount() > 0u);
+
+  // The oldest particle is accelerated downwards, so it falls further on every frame
+  float previousY    = list.GetActiveParticles()[0].Get<Vector3>(ParticleStream::POSITION_STREAM_BIT).y;
+  float previousStep = 0.0f;
+  for(auto frame = 0u; frame < 3u; ++frame)
+  {
+    AdvanceTimeByMs(100);
+
+    sourceCallback.NewFrame();
+    application.SendNotification();
+    application.Render();
+
+    const float y    = list.GetActiveParticles()[0].Get<Vector3>(ParticleStream::POSITION_STREAM_BIT).y;
+    const float step = previousY - y;
+    DALI_TEST_CHECK(step > previousStep);
+    previousY    = y;
+    previousStep = step;
+  }
+
+  // Without a velocity stream the positions are left alone
+  auto staticList = ParticleList::New(4, ParticleStream::POSITION_STREAM_BIT);
+  auto particle   = staticList.NewParticle(1.0f);
+  auto integrator = ParticleModifier::New<VelocityIntegratorModifier>();
+
+  particle.Get<Vector3>(ParticleStream::POSITION_STREAM_BIT) = Vector3(1.0f, 2.0f, 3.0f);
+  GetImplementation(integrator).Update(staticList, 0u, 1u, 0.5f);
+  DALI_TEST_EQUALS(staticList.GetActiveParticles()[0].Get<Vector3>(ParticleStream::POSITION_STREAM_BIT), Vector3(1.0f, 2.0f, 3.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliParticleSystemBatchModifierMT(void)
+{
+  ToolkitTestApplication application;
+
+  Actor actor = Actor::New();
+  application.GetScene().Add(actor);
+
+  auto emitter = CreateEmitter<TestSource, TestModifier>();
+  emitter.AddModifier(ParticleModifier::New<GravityModifier>(Vector3(0.0f, -10.0f, 0.0f)));
+  emitter.SetInitialParticleCount(1000);
+  emitter.SetActiveParticlesLimit(5000);
+  emitter.EnableParallelProcessing(true);
+  emitter.AttachTo(actor);
+  emitter.Start();
+
+  auto& sourceCallback = dynamic_cast<TestSource&>(emitter.GetSource().GetSourceCallback());
+
+  sourceCallback.NewFrame();
+  application.SendNotification();
+  application.Render();
+
+  AdvanceTimeByMs(100);
+
+  sourceCallback.NewFrame();
+  application.SendNotification();
+  application.Render();
+
+  // Every particle is accelerated, whichever worker thread updated it
+  for(auto& particle : emitter.GetParticleList().GetActiveParticles())
+  {
+    DALI_TEST_CHECK(particle.Get<Vector3>(ParticleStream::VELOCITY_STREAM_BIT).y < 0.0f);
+  }
+
+  END_TEST;
+}
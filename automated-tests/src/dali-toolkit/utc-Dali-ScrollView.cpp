@@ -17,6 +17,7 @@
 
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali/devel-api/actors/actor-devel.h>
 #include <dali/devel-api/object/type-registry.h>
 #include <dali/integration-api/events/touch-event-integ.h>
@@ -3104,3 +3105,55 @@ int UtcDaliToolkitScrollViewWheelEvent(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitScrollViewLoadingPriority(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Check that the children within the viewport are loaded before the others");
+
+  ScrollView scrollView = ScrollView::New();
+  application.GetScene().Add(scrollView);
+  Vector2 stageSize = application.GetScene().GetSize();
+  scrollView.SetProperty(Actor::Property::SIZE, stageSize);
+  scrollView.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  scrollView.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+
+  RulerPtr rulerX = new DefaultRuler();
+  RulerPtr rulerY = new DefaultRuler();
+  rulerX->SetDomain(RulerDomain(0.0f, stageSize.width, true));
+  rulerY->SetDomain(RulerDomain(0.0f, stageSize.height * 3.0f, true));
+  scrollView.SetRulerX(rulerX);
+  scrollView.SetRulerY(rulerY);
+
+  // One control at the top of the content, and one two pages below it
+  Control top = Control::New();
+  top.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  top.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  top.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+  scrollView.Add(top);
+
+  Control bottom = Control::New();
+  bottom.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  bottom.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  bottom.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+  bottom.SetProperty(Actor::Property::POSITION, Vector2(0.0f, stageSize.height * 2.0f));
+  scrollView.Add(bottom);
+
+  Wait(application);
+
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(top), DevelVisual::LoadingPriority::VISIBLE, TEST_LOCATION);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(bottom), DevelVisual::LoadingPriority::OFF_SCREEN, TEST_LOCATION);
+
+  // The hints follow the target of the scroll, before the animation ends
+  scrollView.ScrollTo(Vector2(0.0f, stageSize.height * 2.0f));
+
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(top), DevelVisual::LoadingPriority::OFF_SCREEN, TEST_LOCATION);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(bottom), DevelVisual::LoadingPriority::VISIBLE, TEST_LOCATION);
+
+  Wait(application, RENDER_DELAY_SCROLL);
+
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(top), DevelVisual::LoadingPriority::OFF_SCREEN, TEST_LOCATION);
+  DALI_TEST_EQUALS(DevelControl::GetLoadingPriority(bottom), DevelVisual::LoadingPriority::VISIBLE, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -3570,3 +3570,128 @@ int UtcDaliToolkitTextLabelAsyncRenderAutoScrollTimingIssue(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitTextLabelAsyncRenderTextFitMultiLine(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitTextLabelAsyncRenderTextFitMultiLine");
+
+  // Avoid a crash when core load gl resources.
+  application.GetGlAbstraction().SetCheckFramebufferStatusResult(GL_FRAMEBUFFER_COMPLETE);
+
+  // Set the dpi of AsyncTextLoader and FontClient to be identical.
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi(0u, 0u);
+
+  const std::string text("Hello world, the text fit search lays this text out at many point sizes");
+  const float       labelWidth  = 200.0f;
+  const float       labelHeight = 120.0f;
+
+  TextLabel label = TextLabel::New();
+  DALI_TEST_CHECK(label);
+
+  label.SetProperty(DevelTextLabel::Property::RENDER_MODE, DevelTextLabel::Render::ASYNC_AUTO);
+  label.SetProperty(TextLabel::Property::TEXT, text);
+  label.SetProperty(Actor::Property::SIZE, Vector2(labelWidth, labelHeight));
+  label.SetProperty(TextLabel::Property::MULTI_LINE, true);
+
+  Property::Map textFitMapSet;
+  textFitMapSet["enable"]       = true;
+  textFitMapSet["minSize"]      = 5.f;
+  textFitMapSet["maxSize"]      = 60.f;
+  textFitMapSet["stepSize"]     = 1.f;
+  textFitMapSet["fontSizeType"] = "pointSize";
+  label.SetProperty(Toolkit::DevelTextLabel::Property::TEXT_FIT, textFitMapSet);
+
+  application.GetScene().Add(label);
+
+  std::unique_ptr<ConnectionTracker> testRenderTracker = std::make_unique<ConnectionTracker>();
+  bool                               asyncTextRendered = false;
+  label.ConnectSignal(testRenderTracker.get(), "asyncTextRendered", CallbackFunctor(&asyncTextRendered));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, ASYNC_TEXT_THREAD_TIMEOUT), true, TEST_LOCATION);
+  DALI_TEST_CHECK(asyncTextRendered);
+
+  // The glyphs are scaled during the search, but the chosen size is validated with the shaped text.
+  // It must be the size found by the synchronous label, which shapes the text at each size of the search.
+  TextLabel syncLabel = TextLabel::New();
+  syncLabel.SetProperty(DevelTextLabel::Property::RENDER_MODE, DevelTextLabel::Render::SYNC);
+  syncLabel.SetProperty(TextLabel::Property::TEXT, text);
+  syncLabel.SetProperty(Actor::Property::SIZE, Vector2(labelWidth, labelHeight));
+  syncLabel.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  syncLabel.SetProperty(Toolkit::DevelTextLabel::Property::TEXT_FIT, textFitMapSet);
+  application.GetScene().Add(syncLabel);
+
+  application.SendNotification();
+  application.Render();
+
+  float textFitFontSize = (label.GetProperty(Dali::Toolkit::DevelTextLabel::Property::TEXT_FIT).Get<Property::Map>())["fontSize"].Get<float>();
+  float expectedSize    = (syncLabel.GetProperty(Dali::Toolkit::DevelTextLabel::Property::TEXT_FIT).Get<Property::Map>())["fontSize"].Get<float>();
+  DALI_TEST_EQUALS(textFitFontSize, expectedSize, TEST_LOCATION);
+
+  TextLabel sizeLabel = TextLabel::New();
+  sizeLabel.SetProperty(DevelTextLabel::Property::RENDER_MODE, DevelTextLabel::Render::SYNC);
+  sizeLabel.SetProperty(TextLabel::Property::TEXT, text);
+  sizeLabel.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  sizeLabel.SetProperty(TextLabel::Property::POINT_SIZE, textFitFontSize);
+  DALI_TEST_CHECK(sizeLabel.GetHeightForWidth(labelWidth) <= labelHeight);
+
+  // A font size in the markup doesn't follow the point size, so the text is shaped at each size of the search.
+  label.SetProperty(TextLabel::Property::ENABLE_MARKUP, true);
+  label.SetProperty(TextLabel::Property::TEXT, "Hello <font size='10'>world</font>, the text fit search lays this text out at many point sizes");
+
+  asyncTextRendered = false;
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, ASYNC_TEXT_THREAD_TIMEOUT), true, TEST_LOCATION);
+  DALI_TEST_CHECK(asyncTextRendered);
+
+  syncLabel.SetProperty(TextLabel::Property::ENABLE_MARKUP, true);
+  syncLabel.SetProperty(TextLabel::Property::TEXT, "Hello <font size='10'>world</font>, the text fit search lays this text out at many point sizes");
+
+  application.SendNotification();
+  application.Render();
+
+  textFitFontSize = (label.GetProperty(Dali::Toolkit::DevelTextLabel::Property::TEXT_FIT).Get<Property::Map>())["fontSize"].Get<float>();
+  expectedSize    = (syncLabel.GetProperty(Dali::Toolkit::DevelTextLabel::Property::TEXT_FIT).Get<Property::Map>())["fontSize"].Get<float>();
+  DALI_TEST_EQUALS(textFitFontSize, expectedSize, TEST_LOCATION);
+
+  // The fit options are searched with the scaled glyphs too, and the chosen option is validated the same way.
+  std::vector<DevelTextLabel::FitOption> fitOptions;
+  for(float pointSize = 5.f; pointSize <= 60.f; pointSize += 1.f)
+  {
+    fitOptions.push_back(DevelTextLabel::FitOption(pointSize, 0.f));
+  }
+
+  Property::Map textFitDisabled;
+  textFitDisabled["enable"] = false;
+  for(TextLabel fitLabel : {label, syncLabel})
+  {
+    fitLabel.SetProperty(TextLabel::Property::ENABLE_MARKUP, false);
+    fitLabel.SetProperty(TextLabel::Property::TEXT, text);
+    fitLabel.SetProperty(Toolkit::DevelTextLabel::Property::TEXT_FIT, textFitDisabled);
+    DevelTextLabel::SetTextFitArray(fitLabel, true, fitOptions);
+  }
+
+  asyncTextRendered = false;
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, ASYNC_TEXT_THREAD_TIMEOUT), true, TEST_LOCATION);
+  DALI_TEST_CHECK(asyncTextRendered);
+
+  application.SendNotification();
+  application.Render();
+
+  textFitFontSize = (label.GetProperty(Dali::Toolkit::DevelTextLabel::Property::TEXT_FIT).Get<Property::Map>())["fontSize"].Get<float>();
+  expectedSize    = (syncLabel.GetProperty(Dali::Toolkit::DevelTextLabel::Property::TEXT_FIT).Get<Property::Map>())["fontSize"].Get<float>();
+  DALI_TEST_EQUALS(textFitFontSize, expectedSize, TEST_LOCATION);
+
+  END_TEST;
+}
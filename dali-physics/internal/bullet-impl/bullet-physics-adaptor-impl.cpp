@@ -56,6 +56,12 @@ BulletPhysicsAdaptor::BulletPhysicsAdaptor()
 
 BulletPhysicsAdaptor::~BulletPhysicsAdaptor()
 {
+  // Stop the worker thread before it can call back into a partially destroyed adaptor
+  if(mPhysicsWorld)
+  {
+    mPhysicsWorld->SetThreadingMode(Physics::PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+  }
+
   // @todo Ensure physics bodies don't leak
 }
 
@@ -51,6 +51,9 @@ void BulletPhysicsWorld::OnInitialize(/*void* dynamicsWorld*/)
 
 BulletPhysicsWorld::~BulletPhysicsWorld()
 {
+  // Ensure the worker thread can't integrate whilst the world is torn down
+  StopWorkerThread();
+
   Lock();
 
   if(mDynamicsWorld)
@@ -53,6 +53,12 @@ ChipmunkPhysicsAdaptor::ChipmunkPhysicsAdaptor()
 
 ChipmunkPhysicsAdaptor::~ChipmunkPhysicsAdaptor()
 {
+  // Stop the worker thread before it can call back into a partially destroyed adaptor
+  if(mPhysicsWorld)
+  {
+    mPhysicsWorld->SetThreadingMode(Physics::PhysicsAdaptor::ThreadingMode::UPDATE_THREAD);
+  }
+
   // @todo Ensure physics bodies don't leak
 }
 
@@ -81,6 +81,9 @@ void ChipmunkPhysicsWorld::OnInitialize(/*void* dynamicsWorld*/)
 
 ChipmunkPhysicsWorld::~ChipmunkPhysicsWorld()
 {
+  // Ensure the worker thread can't integrate whilst the world is torn down
+  StopWorkerThread();
+
   Lock();
   if(mSpace)
   {
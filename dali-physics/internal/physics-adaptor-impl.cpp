@@ -31,6 +31,9 @@ namespace
 Debug::Filter* gLogFilter = Debug::Filter::New(Debug::Concise, false, "LOG_PHYSICS");
 #endif
 
+constexpr uint32_t SNAPSHOT_INDEX_MASK{3u}; ///< Bits of the shared snapshot holding its index
+constexpr uint32_t SNAPSHOT_PUBLISHED{4u};  ///< Set on the shared snapshot when the worker thread has published it
+
 } // namespace
 
 namespace Dali::Toolkit::Physics::Internal
@@ -58,6 +61,8 @@ void PhysicsAdaptor::Initialize(const Dali::Matrix& transform, Uint16Pair worldS
 
   // Initialize derived adaptor (and world)
   OnInitialize(transform, worldSize);
+
+  mPhysicsWorld->SetStepCallback(Dali::MakeCallback(mSlotDelegate.GetSlot(), &PhysicsAdaptor::OnIntegrated));
 }
 
 void PhysicsAdaptor::SetTimestep(float timestep)
@@ -95,6 +100,16 @@ Physics::PhysicsAdaptor::DebugState PhysicsAdaptor::GetDebugState() const
   return mPhysicsWorld->GetDebugState();
 }
 
+void PhysicsAdaptor::SetThreadingMode(Physics::PhysicsAdaptor::ThreadingMode mode)
+{
+  mPhysicsWorld->SetThreadingMode(mode);
+}
+
+Physics::PhysicsAdaptor::ThreadingMode PhysicsAdaptor::GetThreadingMode() const
+{
+  return mPhysicsWorld->GetThreadingMode();
+}
+
 Dali::Actor PhysicsAdaptor::GetRootActor() const
 {
   return mRootActor;
@@ -102,6 +117,26 @@ Dali::Actor PhysicsAdaptor::GetRootActor() const
 
 void PhysicsAdaptor::OnUpdateActors(Dali::UpdateProxy* updateProxy)
 {
+  if(mPhysicsWorld->GetThreadingMode() == Physics::PhysicsAdaptor::ThreadingMode::WORKER_THREAD)
+  {
+    // The physics world is not locked; only use the latest snapshot published by the worker thread
+    if(mSharedSnapshot.load(std::memory_order_relaxed) & SNAPSHOT_PUBLISHED)
+    {
+      mReadSnapshot = mSharedSnapshot.exchange(mReadSnapshot, std::memory_order_acq_rel) & SNAPSHOT_INDEX_MASK;
+    }
+
+    const TransformSnapshot& snapshot = mSnapshots[mReadSnapshot];
+    for(auto&& entry : snapshot.transforms)
+    {
+      const ActorTransform& transform = entry.second;
+      Vector3 position = transform.previousPosition + (transform.currentPosition - transform.previousPosition) * snapshot.interpolationFactor;
+      updateProxy->BakePosition(entry.first, position);
+      Quaternion rotation = Quaternion::Slerp(transform.previousRotation, transform.currentRotation, snapshot.interpolationFactor);
+      updateProxy->BakeOrientation(entry.first, rotation);
+    }
+    return;
+  }
+
   for(auto&& actor : mPhysicsActors)
   {
     // Get position, orientation from physics world.
@@ -112,11 +147,72 @@ void PhysicsAdaptor::OnUpdateActors(Dali::UpdateProxy* updateProxy)
   }
 }
 
+void PhysicsAdaptor::OnIntegrated(uint32_t stepCount)
+{
+  if(stepCount > 0u)
+  {
+    UpdateActorTransforms();
+  }
+
+  // Publish a copy of the transforms; the update thread picks up the latest one on its next frame
+  TransformSnapshot& snapshot  = mSnapshots[mWriteSnapshot];
+  snapshot.transforms          = mActorTransforms;
+  snapshot.interpolationFactor = mPhysicsWorld->GetInterpolationFactor();
+  mWriteSnapshot               = mSharedSnapshot.exchange(mWriteSnapshot | SNAPSHOT_PUBLISHED, std::memory_order_acq_rel) & SNAPSHOT_INDEX_MASK;
+}
+
+void PhysicsAdaptor::UpdateActorTransforms()
+{
+  for(auto&& actor : mPhysicsActors)
+  {
+    Vector3    position = actor.second->GetActorPosition();
+    Quaternion rotation = actor.second->GetActorRotation();
+
+    auto iter = mActorTransforms.find(actor.first);
+    if(iter == mActorTransforms.end())
+    {
+      mActorTransforms.insert(std::make_pair(actor.first, ActorTransform{position, position, rotation, rotation}));
+    }
+    else
+    {
+      ActorTransform& transform  = iter->second;
+      transform.previousPosition = transform.currentPosition;
+      transform.previousRotation = transform.currentRotation;
+      transform.currentPosition  = position;
+      transform.currentRotation  = rotation;
+    }
+  }
+
+  // Remove transforms of actors that have since been removed
+  if(mActorTransforms.size() != mPhysicsActors.size())
+  {
+    for(auto iter = mActorTransforms.begin(); iter != mActorTransforms.end();)
+    {
+      iter = (mPhysicsActors.find(iter->first) == mPhysicsActors.end()) ? mActorTransforms.erase(iter) : std::next(iter);
+    }
+  }
+}
+
 void PhysicsAdaptor::Queue(UniquePtr<CallbackBase> callback)
 {
   mPhysicsWorld->Queue(Move(callback));
 }
 
+void PhysicsAdaptor::QueueBatch(std::vector<UniquePtr<CallbackBase>>&& callbacks)
+{
+  mPhysicsWorld->QueueBatch(std::move(callbacks));
+}
+
+Physics::PhysicsAdaptor::QueueMetrics PhysicsAdaptor::GetQueueMetrics() const
+{
+  return mPhysicsWorld->GetQueueMetrics();
+}
+
+void PhysicsAdaptor::ResetQueueMetrics()
+{
+  mPhysicsWorld->ResetQueueMetrics();
+}
+
 void PhysicsAdaptor::CreateSyncPoint()
 {
   mPhysicsWorld->CreateSyncPoint();
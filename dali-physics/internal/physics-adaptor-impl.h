@@ -21,6 +21,7 @@
 #include <dali/public-api/common/unique-ptr.h>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/signals/callback.h>
+#include <atomic>
 #include <unordered_map>
 
 // INTERNAL INCLUDES
@@ -135,6 +136,16 @@ public:
    */
   Physics::PhysicsAdaptor::DebugState GetDebugState() const;
 
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::SetThreadingMode
+   */
+  void SetThreadingMode(Physics::PhysicsAdaptor::ThreadingMode mode);
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::GetThreadingMode
+   */
+  Physics::PhysicsAdaptor::ThreadingMode GetThreadingMode() const;
+
   /**
    * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::AddActorBody
    */
@@ -170,6 +181,21 @@ public:
    */
   void Queue(UniquePtr<CallbackBase> callback);
 
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::QueueBatch
+   */
+  void QueueBatch(std::vector<UniquePtr<CallbackBase>>&& callbacks);
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::GetQueueMetrics
+   */
+  Physics::PhysicsAdaptor::QueueMetrics GetQueueMetrics() const;
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::ResetQueueMetrics
+   */
+  void ResetQueueMetrics();
+
   /**
    * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::Queue
    */
@@ -180,16 +206,58 @@ public:
    */
   void OnUpdateActors(Dali::UpdateProxy* updateProxy);
 
+  /**
+   * Snapshot the transforms of all of the known bound actors after the worker
+   * thread has integrated, and publish the snapshot to the update thread.
+   * Called with the physics world locked.
+   * @param[in] stepCount The number of integration steps just run
+   */
+  void OnIntegrated(uint32_t stepCount);
+
+  /**
+   * Move the current transforms of the known bound actors to the previous ones, and
+   * read the new current ones from the physics world. Only used by the worker thread.
+   */
+  void UpdateActorTransforms();
+
   /**
    * Retrieves a reference to the physics world pointer
    */
   UniquePtr<PhysicsWorld>& GetPhysicsWorld();
 
 protected:
+  /**
+   * Double buffered actor transform, used for interpolation in WORKER_THREAD mode
+   */
+  struct ActorTransform
+  {
+    Vector3    previousPosition;
+    Vector3    currentPosition;
+    Quaternion previousRotation;
+    Quaternion currentRotation;
+  };
+
+  /**
+   * The actor transforms and interpolation factor after a worker thread step, as read by the update thread
+   */
+  struct TransformSnapshot
+  {
+    std::unordered_map<uint32_t, ActorTransform> transforms;
+    float                                        interpolationFactor{1.0f};
+  };
+
   UniquePtr<PhysicsWorld>                       mPhysicsWorld;
   std::unordered_map<uint32_t, PhysicsActorPtr> mPhysicsActors;
   Actor                                         mRootActor;
 
+  // The snapshots are handed over without a lock: the worker thread writes one, the update thread
+  // reads another, and the third is swapped between them, so neither thread waits for the other.
+  std::unordered_map<uint32_t, ActorTransform> mActorTransforms; ///< Latest transforms, only used by the worker thread
+  TransformSnapshot                            mSnapshots[3];
+  uint32_t                                     mWriteSnapshot{0u};  ///< Index of the snapshot being written, only used by the worker thread
+  uint32_t                                     mReadSnapshot{1u};   ///< Index of the snapshot being read, only used by the update thread
+  std::atomic<uint32_t>                        mSharedSnapshot{2u}; ///< Index of the swapped snapshot, flagged when it's newer than the read one
+
   Matrix     mTransform;
   Matrix     mInverseTransform;
   Uint16Pair mSize;
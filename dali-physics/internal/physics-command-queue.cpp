@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-physics/internal/physics-command-queue.h>
+
+namespace Dali::Toolkit::Physics::Internal
+{
+namespace
+{
+uint64_t NextPowerOfTwo(uint32_t value)
+{
+  uint64_t result = 2u;
+  while(result < value)
+  {
+    result <<= 1;
+  }
+  return result;
+}
+
+template<typename T>
+void StoreMaximum(std::atomic<T>& maximum, T value)
+{
+  T current = maximum.load(std::memory_order_relaxed);
+  while(value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+} // namespace
+
+PhysicsCommandQueue::PhysicsCommandQueue(uint32_t capacity)
+{
+  const uint64_t size = NextPowerOfTwo(capacity);
+
+  mCells.reset(new Cell[size]);
+  mMask = size - 1u;
+  for(uint64_t i = 0u; i < size; ++i)
+  {
+    mCells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+PhysicsCommandQueue::~PhysicsCommandQueue()
+{
+  // Delete, rather than execute, any commands left over
+  const uint64_t end = mEnqueuePosition.load(std::memory_order_acquire);
+  for(uint64_t position = mDequeuePosition.load(std::memory_order_relaxed); position != end; ++position)
+  {
+    Cell& cell = mCells[position & mMask];
+    if(cell.sequence.load(std::memory_order_acquire) == position + 1u)
+    {
+      delete cell.callback;
+    }
+  }
+  while(!mOverflowQueue.empty())
+  {
+    delete mOverflowQueue.front().callback;
+    mOverflowQueue.pop();
+  }
+}
+
+void PhysicsCommandQueue::Push(UniquePtr<CallbackBase> callback)
+{
+  if(callback)
+  {
+    Push(callback.release(), 1u);
+  }
+}
+
+void PhysicsCommandQueue::PushBatch(std::vector<UniquePtr<CallbackBase>>&& callbacks)
+{
+  if(callbacks.empty())
+  {
+    return;
+  }
+
+  const uint32_t commandCount = static_cast<uint32_t>(callbacks.size());
+
+  // Wrap the whole batch in a single command, so that it only costs one slot
+  auto batch = std::make_shared<std::vector<UniquePtr<CallbackBase>>>(std::move(callbacks));
+  auto command = MakePhysicsCallback([batch]() {
+    for(auto&& callback : *batch)
+    {
+      if(callback)
+      {
+        CallbackBase::Execute(*callback);
+      }
+    }
+  });
+  Push(command.release(), commandCount);
+}
+
+void PhysicsCommandQueue::Push(CallbackBase* callback, uint32_t commandCount)
+{
+  const auto queueTime = Clock::now();
+
+  const uint32_t depth = mDepth.fetch_add(commandCount, std::memory_order_relaxed) + commandCount;
+  StoreMaximum(mPeakDepth, depth);
+
+  // Whilst anything is waiting in the overflow queue, keep adding to it to preserve ordering
+  if(!mOverflowing.load(std::memory_order_acquire) && TryPush(callback, commandCount, queueTime))
+  {
+    return;
+  }
+
+  std::scoped_lock<std::mutex> lock(mOverflowMutex);
+  mOverflowQueue.push(OverflowEntry{callback, commandCount, queueTime});
+  mOverflowing.store(true, std::memory_order_release);
+  mOverflowCount.fetch_add(commandCount, std::memory_order_relaxed);
+}
+
+bool PhysicsCommandQueue::TryPush(CallbackBase* callback, uint32_t commandCount, Clock::time_point queueTime)
+{
+  uint64_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+  for(;;)
+  {
+    Cell&          cell       = mCells[position & mMask];
+    const uint64_t sequence   = cell.sequence.load(std::memory_order_acquire);
+    const int64_t  difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+    if(difference == 0)
+    {
+      if(mEnqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+      {
+        cell.callback     = callback;
+        cell.commandCount = commandCount;
+        cell.queueTime    = queueTime;
+        cell.sequence.store(position + 1u, std::memory_order_release);
+        return true;
+      }
+    }
+    else if(difference < 0)
+    {
+      return false; // Full
+    }
+    else
+    {
+      position = mEnqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void PhysicsCommandQueue::ExecuteAll()
+{
+  const auto now = Clock::now();
+
+  // Only execute what was queued before we started, in case a command queues another
+  const uint64_t end      = mEnqueuePosition.load(std::memory_order_acquire);
+  uint64_t       position = mDequeuePosition.load(std::memory_order_relaxed);
+  while(position != end)
+  {
+    Cell& cell = mCells[position & mMask];
+    if(cell.sequence.load(std::memory_order_acquire) != position + 1u)
+    {
+      // Slot claimed, but the producer hasn't finished writing it yet. Leave the
+      // rest, including the overflow queue, until next time to preserve ordering.
+      return;
+    }
+
+    CallbackBase*           callback     = cell.callback;
+    const uint32_t          commandCount = cell.commandCount;
+    const Clock::time_point queueTime    = cell.queueTime;
+    cell.sequence.store(position + mMask + 1u, std::memory_order_release);
+    mDequeuePosition.store(++position, std::memory_order_relaxed);
+
+    Execute(callback, commandCount, queueTime, now);
+  }
+
+  // A producer may have claimed a slot after the end was read, before a later one spilled into
+  // the overflow queue. The overflow queue is only drained once the ring is empty, so that the
+  // slot is executed first, next time.
+  if(mEnqueuePosition.load(std::memory_order_acquire) != position)
+  {
+    return;
+  }
+
+  if(mOverflowing.load(std::memory_order_acquire))
+  {
+    std::queue<OverflowEntry> overflow;
+    {
+      std::scoped_lock<std::mutex> lock(mOverflowMutex);
+      std::swap(overflow, mOverflowQueue);
+      mOverflowing.store(false, std::memory_order_release);
+    }
+    while(!overflow.empty())
+    {
+      const OverflowEntry& entry = overflow.front();
+      Execute(entry.callback, entry.commandCount, entry.queueTime, now);
+      overflow.pop();
+    }
+  }
+}
+
+void PhysicsCommandQueue::Execute(CallbackBase* callback, uint32_t commandCount, Clock::time_point queueTime, Clock::time_point now)
+{
+  UniquePtr<CallbackBase> command(callback);
+  CallbackBase::Execute(*command); // Execute the queued methods
+
+  const auto latencyUs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - queueTime).count());
+  mDepth.fetch_sub(commandCount, std::memory_order_relaxed);
+  mExecutedCount.fetch_add(commandCount, std::memory_order_relaxed);
+  mTotalLatencyUs.fetch_add(static_cast<uint64_t>(latencyUs) * commandCount, std::memory_order_relaxed);
+  StoreMaximum(mMaxLatencyUs, latencyUs);
+}
+
+Physics::PhysicsAdaptor::QueueMetrics PhysicsCommandQueue::GetMetrics() const
+{
+  Physics::PhysicsAdaptor::QueueMetrics metrics;
+  metrics.depth         = mDepth.load(std::memory_order_relaxed);
+  metrics.peakDepth     = mPeakDepth.load(std::memory_order_relaxed);
+  metrics.overflowCount = mOverflowCount.load(std::memory_order_relaxed);
+  metrics.executedCount = mExecutedCount.load(std::memory_order_relaxed);
+
+  const uint64_t totalLatencyUs = mTotalLatencyUs.load(std::memory_order_relaxed);
+  metrics.averageLatency        = metrics.executedCount > 0u ? static_cast<float>(totalLatencyUs) / metrics.executedCount * 1e-6f : 0.0f;
+  metrics.maxLatency            = mMaxLatencyUs.load(std::memory_order_relaxed) * 1e-6f;
+  return metrics;
+}
+
+void PhysicsCommandQueue::ResetMetrics()
+{
+  mPeakDepth.store(mDepth.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  mOverflowCount.store(0u, std::memory_order_relaxed);
+  mExecutedCount.store(0u, std::memory_order_relaxed);
+  mTotalLatencyUs.store(0u, std::memory_order_relaxed);
+  mMaxLatencyUs.store(0u, std::memory_order_relaxed);
+}
+
+} // namespace Dali::Toolkit::Physics::Internal
@@ -0,0 +1,148 @@
+#ifndef DALI_TOOLKIT_PHYSICS_INTERNAL_PHYSICS_COMMAND_QUEUE_H
+#define DALI_TOOLKIT_PHYSICS_INTERNAL_PHYSICS_COMMAND_QUEUE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/unique-ptr.h>
+#include <dali/public-api/signals/callback.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-physics/public-api/physics-adaptor.h>
+
+namespace Dali::Toolkit::Physics::Internal
+{
+/**
+ * Bounded multi-producer, single-consumer ring of physics commands.
+ *
+ * Producers (normally the event thread) never take a lock unless the ring is
+ * full, in which case commands spill into a mutex guarded overflow queue so
+ * that nothing is dropped. Ordering is preserved: whilst the overflow queue
+ * is in use, all new commands are added to it, and the consumer only drains
+ * the overflow queue once the ring is empty.
+ *
+ * The consumer must be serialized externally; the PhysicsWorld only executes
+ * commands whilst holding its own lock.
+ */
+class PhysicsCommandQueue
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * Constructor
+   * @param[in] capacity The number of slots in the ring, rounded up to a power of 2.
+   */
+  explicit PhysicsCommandQueue(uint32_t capacity);
+
+  /**
+   * Destructor. Deletes any commands that were never executed.
+   */
+  ~PhysicsCommandQueue();
+
+  PhysicsCommandQueue(const PhysicsCommandQueue&)            = delete;
+  PhysicsCommandQueue& operator=(const PhysicsCommandQueue&) = delete;
+
+  /**
+   * Add a command. Safe to call from any number of threads.
+   * @param[in] callback The command to add
+   */
+  void Push(UniquePtr<CallbackBase> callback);
+
+  /**
+   * Add a batch of commands as a single entry, using one slot in the ring.
+   * Safe to call from any number of threads.
+   * @param[in] callbacks The commands to add, executed in order
+   */
+  void PushBatch(std::vector<UniquePtr<CallbackBase>>&& callbacks);
+
+  /**
+   * Execute all commands that have been added. Only one thread may call this at a time.
+   */
+  void ExecuteAll();
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::GetQueueMetrics
+   */
+  Physics::PhysicsAdaptor::QueueMetrics GetMetrics() const;
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::ResetQueueMetrics
+   */
+  void ResetMetrics();
+
+private:
+  struct Cell
+  {
+    std::atomic<uint64_t> sequence{0u};
+    CallbackBase*         callback{nullptr};
+    uint32_t              commandCount{0u}; ///< Number of commands in this entry (batches hold more than 1)
+    Clock::time_point     queueTime;
+  };
+
+  /**
+   * Try to add an entry to the ring.
+   * @return false if the ring is full
+   */
+  bool TryPush(CallbackBase* callback, uint32_t commandCount, Clock::time_point queueTime);
+
+  /**
+   * Add an entry to the ring, or to the overflow queue if the ring is full.
+   */
+  void Push(CallbackBase* callback, uint32_t commandCount);
+
+  /**
+   * Execute an entry and update the latency metrics.
+   */
+  void Execute(CallbackBase* callback, uint32_t commandCount, Clock::time_point queueTime, Clock::time_point now);
+
+private:
+  struct OverflowEntry
+  {
+    CallbackBase*     callback;
+    uint32_t          commandCount;
+    Clock::time_point queueTime;
+  };
+
+  std::unique_ptr<Cell[]> mCells;
+  uint64_t                mMask;
+  std::atomic<uint64_t>   mEnqueuePosition{0u};
+  std::atomic<uint64_t>   mDequeuePosition{0u};
+
+  std::mutex                mOverflowMutex;
+  std::queue<OverflowEntry> mOverflowQueue;
+  std::atomic<bool>         mOverflowing{false}; ///< Set whilst the overflow queue holds entries
+
+  std::atomic<uint32_t> mDepth{0u};           ///< Commands waiting to be executed
+  std::atomic<uint32_t> mPeakDepth{0u};
+  std::atomic<uint32_t> mOverflowCount{0u};
+  std::atomic<uint32_t> mExecutedCount{0u};
+  std::atomic<uint64_t> mTotalLatencyUs{0u};
+  std::atomic<uint32_t> mMaxLatencyUs{0u};
+};
+
+} // namespace Dali::Toolkit::Physics::Internal
+
+#endif //DALI_TOOLKIT_PHYSICS_INTERNAL_PHYSICS_COMMAND_QUEUE_H
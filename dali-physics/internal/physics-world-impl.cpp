@@ -21,8 +21,25 @@
 #include <dali/public-api/adaptor-framework/ui-context.h>
 #include <dali/public-api/update/frame-callback-interface.h>
 
+#include <cmath>
+
 thread_local int gLocked{0};
 
+namespace
+{
+/**
+ * Maximum number of integration steps the worker thread will run per wake-up.
+ * If the solver falls further behind than this, the excess time is dropped
+ * rather than letting the simulation spiral.
+ */
+constexpr uint32_t MAX_SUBSTEPS{8u};
+
+/**
+ * Number of slots in the command ring. Commands beyond this spill into a locked overflow queue.
+ */
+constexpr uint32_t COMMAND_QUEUE_CAPACITY{4096u};
+} // namespace
+
 namespace Dali::Toolkit::Physics::Internal
 {
 /**
@@ -56,7 +73,8 @@ private: // Member variables
 };
 
 PhysicsWorld::PhysicsWorld(Dali::Actor rootActor, Dali::CallbackBase* updateCallback)
-: mUpdateCallback(updateCallback),
+: mCommandQueue(COMMAND_QUEUE_CAPACITY),
+  mUpdateCallback(updateCallback),
   mRootActor(rootActor)
 {
 }
@@ -77,35 +95,62 @@ PhysicsWorld::~PhysicsWorld()
 {
   // Derived class's destructor should clean down physics objects under mutex lock
   // On completion, can remove the callback.
+  StopWorkerThread();
 
   Dali::UiContext::Get().RemoveFrameCallback(*mFrameCallback);
 }
 
 bool PhysicsWorld::OnUpdate(Dali::UpdateProxy& updateProxy, float elapsedSeconds)
 {
-  ScopedLock lock(*this);
+  const bool syncPointSeen = mNotifySyncPoint != Dali::UpdateProxy::INVALID_SYNC &&
+                             mNotifySyncPoint == updateProxy.PopSyncPoint();
+
+  // Hand the elapsed time over to the worker thread; the update thread never waits on the solver.
+  // The mode is checked under the same lock that SetThreadingMode() changes it with, so commands
+  // handed over are either run by the worker, or flushed when it's stopped.
+  bool handedOver{false};
+  {
+    std::scoped_lock<std::mutex> lock(mWorkerMutex);
+    if(mThreadingMode == Physics::PhysicsAdaptor::ThreadingMode::WORKER_THREAD)
+    {
+      mPendingTime += elapsedSeconds;
+      mCommandsReady = mCommandsReady || syncPointSeen;
+      handedOver     = true;
+    }
+  }
 
-  // Process command queue
-  if(mNotifySyncPoint != Dali::UpdateProxy::INVALID_SYNC &&
-     mNotifySyncPoint == updateProxy.PopSyncPoint())
+  if(handedOver)
   {
-    while(!commandQueue.empty())
+    mWorkerCondition.notify_one();
+
+    if(syncPointSeen)
     {
-      CallbackBase::Execute(*commandQueue.front()); // Execute the queued methods
-      commandQueue.pop();
+      mNotifySyncPoint = Dali::UpdateProxy::INVALID_SYNC;
     }
 
+    // Interpolate the actors between the last two snapshots taken by the worker thread
+    if(mUpdateCallback)
+    {
+      Dali::CallbackBase::Execute(*mUpdateCallback, &updateProxy);
+    }
+    return true;
+  }
+
+  ScopedLock lock(*this);
+
+  if(syncPointSeen)
+  {
+    mCommandQueue.ExecuteAll();
     mNotifySyncPoint = Dali::UpdateProxy::INVALID_SYNC;
   }
 
   // Perform as many integration steps as needed to handle elapsed time
-  static float frameTime = 0;
-  frameTime += elapsedSeconds;
+  mFrameTime += elapsedSeconds;
   do
   {
     Integrate(mPhysicsTimeStep);
-    frameTime -= mPhysicsTimeStep;
-  } while(frameTime > 0);
+    mFrameTime -= mPhysicsTimeStep;
+  } while(mFrameTime > 0);
 
   // Update the corresponding actors to their physics spaces
   if(mUpdateCallback)
@@ -117,6 +162,94 @@ bool PhysicsWorld::OnUpdate(Dali::UpdateProxy& updateProxy, float elapsedSeconds
   return true;
 }
 
+void PhysicsWorld::WorkerThreadMain()
+{
+  while(true)
+  {
+    float elapsedSeconds{0.0f};
+    bool  processCommands{false};
+    {
+      std::unique_lock<std::mutex> lock(mWorkerMutex);
+      mWorkerCondition.wait(lock, [this]() { return mStopWorker || mCommandsReady || mPendingTime > 0.0f; });
+      if(mStopWorker)
+      {
+        break;
+      }
+      elapsedSeconds  = mPendingTime;
+      processCommands = mCommandsReady;
+      mPendingTime    = 0.0f;
+      mCommandsReady  = false;
+      mWorkerBusy     = true;
+    }
+
+    RunWorkerBatch(elapsedSeconds, processCommands);
+
+    {
+      std::scoped_lock<std::mutex> lock(mWorkerMutex);
+      mWorkerBusy = false;
+    }
+    mWorkerIdleCondition.notify_all();
+  }
+}
+
+void PhysicsWorld::RunWorkerBatch(float elapsedSeconds, bool processCommands)
+{
+  ScopedLock lock(*this);
+
+  if(processCommands)
+  {
+    mCommandQueue.ExecuteAll();
+  }
+
+  // Fixed timestep accumulator. Run several substeps if we've fallen behind.
+  mFrameTime += elapsedSeconds;
+  uint32_t stepCount = 0u;
+  while(mFrameTime >= mPhysicsTimeStep && stepCount < MAX_SUBSTEPS)
+  {
+    Integrate(mPhysicsTimeStep);
+    mFrameTime -= mPhysicsTimeStep;
+    ++stepCount;
+  }
+  if(mFrameTime >= mPhysicsTimeStep)
+  {
+    mFrameTime = std::fmod(mFrameTime, mPhysicsTimeStep);
+  }
+  if(stepCount > 0u)
+  {
+    mLastStepCount = stepCount;
+  }
+
+  // The previous and current snapshots are a whole batch apart, not a single step, so scale
+  // the fraction to that span. This renders one step behind the solver at an even pace,
+  // however many substeps each batch ran.
+  mInterpolationFactor = mLastStepCount > 0u ? (static_cast<float>(mLastStepCount - 1u) + mFrameTime / mPhysicsTimeStep) / static_cast<float>(mLastStepCount) : 1.0f;
+
+  if(mStepCallback)
+  {
+    Dali::CallbackBase::Execute(*mStepCallback, stepCount);
+  }
+}
+
+void PhysicsWorld::WaitForWorkerThread()
+{
+  std::unique_lock<std::mutex> lock(mWorkerMutex);
+  mWorkerIdleCondition.wait(lock, [this]() { return mStopWorker || mThreadingMode != Physics::PhysicsAdaptor::ThreadingMode::WORKER_THREAD || (!mWorkerBusy && !mCommandsReady && mPendingTime <= 0.0f); });
+}
+
+void PhysicsWorld::StopWorkerThread()
+{
+  if(mWorkerThread.joinable())
+  {
+    {
+      std::scoped_lock<std::mutex> lock(mWorkerMutex);
+      mStopWorker = true;
+    }
+    mWorkerCondition.notify_one();
+    mWorkerIdleCondition.notify_all();
+    mWorkerThread.join();
+  }
+}
+
 void PhysicsWorld::SetTimestep(float timeStep)
 {
   mPhysicsTimeStep = timeStep;
@@ -152,8 +285,22 @@ void PhysicsWorld::Unlock()
 
 void PhysicsWorld::Queue(UniquePtr<CallbackBase> callback)
 {
-  ScopedLock lock(*this);
-  commandQueue.push(Move(callback));
+  mCommandQueue.Push(Move(callback));
+}
+
+void PhysicsWorld::QueueBatch(std::vector<UniquePtr<CallbackBase>>&& callbacks)
+{
+  mCommandQueue.PushBatch(std::move(callbacks));
+}
+
+Physics::PhysicsAdaptor::QueueMetrics PhysicsWorld::GetQueueMetrics() const
+{
+  return mCommandQueue.GetMetrics();
+}
+
+void PhysicsWorld::ResetQueueMetrics()
+{
+  mCommandQueue.ResetMetrics();
 }
 
 void PhysicsWorld::CreateSyncPoint()
@@ -181,4 +328,67 @@ Physics::PhysicsAdaptor::DebugState PhysicsWorld::GetDebugState() const
   return mPhysicsDebugState;
 }
 
+void PhysicsWorld::SetThreadingMode(Physics::PhysicsAdaptor::ThreadingMode mode)
+{
+  if(mode == mThreadingMode)
+  {
+    return;
+  }
+
+  if(mode == Physics::PhysicsAdaptor::ThreadingMode::WORKER_THREAD)
+  {
+    {
+      std::scoped_lock<std::mutex> lock(mWorkerMutex);
+      mStopWorker    = false;
+      mPendingTime   = 0.0f;
+      mCommandsReady = false;
+      mLastStepCount = 0u;
+    }
+    mWorkerThread = std::thread(&PhysicsWorld::WorkerThreadMain, this);
+
+    std::scoped_lock<std::mutex> lock(mWorkerMutex);
+    mThreadingMode = mode;
+  }
+  else
+  {
+    // Stop the update thread handing work over before stopping the worker.
+    // Once the mode is stored under the lock, OnUpdate() can't hand any more commands over.
+    {
+      std::scoped_lock<std::mutex> lock(mWorkerMutex);
+      mThreadingMode = mode;
+    }
+    StopWorkerThread();
+
+    // The update thread has already consumed the sync point of any commands the worker
+    // hadn't run yet, so it would not run them either; flush them now.
+    bool commandsReady{false};
+    {
+      std::scoped_lock<std::mutex> lock(mWorkerMutex);
+      commandsReady  = mCommandsReady;
+      mCommandsReady = false;
+      mPendingTime   = 0.0f;
+    }
+    if(commandsReady)
+    {
+      ScopedLock lock(*this);
+      mCommandQueue.ExecuteAll();
+    }
+  }
+}
+
+Physics::PhysicsAdaptor::ThreadingMode PhysicsWorld::GetThreadingMode() const
+{
+  return mThreadingMode;
+}
+
+void PhysicsWorld::SetStepCallback(Dali::CallbackBase* stepCallback)
+{
+  mStepCallback.reset(stepCallback);
+}
+
+float PhysicsWorld::GetInterpolationFactor() const
+{
+  return mInterpolationFactor;
+}
+
 } // namespace Dali::Toolkit::Physics::Internal
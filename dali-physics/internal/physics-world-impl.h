@@ -24,10 +24,13 @@
 #include <dali/public-api/update/update-proxy.h>
 #include <dali/public-api/signals/callback.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
-#include <queue>
+#include <thread>
 
 // INTERNAL INCLUDES
+#include <dali-physics/internal/physics-command-queue.h>
 #include <dali-physics/public-api/physics-adaptor.h>
 
 namespace Dali::Toolkit::Physics::Internal
@@ -119,9 +122,25 @@ public:
   /**
    * Queue a function for execution in the update thread, prior to the physics integration.
    * Enables syncronization of DALi properties and physics controlled properties.
+   * Does not lock the world.
    */
   void Queue(UniquePtr<CallbackBase> callback);
 
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::QueueBatch
+   */
+  void QueueBatch(std::vector<UniquePtr<CallbackBase>>&& callbacks);
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::GetQueueMetrics
+   */
+  Physics::PhysicsAdaptor::QueueMetrics GetQueueMetrics() const;
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::ResetQueueMetrics
+   */
+  void ResetQueueMetrics();
+
   /**
    * Create a sync point for queued functions.
    *
@@ -166,23 +185,91 @@ public:
    */
   Physics::PhysicsAdaptor::DebugState GetDebugState() const;
 
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::SetThreadingMode
+   */
+  void SetThreadingMode(Physics::PhysicsAdaptor::ThreadingMode mode);
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::GetThreadingMode
+   */
+  Physics::PhysicsAdaptor::ThreadingMode GetThreadingMode() const;
+
+  /**
+   * Set a callback which is executed after each batch of integration steps
+   * on the worker thread, whilst the world is still locked. The PhysicsAdaptor
+   * uses this to snapshot body transforms for interpolation.
+   * @param[in] stepCallback The callback to execute. Ownership is taken.
+   */
+  void SetStepCallback(Dali::CallbackBase* stepCallback);
+
+  /**
+   * Get how far between the previous and current transform snapshots the
+   * actors should be drawn. The snapshots are a whole batch of substeps
+   * apart, so this is scaled by the number of substeps in that batch.
+   * @return The interpolation factor, in the range [0,1]
+   */
+  float GetInterpolationFactor() const;
+
+  /**
+   * Block until the worker thread has integrated all the time and run all
+   * the commands handed over to it so far. Returns at once if the worker
+   * thread isn't running.
+   */
+  void WaitForWorkerThread();
+
 public:
   bool OnUpdate(Dali::UpdateProxy& updateProxy, float elapsedSeconds);
 
 protected:
   virtual void Integrate(float timestep) = 0;
 
+  /**
+   * Stop the worker thread, if running, and wait for it to finish.
+   * Derived classes should call this before destroying the native world.
+   */
+  void StopWorkerThread();
+
+private:
+  /**
+   * Main loop of the worker thread in WORKER_THREAD mode.
+   */
+  void WorkerThreadMain();
+
+  /**
+   * Run the commands and integration steps for one batch of work on the
+   * worker thread, then execute the step callback.
+   * @param[in] elapsedSeconds The time handed over since the last batch
+   * @param[in] processCommands True if the command queue should be run first
+   */
+  void RunWorkerBatch(float elapsedSeconds, bool processCommands);
+
 protected:
-  std::mutex                          mMutex;
-  std::queue<UniquePtr<CallbackBase>> commandQueue;
-  UpdateProxy::NotifySyncPoint        mNotifySyncPoint{Dali::UpdateProxy::INVALID_SYNC};
-  UniquePtr<Dali::CallbackBase>       mUpdateCallback{nullptr};
-  UniquePtr<FrameCallback>            mFrameCallback;
-  Actor                               mRootActor;
+  std::mutex                    mMutex;
+  PhysicsCommandQueue           mCommandQueue; ///< Lock-free for producers; only executed with mMutex held
+  UpdateProxy::NotifySyncPoint  mNotifySyncPoint{Dali::UpdateProxy::INVALID_SYNC};
+  UniquePtr<Dali::CallbackBase> mUpdateCallback{nullptr};
+  UniquePtr<FrameCallback>      mFrameCallback;
+  Actor                         mRootActor;
 
   float                                     mPhysicsTimeStep{1.0 / 180.0};
+  float                                     mFrameTime{0.0f}; ///< Time accumulated but not yet integrated
   Physics::PhysicsAdaptor::IntegrationState mPhysicsIntegrateState{Physics::PhysicsAdaptor::IntegrationState::ON};
   Physics::PhysicsAdaptor::DebugState       mPhysicsDebugState{Physics::PhysicsAdaptor::DebugState::OFF};
+
+  // Worker thread state, only used in WORKER_THREAD mode
+  std::atomic<Physics::PhysicsAdaptor::ThreadingMode> mThreadingMode{Physics::PhysicsAdaptor::ThreadingMode::UPDATE_THREAD};
+  UniquePtr<Dali::CallbackBase>                       mStepCallback{nullptr};
+  std::thread                                         mWorkerThread;
+  std::mutex                                          mWorkerMutex; ///< Guards mPendingTime, mCommandsReady, mWorkerBusy, mStopWorker and changes of mThreadingMode
+  std::condition_variable                             mWorkerCondition;
+  std::condition_variable                             mWorkerIdleCondition; ///< Signalled when the worker finishes a batch
+  float                                               mPendingTime{0.0f};    ///< Elapsed time handed over by the update thread
+  bool                                                mCommandsReady{false}; ///< The sync point has been seen; the worker should run the queue
+  bool                                                mWorkerBusy{false}; ///< The worker has taken a batch and not finished it yet
+  bool                                                mStopWorker{false};
+  uint32_t                                            mLastStepCount{0u}; ///< Substeps run by the last batch that integrated; only used by the worker
+  std::atomic<float>                                  mInterpolationFactor{1.0f};
 };
 
 } // namespace Dali::Toolkit::Physics::Internal
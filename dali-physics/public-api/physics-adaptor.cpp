@@ -117,6 +117,16 @@ Physics::PhysicsAdaptor::DebugState PhysicsAdaptor::GetDebugState() const
   return GetImplementation(*this).GetDebugState();
 }
 
+void PhysicsAdaptor::SetThreadingMode(Physics::PhysicsAdaptor::ThreadingMode mode)
+{
+  GetImplementation(*this).SetThreadingMode(mode);
+}
+
+Physics::PhysicsAdaptor::ThreadingMode PhysicsAdaptor::GetThreadingMode() const
+{
+  return GetImplementation(*this).GetThreadingMode();
+}
+
 PhysicsActor PhysicsAdaptor::AddActorBody(Dali::Actor actor, Dali::Any body)
 {
   Internal::PhysicsActorPtr physicsActor = GetImplementation(*this).AddActorBody(actor, body);
@@ -154,6 +164,21 @@ void PhysicsAdaptor::Queue(UniquePtr<CallbackBase> callback)
   GetImplementation(*this).Queue(Move(callback));
 }
 
+void PhysicsAdaptor::QueueBatch(std::vector<UniquePtr<CallbackBase>>&& callbacks)
+{
+  GetImplementation(*this).QueueBatch(std::move(callbacks));
+}
+
+PhysicsAdaptor::QueueMetrics PhysicsAdaptor::GetQueueMetrics() const
+{
+  return GetImplementation(*this).GetQueueMetrics();
+}
+
+void PhysicsAdaptor::ResetQueueMetrics()
+{
+  GetImplementation(*this).ResetQueueMetrics();
+}
+
 void PhysicsAdaptor::CreateSyncPoint()
 {
   GetImplementation(*this).CreateSyncPoint();
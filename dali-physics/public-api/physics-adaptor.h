@@ -26,6 +26,8 @@
 #include <dali/public-api/object/any.h>
 #include <dali/public-api/object/base-handle.h>
 #include <dali/public-api/signals/callback.h>
+#include <cstdint>
+#include <vector>
 
 namespace Dali::Toolkit::Physics
 {
@@ -65,6 +67,32 @@ public:
     ON
   };
 
+  /**
+   * @brief Enumeration to choose which thread runs the integration step.
+   *
+   * @SINCE_2_5.35
+   */
+  enum class ThreadingMode
+  {
+    UPDATE_THREAD, ///< Integrate in the update thread's frame callback.
+    WORKER_THREAD  ///< Integrate on a dedicated worker thread, and interpolate actors in the update thread.
+  };
+
+  /**
+   * @brief Metrics of the queue of callbacks waiting to be executed before integration.
+   *
+   * @SINCE_2_5.35
+   */
+  struct QueueMetrics
+  {
+    uint32_t depth{0u};           ///< Number of callbacks currently waiting to be executed
+    uint32_t peakDepth{0u};       ///< Highest depth seen since the last reset
+    uint32_t overflowCount{0u};   ///< Number of callbacks that didn't fit into the lock-free ring
+    uint32_t executedCount{0u};   ///< Number of callbacks executed since the last reset
+    float    averageLatency{0.0f}; ///< Average time, in seconds, between queueing and execution
+    float    maxLatency{0.0f};     ///< Maximum time, in seconds, between queueing and execution
+  };
+
   /**
    * @brief Scoped accessor to the physics world.
    *
@@ -351,6 +379,29 @@ public:
    */
   DebugState GetDebugState() const;
 
+  /**
+   * @brief Set the threading mode.
+   *
+   * @SINCE_2_5.35
+   * In WORKER_THREAD mode, the integration step runs on its own thread using a
+   * fixed timestep accumulator, running several substeps if it has fallen behind.
+   * Actor positions and orientations are interpolated between the two most recent
+   * integration steps, so the update thread never waits on the solver.
+   * Queued functions are executed on the worker thread.
+   * @note This is UPDATE_THREAD by default
+   * @note This must not be called whilst holding a ScopedPhysicsAccessor.
+   * @param[in] mode the new threading mode
+   */
+  void SetThreadingMode(ThreadingMode mode);
+
+  /**
+   * @brief Get the threading mode.
+   *
+   * @SINCE_2_5.35
+   * @return the current threading mode
+   */
+  ThreadingMode GetThreadingMode() const;
+
   /**
    * @brief Add an actor / body pair.
    * @pre It's expected that the client has added the body to the physics world.
@@ -458,6 +509,33 @@ public:
    */
   void Queue(UniquePtr<CallbackBase> callback);
 
+  /**
+   * @brief Queue a batch of callbacks to be executed, in order, before the physics integration.
+   *
+   * @SINCE_2_5.35
+   * Equivalent to calling Queue() for each callback, but the whole batch is submitted
+   * as a single entry. CreateSyncPoint() should be called afterwards.
+   * @note Neither Queue() nor QueueBatch() wait for the physics world lock.
+   *
+   * @param[in] callbacks The callbacks to execute. The vector is emptied.
+   */
+  void QueueBatch(std::vector<UniquePtr<CallbackBase>>&& callbacks);
+
+  /**
+   * @brief Get metrics for the queue of callbacks.
+   *
+   * @SINCE_2_5.35
+   * @return The queue depth and latency metrics
+   */
+  QueueMetrics GetQueueMetrics() const;
+
+  /**
+   * @brief Reset the peak depth, overflow count and latency metrics of the queue.
+   *
+   * @SINCE_2_5.35
+   */
+  void ResetQueueMetrics();
+
   /**
    * @brief Create a sync point for queued functions.
    *
@@ -23,8 +23,18 @@
 #include <dali/devel-api/adaptor-framework/file-stream.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
+#include <algorithm>
+#include <limits>
 #include <locale>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DALI_SCENE3D_BUFFER_FILE_MAPPING_ENABLED
+#endif
+
 using Dali::Integration::ToDaliString;
 using Dali::Integration::ToStdString;
 
@@ -35,20 +45,88 @@ namespace
 static constexpr std::string_view EMBEDDED_DATA_PREFIX                 = "data:";
 static constexpr std::string_view EMBEDDED_DATA_APPLICATION_MEDIA_TYPE = "application/";
 static constexpr std::string_view EMBEDDED_DATA_BASE64_ENCODING_TYPE   = "base64,";
+
+/**
+ * @brief Maps the whole file into memory, read-only.
+ *
+ * @param[in] path The path of the file.
+ * @param[out] size The size of the mapping in bytes.
+ * @return The mapped data, which is unmapped when its last owner is released; or nullptr if the file can't be mapped.
+ */
+std::shared_ptr<const uint8_t> MapFile(const std::string& path, uint32_t& size)
+{
+#ifdef DALI_SCENE3D_BUFFER_FILE_MAPPING_ENABLED
+  int fileDescriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if(fileDescriptor < 0)
+  {
+    return {};
+  }
+
+  void*       mapping = MAP_FAILED;
+  struct stat fileStat;
+  if(fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0 && static_cast<uint64_t>(fileStat.st_size) <= std::numeric_limits<uint32_t>::max())
+  {
+    mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  }
+
+  // The mapping keeps its own reference to the file.
+  close(fileDescriptor);
+
+  if(mapping == MAP_FAILED)
+  {
+    return {};
+  }
+
+  const size_t mappingSize = static_cast<size_t>(fileStat.st_size);
+  size                     = static_cast<uint32_t>(mappingSize);
+  return std::shared_ptr<const uint8_t>(static_cast<const uint8_t*>(mapping), [mappingSize](const uint8_t* data)
+  { munmap(const_cast<uint8_t*>(data), mappingSize); });
+#else
+  return {};
+#endif
+}
+
 } // namespace
 
 struct BufferDefinition::Impl
 {
-  Dali::Vector<uint8_t>             buffer;
+  /**
+   * @brief Makes the given memory the data of the buffer, and opens the stream over it.
+   *
+   * @param[in] newData The data. The stream doesn't copy it.
+   * @param[in] newDataSize The size of the data in bytes.
+   */
+  void SetData(std::shared_ptr<const uint8_t> newData, uint32_t newDataSize)
+  {
+    data     = std::move(newData);
+    dataSize = newDataSize;
+    stream   = std::make_shared<Dali::FileStream>(const_cast<uint8_t*>(data.get()), dataSize, FileStream::READ | FileStream::BINARY);
+  }
+
+  /**
+   * @brief Makes the given buffer the data of the buffer.
+   *
+   * @param[in] buffer The buffer, which is taken over.
+   * @param[in] size The size of the data in bytes.
+   */
+  void SetData(Dali::Vector<uint8_t>&& buffer, uint32_t size)
+  {
+    auto holder = std::make_shared<Dali::Vector<uint8_t>>(std::move(buffer));
+    SetData(std::shared_ptr<const uint8_t>(holder, holder->Begin()), size);
+  }
+
+  std::shared_ptr<const uint8_t>    data; ///< Either mapped from the file or the decoded buffer. Mesh attributes may share it.
+  uint32_t                          dataSize{0u};
   std::shared_ptr<Dali::FileStream> stream;
+  std::mutex                        streamMutex; ///< Locked while the buffer is used by one of the meshes loaded in parallel.
 };
 
 BufferDefinition::BufferDefinition(Dali::Vector<uint8_t>&& buffer)
 : mImpl{new BufferDefinition::Impl}
 {
-  mImpl->buffer = std::move(buffer);
-  mImpl->stream = std::make_shared<Dali::FileStream>(mImpl->buffer.Data(), mImpl->buffer.Count(), FileStream::READ | FileStream::BINARY);
-  mIsEmbedded   = true;
+  const uint32_t size = static_cast<uint32_t>(buffer.Count());
+  mImpl->SetData(std::move(buffer), size);
+  mIsEmbedded = true;
 }
 
 BufferDefinition::BufferDefinition()
@@ -81,6 +159,23 @@ Dali::String BufferDefinition::GetUri()
   return ToDaliString(result);
 }
 
+std::shared_ptr<const uint8_t> BufferDefinition::GetData()
+{
+  LoadBuffer();
+  return mImpl->data;
+}
+
+uint32_t BufferDefinition::GetDataSize()
+{
+  LoadBuffer();
+  return mImpl->dataSize;
+}
+
+std::mutex& BufferDefinition::GetBufferStreamMutex()
+{
+  return mImpl->streamMutex;
+}
+
 bool BufferDefinition::IsAvailable()
 {
   LoadBuffer();
@@ -99,18 +194,30 @@ void BufferDefinition::LoadBuffer()
       {
         position += EMBEDDED_DATA_BASE64_ENCODING_TYPE.length();
         std::string_view data = std::string_view(uri).substr(position);
-        mImpl->buffer.Clear();
-        std::vector<uint8_t> tempBuffer;
+        Dali::Vector<uint8_t> buffer;
+        std::vector<uint8_t>  tempBuffer;
         Dali::Toolkit::DecodeBase64FromString(data, tempBuffer);
-        mImpl->buffer.Insert(mImpl->buffer.End(), const_cast<uint8_t*>(tempBuffer.data()), const_cast<uint8_t*>(tempBuffer.data() + tempBuffer.size()));
-        mImpl->stream = std::make_shared<Dali::FileStream>(mImpl->buffer.Data(), mByteLength, FileStream::READ | FileStream::BINARY);
-        mIsEmbedded   = true;
+        buffer.Insert(buffer.End(), const_cast<uint8_t*>(tempBuffer.data()), const_cast<uint8_t*>(tempBuffer.data() + tempBuffer.size()));
+        mImpl->SetData(std::move(buffer), std::min(mByteLength, static_cast<uint32_t>(tempBuffer.size())));
+        mIsEmbedded = true;
       }
     }
     else
     {
       std::string fullPath = ToStdString(mResourcePath) + uri;
-      mImpl->stream        = std::make_shared<Dali::FileStream>(fullPath, FileStream::READ | FileStream::BINARY);
+
+      // Map the file if we can, so that mesh attributes can use its data without copying it.
+      uint32_t mappingSize = 0u;
+      auto     mapping     = MapFile(fullPath, mappingSize);
+      if(mapping)
+      {
+        mImpl->SetData(std::move(mapping), mappingSize);
+      }
+      else
+      {
+        mImpl->stream = std::make_shared<Dali::FileStream>(fullPath, FileStream::READ | FileStream::BINARY);
+      }
+
       if(mImpl->stream == nullptr)
       {
         DALI_LOG_ERROR("Failed to load %s\n", fullPath.c_str());
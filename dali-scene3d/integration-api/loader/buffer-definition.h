@@ -21,7 +21,10 @@
 #include <dali/public-api/common/dali-string.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/unique-ptr.h>
+#include <cstdint>
 #include <fstream>
+#include <memory>
+#include <mutex>
 
 // INTERNAL INCLUDES
 #include <dali-scene3d/public-api/api.h>
@@ -63,6 +66,33 @@ struct DALI_SCENE3D_API BufferDefinition
    */
   Dali::String GetUri();
 
+  /**
+   * @brief Retrieves the data of this buffer in memory.
+   *
+   * The data is either mapped from the buffer file, or decoded from an embedded buffer.
+   * The returned pointer shares the ownership of the memory, so the data stays valid after this buffer is destroyed.
+   * @SINCE_2_5.35
+   * @return The data of the buffer, or nullptr if it is only available through GetBufferStream().
+   */
+  std::shared_ptr<const uint8_t> GetData();
+
+  /**
+   * @brief Retrieves the size of the data returned by GetData().
+   * @SINCE_2_5.35
+   * @return The size of the data in bytes, or 0 if there is no data in memory.
+   */
+  uint32_t GetDataSize();
+
+  /**
+   * @brief Retrieves the mutex to lock while this buffer is used from several threads.
+   *
+   * The meshes of a model share its buffers, and can be loaded in parallel. They lock the mutex of a buffer
+   * while they load it or read its stream, so meshes reading other buffers are not blocked.
+   * @SINCE_2_5.35
+   * @return The mutex of this buffer.
+   */
+  std::mutex& GetBufferStreamMutex();
+
   /**
    * @brief Checks whether the buffer is available or not.
    *
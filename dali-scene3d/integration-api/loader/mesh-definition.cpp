@@ -25,15 +25,20 @@
 #include <dali/integration-api/string-utils.h>
 #include <dali/integration-api/texture-integ.h>
 #include <dali/public-api/common/dali-utility.h>
-#include <dali/public-api/math/compile-time-math.h>
 
 #include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <functional>
 #include <locale>
+#include <mutex>
 #include <type_traits>
 
+// INTERNAL INCLUDES
+#include <dali-scene3d/internal/common/parallel-job-runner.h>
+#include <dali-scene3d/internal/loader/mesh-attribute-generator.h>
+#include <dali-scene3d/internal/loader/mesh-simplifier.h>
+
 using Dali::Integration::ToDaliString;
 using Dali::Integration::ToStdString;
 
@@ -68,42 +73,29 @@ struct LoadAccessorListInputs
   BufferDefinition::Vector&               buffers;
 };
 
-template<bool use32BitIndices>
-class IndexProvider
-{
-public:
-  using IndexType = typename std::conditional_t<use32BitIndices, uint32_t, uint16_t>;
-  IndexProvider(const uint16_t* indices)
-  : mData(reinterpret_cast<uintptr_t>(indices)),
-    mFunc(indices ? IncrementPointer : Increment)
-  {
-  }
-
-  IndexType operator()()
-  {
-    return mFunc(mData);
-  }
-
-private:
-  static IndexType Increment(uintptr_t& data)
-  {
-    // mData was 'zero' at construct time. Just simply return counter start with 0.
-    return static_cast<IndexType>(data++);
-  }
+const char* QUAD("quad");
 
-  static IndexType IncrementPointer(uintptr_t& data)
-  {
-    auto iPtr   = reinterpret_cast<const IndexType*>(data);
-    auto result = *iPtr;
-    data        = reinterpret_cast<uintptr_t>(++iPtr);
-    return result;
-  }
+constexpr uint32_t MINIMUM_NUMBER_OF_LOD_TRIANGLES = 256u; ///< Smaller meshes don't get simplified any further.
+constexpr float    MAXIMUM_LOD_INDEX_RATIO         = 0.9f; ///< A level of detail must remove at least a tenth of the triangles of the previous one.
 
-  uintptr_t mData;
-  IndexType (*mFunc)(uintptr_t&);
+/**
+ * @brief A stream to read accessors from, with its buffer locked while it is used.
+ *
+ * The buffers are shared by all the meshes of a model, which can be loaded in parallel.
+ * Each buffer has its own mutex, so that meshes reading from other buffers are not blocked.
+ * The file of a mesh is only read by that mesh, so its stream is not locked.
+ */
+struct LockedStream
+{
+  std::unique_lock<std::mutex> lock;
+  std::iostream&               stream;
 };
 
-const char* QUAD("quad");
+LockedStream GetBufferStream(BufferDefinition& buffer)
+{
+  std::unique_lock<std::mutex> lock(buffer.GetBufferStreamMutex());
+  return LockedStream{std::move(lock), buffer.GetBufferStream()};
+}
 
 ///@brief Reads a blob from the given stream @a source into @a target, which must have
 /// at least @a descriptor.length bytes.
@@ -248,6 +240,12 @@ bool ReadAccessor(const MeshDefinition::Accessor& accessor, std::istream& source
   return ReadAccessor(accessor, source, target, nullptr);
 }
 
+///@brief Reads an accessor from @a source, whose buffer is unlocked as soon as it is read.
+bool ReadAccessor(const MeshDefinition::Accessor& accessor, LockedStream&& source, uint8_t* target)
+{
+  return ReadAccessor(accessor, source.stream, target, nullptr);
+}
+
 template<typename T, bool needsNormalize>
 void ReadVectorAccessor(const MeshDefinition::Accessor& accessor, std::istream& source, std::vector<uint8_t>& buffer)
 {
@@ -306,10 +304,21 @@ void ReadTypedVectorAccessor(LoadDataType loadDataType, MeshDefinition::Accessor
   }
 }
 
-template<bool use32BitsIndices, typename IndexProviderType = IndexProvider<use32BitsIndices>>
+/**
+ * @brief Retrieves the number of helpers to generate the attributes of a mesh.
+ *
+ * None when the mesh is itself loaded in a parallel job, e.g. by ResourceBundle::LoadRawResources(),
+ * as the other threads are busy loading the other meshes.
+ */
+uint32_t GetNumberOfAttributeJobHelpers()
+{
+  return Scene3D::Internal::IsRunningParallelJob() ? 0u : Scene3D::Internal::GetDefaultNumberOfJobHelpers();
+}
+
+template<bool use32BitsIndices>
 bool GenerateNormals(MeshDefinition::RawData& raw)
 {
-  using IndexType = typename IndexProviderType::IndexType;
+  using IndexType = typename std::conditional_t<use32BitsIndices, uint32_t, uint16_t>;
 
   // mIndicies size must be even if we use 32bit indices.
   if(DALI_UNLIKELY(use32BitsIndices && !raw.mIndices.Empty() && !(raw.mIndices.Size() % (sizeof(IndexType) / sizeof(uint16_t)) == 0)))
@@ -320,45 +329,22 @@ bool GenerateNormals(MeshDefinition::RawData& raw)
   auto& attribs = raw.mAttribs;
   DALI_ASSERT_DEBUG(attribs.Size() > 0); // positions
 
-  IndexProviderType getIndex(raw.mIndices.Data());
-
-  const uint32_t numIndices = raw.mIndices.Empty() ? attribs[0].mNumElements : static_cast<uint32_t>(raw.mIndices.Size() / (sizeof(IndexType) / sizeof(uint16_t)));
+  const uint32_t numVertices = attribs[0].mNumElements;
+  const uint32_t numIndices  = raw.mIndices.Empty() ? numVertices : static_cast<uint32_t>(raw.mIndices.Size() / (sizeof(IndexType) / sizeof(uint16_t)));
+  const auto*    indices     = raw.mIndices.Empty() ? nullptr : reinterpret_cast<const IndexType*>(raw.mIndices.Begin());
 
-  auto* positions = reinterpret_cast<const Vector3*>(attribs[0].mData.Data());
+  Dali::Vector<uint8_t> buffer(numVertices * sizeof(Vector3));
+  Internal::GenerateNormals(reinterpret_cast<const Vector3*>(attribs[0].GetData()), numVertices, indices, numIndices, reinterpret_cast<Vector3*>(buffer.Begin()), GetNumberOfAttributeJobHelpers());
 
-  Dali::Vector<uint8_t> buffer(attribs[0].mNumElements * sizeof(Vector3));
-  auto                  normals = reinterpret_cast<Vector3*>(buffer.Data());
-
-  for(uint32_t i = 0; i < numIndices; i += 3)
-  {
-    IndexType indices[]{getIndex(), getIndex(), getIndex()};
-    Vector3   pos[]{positions[indices[0]], positions[indices[1]], positions[indices[2]]};
-
-    Vector3 a = pos[1] - pos[0];
-    Vector3 b = pos[2] - pos[0];
-
-    Vector3 normal(a.Cross(b));
-    normals[indices[0]] += normal;
-    normals[indices[1]] += normal;
-    normals[indices[2]] += normal;
-  }
-
-  auto iEnd = normals + attribs[0].mNumElements;
-  while(normals != iEnd)
-  {
-    normals->Normalize();
-    ++normals;
-  }
-
-  attribs.PushBack(MeshDefinition::RawData::Attrib{"aNormal", Property::VECTOR3, attribs[0].mNumElements, std::move(buffer)});
+  attribs.PushBack(MeshDefinition::RawData::Attrib{"aNormal", Property::VECTOR3, numVertices, std::move(buffer)});
 
   return true;
 }
 
-template<bool use32BitsIndices, bool useVec3, bool hasUvs, typename T = std::conditional_t<useVec3, Vector3, Vector4>, typename = std::enable_if_t<(std::is_same<T, Vector3>::value || std::is_same<T, Vector4>::value)>, typename IndexProviderType = IndexProvider<use32BitsIndices>>
+template<bool use32BitsIndices, bool useVec3, bool hasUvs, typename T = std::conditional_t<useVec3, Vector3, Vector4>>
 bool GenerateTangents(MeshDefinition::RawData& raw)
 {
-  using IndexType = typename IndexProviderType::IndexType;
+  using IndexType = typename std::conditional_t<use32BitsIndices, uint32_t, uint16_t>;
 
   // mIndicies size must be even if we use 32bit indices.
   if(DALI_UNLIKELY(use32BitsIndices && !raw.mIndices.Empty() && !(raw.mIndices.Size() % (sizeof(IndexType) / sizeof(uint16_t)) == 0)))
@@ -373,78 +359,14 @@ bool GenerateTangents(MeshDefinition::RawData& raw)
     return false;
   }
 
-  Dali::Vector<uint8_t> buffer(attribs[0].mNumElements * sizeof(T));
-  auto                  tangents = reinterpret_cast<T*>(buffer.Data());
-
-  if constexpr(hasUvs)
-  {
-    IndexProviderType getIndex(raw.mIndices.Data());
-
-    const uint32_t numIndices = raw.mIndices.Empty() ? attribs[0].mNumElements : static_cast<uint32_t>(raw.mIndices.Size() / (sizeof(IndexType) / sizeof(uint16_t)));
-
-    auto* positions = reinterpret_cast<const Vector3*>(attribs[0].mData.Data());
-    auto* uvs       = reinterpret_cast<const Vector2*>(attribs[2].mData.Data());
-
-    for(uint32_t i = 0; i < numIndices; i += 3)
-    {
-      IndexType indices[]{getIndex(), getIndex(), getIndex()};
-      Vector3   pos[]{positions[indices[0]], positions[indices[1]], positions[indices[2]]};
-      Vector2   uv[]{uvs[indices[0]], uvs[indices[1]], uvs[indices[2]]};
-
-      float x0 = pos[1].x - pos[0].x;
-      float y0 = pos[1].y - pos[0].y;
-      float z0 = pos[1].z - pos[0].z;
-
-      float x1 = pos[2].x - pos[0].x;
-      float y1 = pos[2].y - pos[0].y;
-      float z1 = pos[2].z - pos[0].z;
-
-      float s0 = uv[1].x - uv[0].x;
-      float t0 = uv[1].y - uv[0].y;
-
-      float s1 = uv[2].x - uv[0].x;
-      float t1 = uv[2].y - uv[0].y;
-
-      float   det = (s0 * t1 - t0 * s1);
-      float   r   = 1.f / ((std::abs(det) < Dali::Epsilon<1000>::value) ? (Dali::Epsilon<1000>::value * (det > 0.0f ? 1.f : -1.f)) : det);
-      Vector3 tangent((x0 * t1 - t0 * x1) * r, (y0 * t1 - t0 * y1) * r, (z0 * t1 - t0 * z1) * r);
-      tangents[indices[0]] += T(tangent);
-      tangents[indices[1]] += T(tangent);
-      tangents[indices[2]] += T(tangent);
-    }
-  }
+  const uint32_t numVertices = std::min(attribs[0].mNumElements, attribs[1].mNumElements);
+  const uint32_t numIndices  = raw.mIndices.Empty() ? attribs[0].mNumElements : static_cast<uint32_t>(raw.mIndices.Size() / (sizeof(IndexType) / sizeof(uint16_t)));
+  const auto*    indices     = raw.mIndices.Empty() ? nullptr : reinterpret_cast<const IndexType*>(raw.mIndices.Begin());
+  const auto*    uvs         = hasUvs ? reinterpret_cast<const Vector2*>(attribs[2].GetData()) : nullptr;
 
-  auto* normals = reinterpret_cast<const Vector3*>(attribs[1].mData.Data());
-  auto  iEnd    = normals + attribs[1].mNumElements;
-  while(normals != iEnd)
-  {
-    Vector3 tangentVec3;
-    if constexpr(hasUvs)
-    {
-      // Calculated by indexs
-      tangentVec3 = Vector3((*tangents).x, (*tangents).y, (*tangents).z);
-    }
-    else
-    {
-      // Only choiced by normal vector. by indexs
-      Vector3 t[]{normals->Cross(Vector3::XAXIS), normals->Cross(Vector3::YAXIS)};
-      tangentVec3 = t[t[1].LengthSquared() > t[0].LengthSquared()];
-    }
-
-    tangentVec3 -= *normals * normals->Dot(tangentVec3);
-    tangentVec3.Normalize();
-    if constexpr(useVec3)
-    {
-      *tangents = tangentVec3;
-    }
-    else
-    {
-      *tangents = Vector4(tangentVec3.x, tangentVec3.y, tangentVec3.z, 1.0f);
-    }
+  Dali::Vector<uint8_t> buffer(attribs[0].mNumElements * sizeof(T));
+  Internal::GenerateTangents(reinterpret_cast<const Vector3*>(attribs[0].GetData()), reinterpret_cast<const Vector3*>(attribs[1].GetData()), uvs, numVertices, indices, numIndices, reinterpret_cast<T*>(buffer.Begin()), GetNumberOfAttributeJobHelpers());
 
-    ++tangents;
-    ++normals;
-  }
   attribs.PushBack(MeshDefinition::RawData::Attrib{"aTangent", useVec3 ? Property::VECTOR3 : Property::VECTOR4, attribs[0].mNumElements, std::move(buffer)});
 
   return true;
@@ -601,7 +523,7 @@ void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, Dali::Vector<MeshDefinit
       Dali::Vector<uint8_t>  buffer(bufferSize);
       Dali::Vector<uint32_t> sparseIndices{};
 
-      if(ReadAccessor(blendShape.deltas, buffers[blendShape.deltas.mBufferIdx].GetBufferStream(), buffer.Data(), &sparseIndices))
+      if(ReadAccessor(blendShape.deltas, GetBufferStream(buffers[blendShape.deltas.mBufferIdx]).stream, buffer.Data(), &sparseIndices))
       {
         GetDequantizedData(buffer, 3u, numVector3, blendShape.mFlags & MeshDefinition::POSITIONS_MASK, blendShape.deltas.mNormalized);
 
@@ -674,7 +596,7 @@ void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, Dali::Vector<MeshDefinit
       Dali::Vector<uint8_t>  buffer(bufferSize);
       Dali::Vector<uint32_t> sparseIndices;
 
-      if(ReadAccessor(blendShape.normals, buffers[blendShape.normals.mBufferIdx].GetBufferStream(), buffer.Data(), &sparseIndices))
+      if(ReadAccessor(blendShape.normals, GetBufferStream(buffers[blendShape.normals.mBufferIdx]).stream, buffer.Data(), &sparseIndices))
       {
         GetDequantizedData(buffer, 3u, numVector3, blendShape.mFlags & MeshDefinition::NORMALS_MASK, blendShape.normals.mNormalized);
 
@@ -749,7 +671,7 @@ void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, Dali::Vector<MeshDefinit
       Dali::Vector<uint8_t>  buffer(bufferSize);
       Dali::Vector<uint32_t> sparseIndices;
 
-      if(ReadAccessor(blendShape.tangents, buffers[blendShape.tangents.mBufferIdx].GetBufferStream(), buffer.Data(), &sparseIndices))
+      if(ReadAccessor(blendShape.tangents, GetBufferStream(buffers[blendShape.tangents.mBufferIdx]).stream, buffer.Data(), &sparseIndices))
       {
         GetDequantizedData(buffer, 3u, numVector3, blendShape.mFlags & MeshDefinition::TANGENTS_MASK, blendShape.tangents.mNormalized);
 
@@ -831,21 +753,91 @@ void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, Dali::Vector<MeshDefinit
   }
 }
 
-std::iostream& GetAvailableData(std::iostream* meshStream, const std::string& meshPath, BufferDefinition::Vector& buffers, Index bufferIdx, std::string& availablePath)
+LockedStream GetAvailableData(std::iostream* meshStream, const std::string& meshPath, BufferDefinition::Vector& buffers, Index bufferIdx, std::string& availablePath)
 {
   if(meshStream)
   {
     availablePath = meshPath;
     meshStream->imbue(std::locale::classic());
-    return *meshStream;
+    return LockedStream{{}, *meshStream};
   }
 
   // Only access buffer when meshStream is null and bufferIdx is valid
   DALI_ASSERT_ALWAYS(bufferIdx != INVALID_INDEX && bufferIdx < buffers.Size());
   availablePath = ToStdString(buffers[bufferIdx].GetUri());
-  auto& stream  = buffers[bufferIdx].GetBufferStream();
-  stream.imbue(std::locale::classic());
-  return stream;
+  auto source   = GetBufferStream(buffers[bufferIdx]);
+  source.stream.imbue(std::locale::classic());
+  return source;
+}
+
+///@brief Checks whether clamping @a count elements of @a numComponents @a values to @a min / @a max would leave them as they are.
+bool IsWithinMinMax(const Dali::Vector<float>& min, const Dali::Vector<float>& max, uint32_t numComponents, uint32_t count, const float* values)
+{
+  if(min.Empty() && max.Empty())
+  {
+    return true;
+  }
+
+  if(Max(min.Size(), max.Size()) != numComponents || (!min.Empty() && !max.Empty() && min.Size() != max.Size()))
+  {
+    return false;
+  }
+
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    for(uint32_t j = 0; j < numComponents; ++j)
+    {
+      // Written so that NaN-s fail the test, as clamping might replace them.
+      const float value = *values++;
+      if((!min.Empty() && !(value >= min[j])) || (!max.Empty() && !(value <= max[j])))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Retrieves the data of an accessor straight from the memory of its buffer, if it can be used as it is.
+ *
+ * That is the case if the elements are floats that follow each other tightly in a buffer which is mapped or decoded in memory,
+ * and there is nothing to dequantise, patch from sparse values or clamp to the min / max of the accessor.
+ * Otherwise the data has to be read into a copy and processed, and nullptr is returned.
+ *
+ * @param[in] accessor The accessor.
+ * @param[in] quantizationFlags The flags of the quantized types of the attribute; zero if it is made of floats.
+ * @param[in] fileStream The mesh file stream, if the mesh has its own file.
+ * @param[in] buffers The buffers of the resources.
+ * @param[in] numComponents The number of floats per element.
+ * @param[in] count The number of elements.
+ * @return The data, sharing the ownership of the buffer memory; or nullptr.
+ */
+std::shared_ptr<const uint8_t> GetMappedData(const MeshDefinition::Accessor& accessor, uint32_t quantizationFlags, std::iostream* fileStream, BufferDefinition::Vector& buffers, uint32_t numComponents, uint32_t count)
+{
+  const auto& blob = accessor.mBlob;
+  if(quantizationFlags != 0u || fileStream || accessor.mSparse || accessor.mNormalized ||
+     !blob.IsDefined() || !blob.IsConsecutive() || blob.mLength != numComponents * count * sizeof(float) || blob.mOffset % alignof(float) != 0u ||
+     accessor.mBufferIdx == INVALID_INDEX || accessor.mBufferIdx >= buffers.Size())
+  {
+    return {};
+  }
+
+  std::shared_ptr<const uint8_t> data;
+  uint32_t                       dataSize;
+  {
+    std::scoped_lock<std::mutex> lock(buffers[accessor.mBufferIdx].GetBufferStreamMutex());
+    data     = buffers[accessor.mBufferIdx].GetData();
+    dataSize = buffers[accessor.mBufferIdx].GetDataSize();
+  }
+
+  if(!data || static_cast<uint64_t>(blob.mOffset) + blob.mLength > dataSize ||
+     !IsWithinMinMax(blob.mMin, blob.mMax, numComponents, count, reinterpret_cast<const float*>(data.get() + blob.mOffset)))
+  {
+    return {};
+  }
+
+  return std::shared_ptr<const uint8_t>(data, data.get() + blob.mOffset);
 }
 
 template<bool needsNormalize>
@@ -861,12 +853,12 @@ void ReadTypedVectorAccessors(LoadAccessorListInputs loadAccessorListInputs, Loa
       continue;
     }
     std::string        pathJoint;
-    auto&              dataStream = GetAvailableData(loadAccessorListInputs.fileStream, loadAccessorListInputs.meshPath, loadAccessorListInputs.buffers, accessor.mBufferIdx, pathJoint);
+    auto               source = GetAvailableData(loadAccessorListInputs.fileStream, loadAccessorListInputs.meshPath, loadAccessorListInputs.buffers, accessor.mBufferIdx, pathJoint);
     std::ostringstream name;
     name.imbue(std::locale::classic());
     name << attributeName << setIndex++;
     std::vector<uint8_t> tmpBuf;
-    ReadTypedVectorAccessor<needsNormalize>(loadDataType, accessor, dataStream, tmpBuf);
+    ReadTypedVectorAccessor<needsNormalize>(loadDataType, accessor, source.stream, tmpBuf);
     Dali::Vector<uint8_t> buffer;
     buffer.Insert(buffer.End(), tmpBuf.data(), tmpBuf.data() + tmpBuf.size());
     loadAccessorListInputs.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{ToDaliString(name.str()), Property::VECTOR4, static_cast<uint32_t>(buffer.Size() / sizeof(Vector4)), std::move(buffer)});
@@ -886,8 +878,7 @@ void LoadIndices(LoadAccessorInputs indicesInput)
       indicesInput.rawData.mIndices.Resize(indexCount * 2); // NOTE: we need space for uint32_ts initially.
 
       std::string path;
-      auto&       stream = GetAvailableData(indicesInput.fileStream, indicesInput.meshPath, indicesInput.buffers, indicesInput.accessor.mBufferIdx, path);
-      if(!ReadAccessor(indicesInput.accessor, stream, reinterpret_cast<uint8_t*>(indicesInput.rawData.mIndices.Data())))
+      if(!ReadAccessor(indicesInput.accessor, GetAvailableData(indicesInput.fileStream, indicesInput.meshPath, indicesInput.buffers, indicesInput.accessor.mBufferIdx, path), reinterpret_cast<uint8_t*>(indicesInput.rawData.mIndices.Data())))
       {
         DALI_LOG_ERROR("Failed to read indices from %s\n", path.c_str());
         ExceptionFlinger(ASSERT_LOCATION) << "Failed to read indices from '" << path << "'.";
@@ -903,8 +894,7 @@ void LoadIndices(LoadAccessorInputs indicesInput)
 
       std::string path;
       auto        u8s    = reinterpret_cast<uint8_t*>(indicesInput.rawData.mIndices.Data()) + indexCount;
-      auto&       stream = GetAvailableData(indicesInput.fileStream, indicesInput.meshPath, indicesInput.buffers, indicesInput.accessor.mBufferIdx, path);
-      if(!ReadAccessor(indicesInput.accessor, stream, u8s))
+      if(!ReadAccessor(indicesInput.accessor, GetAvailableData(indicesInput.fileStream, indicesInput.meshPath, indicesInput.buffers, indicesInput.accessor.mBufferIdx, path), u8s))
       {
         DALI_LOG_ERROR("Failed to read indices from %s\n", path.c_str());
         ExceptionFlinger(ASSERT_LOCATION) << "Failed to read indices from '" << path << "'.";
@@ -927,8 +917,7 @@ void LoadIndices(LoadAccessorInputs indicesInput)
       indicesInput.rawData.mIndices.Resize(indicesInput.accessor.mBlob.mLength / sizeof(unsigned short));
 
       std::string path;
-      auto&       stream = GetAvailableData(indicesInput.fileStream, indicesInput.meshPath, indicesInput.buffers, indicesInput.accessor.mBufferIdx, path);
-      if(!ReadAccessor(indicesInput.accessor, stream, reinterpret_cast<uint8_t*>(indicesInput.rawData.mIndices.Data())))
+      if(!ReadAccessor(indicesInput.accessor, GetAvailableData(indicesInput.fileStream, indicesInput.meshPath, indicesInput.buffers, indicesInput.accessor.mBufferIdx, path), reinterpret_cast<uint8_t*>(indicesInput.rawData.mIndices.Data())))
       {
         DALI_LOG_ERROR("Failed to read indices from %s\n", path.c_str());
         ExceptionFlinger(ASSERT_LOCATION) << "Failed to read indicesInput.accessor from '" << path << "'.";
@@ -967,11 +956,22 @@ uint32_t LoadPositions(LoadAccessorInputs positionsInput, bool hasBlendShape)
       numVector3 = static_cast<uint32_t>(bufferSize / sizeof(Vector3));
     }
 
+    auto mappedData = GetMappedData(positionsInput.accessor, positionsInput.flags & MeshDefinition::FlagMasks::POSITIONS_MASK, positionsInput.fileStream, positionsInput.buffers, 3u, numVector3);
+    if(mappedData)
+    {
+      if(positionsInput.accessor.mBlob.mMin.Size() != 3u || positionsInput.accessor.mBlob.mMax.Size() != 3u)
+      {
+        MeshDefinition::Blob::ComputeMinMax(positionsInput.accessor.mBlob.mMin, positionsInput.accessor.mBlob.mMax, 3u, numVector3, reinterpret_cast<const float*>(mappedData.get()));
+      }
+
+      positionsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aPosition", Property::VECTOR3, numVector3, {}, std::move(mappedData)});
+      return numVector3;
+    }
+
     Dali::Vector<uint8_t> buffer(bufferSize);
 
     std::string path;
-    auto&       stream = GetAvailableData(positionsInput.fileStream, positionsInput.meshPath, positionsInput.buffers, positionsInput.accessor.mBufferIdx, path);
-    if(!ReadAccessor(positionsInput.accessor, stream, buffer.Data()))
+    if(!ReadAccessor(positionsInput.accessor, GetAvailableData(positionsInput.fileStream, positionsInput.meshPath, positionsInput.buffers, positionsInput.accessor.mBufferIdx, path), buffer.Data()))
     {
       ExceptionFlinger(ASSERT_LOCATION) << "Failed to read positions from '" << path << "'.";
     }
@@ -1033,25 +1033,32 @@ bool LoadNormals(LoadAccessorInputs normalsInput, bool isTriangles, uint32_t pos
       numVector3 = static_cast<uint32_t>(bufferSize / sizeof(Vector3));
     }
 
-    Dali::Vector<uint8_t> buffer(bufferSize);
-
-    std::string path;
-    auto&       stream = GetAvailableData(normalsInput.fileStream, normalsInput.meshPath, normalsInput.buffers, normalsInput.accessor.mBufferIdx, path);
-    if(!ReadAccessor(normalsInput.accessor, stream, buffer.Data()))
+    auto mappedData = GetMappedData(normalsInput.accessor, normalsInput.flags & MeshDefinition::FlagMasks::NORMALS_MASK, normalsInput.fileStream, normalsInput.buffers, 3u, numVector3);
+    if(mappedData)
     {
-      ExceptionFlinger(ASSERT_LOCATION) << "Failed to read normals from '" << path << "'.";
+      normalsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aNormal", Property::VECTOR3, numVector3, {}, std::move(mappedData)});
     }
+    else
+    {
+      Dali::Vector<uint8_t> buffer(bufferSize);
 
-    GetDequantizedData(buffer, 3u, numVector3, normalsInput.flags & MeshDefinition::FlagMasks::NORMALS_MASK, normalsInput.accessor.mNormalized);
+      std::string path;
+      if(!ReadAccessor(normalsInput.accessor, GetAvailableData(normalsInput.fileStream, normalsInput.meshPath, normalsInput.buffers, normalsInput.accessor.mBufferIdx, path), buffer.Data()))
+      {
+        ExceptionFlinger(ASSERT_LOCATION) << "Failed to read normals from '" << path << "'.";
+      }
 
-    if(normalsInput.accessor.mNormalized)
-    {
-      GetDequantizedMinMax(normalsInput.accessor.mBlob.mMin, normalsInput.accessor.mBlob.mMax, normalsInput.flags & MeshDefinition::FlagMasks::NORMALS_MASK);
-    }
+      GetDequantizedData(buffer, 3u, numVector3, normalsInput.flags & MeshDefinition::FlagMasks::NORMALS_MASK, normalsInput.accessor.mNormalized);
+
+      if(normalsInput.accessor.mNormalized)
+      {
+        GetDequantizedMinMax(normalsInput.accessor.mBlob.mMin, normalsInput.accessor.mBlob.mMax, normalsInput.flags & MeshDefinition::FlagMasks::NORMALS_MASK);
+      }
 
-    normalsInput.accessor.mBlob.ApplyMinMax(numVector3, reinterpret_cast<float*>(buffer.Data()));
+      normalsInput.accessor.mBlob.ApplyMinMax(numVector3, reinterpret_cast<float*>(buffer.Data()));
 
-    normalsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aNormal", Property::VECTOR3, numVector3, std::move(buffer)});
+      normalsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aNormal", Property::VECTOR3, numVector3, std::move(buffer)});
+    }
   }
   else if(normalsInput.accessor.mBlob.mLength != 0 && isTriangles)
   {
@@ -1104,35 +1111,43 @@ void LoadTextureCoordinates(LoadAccessorListInputs textureCoordinatesInput)
       uvCount = static_cast<uint32_t>(bufferSize / sizeof(Vector2));
     }
 
-    Dali::Vector<uint8_t> buffer(bufferSize);
-
-    std::string path;
-    auto&       stream = GetAvailableData(textureCoordinatesInput.fileStream, textureCoordinatesInput.meshPath, textureCoordinatesInput.buffers, texCoords.mBufferIdx, path);
-    if(!ReadAccessor(texCoords, stream, buffer.Data()))
+    // Flipping changes the data, so it needs a copy too.
+    auto mappedData = MaskMatch(textureCoordinatesInput.flags, MeshDefinition::Flags::FLIP_UVS_VERTICAL) ? nullptr : GetMappedData(texCoords, textureCoordinatesInput.flags & MeshDefinition::FlagMasks::TEXCOORDS_MASK, textureCoordinatesInput.fileStream, textureCoordinatesInput.buffers, 2u, uvCount);
+    if(mappedData)
     {
-      ExceptionFlinger(ASSERT_LOCATION) << "Failed to read uv-s from '" << path << "'.";
+      textureCoordinatesInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aTexCoord", Property::VECTOR2, static_cast<uint32_t>(uvCount), {}, std::move(mappedData)});
     }
+    else
+    {
+      Dali::Vector<uint8_t> buffer(bufferSize);
 
-    GetDequantizedData(buffer, 2u, uvCount, textureCoordinatesInput.flags & MeshDefinition::FlagMasks::TEXCOORDS_MASK, texCoords.mNormalized);
+      std::string path;
+      if(!ReadAccessor(texCoords, GetAvailableData(textureCoordinatesInput.fileStream, textureCoordinatesInput.meshPath, textureCoordinatesInput.buffers, texCoords.mBufferIdx, path), buffer.Data()))
+      {
+        ExceptionFlinger(ASSERT_LOCATION) << "Failed to read uv-s from '" << path << "'.";
+      }
 
-    if(MaskMatch(textureCoordinatesInput.flags, MeshDefinition::Flags::FLIP_UVS_VERTICAL))
-    {
-      auto uv    = reinterpret_cast<Vector2*>(buffer.Data());
-      auto uvEnd = uv + uvCount;
-      while(uv != uvEnd)
+      GetDequantizedData(buffer, 2u, uvCount, textureCoordinatesInput.flags & MeshDefinition::FlagMasks::TEXCOORDS_MASK, texCoords.mNormalized);
+
+      if(MaskMatch(textureCoordinatesInput.flags, MeshDefinition::Flags::FLIP_UVS_VERTICAL))
       {
-        uv->y = 1.0f - uv->y;
-        ++uv;
+        auto uv    = reinterpret_cast<Vector2*>(buffer.Data());
+        auto uvEnd = uv + uvCount;
+        while(uv != uvEnd)
+        {
+          uv->y = 1.0f - uv->y;
+          ++uv;
+        }
       }
-    }
 
-    if(texCoords.mNormalized)
-    {
-      GetDequantizedMinMax(texCoords.mBlob.mMin, texCoords.mBlob.mMax, textureCoordinatesInput.flags & MeshDefinition::FlagMasks::TEXCOORDS_MASK);
-    }
+      if(texCoords.mNormalized)
+      {
+        GetDequantizedMinMax(texCoords.mBlob.mMin, texCoords.mBlob.mMax, textureCoordinatesInput.flags & MeshDefinition::FlagMasks::TEXCOORDS_MASK);
+      }
 
-    texCoords.mBlob.ApplyMinMax(static_cast<uint32_t>(uvCount), reinterpret_cast<float*>(buffer.Data()));
-    textureCoordinatesInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aTexCoord", Property::VECTOR2, static_cast<uint32_t>(uvCount), std::move(buffer)});
+      texCoords.mBlob.ApplyMinMax(static_cast<uint32_t>(uvCount), reinterpret_cast<float*>(buffer.Data()));
+      textureCoordinatesInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aTexCoord", Property::VECTOR2, static_cast<uint32_t>(uvCount), std::move(buffer)});
+    }
   }
 }
 
@@ -1169,25 +1184,32 @@ void LoadTangents(LoadAccessorInputs tangentsInput, bool hasNormals, bool hasUvs
       numTangents = static_cast<uint32_t>(bufferSize / propertySize);
     }
 
-    Dali::Vector<uint8_t> buffer(bufferSize);
-
-    std::string path;
-    auto&       stream = GetAvailableData(tangentsInput.fileStream, tangentsInput.meshPath, tangentsInput.buffers, tangentsInput.accessor.mBufferIdx, path);
-    if(!ReadAccessor(tangentsInput.accessor, stream, buffer.Data()))
+    auto mappedData = GetMappedData(tangentsInput.accessor, tangentsInput.flags & MeshDefinition::FlagMasks::TANGENTS_MASK, tangentsInput.fileStream, tangentsInput.buffers, componentCount, numTangents);
+    if(mappedData)
     {
-      ExceptionFlinger(ASSERT_LOCATION) << "Failed to read tangents from '" << path << "'.";
+      tangentsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aTangent", tangentType, static_cast<uint32_t>(numTangents), {}, std::move(mappedData)});
     }
+    else
+    {
+      Dali::Vector<uint8_t> buffer(bufferSize);
 
-    GetDequantizedData(buffer, componentCount, numTangents, tangentsInput.flags & MeshDefinition::FlagMasks::TANGENTS_MASK, tangentsInput.accessor.mNormalized);
+      std::string path;
+      if(!ReadAccessor(tangentsInput.accessor, GetAvailableData(tangentsInput.fileStream, tangentsInput.meshPath, tangentsInput.buffers, tangentsInput.accessor.mBufferIdx, path), buffer.Data()))
+      {
+        ExceptionFlinger(ASSERT_LOCATION) << "Failed to read tangents from '" << path << "'.";
+      }
 
-    if(tangentsInput.accessor.mNormalized)
-    {
-      GetDequantizedMinMax(tangentsInput.accessor.mBlob.mMin, tangentsInput.accessor.mBlob.mMax, tangentsInput.flags & MeshDefinition::FlagMasks::TANGENTS_MASK);
-    }
+      GetDequantizedData(buffer, componentCount, numTangents, tangentsInput.flags & MeshDefinition::FlagMasks::TANGENTS_MASK, tangentsInput.accessor.mNormalized);
+
+      if(tangentsInput.accessor.mNormalized)
+      {
+        GetDequantizedMinMax(tangentsInput.accessor.mBlob.mMin, tangentsInput.accessor.mBlob.mMax, tangentsInput.flags & MeshDefinition::FlagMasks::TANGENTS_MASK);
+      }
 
-    tangentsInput.accessor.mBlob.ApplyMinMax(numTangents, reinterpret_cast<float*>(buffer.Data()));
+      tangentsInput.accessor.mBlob.ApplyMinMax(numTangents, reinterpret_cast<float*>(buffer.Data()));
 
-    tangentsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aTangent", tangentType, static_cast<uint32_t>(numTangents), std::move(buffer)});
+      tangentsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aTangent", tangentType, static_cast<uint32_t>(numTangents), std::move(buffer)});
+    }
   }
   else if(tangentsInput.accessor.mBlob.mLength != 0 && hasNormals && isTriangles)
   {
@@ -1234,18 +1256,28 @@ void LoadColors(LoadAccessorListInputs colorsInput)
       DALI_ASSERT_ALWAYS(((colorsInput.accessors[0].mBlob.mLength % propertySize == 0) ||
                           colorsInput.accessors[0].mBlob.mStride >= propertySize) &&
                          "Colors buffer length not a multiple of element size");
-      const auto            bufferSize = colorsInput.accessors[0].mBlob.GetBufferSize();
-      Dali::Vector<uint8_t> buffer(bufferSize);
+      const uint32_t numComponents = propertySize / sizeof(float);
+      const uint32_t numColors     = colorsInput.accessors[0].mBlob.GetBufferSize() / propertySize;
 
-      std::string path;
-      auto&       stream = GetAvailableData(colorsInput.fileStream, colorsInput.meshPath, colorsInput.buffers, colorsInput.accessors[0].mBufferIdx, path);
-      if(!ReadAccessor(colorsInput.accessors[0], stream, buffer.Data()))
+      auto mappedData = GetMappedData(colorsInput.accessors[0], 0u, colorsInput.fileStream, colorsInput.buffers, numComponents, numColors);
+      if(mappedData)
       {
-        ExceptionFlinger(ASSERT_LOCATION) << "Failed to read colors from '" << path << "'.";
+        colorsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aVertexColor", propertyType, numColors, {}, std::move(mappedData)});
       }
-      colorsInput.accessors[0].mBlob.ApplyMinMax(bufferSize / propertySize, reinterpret_cast<float*>(buffer.Data()));
+      else
+      {
+        const auto            bufferSize = colorsInput.accessors[0].mBlob.GetBufferSize();
+        Dali::Vector<uint8_t> buffer(bufferSize);
 
-      colorsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aVertexColor", propertyType, static_cast<uint32_t>(bufferSize / propertySize), std::move(buffer)});
+        std::string path;
+        if(!ReadAccessor(colorsInput.accessors[0], GetAvailableData(colorsInput.fileStream, colorsInput.meshPath, colorsInput.buffers, colorsInput.accessors[0].mBufferIdx, path), buffer.Data()))
+        {
+          ExceptionFlinger(ASSERT_LOCATION) << "Failed to read colors from '" << path << "'.";
+        }
+        colorsInput.accessors[0].mBlob.ApplyMinMax(bufferSize / propertySize, reinterpret_cast<float*>(buffer.Data()));
+
+        colorsInput.rawData.mAttribs.PushBack(MeshDefinition::RawData::Attrib{"aVertexColor", propertyType, static_cast<uint32_t>(bufferSize / propertySize), std::move(buffer)});
+      }
     }
   }
   else if(!colorsInput.rawData.mAttribs.Empty())
@@ -1348,6 +1380,73 @@ void LoadBlendShapes(MeshDefinition::RawData& rawData, Dali::Vector<MeshDefiniti
   }
 }
 
+/**
+ * @brief Generates simplified levels of detail of an indexed triangle mesh, and adds their indices after the ones of the mesh.
+ *
+ * Each level has about half the triangles of the previous one. It stops early when a mesh gets too small, or can't be simplified much more.
+ * This runs on every load of the mesh, as the levels aren't persisted.
+ */
+void GenerateLevelsOfDetail(MeshDefinition::RawData& rawData, bool hasU32Indices)
+{
+  const uint32_t numberOfLevels = Internal::GetNumberOfGeneratedLevelsOfDetail();
+  if(numberOfLevels == 0u || rawData.mIndices.Empty())
+  {
+    return;
+  }
+
+  auto positions = std::find_if(rawData.mAttribs.Begin(), rawData.mAttribs.End(), [](const MeshDefinition::RawData::Attrib& attrib)
+  { return attrib.mType == Property::VECTOR3 && ToStdString(attrib.mName) == "aPosition"; });
+  if(positions == rawData.mAttribs.End())
+  {
+    return;
+  }
+
+  std::vector<uint32_t> indices;
+  if(hasU32Indices)
+  {
+    const auto u32s = reinterpret_cast<const uint32_t*>(rawData.mIndices.Begin());
+    indices.assign(u32s, u32s + rawData.mIndices.Count() / 2u);
+  }
+  else
+  {
+    indices.assign(rawData.mIndices.Begin(), rawData.mIndices.End());
+  }
+
+  Dali::Vector<uint32_t> lodIndexCounts;
+  lodIndexCounts.PushBack(static_cast<uint32_t>(indices.size()));
+  for(uint32_t level = 0u; level < numberOfLevels && indices.size() / 3u >= MINIMUM_NUMBER_OF_LOD_TRIANGLES; ++level)
+  {
+    const uint32_t targetNumIndices = static_cast<uint32_t>(indices.size() / 6u * 3u);
+    auto           simplified       = Internal::SimplifyMesh(reinterpret_cast<const Vector3*>(positions->GetData()), positions->mNumElements, indices.data(), static_cast<uint32_t>(indices.size()), targetNumIndices);
+    if(simplified.size() > indices.size() * MAXIMUM_LOD_INDEX_RATIO)
+    {
+      break;
+    }
+
+    if(hasU32Indices)
+    {
+      const auto offset = rawData.mIndices.Count();
+      rawData.mIndices.Resize(offset + simplified.size() * 2u);
+      memcpy(rawData.mIndices.Begin() + offset, simplified.data(), simplified.size() * sizeof(uint32_t));
+    }
+    else
+    {
+      rawData.mIndices.Reserve(rawData.mIndices.Count() + simplified.size());
+      for(const auto index : simplified)
+      {
+        rawData.mIndices.PushBack(static_cast<uint16_t>(index));
+      }
+    }
+    lodIndexCounts.PushBack(static_cast<uint32_t>(simplified.size()));
+    indices = std::move(simplified);
+  }
+
+  if(lodIndexCounts.Count() > 1u)
+  {
+    rawData.mLodIndexCounts = std::move(lodIndexCounts);
+  }
+}
+
 } // namespace
 
 MeshDefinition::SparseBlob::SparseBlob(const Blob& indices, const Blob& values, uint32_t count)
@@ -1463,7 +1562,7 @@ void MeshDefinition::RawData::Attrib::AttachBuffer(Geometry& g) const
   Property::Map attribMap;
   attribMap[ToDaliString(mName)] = mType;
   VertexBuffer attribBuffer      = VertexBuffer::New(attribMap);
-  attribBuffer.SetData(mData.Data(), mNumElements);
+  attribBuffer.SetData(GetData(), mNumElements);
 
   g.AddVertexBuffer(attribBuffer);
 }
@@ -1566,6 +1665,11 @@ MeshDefinition::LoadRaw(const Dali::String& modelsPath, BufferDefinition::Vector
   }
 
   LoadBlendShapes(raw, mBlendShapes, mBlendShapeHeader, mBlendShapeVersion, numberOfVertices, fileStream, buffers);
+
+  if(isTriangles)
+  {
+    GenerateLevelsOfDetail(raw, MaskMatch(mFlags, U32_INDICES));
+  }
   return raw;
 }
 
@@ -1600,6 +1704,8 @@ MeshGeometry MeshDefinition::Load(RawData&& raw) const
       a.AttachBuffer(meshGeometry.geometry);
     }
 
+    meshGeometry.lodIndexCounts = std::move(raw.mLodIndexCounts);
+
     if(HasBlendShapes())
     {
       meshGeometry.blendShapeBufferOffset      = raw.mBlendShapeBufferOffset;
@@ -246,10 +246,20 @@ struct DALI_SCENE3D_API MeshDefinition
   {
     struct Attrib
     {
-      Dali::String          mName;
-      Property::Type        mType;
-      uint32_t              mNumElements;
-      Dali::Vector<uint8_t> mData;
+      Dali::String                   mName;
+      Property::Type                 mType;
+      uint32_t                       mNumElements;
+      Dali::Vector<uint8_t>          mData;
+      std::shared_ptr<const uint8_t> mMappedData; ///< If set, the data is used from the buffer memory as it is, and mData is empty.
+
+      /**
+       * @brief Retrieves the data of the attribute, from the buffer memory or mData.
+       * @SINCE_2_5.35
+       */
+      const uint8_t* GetData() const
+      {
+        return mMappedData ? mMappedData.get() : mData.Begin();
+      }
 
       void AttachBuffer(Geometry& g) const;
     };
@@ -257,6 +267,14 @@ struct DALI_SCENE3D_API MeshDefinition
     Dali::Vector<uint16_t> mIndices;
     Dali::Vector<Attrib>   mAttribs;
 
+    /**
+     * @brief The number of indices of each level of detail, from the original mesh, if any were generated.
+     * The indices of the levels follow each other in mIndices.
+     * The levels are generated each time the mesh is loaded; they aren't stored anywhere.
+     * @SINCE_2_5.35
+     */
+    Dali::Vector<uint32_t> mLodIndexCounts;
+
     unsigned int        mBlendShapeBufferOffset{0};
     Dali::Vector<float> mBlendShapeUnnormalizeFactor;
     PixelData           mBlendShapeData;
@@ -20,6 +20,7 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/rendering/geometry.h>
 #include <dali/public-api/rendering/texture.h>
+#include <dali/public-api/rendering/vertex-buffer.h>
 
 // INTERNAL INCLUDES
 #include <dali-scene3d/public-api/api.h>
@@ -29,10 +30,12 @@ namespace Dali::Scene3D::Loader
 {
 struct DALI_SCENE3D_API MeshGeometry
 {
-  Geometry      geometry;                    ///< The array of vertices. @SINCE_2_0.7
-  Texture       blendShapeGeometry;          ///< The array of vertices of the different blend shapes encoded inside a texture with power of two dimensions. @SINCE_2_0.7
-  Vector<float> blendShapeUnnormalizeFactor; ///< Factor used to unnormalize the geometry of the blend shape. @SINCE_2_0.7
-  unsigned int  blendShapeBufferOffset{0};   ///< Offset used to calculate the start of each blend shape. @SINCE_2_0.20
+  Geometry         geometry;                    ///< The array of vertices. @SINCE_2_0.7
+  Texture          blendShapeGeometry;          ///< The array of vertices of the different blend shapes encoded inside a texture with power of two dimensions. @SINCE_2_0.7
+  Vector<float>    blendShapeUnnormalizeFactor; ///< Factor used to unnormalize the geometry of the blend shape. @SINCE_2_0.7
+  unsigned int     blendShapeBufferOffset{0};   ///< Offset used to calculate the start of each blend shape. @SINCE_2_0.20
+  Vector<uint32_t> lodIndexCounts;              ///< The number of indices of each level of detail, which follow each other in the index buffer. Empty without levels of detail. @SINCE_2_5.35
+  VertexBuffer     instanceBuffer;              ///< The transforms of the instances, once added to the geometry of an instanced node. @SINCE_2_5.35
 };
 
 } // namespace Dali::Scene3D::Loader
@@ -20,10 +20,12 @@
 #include <dali-scene3d/integration-api/loader/model-loader.h>
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include <dlfcn.h>
 #include <algorithm>
+#include <cstdlib>
 #include <filesystem>
 #include <memory>
 
@@ -45,6 +47,8 @@ constexpr std::string_view USDA_EXTENSION     = ".usda";
 constexpr std::string_view USDC_EXTENSION     = ".usdc";
 constexpr std::string_view METADATA_EXTENSION = "metadata";
 
+const char* DALI_SCENE3D_INSTANCING_MINIMUM_COUNT("DALI_SCENE3D_INSTANCING_MINIMUM_COUNT");
+
 const char* USD_LOADER_SO("libdali2-usd-loader.so");
 const char* CREATE_USD_LOADER_SYMBOL("CreateUsdLoader");
 
@@ -77,6 +81,30 @@ extern "C" void* DlsymProxy(void* handle, const char* name)
   return dlsym(handle, name);
 }
 
+/**
+ * @brief Retrieves how many identical sibling nodes are drawn as the instances of one node, at least.
+ *
+ * It's set by the DALI_SCENE3D_INSTANCING_MINIMUM_COUNT environment variable, and 0 (never) by default.
+ */
+uint32_t GetMinimumNumberOfInstances()
+{
+  static const uint32_t minimumNumberOfInstances = []()
+  {
+    uint32_t minimum = 0u;
+
+    // Check environment variable for DALI_SCENE3D_INSTANCING_MINIMUM_COUNT
+    auto minimumString = EnvironmentVariable::GetEnvironmentVariable(DALI_SCENE3D_INSTANCING_MINIMUM_COUNT);
+    if(minimumString)
+    {
+      minimum = static_cast<uint32_t>(std::max(std::atoi(minimumString), 0));
+      DALI_LOG_RELEASE_INFO("Scene3D instancing minimum count:%u\n", minimum);
+    }
+    return minimum;
+  }();
+
+  return minimumNumberOfInstances;
+}
+
 } // namespace
 
 ModelLoader::ModelLoader(const Dali::String& modelUrl, const Dali::String& resourceDirectoryUrl, Dali::Scene3D::Loader::LoadResult& loadResult)
@@ -106,6 +134,10 @@ bool ModelLoader::LoadModel(Dali::Scene3D::Loader::ResourceBundle::PathProvider&
 
   Dali::Scene3D::Loader::LoadSceneMetadata(metaDataUrl.c_str(), mLoadResult.mSceneMetadata);
   loadSucceeded = mImpl->LoadModel(mModelUrl, mLoadResult);
+  if(loadSucceeded && GetMinimumNumberOfInstances() > 0u)
+  {
+    GetScene().InstanceRepeatedNodes(GetResources(), GetAnimations(), GetMinimumNumberOfInstances());
+  }
   LoadResource(pathProvider, loadOnlyRawResource);
 
   return loadSucceeded;
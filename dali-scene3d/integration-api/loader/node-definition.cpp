@@ -22,6 +22,10 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include <dali/public-api/common/dali-utility.h>
+#include <dali/public-api/rendering/vertex-buffer.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 // INTERNAL INCLUDES
 #include <dali-scene3d/internal/light/light-impl.h>
@@ -98,6 +102,56 @@ Vector4 GetTextureFactor(Scene3D::Loader::MaterialDefinition& materialDefinition
   return factor;
 }
 
+/**
+ * @brief Creates a vertex buffer of the transforms of the instances, one column of each matrix per attribute.
+ */
+VertexBuffer CreateInstanceBuffer(const Dali::Vector<Matrix>& instanceTransforms)
+{
+  Property::Map format;
+  format["aInstanceMatrix0"] = Property::VECTOR4;
+  format["aInstanceMatrix1"] = Property::VECTOR4;
+  format["aInstanceMatrix2"] = Property::VECTOR4;
+  format["aInstanceMatrix3"] = Property::VECTOR4;
+
+  VertexBuffer instanceBuffer = VertexBuffer::New(format);
+  instanceBuffer.SetData(instanceTransforms.Begin(), instanceTransforms.Count());
+  instanceBuffer.SetDivisor(1u);
+  return instanceBuffer;
+}
+
+/**
+ * @brief Retrieves the radius of a sphere around the origin that contains all the instances of a mesh.
+ */
+float GetInstancedBoundingRadius(const Dali::Vector<Matrix>& instanceTransforms, float boundingRadius)
+{
+  float instancedRadius = 0.0f;
+  for(const auto& transform : instanceTransforms)
+  {
+    const float scale = std::max({transform.GetXAxis().Length(), transform.GetYAxis().Length(), transform.GetZAxis().Length()});
+    instancedRadius   = std::max(instancedRadius, transform.GetTranslation3().Length() + boundingRadius * scale);
+  }
+  return instancedRadius;
+}
+
+/**
+ * @brief Extends a box to contain all the instances of a mesh.
+ */
+void GetInstancedBoundingBox(const Dali::Vector<Matrix>& instanceTransforms, Vector3& min, Vector3& max)
+{
+  const Vector3 corners[2]{min, max};
+  min = Vector3::ONE * std::numeric_limits<float>::max();
+  max = Vector3::ONE * std::numeric_limits<float>::lowest();
+  for(const auto& transform : instanceTransforms)
+  {
+    for(uint32_t i = 0u; i < 8u; ++i)
+    {
+      const Vector4 corner = transform * Vector4(corners[i & 1u].x, corners[(i >> 1u) & 1u].y, corners[(i >> 2u) & 1u].z, 1.0f);
+      min                  = Vector3(std::min(min.x, corner.x), std::min(min.y, corner.y), std::min(min.z, corner.z));
+      max                  = Vector3(std::max(max.x, corner.x), std::max(max.y, corner.y), std::max(max.z, corner.z));
+    }
+  }
+}
+
 } // namespace
 
 namespace Scene3D
@@ -273,14 +327,26 @@ void ModelRenderable::OnCreate(const NodeDefinition& nodeDefinition, NodeDefinit
   auto& resources = params.mResources;
   auto& mesh      = resources.mMeshes[mMeshIdx];
 
+  // The geometry of an instanced mesh is only used by this node, so it's shared with any other model of the same scene.
+  const uint32_t instanceCount = static_cast<uint32_t>(nodeDefinition.mInstanceTransforms.Count());
+  if(instanceCount > 0u && !mesh.second.instanceBuffer)
+  {
+    mesh.second.instanceBuffer = CreateInstanceBuffer(nodeDefinition.mInstanceTransforms);
+    mesh.second.geometry.AddVertexBuffer(mesh.second.instanceBuffer);
+  }
+
   ShaderOption::HashType shaderOptionHash{0u};
   Renderer               renderer;
   if(mShaderIdx == INVALID_INDEX)
   {
     ShaderOption option = params.mShaderManager->ProduceShaderOption(params.mResources.mMaterials[mMaterialIdx].first,
                                                                      params.mResources.mMeshes[mMeshIdx].first);
-    shaderOptionHash    = option.GetOptionHash();
-    Shader shader       = params.mShaderManager->ProduceShader(option);
+    if(instanceCount > 0u)
+    {
+      option.AddOption(ShaderOption::Type::INSTANCING);
+    }
+    shaderOptionHash = option.GetOptionHash();
+    Shader shader    = params.mShaderManager->ProduceShader(option);
 
     renderer = Renderer::New(mesh.second.geometry, shader);
 
@@ -334,6 +400,33 @@ void ModelRenderable::OnCreate(const NodeDefinition& nodeDefinition, NodeDefinit
     primitive.SetBlendShapeGeometry(mesh.second.blendShapeGeometry);
     primitive.SetSkinned(mesh.first.IsSkinned(), mesh.first.GetNumberOfJointSets());
     primitive.SetVertexColor(mesh.first.HasVertexColor());
+    primitive.SetInstanceCount(instanceCount);
+
+    if(!mesh.second.lodIndexCounts.Empty())
+    {
+      // The index buffer holds every level, so the renderer is always restricted to one of them.
+      // Without the bounds of the positions, the radius is zero and the most detailed level is kept.
+      float radius = 0.0f;
+      if(mesh.first.mPositions.mBlob.mMin.Size() == 3u && mesh.first.mPositions.mBlob.mMax.Size() == 3u)
+      {
+        const auto&   min = mesh.first.mPositions.mBlob.mMin;
+        const auto&   max = mesh.first.mPositions.mBlob.mMax;
+        const Vector3 extent(std::max(std::abs(min[0]), std::abs(max[0])), std::max(std::abs(min[1]), std::abs(max[1])), std::max(std::abs(min[2]), std::abs(max[2])));
+        radius = instanceCount > 0u ? GetInstancedBoundingRadius(nodeDefinition.mInstanceTransforms, extent.Length()) : extent.Length();
+      }
+      primitive.SetLevelsOfDetail(mesh.second.lodIndexCounts, radius);
+    }
+
+    // Skinning and blend shapes move the vertices out of the box of the mesh.
+    Vector3 min, max;
+    if(!mesh.first.IsSkinned() && !mesh.first.HasBlendShapes() && GetExtents(resources, min, max))
+    {
+      if(instanceCount > 0u)
+      {
+        GetInstancedBoundingBox(nodeDefinition.mInstanceTransforms, min, max);
+      }
+      primitive.SetBoundingBox(min, max);
+    }
   }
 
   auto shader = renderer.GetShader();
@@ -300,6 +300,15 @@ public: // DATA
   Dali::Vector<Extra>                 mExtras;
   Dali::Vector<ConstraintDefinition>  mConstraints;
 
+  /**
+   * @brief The transforms of the instances of the renderables, in the space of this node.
+   *
+   * If any, the renderables are drawn once for each of them, with a single instanced renderer each.
+   * @SINCE_2_5.35
+   * @note The meshes of an instanced node mustn't be used by other nodes, as the transforms are added to their geometry.
+   */
+  Dali::Vector<Matrix> mInstanceTransforms;
+
   Dali::Vector<Index> mChildren;
   Index               mParentIdx = INVALID_INDEX;
 };
@@ -20,9 +20,11 @@
 
 // EXTERNAL INCLUDES
 #include <dali-scene3d/internal/common/image-resource-loader.h>
+#include <dali-scene3d/internal/common/parallel-job-runner.h>
 #include <dali-toolkit/public-api/image-loader/sync-image-loader.h>
 #include <dali/integration-api/string-utils.h>
 #include <dali/public-api/rendering/sampler.h>
+#include <chrono>
 #include <cstring>
 #include <fstream>
 #include <istream>
@@ -45,6 +47,11 @@ const char* const RESOURCE_TYPE_NAMES[] = {
   "Material",
 };
 
+uint32_t GetMicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
 } // namespace
 
 const char* GetResourceTypeName(ResourceType::Value type)
@@ -168,13 +175,24 @@ void ResourceBundle::LoadResources(PathProvider pathProvider, Options::Type opti
 }
 
 void ResourceBundle::LoadRawResources(PathProvider pathProvider, Options::Type options)
+{
+  RawResourceLoadStatistics statistics;
+  LoadRawResources(pathProvider, options, statistics);
+}
+
+void ResourceBundle::LoadRawResources(PathProvider pathProvider, Options::Type options, RawResourceLoadStatistics& statistics)
 {
   const auto kForceLoad = MaskMatch(options, Options::ForceReload);
 
+  statistics.mLoadTimes.Clear();
+  statistics.mTotalMicroseconds = 0u;
+
   if(kForceLoad || (!mRawResourcesLoaded && !mRawResourcesLoading))
   {
     mRawResourcesLoading = true;
 
+    const auto loadStartTime = std::chrono::steady_clock::now();
+
     const auto& refCountEnvMaps  = mReferenceCounts[ResourceType::Environment];
     auto        environmentsPath = ToDaliString(pathProvider(ResourceType::Environment));
     for(uint32_t i = 0, iEnd = refCountEnvMaps.Size(); i != iEnd; ++i)
@@ -183,7 +201,9 @@ void ResourceBundle::LoadRawResources(PathProvider pathProvider, Options::Type o
       auto& iEnvMap  = mEnvironmentMaps[i];
       if(refCount > 0 && (kForceLoad || (!iEnvMap.first.mRawData && !iEnvMap.second.IsLoaded())))
       {
+        const auto startTime   = std::chrono::steady_clock::now();
         iEnvMap.first.mRawData = MakeShared<EnvironmentDefinition::RawData>(iEnvMap.first.LoadRaw(environmentsPath));
+        statistics.mLoadTimes.PushBack({ResourceType::Environment, i, GetMicrosecondsSince(startTime)});
       }
     }
 
@@ -195,7 +215,25 @@ void ResourceBundle::LoadRawResources(PathProvider pathProvider, Options::Type o
       auto& iShader  = mShaders[i];
       if(refCount > 0 && (kForceLoad || !iShader.second))
       {
+        const auto startTime   = std::chrono::steady_clock::now();
         iShader.first.mRawData = MakeShared<ShaderDefinition::RawData>(iShader.first.LoadRaw(shadersPath));
+        statistics.mLoadTimes.PushBack({ResourceType::Shader, i, GetMicrosecondsSince(startTime)});
+      }
+    }
+
+    // Materials and meshes don't depend on each other, so they are loaded in parallel.
+    // Materials go first, as decoding their images usually takes the longest.
+    RawResourceLoadTimes jobs;
+
+    const auto& refCountMaterials = mReferenceCounts[ResourceType::Material];
+    auto        imagesPath        = ToDaliString(pathProvider(ResourceType::Material));
+    for(uint32_t i = 0, iEnd = refCountMaterials.Size(); i != iEnd; ++i)
+    {
+      auto  refCount  = refCountMaterials[i];
+      auto& iMaterial = mMaterials[i];
+      if(refCount > 0 && (kForceLoad || (!iMaterial.first.mRawData && !iMaterial.second)))
+      {
+        jobs.PushBack({ResourceType::Material, i, 0u});
       }
     }
 
@@ -207,21 +245,30 @@ void ResourceBundle::LoadRawResources(PathProvider pathProvider, Options::Type o
       auto& iMesh    = mMeshes[i];
       if(refCount > 0 && (kForceLoad || (!iMesh.first.mRawData && !iMesh.second.geometry)))
       {
-        iMesh.first.mRawData = MakeShared<MeshDefinition::RawData>(iMesh.first.LoadRaw(modelsPath, mBuffers));
+        jobs.PushBack({ResourceType::Mesh, i, 0u});
       }
     }
 
-    const auto& refCountMaterials = mReferenceCounts[ResourceType::Material];
-    auto        imagesPath        = ToDaliString(pathProvider(ResourceType::Material));
-    for(uint32_t i = 0, iEnd = refCountMaterials.Size(); i != iEnd; ++i)
+    auto loadJob = [&](uint32_t jobIndex)
     {
-      auto  refCount  = refCountMaterials[i];
-      auto& iMaterial = mMaterials[i];
-      if(refCount > 0 && (kForceLoad || (!iMaterial.first.mRawData && !iMaterial.second)))
+      auto&      job       = jobs[jobIndex];
+      const auto startTime = std::chrono::steady_clock::now();
+      if(job.mType == ResourceType::Material)
       {
+        auto& iMaterial          = mMaterials[job.mIndex];
         iMaterial.first.mRawData = MakeShared<MaterialDefinition::RawData>(iMaterial.first.LoadRaw(imagesPath));
       }
-    }
+      else
+      {
+        auto& iMesh          = mMeshes[job.mIndex];
+        iMesh.first.mRawData = MakeShared<MeshDefinition::RawData>(iMesh.first.LoadRaw(modelsPath, mBuffers));
+      }
+      job.mMicroseconds = GetMicrosecondsSince(startTime);
+    };
+    Internal::RunParallelJobs(static_cast<uint32_t>(jobs.Count()), loadJob, Internal::GetDefaultNumberOfJobHelpers());
+
+    statistics.mLoadTimes.Insert(statistics.mLoadTimes.End(), jobs.Begin(), jobs.End());
+    statistics.mTotalMicroseconds = GetMicrosecondsSince(loadStartTime);
 
     mRawResourcesLoading = false;
     mRawResourcesLoaded  = true;
@@ -83,6 +83,29 @@ public:
 
   using PathProvider = std::function<std::string(ResourceType::Value)>;
 
+  /**
+   * @brief The time spent loading the raw data of a resource.
+   * @SINCE_2_5.35
+   */
+  struct RawResourceLoadTime
+  {
+    ResourceType::Value mType;         ///< The type of the resource.
+    uint32_t            mIndex;        ///< The index of the resource in the definitions of its type.
+    uint32_t            mMicroseconds; ///< The time spent loading the resource.
+  };
+
+  using RawResourceLoadTimes = Dali::Vector<RawResourceLoadTime>;
+
+  /**
+   * @brief The times spent by a call to LoadRawResources().
+   * @SINCE_2_5.35
+   */
+  struct RawResourceLoadStatistics
+  {
+    RawResourceLoadTimes mLoadTimes;              ///< The time spent on each resource that was loaded.
+    uint32_t             mTotalMicroseconds{0u}; ///< The total time spent loading.
+  };
+
   ResourceBundle();
 
   ResourceBundle(const ResourceBundle&)            = delete;
@@ -139,10 +162,23 @@ public:
    * @note This method only loads raw data from resource file, and
    * doesn't create any of DALi objects. GenerateResources() method is required to be called
    * after this method to create DALi objects.
+   * @note Meshes and materials are loaded in parallel.
    */
   void LoadRawResources(PathProvider  pathProvider,
                         Options::Type options = Options::None);
 
+  /**
+   * @brief Loads the raw data of resources as LoadRawResources(PathProvider, Options::Type), and reports the
+   * time spent on it.
+   * @SINCE_2_5.35
+   * @param[in] pathProvider path provider for resource data.
+   * @param[in] options Option to load resource
+   * @param[out] statistics The time spent on each resource loaded by this call, and in total.
+   */
+  void LoadRawResources(PathProvider               pathProvider,
+                        Options::Type              options,
+                        RawResourceLoadStatistics& statistics);
+
   /**
    * @brief Generates DALi objects from already loaded Raw Resources.
    * @SINCE_2_2.9
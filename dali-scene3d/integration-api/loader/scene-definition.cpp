@@ -24,7 +24,9 @@
 #include <dali/public-api/animation/constraints.h>
 #include <dali/public-api/common/dali-utility.h>
 #include <algorithm>
+#include <cstring>
 #include <locale>
+#include <vector>
 
 // INTERNAL
 #include <dali-scene3d/internal/graphics/builtin-shader-extern-gen.h>
@@ -974,6 +976,160 @@ void SceneDefinition::EnsureUniqueBlendShapeShaderInstances(ResourceBundle& reso
   }
 }
 
+uint32_t SceneDefinition::InstanceRepeatedNodes(const ResourceBundle&                    resources,
+                                                const Dali::Vector<AnimationDefinition>& animations,
+                                                uint32_t                                 minimumNumberOfInstances)
+{
+  if(minimumNumberOfInstances < 2u)
+  {
+    return 0u;
+  }
+
+  const uint32_t numberOfNodes = mNodes.Count();
+
+  // The nodes that something refers to need their own actors.
+  std::vector<bool> isReferenced(numberOfNodes, false);
+  auto              addReference = [&isReferenced, numberOfNodes](Index iNode)
+  {
+    if(iNode < numberOfNodes)
+    {
+      isReferenced[iNode] = true;
+    }
+  };
+
+  for(const auto& animation : animations)
+  {
+    for(uint32_t i = 0u; i < animation.GetPropertyCount(); ++i)
+    {
+      const auto& property = animation.GetPropertyAt(i);
+      Index       iNode    = property.mNodeIndex;
+      if(iNode == INVALID_INDEX && !FindNode(property.mNodeName, &iNode))
+      {
+        continue;
+      }
+      addReference(iNode);
+    }
+  }
+
+  for(const auto& skeleton : resources.mSkeletons)
+  {
+    addReference(skeleton.mRootNodeIdx);
+    for(const auto& joint : skeleton.mJoints)
+    {
+      addReference(joint.mNodeIdx);
+    }
+  }
+
+  std::vector<uint32_t> meshUseCounts(resources.mMeshes.Size(), 0u);
+  for(const auto& node : mNodes)
+  {
+    for(const auto& constraint : node->mConstraints)
+    {
+      addReference(constraint.mSourceIdx);
+    }
+
+    for(const auto& renderable : node->mRenderables)
+    {
+      auto modelRenderable = dynamic_cast<const ModelRenderable*>(renderable.Get());
+      if(modelRenderable && modelRenderable->mMeshIdx < meshUseCounts.size())
+      {
+        ++meshUseCounts[modelRenderable->mMeshIdx];
+      }
+    }
+  }
+
+  // The nodes that look the same, by parent: the mesh, material and color of each of their renderables.
+  auto getInstancingKey = [&](Index iNode, std::vector<uint32_t>& key)
+  {
+    const NodeDefinition& node = *mNodes[iNode];
+    if(isReferenced[iNode] || !node.mChildren.Empty() || node.mCustomization || !node.mConstraints.Empty() || !node.mExtras.Empty() ||
+       !node.mIsVisible || !node.mInstanceTransforms.Empty() || node.mRenderables.Empty() || node.mParentIdx >= numberOfNodes ||
+       mNodes[node.mParentIdx]->mCustomization) // Customizations choose their children by index.
+    {
+      return false;
+    }
+
+    for(const auto& renderable : node.mRenderables)
+    {
+      auto modelRenderable = dynamic_cast<const ModelRenderable*>(renderable.Get());
+      if(!modelRenderable || dynamic_cast<const ArcRenderable*>(modelRenderable) || modelRenderable->mShaderIdx != INVALID_INDEX ||
+         modelRenderable->mMeshIdx >= resources.mMeshes.Size() || modelRenderable->mMaterialIdx >= resources.mMaterials.Size())
+      {
+        return false;
+      }
+
+      const auto& mesh = resources.mMeshes[modelRenderable->mMeshIdx].first;
+      if(mesh.IsSkinned() || mesh.HasBlendShapes())
+      {
+        return false;
+      }
+
+      uint32_t color[4];
+      std::memcpy(color, modelRenderable->mColor.AsFloat(), sizeof(color));
+      key.insert(key.end(), {modelRenderable->mMeshIdx, modelRenderable->mMaterialIdx, color[0], color[1], color[2], color[3]});
+    }
+    return true;
+  };
+
+  std::map<std::pair<Index, std::vector<uint32_t>>, std::vector<Index>> groups;
+  for(Index iNode = 0u; iNode < numberOfNodes; ++iNode)
+  {
+    std::vector<uint32_t> key;
+    if(getInstancingKey(iNode, key))
+    {
+      groups[{mNodes[iNode]->mParentIdx, std::move(key)}].push_back(iNode);
+    }
+  }
+
+  std::vector<bool> isMerged(numberOfNodes, false);
+  uint32_t          numberOfMergedNodes = 0u;
+  for(const auto& group : groups)
+  {
+    const auto& key   = group.first.second;
+    const auto& nodes = group.second;
+
+    // The transforms of the instances are added to the geometries of the meshes.
+    bool isInstanceable = nodes.size() >= minimumNumberOfInstances;
+    for(size_t i = 0u; isInstanceable && i < key.size(); i += 6u)
+    {
+      isInstanceable = meshUseCounts[key[i]] == nodes.size();
+    }
+    if(!isInstanceable)
+    {
+      continue;
+    }
+
+    NodeDefinition& instancedNode = *mNodes[nodes[0]];
+    instancedNode.mInstanceTransforms.Reserve(nodes.size());
+    for(const auto iNode : nodes)
+    {
+      instancedNode.mInstanceTransforms.PushBack(mNodes[iNode]->GetLocalSpace());
+      if(iNode != nodes[0])
+      {
+        mNodes[iNode]->mParentIdx = INVALID_INDEX;
+        isMerged[iNode]           = true;
+        ++numberOfMergedNodes;
+      }
+    }
+
+    instancedNode.mPosition    = Vector3::ZERO;
+    instancedNode.mOrientation = Quaternion::IDENTITY;
+    instancedNode.mScale       = Vector3::ONE;
+  }
+
+  if(numberOfMergedNodes > 0u)
+  {
+    for(auto& node : mNodes)
+    {
+      auto& children     = node->mChildren;
+      auto  iChildrenEnd = std::remove_if(children.Begin(), children.End(), [&isMerged](Index iChild) { return isMerged[iChild]; });
+      children.Resize(static_cast<uint32_t>(iChildrenEnd - children.Begin()));
+    }
+  }
+
+  return numberOfMergedNodes;
+}
+
 SceneDefinition& SceneDefinition::operator=(SceneDefinition&& other)
 {
   SceneDefinition temp(std::move(other));
@@ -27,6 +27,7 @@
 #include <string>
 
 // INTERNAL INCLUDES
+#include <dali-scene3d/integration-api/loader/animation-definition.h>
 #include <dali-scene3d/integration-api/loader/customization.h>
 #include <dali-scene3d/integration-api/loader/node-definition.h>
 #include <dali-scene3d/integration-api/loader/string-callback.h>
@@ -275,6 +276,24 @@ public: // METHODS
                                   Dali::Vector<BlendshapeShaderConfigurationRequest>&& requests,
                                   StringCallback                                       onError = DefaultErrorCallback) const;
 
+  /**
+   * @brief Merges the leaf nodes of a parent that render the same meshes with the same materials into one
+   *  node, which draws all of them with instancing.
+   *
+   * The first of the nodes draws the others, with their local transforms as its NodeDefinition::mInstanceTransforms
+   * and an identity transform of its own. The others are detached from the scene. Nodes are only merged if they
+   * aren't targeted by the animations, constraints or skeletons of the scene, have no extras, customization, skinning
+   * or blend shapes, use the default shaders, and if their meshes are used by no other node.
+   * @SINCE_2_5.35
+   * @param[in] resources The resources of the scene.
+   * @param[in] animations The animations of the scene.
+   * @param[in] minimumNumberOfInstances How many identical nodes a parent needs to have for them to be merged.
+   * @return The number of nodes that were detached from the scene.
+   */
+  uint32_t InstanceRepeatedNodes(const ResourceBundle&                    resources,
+                                 const Dali::Vector<AnimationDefinition>& animations,
+                                 uint32_t                                 minimumNumberOfInstances);
+
   SceneDefinition& operator=(SceneDefinition&& other);
 
 private: // METHODS
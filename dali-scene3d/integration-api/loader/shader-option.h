@@ -53,6 +53,7 @@ public:
     MORPH_NORMAL,               // 10000
     MORPH_TANGENT,              // 20000
     MORPH_VERSION_2_0,          // 40000
+    INSTANCING,                 // 80000
   };
 
   struct MacroDefinition
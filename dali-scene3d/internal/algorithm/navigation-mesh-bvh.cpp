@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-scene3d/internal/algorithm/navigation-mesh-bvh.h>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/internal/algorithm/navigation-mesh-impl.h>
+
+namespace Dali::Scene3D::Internal::Algorithm
+{
+namespace
+{
+constexpr uint32_t MAX_FACES_PER_LEAF = 4u;
+
+// Bounding boxes are slightly inflated so flat, axis aligned faces are never missed by the slab test
+constexpr float BOUNDS_EPSILON = 1e-4f;
+} // namespace
+
+void NavigationMeshBvh::Build(const NavigationMesh& mesh)
+{
+  mNodes.clear();
+  mFaceIndices.clear();
+
+  const auto faceCount = mesh.GetFaceCount();
+  if(faceCount == 0u)
+  {
+    return;
+  }
+
+  std::vector<Dali::Vector3> faceMin(faceCount);
+  std::vector<Dali::Vector3> faceMax(faceCount);
+  std::vector<Dali::Vector3> faceCenter(faceCount);
+  mFaceIndices.resize(faceCount);
+
+  for(auto faceIndex = 0u; faceIndex < faceCount; ++faceIndex)
+  {
+    const auto* face = mesh.GetFace(static_cast<FaceIndex>(faceIndex));
+
+    Dali::Vector3 min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Dali::Vector3 max(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+    for(auto vertexIndex : face->vertex)
+    {
+      const auto* vertex = mesh.GetVertex(vertexIndex);
+      for(auto i = 0u; i < 3u; ++i)
+      {
+        min[i] = std::min(min[i], vertex->coordinates[i]);
+        max[i] = std::max(max[i], vertex->coordinates[i]);
+      }
+    }
+
+    faceMin[faceIndex]    = min - Dali::Vector3(BOUNDS_EPSILON, BOUNDS_EPSILON, BOUNDS_EPSILON);
+    faceMax[faceIndex]    = max + Dali::Vector3(BOUNDS_EPSILON, BOUNDS_EPSILON, BOUNDS_EPSILON);
+    faceCenter[faceIndex] = (min + max) * 0.5f;
+
+    mFaceIndices[faceIndex] = static_cast<FaceIndex>(faceIndex);
+  }
+
+  // Binary tree with at most MAX_FACES_PER_LEAF faces per leaf
+  mNodes.reserve(2u * (faceCount / MAX_FACES_PER_LEAF + 1u));
+  BuildNode(0u, faceCount, faceMin, faceMax, faceCenter);
+}
+
+uint32_t NavigationMeshBvh::BuildNode(uint32_t begin, uint32_t end, const std::vector<Dali::Vector3>& faceMin, const std::vector<Dali::Vector3>& faceMax, const std::vector<Dali::Vector3>& faceCenter)
+{
+  const uint32_t nodeIndex = static_cast<uint32_t>(mNodes.size());
+  mNodes.emplace_back();
+
+  Dali::Vector3 min       = faceMin[mFaceIndices[begin]];
+  Dali::Vector3 max       = faceMax[mFaceIndices[begin]];
+  Dali::Vector3 centerMin = faceCenter[mFaceIndices[begin]];
+  Dali::Vector3 centerMax = centerMin;
+  for(auto i = begin + 1u; i < end; ++i)
+  {
+    const auto faceIndex = mFaceIndices[i];
+    for(auto axis = 0u; axis < 3u; ++axis)
+    {
+      min[axis]       = std::min(min[axis], faceMin[faceIndex][axis]);
+      max[axis]       = std::max(max[axis], faceMax[faceIndex][axis]);
+      centerMin[axis] = std::min(centerMin[axis], faceCenter[faceIndex][axis]);
+      centerMax[axis] = std::max(centerMax[axis], faceCenter[faceIndex][axis]);
+    }
+  }
+
+  mNodes[nodeIndex].min = min;
+  mNodes[nodeIndex].max = max;
+
+  if(end - begin <= MAX_FACES_PER_LEAF)
+  {
+    mNodes[nodeIndex].first     = begin;
+    mNodes[nodeIndex].faceCount = end - begin;
+    return nodeIndex;
+  }
+
+  // Split by median of face centers along the widest axis
+  const Dali::Vector3 extent = centerMax - centerMin;
+  const uint32_t      axis   = (extent.x >= extent.y && extent.x >= extent.z) ? 0u : (extent.y >= extent.z ? 1u : 2u);
+  const uint32_t      middle = begin + (end - begin) / 2u;
+
+  std::nth_element(mFaceIndices.begin() + begin, mFaceIndices.begin() + middle, mFaceIndices.begin() + end, [&faceCenter, axis](FaceIndex lhs, FaceIndex rhs) { return faceCenter[lhs][axis] < faceCenter[rhs][axis]; });
+
+  // The first child always follows its parent, only the second one needs to be stored
+  BuildNode(begin, middle, faceMin, faceMax, faceCenter);
+  const uint32_t rightIndex = BuildNode(middle, end, faceMin, faceMax, faceCenter);
+
+  mNodes[nodeIndex].first     = rightIndex;
+  mNodes[nodeIndex].faceCount = 0u;
+  return nodeIndex;
+}
+
+} // namespace Dali::Scene3D::Internal::Algorithm
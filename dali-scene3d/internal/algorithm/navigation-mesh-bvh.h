@@ -0,0 +1,222 @@
+#ifndef DALI_SCENE3D_INTERNAL_NAVIGATION_MESH_BVH_H
+#define DALI_SCENE3D_INTERNAL_NAVIGATION_MESH_BVH_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/vector-wrapper.h>
+#include <dali/public-api/math/math-utils.h>
+#include <dali/public-api/math/vector3.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <limits>
+#include <utility>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/public-api/algorithm/navigation-mesh.h>
+
+namespace Dali::Scene3D::Internal::Algorithm
+{
+class NavigationMesh;
+
+/**
+ * @class NavigationMeshBvh
+ *
+ * Bounding volume hierarchy built over the faces of the navigation mesh.
+ * It is built once when the mesh is loaded and lets ray queries (FindFloor, RayCastIntersect)
+ * test only the faces whose bounding boxes are crossed by the ray.
+ *
+ * All coordinates are in the navigation mesh local space.
+ */
+class NavigationMeshBvh
+{
+public:
+  using FaceIndex = Dali::Scene3D::Algorithm::FaceIndex;
+
+  /**
+   * @brief Builds the hierarchy over the faces of the given mesh
+   * @param[in] mesh Navigation mesh to build hierarchy for
+   */
+  void Build(const NavigationMesh& mesh);
+
+  /**
+   * @brief Looks for the closest face hit by the ray
+   *
+   * Faces are visited front to back and subtrees further than the closest hit found so far are skipped.
+   *
+   * @param[in] origin Origin of the ray
+   * @param[in] direction Direction of the ray
+   * @param[in] testFace Functor with signature bool(FaceIndex, float& outDistance) testing single face against the ray
+   * @param[out] outDistance Distance (in units of direction) to the closest hit
+   * @return Index of the closest face hit or NULL_FACE if nothing is hit
+   */
+  template<typename FaceTest>
+  FaceIndex FindClosest(const Dali::Vector3& origin, const Dali::Vector3& direction, FaceTest&& testFace, float& outDistance) const
+  {
+    FaceIndex closestFace     = Dali::Scene3D::Algorithm::NavigationMesh::NULL_FACE;
+    float     closestDistance = std::numeric_limits<float>::max();
+
+    if(mNodes.empty())
+    {
+      return closestFace;
+    }
+
+    Ray ray;
+    ray.origin = origin;
+    for(auto i = 0u; i < 3u; ++i)
+    {
+      ray.parallel[i]         = Dali::EqualsZero(direction[i]);
+      ray.inverseDirection[i] = ray.parallel[i] ? 0.0f : 1.0f / direction[i];
+    }
+
+    // Depth is bounded by log2(face count) since the split is always by median
+    uint32_t stack[64];
+    uint32_t stackSize    = 0u;
+    float    nodeDistance = 0.0f;
+    stack[stackSize++]    = 0u;
+
+    while(stackSize > 0u)
+    {
+      const auto& node = mNodes[stack[--stackSize]];
+      if(!IntersectNode(node, ray, closestDistance, nodeDistance))
+      {
+        continue;
+      }
+
+      if(node.faceCount > 0u)
+      {
+        for(auto i = node.first; i < node.first + node.faceCount; ++i)
+        {
+          float distance = 0.0f;
+          if(testFace(mFaceIndices[i], distance) && distance < closestDistance)
+          {
+            closestDistance = distance;
+            closestFace     = mFaceIndices[i];
+          }
+        }
+      }
+      else
+      {
+        // Push the further child first so the nearer one is visited first
+        const uint32_t leftIndex  = static_cast<uint32_t>(&node - mNodes.data()) + 1u;
+        const uint32_t rightIndex = node.first;
+        float          leftDistance, rightDistance;
+        const bool     leftHit  = IntersectNode(mNodes[leftIndex], ray, closestDistance, leftDistance);
+        const bool     rightHit = IntersectNode(mNodes[rightIndex], ray, closestDistance, rightDistance);
+        if(leftHit && rightHit)
+        {
+          stack[stackSize++] = leftDistance < rightDistance ? rightIndex : leftIndex;
+          stack[stackSize++] = leftDistance < rightDistance ? leftIndex : rightIndex;
+        }
+        else if(leftHit)
+        {
+          stack[stackSize++] = leftIndex;
+        }
+        else if(rightHit)
+        {
+          stack[stackSize++] = rightIndex;
+        }
+      }
+    }
+
+    outDistance = closestDistance;
+    return closestFace;
+  }
+
+  /**
+   * @brief Returns whether the hierarchy has been built
+   * @return True if the hierarchy contains no face
+   */
+  [[nodiscard]] bool IsEmpty() const
+  {
+    return mNodes.empty();
+  }
+
+private:
+  /**
+   * Single node of the hierarchy. Leaf nodes reference a range of mFaceIndices,
+   * internal nodes store the index of the second child (the first child is always the next node).
+   */
+  struct Node
+  {
+    Dali::Vector3 min;       ///< Minimum corner of bounding box
+    Dali::Vector3 max;       ///< Maximum corner of bounding box
+    uint32_t      first;     ///< Leaf: first index in mFaceIndices. Internal node: index of the second child
+    uint32_t      faceCount; ///< Number of faces in leaf or 0 for internal node
+  };
+
+  /**
+   * Ray with precomputed inverse direction used by the slab test
+   */
+  struct Ray
+  {
+    Dali::Vector3 origin;
+    Dali::Vector3 inverseDirection;
+    bool          parallel[3];
+  };
+
+  /**
+   * Recursively builds the subtree for faces in the [begin, end) range of mFaceIndices
+   * @return Index of the created node
+   */
+  uint32_t BuildNode(uint32_t begin, uint32_t end, const std::vector<Dali::Vector3>& faceMin, const std::vector<Dali::Vector3>& faceMax, const std::vector<Dali::Vector3>& faceCenter);
+
+  /**
+   * Slab test between ray and node bounding box
+   * @return True if the box is crossed closer than maxDistance, outDistance is set to the entry distance
+   */
+  static bool IntersectNode(const Node& node, const Ray& ray, float maxDistance, float& outDistance)
+  {
+    float nearDistance = 0.0f;
+    float farDistance  = maxDistance;
+    for(auto i = 0u; i < 3u; ++i)
+    {
+      if(ray.parallel[i])
+      {
+        if(ray.origin[i] < node.min[i] || ray.origin[i] > node.max[i])
+        {
+          return false;
+        }
+        continue;
+      }
+
+      float t0 = (node.min[i] - ray.origin[i]) * ray.inverseDirection[i];
+      float t1 = (node.max[i] - ray.origin[i]) * ray.inverseDirection[i];
+      if(t0 > t1)
+      {
+        std::swap(t0, t1);
+      }
+      nearDistance = std::max(nearDistance, t0);
+      farDistance  = std::min(farDistance, t1);
+      if(nearDistance > farDistance)
+      {
+        return false;
+      }
+    }
+    outDistance = nearDistance;
+    return true;
+  }
+
+private:
+  std::vector<Node>      mNodes;       ///< Nodes of the hierarchy, root is at index 0
+  std::vector<FaceIndex> mFaceIndices; ///< Faces ordered by leaf
+};
+
+} // namespace Dali::Scene3D::Internal::Algorithm
+
+#endif // DALI_SCENE3D_INTERNAL_NAVIGATION_MESH_BVH_H
@@ -18,7 +18,6 @@
 #include <dali-scene3d/internal/algorithm/navigation-mesh-impl.h>
 
 // EXTERNAL INCLUDES
-#include <dali/devel-api/common/list-wrapper.h>
 #include <dali/integration-api/debug.h>
 
 #include <algorithm>
@@ -88,6 +87,9 @@ NavigationMesh::NavigationMesh(const Dali::Vector<uint8_t>& buffer)
   // Setup header from the buffer
   mHeader      = *reinterpret_cast<NavigationMeshHeader_V10*>(mBuffer.Data());
   mCurrentFace = Scene3D::Algorithm::NavigationMesh::NULL_FACE;
+
+  // Build spatial acceleration structure for the floor and ray queries
+  mBvh.Build(*this);
 }
 
 [[nodiscard]] uint32_t NavigationMesh::GetFaceCount() const
@@ -188,42 +190,81 @@ bool NavigationMesh::FindFloor(const Dali::Vector3& position, Dali::Vector3& out
 
 bool NavigationMesh::FindFloor(const Dali::Vector3& position, Dali::Vector3& outPosition, FaceIndex& outFaceIndex)
 {
-  [[maybe_unused]] auto newPos = PointSceneToLocal(Dali::Vector3(position));
-
-  NavigationRay ray;
+  if(!FindFloorInternal(position, outPosition, outFaceIndex))
+  {
+    return false;
+  }
 
-  ray.origin = PointSceneToLocal(Dali::Vector3(position)); // origin is equal position
+  mCurrentFace = outFaceIndex;
+  return true;
+}
 
-  // Ray direction matches gravity direction
-  ray.direction = Vector3(mHeader.gravityVector);
+uint32_t NavigationMesh::FindFloors(const Dali::Vector<Dali::Vector3>& positions, Dali::Vector<Dali::Vector3>& outPositions, Dali::Vector<FaceIndex>& outFaceIndices) const
+{
+  const auto count = positions.Count();
+  outPositions.Resize(count);
+  outFaceIndices.Resize(count);
 
-  const auto                   POLY_COUNT = GetFaceCount();
-  std::vector<IntersectResult> results;
-  for(auto faceIndex = 0u; faceIndex < POLY_COUNT; ++faceIndex)
+  uint32_t foundCount = 0u;
+  for(auto i = 0u; i < count; ++i)
   {
-    auto result = NavigationRayFaceIntersection(ray, *GetFace(faceIndex));
-    if(result.result)
+    if(FindFloorInternal(positions[i], outPositions[i], outFaceIndices[i]))
+    {
+      ++foundCount;
+    }
+    else
     {
-      result.faceIndex = faceIndex;
-      results.emplace_back(result);
+      outPositions[i]   = positions[i];
+      outFaceIndices[i] = ::Dali::Scene3D::Algorithm::NavigationMesh::NULL_FACE;
     }
   }
 
-  // find minimal distance to the floor and return that position and distance
-  if(results.empty())
+  return foundCount;
+}
+
+bool NavigationMesh::FindFloorInternal(const Dali::Vector3& position, Dali::Vector3& outPosition, FaceIndex& outFaceIndex) const
+{
+  NavigationRay ray;
+
+  ray.origin = PointSceneToLocal(Dali::Vector3(position)); // origin is equal position
+
+  // Ray direction matches gravity direction
+  ray.direction = Vector3(mHeader.gravityVector);
+
+  // find minimal distance to the floor and return that position and face
+  auto result = FindClosestIntersection(ray);
+  if(!result.result)
   {
     return false;
   }
 
-  std::sort(results.begin(), results.end(), [](const IntersectResult& lhs, const IntersectResult& rhs) { return lhs.distance < rhs.distance; });
-
-  outPosition  = PointLocalToScene(results.front().point);
-  outFaceIndex = results.front().faceIndex;
-  mCurrentFace = outFaceIndex;
+  outPosition  = PointLocalToScene(result.point);
+  outFaceIndex = result.faceIndex;
 
   return true;
 }
 
+NavigationMesh::IntersectResult NavigationMesh::FindClosestIntersection(NavigationRay& ray) const
+{
+  auto testFace = [this, &ray](FaceIndex testFaceIndex, float& outDistance)
+  {
+    auto result = NavigationRayFaceIntersection(ray, *GetFace(testFaceIndex));
+    outDistance = result.distance;
+    return result.result;
+  };
+
+  float distance  = 0.0f;
+  auto  faceIndex = mBvh.FindClosest(ray.origin, ray.direction, testFace, distance);
+  if(faceIndex == ::Dali::Scene3D::Algorithm::NavigationMesh::NULL_FACE)
+  {
+    return IntersectResult{Vector3::ZERO, 0.0f, 0u, false};
+  }
+
+  auto result      = NavigationRayFaceIntersection(ray, *GetFace(faceIndex));
+  result.faceIndex = faceIndex;
+  return result;
+}
+
 const Poly* NavigationMesh::GetFace(FaceIndex index) const
 {
   auto* basePtr = reinterpret_cast<const Poly*>(mBuffer.Data() + mHeader.dataOffset + mHeader.polyDataOffset);
@@ -256,9 +297,6 @@ NavigationMesh::IntersectResult NavigationMesh::NavigationRayFaceIntersection(Na
 
 NavigationMesh::IntersectResult NavigationMesh::RayCastIntersect(NavigationRay& rayOrig) const
 {
-  auto                       faceCount = GetFaceCount();
-  std::list<IntersectResult> results;
-
   NavigationRay ray;
 
   ray.origin = PointSceneToLocal(rayOrig.origin); // origin is equal position
@@ -266,37 +304,8 @@ NavigationMesh::IntersectResult NavigationMesh::RayCastIntersect(NavigationRay&
   // Ray direction matches gravity direction
   ray.direction = PointSceneToLocal(rayOrig.origin + rayOrig.direction) - ray.origin;
   ray.direction.Normalize();
-  for(auto i = 0u; i < faceCount; ++i)
-  {
-    auto result = NavigationRayFaceIntersection(ray, *GetFace(i));
-    if(result.result)
-    {
-      result.faceIndex = i;
-      if(results.empty())
-      {
-        results.push_back(result);
-      }
-      else
-      {
-        for(auto it = results.begin(); it != results.end(); ++it)
-        {
-          if((*it).distance > result.distance)
-          {
-            results.insert(it, result);
-            break;
-          }
-        }
-      }
-    }
-  }
-  if(!results.empty())
-  {
-    return results.front();
-  }
-  else
-  {
-    return IntersectResult{Vector3::ZERO, 0.0f, 0u, false};
-  }
+
+  return FindClosestIntersection(ray);
 }
 
 void NavigationMesh::SetTransform(const Dali::Matrix& transform)
@@ -29,6 +29,7 @@
 #include <mutex>
 
 // INTERNAL INCLUDES
+#include <dali-scene3d/internal/algorithm/navigation-mesh-bvh.h>
 #include <dali-scene3d/internal/algorithm/navigation-mesh-header.h>
 #include <dali-scene3d/public-api/algorithm/navigation-mesh.h>
 #include <dali-scene3d/public-api/algorithm/path-finder.h>
@@ -117,6 +118,11 @@ public:
    */
   bool FindFloor(const Dali::Vector3& position, Dali::Vector3& outPosition, FaceIndex& outFaceIndex);
 
+  /**
+   * @copydoc Dali::Scene3D::Algorithm::NavigationMesh::FindFloors()
+   */
+  uint32_t FindFloors(const Dali::Vector<Dali::Vector3>& positions, Dali::Vector<Dali::Vector3>& outPositions, Dali::Vector<FaceIndex>& outFaceIndices) const;
+
   /**
    * @copydoc Dali::Scene3D::Algorithm::NavigationMesh::GetFace()
    */
@@ -150,6 +156,24 @@ public:
    */
   IntersectResult RayCastIntersect(NavigationRay& rayOrig) const;
 
+private:
+  /**
+   * @brief Looks for the closest face under the position along the gravity vector
+   * @param[in] position Position in the scene space
+   * @param[out] outPosition Position on the floor in the scene space
+   * @param[out] outFaceIndex Index of the floor face
+   * @return True if floor has been found
+   */
+  bool FindFloorInternal(const Dali::Vector3& position, Dali::Vector3& outPosition, FaceIndex& outFaceIndex) const;
+
+  /**
+   * @brief Looks for the closest face hit by the ray defined in the local space
+   * @param[in] ray Ray in the navigation mesh local space
+   * @return Intersection result with the closest face
+   */
+  IntersectResult FindClosestIntersection(NavigationRay& ray) const;
+
+public:
   /**
    * @copydoc Dali::Scene3D::Algorithm::NavigationMesh::PointSceneToLocal()
    */
@@ -180,6 +204,7 @@ private:
   FaceIndex                mCurrentFace;      //< Current face (last floor position)
   Dali::Matrix             mTransform;        //< Transform matrix
   Dali::Matrix             mTransformInverse; //< Inverse of the transform matrix
+  NavigationMeshBvh        mBvh;              //< Bounding volume hierarchy of faces
 };
 
 inline Internal::Algorithm::NavigationMesh& GetImplementation(Dali::Scene3D::Algorithm::NavigationMesh& navigationMesh)
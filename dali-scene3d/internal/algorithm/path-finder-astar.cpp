@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-scene3d/internal/algorithm/path-finder-astar.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm> ///< for std::push_heap, std::pop_heap
+#include <limits>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/internal/algorithm/path-finder-waypoint-data.h>
+#include <dali-scene3d/public-api/algorithm/path-finder-waypoint.h>
+
+using WayPointList = Dali::Scene3D::Algorithm::WayPointList;
+
+namespace
+{
+/**
+ * @brief 2D cross product. Positive if rhs is counter-clockwise from lhs.
+ */
+inline float Cross(const Dali::Vector2& lhs, const Dali::Vector2& rhs)
+{
+  return lhs.x * rhs.y - lhs.y * rhs.x;
+}
+} // namespace
+
+namespace Dali::Scene3D::Internal::Algorithm
+{
+PathFinderAlgorithmAStar::PathFinderAlgorithmAStar(Dali::Scene3D::Algorithm::NavigationMesh& navMesh)
+: mNavigationMesh(&GetImplementation(navMesh))
+{
+  PrepareData();
+}
+
+PathFinderAlgorithmAStar::~PathFinderAlgorithmAStar() = default;
+
+Scene3D::Algorithm::WayPointList PathFinderAlgorithmAStar::FindPath(const Dali::Vector3& positionFrom, const Dali::Vector3& positionTo)
+{
+  Dali::Vector3 outPosFrom;
+  FaceIndex     polyIndexFrom;
+  auto          result = mNavigationMesh->FindFloor(positionFrom, outPosFrom, polyIndexFrom);
+
+  Scene3D::Algorithm::WayPointList waypoints;
+
+  if(result)
+  {
+    Dali::Vector3 outPosTo;
+    FaceIndex     polyIndexTo;
+    result = mNavigationMesh->FindFloor(positionTo, outPosTo, polyIndexTo);
+
+    if(result)
+    {
+      // Get waypoints
+      waypoints = FindPath(polyIndexFrom, polyIndexTo);
+
+      if(!waypoints.Empty())
+      {
+        // replace first and last waypoint
+        auto& wpFrom = static_cast<WayPointData&>(waypoints[0]);
+        auto& wpTo   = static_cast<WayPointData&>(waypoints.Back());
+
+        Vector2 fromCenter(wpFrom.point3d.x, wpFrom.point3d.y);
+        wpFrom.point3d = outPosFrom;
+        wpFrom.point2d = fromCenter - Vector2(outPosFrom.x, outPosFrom.y);
+
+        Vector2 toCenter(wpTo.point3d.x, wpTo.point3d.y);
+        wpTo.point3d = outPosTo;
+        wpTo.point2d = toCenter - Vector2(outPosTo.x, outPosTo.y);
+      }
+    }
+  }
+
+  // Returns waypoints with non-zero size of empty vector in case of failure (no path to be found)
+  return waypoints;
+}
+
+Scene3D::Algorithm::WayPointList PathFinderAlgorithmAStar::FindPath(FaceIndex sourcePolyIndex, FaceIndex targetPolyIndex)
+{
+  const auto nodeCount = uint32_t(mNodes.size());
+  if(sourcePolyIndex >= nodeCount || targetPolyIndex >= nodeCount)
+  {
+    return {};
+  }
+
+  BeginSearch();
+
+  const auto targetCenter = mNodes[targetPolyIndex].center;
+  const auto heuristic    = [this, &targetCenter](FaceIndex faceIndex) { return (mNodes[faceIndex].center - targetCenter).Length(); };
+  const auto heapCompare  = [](const OpenEntry& lhs, const OpenEntry& rhs) { return lhs.estimate > rhs.estimate; };
+
+  mSearchStates[sourcePolyIndex] = {0.0f, Scene3D::Algorithm::NavigationMesh::NULL_FACE, mSearchGeneration, false};
+  mOpenList.push_back({heuristic(sourcePolyIndex), sourcePolyIndex});
+
+  bool found = false;
+  while(!mOpenList.empty())
+  {
+    // take the node with minimum estimated distance
+    std::pop_heap(mOpenList.begin(), mOpenList.end(), heapCompare);
+    const auto currentIndex = mOpenList.back().index;
+    mOpenList.pop_back();
+
+    auto& current = mSearchStates[currentIndex];
+
+    // Old item. just ignore.
+    if(current.closed)
+    {
+      continue;
+    }
+    current.closed = true;
+
+    // The heuristic is consistent, so the target is final once it is expanded.
+    if(currentIndex == targetPolyIndex)
+    {
+      found = true;
+      break;
+    }
+
+    // check the neighbours
+    const auto& node = mNodes[currentIndex];
+    for(auto i = 0u; i < 3; ++i)
+    {
+      auto nIndex = node.faces[i];
+      if(nIndex == Scene3D::Algorithm::NavigationMesh::NULL_FACE)
+      {
+        continue;
+      }
+
+      auto& neighbour = mSearchStates[nIndex];
+      if(neighbour.generation != mSearchGeneration)
+      {
+        neighbour = {std::numeric_limits<float>::infinity(), Scene3D::Algorithm::NavigationMesh::NULL_FACE, mSearchGeneration, false};
+      }
+
+      if(neighbour.closed)
+      {
+        continue;
+      }
+
+      auto alt = current.distance + node.weight[i];
+      if(alt < neighbour.distance)
+      {
+        neighbour.distance = alt;
+        neighbour.prev     = currentIndex;
+
+        mOpenList.push_back({alt + heuristic(nIndex), nIndex});
+        std::push_heap(mOpenList.begin(), mOpenList.end(), heapCompare);
+      }
+    }
+  }
+
+  // Failed to find a path
+  if(!found)
+  {
+    // Return empty WayPointList
+    return {};
+  }
+
+  // Walk back from the target to the source
+  mPathFaces.clear();
+  for(auto u = targetPolyIndex; u != Scene3D::Algorithm::NavigationMesh::NULL_FACE; u = mSearchStates[u].prev)
+  {
+    mPathFaces.push_back(u);
+  }
+  std::reverse(mPathFaces.begin(), mPathFaces.end());
+
+  WayPointList waypoints;
+  waypoints.Resize(static_cast<uint32_t>(mPathFaces.size()));
+
+  auto index = 0u;
+  auto prevN = 0u;
+  for(auto n : mPathFaces)
+  {
+    auto& wp     = static_cast<WayPointData&>(waypoints[index]);
+    wp.face      = mNavigationMesh->GetFace(n);
+    wp.nodeIndex = n;
+
+    wp.edge = nullptr;
+    // set the common edge with previous node
+    if(index > 0)
+    {
+      const auto& node = mNodes[prevN];
+      for(auto i = 0u; i < 3; ++i)
+      {
+        if(node.faces[i] == wp.nodeIndex)
+        {
+          wp.edge = mNavigationMesh->GetEdge(node.edges[i]);
+          break;
+        }
+      }
+    }
+
+    prevN = n;
+    index++;
+  }
+
+  return OptimizeWaypoints(waypoints);
+}
+
+void PathFinderAlgorithmAStar::PrepareData()
+{
+  // Build the list structure connecting the nodes
+  auto faceCount = mNavigationMesh->GetFaceCount();
+
+  mNodes.resize(faceCount);
+  mSearchStates.resize(faceCount, {std::numeric_limits<float>::infinity(), Scene3D::Algorithm::NavigationMesh::NULL_FACE, 0u, false});
+
+  // for each face build the list
+  for(auto i = 0u; i < faceCount; ++i)
+  {
+    auto&       node = mNodes[i];
+    const auto* face = mNavigationMesh->GetFace(i);
+    auto        c0   = Dali::Vector3(face->center);
+
+    node.center = c0;
+
+    // for each edge add neighbouring face and compute distance to set the weight of node
+    for(auto edgeIndex = 0u; edgeIndex < 3; ++edgeIndex)
+    {
+      const auto* edge = mNavigationMesh->GetEdge(face->edge[edgeIndex]);
+      auto        p1   = edge->face[0];
+      auto        p2   = edge->face[1];
+
+      // One of faces is current face so ignore it
+      auto p                = ((p1 != i) ? p1 : p2);
+      node.faces[edgeIndex] = p;
+      if(p != ::Dali::Scene3D::Algorithm::NavigationMesh::NULL_FACE)
+      {
+        node.edges[edgeIndex]  = face->edge[edgeIndex];
+        auto c1                = Dali::Vector3(mNavigationMesh->GetFace(p)->center);
+        node.weight[edgeIndex] = (c1 - c0).Length();
+      }
+    }
+  }
+}
+
+void PathFinderAlgorithmAStar::BeginSearch()
+{
+  // On overflow, states of old generations could be seen as valid again so reset them all.
+  if(++mSearchGeneration == 0u)
+  {
+    for(auto& state : mSearchStates)
+    {
+      state.generation = 0u;
+    }
+    mSearchGeneration = 1u;
+  }
+  mOpenList.clear();
+}
+
+Scene3D::Algorithm::WayPointList PathFinderAlgorithmAStar::OptimizeWaypoints(WayPointList& waypoints) const
+{
+  WayPointList optimizedWaypoints;
+  optimizedWaypoints.Reserve(waypoints.Count());
+  optimizedWaypoints.PushBack(waypoints[0]);
+
+  // The visible area from the last kept waypoint is tracked as a wedge narrowed by every crossed edge,
+  // so each waypoint is tested in constant time instead of against all edges since the last kept one.
+  auto faceCenter = [](Dali::Scene3D::Algorithm::WayPoint& waypoint)
+  {
+    const auto* face = static_cast<WayPointData&>(waypoint).face;
+    return Dali::Vector2(face->center[0], face->center[1]);
+  };
+
+  auto startIndex  = 0u;
+  auto startCenter = faceCenter(waypoints[0]);
+  auto wedgeRight  = Dali::Vector2::ZERO;
+  auto wedgeLeft   = Dali::Vector2::ZERO;
+
+  for(auto wpIndex = 1u; wpIndex < waypoints.Count(); ++wpIndex)
+  {
+    if(wpIndex == waypoints.Count() - 1)
+    {
+      optimizedWaypoints.PushBack(waypoints.Back());
+      break;
+    }
+
+    const auto& wpData = static_cast<const WayPointData&>(waypoints[wpIndex]);
+    const auto* pb0    = mNavigationMesh->GetVertex(wpData.edge->vertex[0]);
+    const auto* pb1    = mNavigationMesh->GetVertex(wpData.edge->vertex[1]);
+
+    // Directions from the start to the ends of the crossed edge, ordered clockwise to counter-clockwise
+    auto edgeRight = Dali::Vector2(pb0->x, pb0->y) - startCenter;
+    auto edgeLeft  = Dali::Vector2(pb1->x, pb1->y) - startCenter;
+    if(Cross(edgeRight, edgeLeft) < 0.0f)
+    {
+      std::swap(edgeRight, edgeLeft);
+    }
+
+    const bool firstEdge = (wpIndex == startIndex + 1u);
+    if(firstEdge)
+    {
+      wedgeRight = edgeRight;
+      wedgeLeft  = edgeLeft;
+    }
+    else
+    {
+      if(Cross(wedgeRight, edgeRight) > 0.0f)
+      {
+        wedgeRight = edgeRight;
+      }
+      if(Cross(edgeLeft, wedgeLeft) > 0.0f)
+      {
+        wedgeLeft = edgeLeft;
+      }
+    }
+
+    const auto direction = faceCenter(waypoints[wpIndex]) - startCenter;
+    const bool visible   = Cross(wedgeRight, wedgeLeft) >= 0.0f && Cross(wedgeRight, direction) >= 0.0f && Cross(direction, wedgeLeft) >= 0.0f;
+
+    // Neighbour of the start is always reachable
+    if(!visible && !firstEdge)
+    {
+      // Keep the last visible waypoint and continue from there
+      startIndex  = wpIndex - 1u;
+      startCenter = faceCenter(waypoints[startIndex]);
+      optimizedWaypoints.PushBack(waypoints[startIndex]);
+
+      // Test the current waypoint again from the new start
+      --wpIndex;
+    }
+  }
+
+  for(auto& wp : optimizedWaypoints)
+  {
+    auto& wpData   = static_cast<WayPointData&>(wp);
+    wpData.point3d = mNavigationMesh->PointLocalToScene(Dali::Vector3(wpData.face->center));
+    wpData.point2d = Vector2::ZERO;
+  }
+
+  return optimizedWaypoints;
+}
+} // namespace Dali::Scene3D::Internal::Algorithm
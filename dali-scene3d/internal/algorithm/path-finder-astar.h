@@ -0,0 +1,130 @@
+#ifndef DALI_SCENE3D_INTERNAL_PATH_FINDER_ASTAR_H
+#define DALI_SCENE3D_INTERNAL_PATH_FINDER_ASTAR_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/vector-wrapper.h>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/internal/algorithm/navigation-mesh-impl.h>
+#include <dali-scene3d/public-api/algorithm/path-finder.h>
+
+namespace Dali::Scene3D::Internal::Algorithm
+{
+/**
+ * @class PathFinderAlgorithmAStar
+ *
+ * A* search over the faces of the navigation mesh. The distance between face centres is used
+ * both as the edge weight and as the heuristic, so the heuristic is consistent and the found path
+ * is as short as the one found by Dijkstra.
+ *
+ * The search state is kept between queries and invalidated by increasing a generation counter,
+ * so consecutive queries (e.g. for many agents) don't reallocate or clear per-face buffers.
+ */
+class PathFinderAlgorithmAStar : public Dali::Scene3D::Algorithm::PathFinderBase
+{
+public:
+  /**
+   * @brief Constructor
+   *
+   * @param[in] navMesh Navigation mesh to associate with the algorithm
+   */
+  explicit PathFinderAlgorithmAStar(Dali::Scene3D::Algorithm::NavigationMesh& navMesh);
+
+  /**
+   * @brief Destructor
+   */
+  ~PathFinderAlgorithmAStar() override;
+
+  /**
+   * @brief Looks for a path from point A to point B.
+   *
+   * @param[in] positionFrom source position in NavigationMesh parent space
+   * @param[in] positionTo target position in NavigationMesh parent space
+   * @return List of waypoints for path
+   */
+  Scene3D::Algorithm::WayPointList FindPath(const Dali::Vector3& positionFrom, const Dali::Vector3& positionTo) override;
+
+  /**
+   * @brief Finds path between NavigationMesh faces
+   *
+   * @param[in] sourcePolyIndex Index of start polygon
+   * @param[in] targetPolyIndex Index of end polygon
+   * @return List of waypoints for path
+   */
+  Scene3D::Algorithm::WayPointList FindPath(FaceIndex sourcePolyIndex, FaceIndex targetPolyIndex) override;
+
+private:
+  /**
+   * Build the graph of nodes
+   * distance between nodes is weight of node
+   */
+  void PrepareData();
+
+  /**
+   * Starts new search. Invalidates search state of all nodes in O(1)
+   */
+  void BeginSearch();
+
+  /**
+   * Removes waypoints which can be reached in straight line from the previous kept waypoint
+   */
+  Scene3D::Algorithm::WayPointList OptimizeWaypoints(Scene3D::Algorithm::WayPointList& waypoints) const;
+
+  /**
+   * Structure describes single node of pathfinding algorithm
+   */
+  struct FaceNode
+  {
+    // neighbours
+    FaceIndex     faces[3];  ///< List of neighbouring faces (max 3 for a triangle)
+    EdgeIndex     edges[3];  ///< List of edges (max 3 for a triangle)
+    float         weight[3]; ///< List of weights (by distance) to each neighbour
+    Dali::Vector3 center;    ///< Centre of the face used by the heuristic
+  };
+
+  /**
+   * Search state of single node. Valid only if generation matches the current search generation
+   */
+  struct SearchState
+  {
+    float     distance;   ///< Distance from the source face
+    FaceIndex prev;       ///< Previous face on the shortest path
+    uint32_t  generation; ///< Generation of the search which initialised this state
+    bool      closed;     ///< True if the node has been already expanded
+  };
+
+  /**
+   * Entry of the open list
+   */
+  struct OpenEntry
+  {
+    float     estimate; ///< Distance from the source plus heuristic
+    FaceIndex index;    ///< Face index
+  };
+
+  NavigationMesh*          mNavigationMesh;        ///< Pointer to a valid NavigationMesh
+  std::vector<FaceNode>    mNodes;                 ///< List of nodes
+  std::vector<SearchState> mSearchStates;          ///< Reusable search state per node
+  std::vector<OpenEntry>   mOpenList;              ///< Reusable binary heap of the open nodes
+  std::vector<FaceIndex>   mPathFaces;             ///< Reusable buffer for reconstructed path
+  uint32_t                 mSearchGeneration{0u}; ///< Generation of the current search
+};
+} // namespace Dali::Scene3D::Internal::Algorithm
+
+#endif // DALI_SCENE3D_INTERNAL_PATH_FINDER_ASTAR_H
@@ -0,0 +1,57 @@
+#ifndef DALI_SCENE3D_INTERNAL_CAMERA_OBSERVER_H
+#define DALI_SCENE3D_INTERNAL_CAMERA_OBSERVER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/actors/camera-actor.h>
+
+namespace Dali
+{
+namespace Scene3D
+{
+namespace Internal
+{
+class CameraObserver
+{
+public:
+  /**
+   * @brief Constructor.
+   */
+  CameraObserver() = default;
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~CameraObserver() = default;
+
+  /**
+   * @brief Notifies the selected camera of parent SceneView is changed.
+   *
+   * @param[in] camera The camera that is now used to render the SceneView.
+   */
+  virtual void NotifySelectedCameraChanged(Dali::CameraActor camera) = 0;
+};
+
+} // namespace Internal
+
+} // namespace Scene3D
+
+} // namespace Dali
+
+#endif // DALI_SCENE3D_INTERNAL_CAMERA_OBSERVER_H
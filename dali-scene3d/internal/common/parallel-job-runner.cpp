@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-scene3d/internal/common/parallel-job-runner.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/async-task-manager.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Dali
+{
+namespace Scene3D
+{
+namespace Internal
+{
+namespace
+{
+const char* DALI_SCENE3D_LOADER_THREADS("DALI_SCENE3D_LOADER_THREADS");
+
+constexpr uint32_t MAXIMUM_NUMBER_OF_HELPERS = 15u;
+
+thread_local uint32_t gParallelJobDepth = 0u; ///< The number of nested RunParallelJobs() whose jobs the thread is running
+
+/**
+ * @brief Marks the calling thread as running jobs for its lifetime.
+ */
+struct ParallelJobScope
+{
+  ParallelJobScope()
+  {
+    ++gParallelJobDepth;
+  }
+
+  ~ParallelJobScope()
+  {
+    --gParallelJobDepth;
+  }
+};
+
+/**
+ * @brief The jobs shared by the calling thread and the helpers.
+ *
+ * Helpers own a reference to it, so a helper that starts after all the jobs have finished
+ * finds nothing to do and doesn't touch the caller's data.
+ */
+struct JobQueue
+{
+  JobQueue(uint32_t numberOfJobs, const std::function<void(uint32_t)>& job)
+  : mJob(job),
+    mNumberOfJobs(numberOfJobs)
+  {
+  }
+
+  /**
+   * @brief Runs jobs until there are no more jobs to start.
+   */
+  void RunJobs()
+  {
+    ParallelJobScope scope;
+    uint32_t         index;
+    while((index = mNextJob.fetch_add(1u, std::memory_order_relaxed)) < mNumberOfJobs)
+    {
+      std::exception_ptr exception;
+      try
+      {
+        mJob(index);
+      }
+      catch(...)
+      {
+        exception = std::current_exception();
+      }
+
+      std::scoped_lock<std::mutex> lock(mMutex);
+      if(exception && !mException)
+      {
+        mException = exception;
+      }
+      if(++mNumberOfFinishedJobs == mNumberOfJobs)
+      {
+        mFinished.notify_all();
+      }
+    }
+  }
+
+  /**
+   * @brief Waits until all the jobs have finished.
+   *
+   * Rethrows the first exception thrown by a job, as they would be if the jobs had run in the calling thread.
+   */
+  void Wait()
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mFinished.wait(lock, [this]() { return mNumberOfFinishedJobs == mNumberOfJobs; });
+    if(mException)
+    {
+      std::rethrow_exception(mException);
+    }
+  }
+
+  std::function<void(uint32_t)> mJob;
+  const uint32_t                mNumberOfJobs;
+  std::atomic<uint32_t>         mNextJob{0u};
+  std::mutex                    mMutex;
+  std::condition_variable       mFinished;
+  uint32_t                      mNumberOfFinishedJobs{0u};
+  std::exception_ptr            mException;
+};
+
+using JobQueuePtr = std::shared_ptr<JobQueue>;
+
+class JobHelperTask : public AsyncTask
+{
+public:
+  JobHelperTask(JobQueuePtr jobQueue)
+  : AsyncTask(MakeCallback(&JobHelperTask::OnCompleted), AsyncTask::PriorityType::HIGH, AsyncTask::ThreadType::WORKER_THREAD),
+    mJobQueue(std::move(jobQueue))
+  {
+  }
+
+  void Process() override
+  {
+    mJobQueue->RunJobs();
+    mJobQueue.reset();
+  }
+
+  Dali::StringView GetTaskName() const override
+  {
+    return Dali::StringView("JobHelperTask");
+  }
+
+private:
+  static void OnCompleted(AsyncTaskPtr /* task */)
+  {
+    // Nothing to do. The caller waits on the job queue.
+  }
+
+  JobQueuePtr mJobQueue;
+};
+
+} // namespace
+
+void RunParallelJobs(uint32_t numberOfJobs, const std::function<void(uint32_t)>& job, uint32_t maximumNumberOfHelpers)
+{
+  const uint32_t numberOfHelpers = std::min(maximumNumberOfHelpers, (numberOfJobs > 0u) ? numberOfJobs - 1u : 0u);
+  if(0u == numberOfHelpers)
+  {
+    ParallelJobScope scope;
+    for(uint32_t index = 0u; index < numberOfJobs; ++index)
+    {
+      job(index);
+    }
+    return;
+  }
+
+  JobQueuePtr jobQueue = std::make_shared<JobQueue>(numberOfJobs, job);
+
+  std::vector<std::thread> helperThreads;
+  Dali::AsyncTaskManager   asyncTaskManager = Dali::AsyncTaskManager::Get();
+  if(asyncTaskManager)
+  {
+    for(uint32_t helper = 0u; helper < numberOfHelpers; ++helper)
+    {
+      asyncTaskManager.AddTask(new JobHelperTask(jobQueue));
+    }
+  }
+  else
+  {
+    // There is no async task manager for this thread.
+    helperThreads.reserve(numberOfHelpers);
+    for(uint32_t helper = 0u; helper < numberOfHelpers; ++helper)
+    {
+      helperThreads.emplace_back([jobQueue]() { jobQueue->RunJobs(); });
+    }
+  }
+
+  jobQueue->RunJobs();
+
+  // Helper threads have nothing left to do once all the jobs have finished.
+  for(auto& thread : helperThreads)
+  {
+    thread.join();
+  }
+
+  jobQueue->Wait();
+}
+
+bool IsRunningParallelJob()
+{
+  return gParallelJobDepth > 0u;
+}
+
+uint32_t GetDefaultNumberOfJobHelpers()
+{
+  static const uint32_t numberOfHelpers = []()
+  {
+    uint32_t numberOfThreads = std::thread::hardware_concurrency();
+
+    // Check environment variable for DALI_SCENE3D_LOADER_THREADS
+    auto numberOfThreadsString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_SCENE3D_LOADER_THREADS);
+    if(numberOfThreadsString)
+    {
+      numberOfThreads = static_cast<uint32_t>(std::max(1, std::atoi(numberOfThreadsString)));
+      DALI_LOG_RELEASE_INFO("Scene3D loader threads:%u\n", numberOfThreads);
+    }
+
+    return std::min(MAXIMUM_NUMBER_OF_HELPERS, (numberOfThreads > 1u) ? numberOfThreads - 1u : 0u);
+  }();
+
+  return numberOfHelpers;
+}
+
+} // namespace Internal
+
+} // namespace Scene3D
+
+} // namespace Dali
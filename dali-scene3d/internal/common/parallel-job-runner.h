@@ -0,0 +1,70 @@
+#ifndef DALI_SCENE3D_INTERNAL_PARALLEL_JOB_RUNNER_H
+#define DALI_SCENE3D_INTERNAL_PARALLEL_JOB_RUNNER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <functional>
+
+namespace Dali
+{
+namespace Scene3D
+{
+namespace Internal
+{
+/**
+ * @brief Runs independent jobs in parallel and returns when all of them have finished.
+ *
+ * The jobs are shared between the calling thread and helper tasks added to the AsyncTaskManager.
+ * The calling thread runs jobs too, so it never waits for a job that no thread has started,
+ * i.e. it's safe to call this from a task that is itself running on the async task pool.
+ * If the AsyncTaskManager can't be reached from the calling thread, helper threads are used instead.
+ *
+ * @param[in] numberOfJobs The number of jobs.
+ * @param[in] job The function that runs the job of the given index. It's called from several threads at once.
+ * @param[in] maximumNumberOfHelpers The maximum number of helpers. Zero runs all the jobs in the calling thread.
+ */
+void RunParallelJobs(uint32_t numberOfJobs, const std::function<void(uint32_t)>& job, uint32_t maximumNumberOfHelpers);
+
+/**
+ * @brief Checks whether the calling thread is running a job of RunParallelJobs().
+ *
+ * The other threads are then busy with the outer jobs, so jobs run from a job should use no helpers.
+ *
+ * @return True if it's called from a job.
+ */
+bool IsRunningParallelJob();
+
+/**
+ * @brief Retrieves the default maximum number of helpers, based on the number of cores.
+ *
+ * It can be overridden with the DALI_SCENE3D_LOADER_THREADS environment variable,
+ * which sets the total number of threads, including the calling one.
+ *
+ * @return The maximum number of helpers.
+ */
+uint32_t GetDefaultNumberOfJobHelpers();
+
+} // namespace Internal
+
+} // namespace Scene3D
+
+} // namespace Dali
+
+#endif // DALI_SCENE3D_INTERNAL_PARALLEL_JOB_RUNNER_H
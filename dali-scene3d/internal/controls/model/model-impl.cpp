@@ -25,12 +25,15 @@
 #include <dali/devel-api/object/type-registry-helper.h>
 #include <dali/devel-api/object/type-registry.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/integration-api/adaptor-framework/scene-holder.h>
+#include <dali/integration-api/constraint-integ.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include <dali/public-api/common/dali-utility.h>
 #include <dali/public-api/math/math-utils.h>
 #include <algorithm>
 #include <filesystem>
+#include <iterator>
 
 // INTERNAL INCLUDES
 #include <dali-scene3d/integration-api/loader/animation-definition.h>
@@ -47,6 +50,8 @@
 #include <dali-scene3d/internal/light/light-impl.h>
 #include <dali-scene3d/internal/model-components/model-node-impl.h>
 #include <dali-scene3d/internal/model-components/model-node-tree-utility.h>
+#include <dali-scene3d/internal/model-components/model-primitive-impl.h>
+#include <dali-scene3d/public-api/common/scene3d-constraint-tag-ranges.h>
 #include <dali-scene3d/public-api/controls/model/model.h>
 #include <dali-scene3d/public-api/model-motion/motion-index/blend-shape-index.h>
 #include <dali-toolkit/public-api/controls/control-impl.h>
@@ -75,6 +80,8 @@ BaseHandle Create()
 
 // Setup properties, signals and actions using the type-registry.
 DALI_TYPE_REGISTRATION_BEGIN(Scene3D::Model, Toolkit::Control, Create);
+DALI_PROPERTY_REGISTRATION(Scene3D, Model, "LodThresholds", ARRAY, LOD_THRESHOLDS)
+DALI_PROPERTY_REGISTRATION(Scene3D, Model, "FrustumCulling", BOOLEAN, FRUSTUM_CULLING)
 DALI_TYPE_REGISTRATION_END()
 
 static constexpr Vector3 Y_DIRECTION(1.0f, -1.0f, 1.0f);
@@ -83,6 +90,14 @@ static constexpr float   SIZE_STEP_CONDITION = 0.1f;
 static constexpr bool DEFAULT_MODEL_CHILDREN_SENSITIVE = false;
 static constexpr bool DEFAULT_MODEL_CHILDREN_FOCUSABLE = false;
 
+static constexpr uint32_t         MODEL_CONSTRAINT_TAG     = Dali::Scene3D::ConstraintTagRanges::SCENE3D_CONSTRAINT_TAG_START + 400;
+static constexpr std::string_view LOD_LEVEL_PROPERTY_NAME  = "lodLevel";
+static constexpr float            LOD_LEVEL_STEP_CONDITION = 1.0f;
+static constexpr float            LOD_LEVEL_STEP_REFERENCE = -0.5f; ///< The levels are in the middle of the steps, so that each change is notified.
+static constexpr std::string_view VISIBLE_PROPERTY_NAME    = "frustumVisible";
+static constexpr float            VISIBLE_STEP_CONDITION   = 1.0f;
+static constexpr float            VISIBLE_STEP_REFERENCE   = 0.5f; ///< Between culled (0) and visible (1).
+
 struct BoundingVolume
 {
   void Init()
@@ -154,13 +169,24 @@ void AddModelTreeToAABB(BoundingVolume& AABB, const Dali::Scene3D::Loader::Scene
   Vector3 volume[2];
   if(node->GetExtents(nodeParams.mResources, volume[0], volume[1]))
   {
-    for(uint32_t i = 0; i < BOX_POINT_COUNT; ++i)
+    // An instanced node is drawn once per instance transform.
+    const uint32_t instanceCount = std::max<uint32_t>(node->mInstanceTransforms.Count(), 1u);
+    for(uint32_t instance = 0u; instance < instanceCount; ++instance)
     {
-      Vector4 position       = Vector4(volume[BBIndex[i][0]].x, volume[BBIndex[i][1]].y, volume[BBIndex[i][2]].z, 1.0f);
-      Vector4 objectPosition = nodeMatrix * position;
-      objectPosition /= objectPosition.w;
+      Matrix instanceMatrix = nodeMatrix;
+      if(!node->mInstanceTransforms.Empty())
+      {
+        Matrix::Multiply(instanceMatrix, node->mInstanceTransforms[instance], nodeMatrix);
+      }
+
+      for(uint32_t i = 0; i < BOX_POINT_COUNT; ++i)
+      {
+        Vector4 position       = Vector4(volume[BBIndex[i][0]].x, volume[BBIndex[i][1]].y, volume[BBIndex[i][2]].z, 1.0f);
+        Vector4 objectPosition = instanceMatrix * position;
+        objectPosition /= objectPosition.w;
 
-      AABB.ConsiderNewPointInVolume(Vector3(objectPosition));
+        AABB.ConsiderNewPointInVolume(Vector3(objectPosition));
+      }
     }
   }
 
@@ -204,6 +230,210 @@ void UpdateBlendShapeNodeMapRecursively(Model::BlendShapeModelNodeMap& resultMap
   }
 }
 
+void CollectLevelOfDetailNodesRecursively(std::vector<Scene3D::ModelNode>& nodes, const Scene3D::ModelNode& node)
+{
+  if(!node)
+  {
+    return;
+  }
+
+  const uint32_t primitiveCount = node.GetModelPrimitiveCount();
+  for(uint32_t i = 0u; i < primitiveCount; ++i)
+  {
+    // Without a bounding radius the size on the screen is unknown, so the primitive keeps its most detailed level.
+    Scene3D::ModelPrimitive primitive = node.GetModelPrimitive(i);
+    if(GetImplementation(primitive).GetNumberOfLevelsOfDetail() > 1u && GetImplementation(primitive).GetBoundingRadius() > 0.0f)
+    {
+      nodes.push_back(node);
+      break;
+    }
+  }
+
+  const auto childCount = node.GetChildCount();
+  for(auto i = 0u; i < childCount; ++i)
+  {
+    CollectLevelOfDetailNodesRecursively(nodes, Scene3D::ModelNode::DownCast(node.GetChildAt(i)));
+  }
+}
+
+/**
+ * @brief Checks whether an actor is the root of a subtree or one of its descendants.
+ */
+bool IsInSubtree(Dali::Actor actor, const Dali::Actor& root)
+{
+  while(actor)
+  {
+    if(actor == root)
+    {
+      return true;
+    }
+    actor = actor.GetParent();
+  }
+  return false;
+}
+
+/**
+ * @brief Selects the level of detail of a node from how large it is on the screen, relative to half the height of the view.
+ */
+float SelectLevelOfDetail(const Matrix& worldMatrix, const Matrix& cameraWorldMatrix, const Matrix& projectionMatrix, float boundingRadius, const std::vector<float>& thresholds, uint32_t maximumLevel)
+{
+  const float scale  = std::max(worldMatrix.GetXAxis().Length(), std::max(worldMatrix.GetYAxis().Length(), worldMatrix.GetZAxis().Length()));
+  const float radius = boundingRadius * scale;
+
+  // The projection scales half the height of the view to 1, and a perspective one also divides by the depth.
+  const float* projection    = projectionMatrix.AsFloat();
+  float        projectedSize = radius * std::abs(projection[5]);
+  if(!Dali::EqualsZero(projection[11]))
+  {
+    const float distance = (worldMatrix.GetTranslation3() - cameraWorldMatrix.GetTranslation3()).Length();
+    projectedSize        = (distance > radius) ? projectedSize / distance : std::numeric_limits<float>::max();
+  }
+
+  uint32_t level = 0u;
+  for(const auto threshold : thresholds)
+  {
+    if(projectedSize < threshold)
+    {
+      ++level;
+    }
+  }
+  return static_cast<float>(std::min(level, maximumLevel));
+}
+
+void SetLevelOfDetail(Scene3D::ModelNode& node, uint32_t level)
+{
+  const uint32_t primitiveCount = node.GetModelPrimitiveCount();
+  for(uint32_t i = 0u; i < primitiveCount; ++i)
+  {
+    Scene3D::ModelPrimitive primitive = node.GetModelPrimitive(i);
+    GetImplementation(primitive).SetLevelOfDetail(level);
+  }
+}
+
+/**
+ * @brief Retrieves the box that contains all the primitives of a node, in the space of the node.
+ *
+ * @return False if the node has no primitive, or one of them has no bounding box.
+ */
+bool GetNodeBoundingBox(const Scene3D::ModelNode& node, Vector3& min, Vector3& max)
+{
+  const uint32_t primitiveCount = node.GetModelPrimitiveCount();
+  min                           = Vector3::ONE * std::numeric_limits<float>::max();
+  max                           = Vector3::ONE * std::numeric_limits<float>::lowest();
+  for(uint32_t i = 0u; i < primitiveCount; ++i)
+  {
+    Scene3D::ModelPrimitive primitive = node.GetModelPrimitive(i);
+    Vector3                 primitiveMin, primitiveMax;
+    if(!GetImplementation(primitive).GetBoundingBox(primitiveMin, primitiveMax))
+    {
+      return false;
+    }
+    min = Vector3(std::min(min.x, primitiveMin.x), std::min(min.y, primitiveMin.y), std::min(min.z, primitiveMin.z));
+    max = Vector3(std::max(max.x, primitiveMax.x), std::max(max.y, primitiveMax.y), std::max(max.z, primitiveMax.z));
+  }
+  return primitiveCount > 0u;
+}
+
+void CollectCullingNodesRecursively(std::vector<Scene3D::ModelNode>& nodes, const Scene3D::ModelNode& node)
+{
+  if(!node)
+  {
+    return;
+  }
+
+  Vector3 min, max;
+  if(GetNodeBoundingBox(node, min, max))
+  {
+    nodes.push_back(node);
+  }
+
+  const auto childCount = node.GetChildCount();
+  for(auto i = 0u; i < childCount; ++i)
+  {
+    CollectCullingNodesRecursively(nodes, Scene3D::ModelNode::DownCast(node.GetChildAt(i)));
+  }
+}
+
+/**
+ * @brief Checks whether a box is in the frustum of a view projection, i.e. not entirely outside of one of its planes.
+ */
+bool IsBoxInFrustum(const Matrix& viewProjectionMatrix, const Vector3& min, const Vector3& max)
+{
+  // The planes are the sums and differences of the last row of the matrix with each of the others.
+  const float* m = viewProjectionMatrix.AsFloat();
+  for(uint32_t row = 0u; row < 3u; ++row)
+  {
+    for(const float sign : {1.0f, -1.0f})
+    {
+      const Vector4 plane(m[3] + sign * m[row], m[7] + sign * m[4 + row], m[11] + sign * m[8 + row], m[15] + sign * m[12 + row]);
+
+      // The corner of the box that is the furthest along the normal of the plane.
+      const Vector3 corner(plane.x >= 0.0f ? max.x : min.x, plane.y >= 0.0f ? max.y : min.y, plane.z >= 0.0f ? max.z : min.z);
+      if(plane.x * corner.x + plane.y * corner.y + plane.z * corner.z + plane.w < 0.0f)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Sets 1 to a node in the frustum of the camera or of the shadow light camera, 0 otherwise.
+ *
+ * The box of the node is kept in world space, and only transformed again when the node moves.
+ */
+struct FrustumCullingConstraint
+{
+  FrustumCullingConstraint(const Vector3& boundingBoxMin, const Vector3& boundingBoxMax, bool hasShadowCamera)
+  : mBoundingBoxMin(boundingBoxMin),
+    mBoundingBoxMax(boundingBoxMax),
+    mHasShadowCamera(hasShadowCamera)
+  {
+  }
+
+  void operator()(float& output, const PropertyInputContainer& inputs)
+  {
+    const Matrix& worldMatrix = inputs[0]->GetMatrix();
+    if(mIsWorldBoxDirty || worldMatrix != mWorldMatrix)
+    {
+      mWorldMatrix     = worldMatrix;
+      mIsWorldBoxDirty = false;
+      UpdateWorldBox();
+    }
+
+    Matrix viewProjectionMatrix(false);
+    Matrix::Multiply(viewProjectionMatrix, inputs[1]->GetMatrix(), inputs[2]->GetMatrix());
+    bool isVisible = IsBoxInFrustum(viewProjectionMatrix, mWorldBoxMin, mWorldBoxMax);
+    if(!isVisible && mHasShadowCamera)
+    {
+      isVisible = IsBoxInFrustum(inputs[3]->GetMatrix(), mWorldBoxMin, mWorldBoxMax);
+    }
+    output = isVisible ? 1.0f : 0.0f;
+  }
+
+  void UpdateWorldBox()
+  {
+    const Vector3 corners[2]{mBoundingBoxMin, mBoundingBoxMax};
+    mWorldBoxMin = Vector3::ONE * std::numeric_limits<float>::max();
+    mWorldBoxMax = Vector3::ONE * std::numeric_limits<float>::lowest();
+    for(uint32_t i = 0u; i < 8u; ++i)
+    {
+      const Vector4 corner = mWorldMatrix * Vector4(corners[i & 1u].x, corners[(i >> 1u) & 1u].y, corners[(i >> 2u) & 1u].z, 1.0f);
+      mWorldBoxMin         = Vector3(std::min(mWorldBoxMin.x, corner.x), std::min(mWorldBoxMin.y, corner.y), std::min(mWorldBoxMin.z, corner.z));
+      mWorldBoxMax         = Vector3(std::max(mWorldBoxMax.x, corner.x), std::max(mWorldBoxMax.y, corner.y), std::max(mWorldBoxMax.z, corner.z));
+    }
+  }
+
+  Vector3 mBoundingBoxMin;
+  Vector3 mBoundingBoxMax;
+  Matrix  mWorldMatrix{false};
+  Vector3 mWorldBoxMin;
+  Vector3 mWorldBoxMax;
+  bool    mHasShadowCamera;
+  bool    mIsWorldBoxDirty{true};
+};
+
 void ResetResourceTask(IntrusivePtr<AsyncTask>&& asyncTask)
 {
   if(!asyncTask)
@@ -222,6 +452,7 @@ Model::Model(const std::string& modelUrl, const std::string& resourceDirectoryUr
   mResourceDirectoryUrl(resourceDirectoryUrl),
   mModelRoot(),
   mShaderManager(new Scene3D::Loader::ShaderManager()),
+  mIsFrustumCullingEnabled(false),
   mNaturalSize(Vector3::ZERO),
   mModelPivot(Pivot::CENTER),
   mSceneIblScaleFactor(1.0f),
@@ -304,6 +535,9 @@ void Model::AddModelNode(Scene3D::ModelNode modelNode)
     Scene3D::ColliderMeshProcessor::Get().ColliderMeshChanged(*this);
   }
 
+  AddLevelOfDetailNodes(modelNode);
+  AddCullingNodes(modelNode);
+
   if(Self().GetProperty<bool>(Dali::Actor::Property::CONNECTED_TO_SCENE))
   {
     NotifyResourceReady();
@@ -340,6 +574,9 @@ void Model::RemoveModelNode(Scene3D::ModelNode modelNode)
     GetImplementation(modelNode).SetRootModel(nullptr);
   }
 
+  RemoveLevelOfDetailNodes(modelNode);
+  RemoveCullingNodes(modelNode);
+
   if(mModelRoot)
   {
     ModelNodeTreeUtility::UpdateShaderRecursively(modelNode, nullptr);
@@ -787,6 +1024,7 @@ void Model::CastShadow(bool castShadow)
 {
   mIsShadowCasting = castShadow;
   ModelNodeTreeUtility::UpdateCastShadowRecursively(mModelRoot, mIsShadowCasting);
+  UpdateCullingConstraints();
 }
 
 bool Model::IsShadowCasting() const
@@ -849,6 +1087,7 @@ void Model::OnSceneConnection(int depth)
     {
       mParentSceneView = sceneView;
       GetImpl(sceneView).RegisterSceneItem(this);
+      GetImpl(sceneView).RegisterCameraObserver(this);
       Scene3D::Loader::ShaderManagerPtr shaderManager = GetImpl(sceneView).GetShaderManager();
       if(mShaderManager != shaderManager)
       {
@@ -887,6 +1126,8 @@ void Model::OnSceneConnection(int depth)
   }
 
   NotifyResourceReady();
+  UpdateLevelOfDetailConstraints();
+  UpdateCullingConstraints();
 
   mSizeNotification = Self().AddPropertyNotification(Actor::Property::SIZE, StepCondition(SIZE_STEP_CONDITION));
   mSizeNotification.NotifySignal().Connect(this, &Model::OnSizeNotification);
@@ -902,6 +1143,7 @@ void Model::OnSceneDisconnection()
   if(sceneView && sceneView.GetProperty<bool>(Dali::Actor::Property::CONNECTED_TO_SCENE))
   {
     GetImpl(sceneView).UnregisterSceneItem(this);
+    GetImpl(sceneView).UnregisterCameraObserver(this);
     mParentSceneView.Reset();
   }
 
@@ -1070,6 +1312,9 @@ void Model::NotifyShadowMapTexture(Dali::Texture shadowMapTexture)
   {
     mShadowMapTexture = shadowMapTexture;
     ModelNodeTreeUtility::UpdateShadowMapTextureRecursively(mModelRoot, mShadowMapTexture);
+
+    // The shadow light camera is changed with the shadow map.
+    UpdateCullingConstraints();
   }
 }
 
@@ -1098,6 +1343,12 @@ void Model::NotifyImageBasedLightScaleFactor(float scaleFactor)
   }
 }
 
+void Model::NotifySelectedCameraChanged(Dali::CameraActor camera)
+{
+  UpdateLevelOfDetailConstraints();
+  UpdateCullingConstraints();
+}
+
 void Model::OnModelLoadComplete()
 {
   IntrusivePtr<Model> self = this; // Keep reference until this API finished
@@ -1236,6 +1487,8 @@ void Model::CreateModel()
   }
 
   UpdateBlendShapeNodeMap();
+  CollectLevelOfDetailNodes();
+  CollectCullingNodes();
 
   mNaturalSize = AABB.CalculateSize();
   mModelPivot  = AABB.CalculatePivot();
@@ -1294,6 +1547,338 @@ void Model::UpdateBlendShapeNodeMap()
   UpdateBlendShapeNodeMapRecursively(mBlendShapeModelNodeMap, mModelRoot);
 }
 
+void Model::CollectLevelOfDetailNodes()
+{
+  ResetLevelOfDetailNodes();
+  AddLevelOfDetailNodes(mModelRoot);
+}
+
+void Model::AddLevelOfDetailNodes(const Scene3D::ModelNode& modelNode)
+{
+  std::vector<Scene3D::ModelNode> nodes;
+  CollectLevelOfDetailNodesRecursively(nodes, modelNode);
+
+  const std::size_t firstIndex = mLevelOfDetailNodes.size();
+  for(auto& node : nodes)
+  {
+    LevelOfDetailNode levelOfDetailNode{node, Property::INVALID_INDEX, 0.0f, 0u, {}, {}};
+
+    const uint32_t primitiveCount = node.GetModelPrimitiveCount();
+    for(uint32_t i = 0u; i < primitiveCount; ++i)
+    {
+      Scene3D::ModelPrimitive primitive     = node.GetModelPrimitive(i);
+      auto&                   primitiveImpl = GetImplementation(primitive);
+      levelOfDetailNode.boundingRadius      = std::max(levelOfDetailNode.boundingRadius, primitiveImpl.GetBoundingRadius());
+      levelOfDetailNode.numberOfLevels      = std::max(levelOfDetailNode.numberOfLevels, primitiveImpl.GetNumberOfLevelsOfDetail());
+    }
+
+    levelOfDetailNode.levelIndex   = node.RegisterProperty(LOD_LEVEL_PROPERTY_NAME.data(), 0.0f);
+    levelOfDetailNode.notification = node.AddPropertyNotification(levelOfDetailNode.levelIndex, StepCondition(LOD_LEVEL_STEP_CONDITION, LOD_LEVEL_STEP_REFERENCE));
+    levelOfDetailNode.notification.NotifySignal().Connect(this, &Model::OnLevelOfDetailNotification);
+    mLevelOfDetailNodes.push_back(std::move(levelOfDetailNode));
+  }
+
+  UpdateLevelOfDetailConstraints(firstIndex);
+}
+
+void Model::RemoveLevelOfDetailNodes(const Scene3D::ModelNode& modelNode)
+{
+  // Move the nodes of the subtree to the end, keeping the order of the others.
+  auto iter = std::stable_partition(mLevelOfDetailNodes.begin(), mLevelOfDetailNodes.end(), [&modelNode](const LevelOfDetailNode& levelOfDetailNode)
+  { return !IsInSubtree(levelOfDetailNode.node, modelNode); });
+  ResetLevelOfDetailNodes(static_cast<std::size_t>(std::distance(mLevelOfDetailNodes.begin(), iter)));
+}
+
+void Model::ResetLevelOfDetailNodes(std::size_t firstIndex)
+{
+  for(std::size_t index = firstIndex; index < mLevelOfDetailNodes.size(); ++index)
+  {
+    auto& levelOfDetailNode = mLevelOfDetailNodes[index];
+    if(levelOfDetailNode.constraint)
+    {
+      levelOfDetailNode.constraint.Remove();
+    }
+    levelOfDetailNode.notification.NotifySignal().Disconnect(this, &Model::OnLevelOfDetailNotification);
+    levelOfDetailNode.node.RemovePropertyNotification(levelOfDetailNode.notification);
+    SetLevelOfDetail(levelOfDetailNode.node, 0u);
+  }
+  mLevelOfDetailNodes.resize(std::min(firstIndex, mLevelOfDetailNodes.size()));
+}
+
+void Model::UpdateLevelOfDetailConstraints(std::size_t firstIndex)
+{
+  Dali::CameraActor camera = (mLevelOfDetailThresholds.empty() || firstIndex >= mLevelOfDetailNodes.size()) ? Dali::CameraActor() : GetRenderingCamera();
+  for(std::size_t index = firstIndex; index < mLevelOfDetailNodes.size(); ++index)
+  {
+    auto& levelOfDetailNode = mLevelOfDetailNodes[index];
+    if(levelOfDetailNode.constraint)
+    {
+      levelOfDetailNode.constraint.Remove();
+      levelOfDetailNode.constraint.Reset();
+    }
+
+    if(!camera)
+    {
+      // Without thresholds or a camera, the original meshes are used.
+      levelOfDetailNode.node.SetProperty(levelOfDetailNode.levelIndex, 0.0f);
+      SetLevelOfDetail(levelOfDetailNode.node, 0u);
+      continue;
+    }
+
+    levelOfDetailNode.constraint = Constraint::New<float>(levelOfDetailNode.node, levelOfDetailNode.levelIndex, [thresholds = mLevelOfDetailThresholds, boundingRadius = levelOfDetailNode.boundingRadius, maximumLevel = levelOfDetailNode.numberOfLevels - 1u](float& output, const PropertyInputContainer& inputs)
+    { output = SelectLevelOfDetail(inputs[0]->GetMatrix(), inputs[1]->GetMatrix(), inputs[2]->GetMatrix(), boundingRadius, thresholds, maximumLevel); });
+    levelOfDetailNode.constraint.AddSource(Source{levelOfDetailNode.node, Dali::Actor::Property::WORLD_MATRIX});
+    levelOfDetailNode.constraint.AddSource(Source{camera, Dali::Actor::Property::WORLD_MATRIX});
+    levelOfDetailNode.constraint.AddSource(Source{camera, Dali::CameraActor::Property::PROJECTION_MATRIX});
+    Dali::Integration::ConstraintSetInternalTag(levelOfDetailNode.constraint, MODEL_CONSTRAINT_TAG);
+    levelOfDetailNode.constraint.Apply();
+  }
+}
+
+Dali::CameraActor Model::GetRenderingCamera() const
+{
+  Scene3D::SceneView sceneView = mParentSceneView.GetHandle();
+  if(sceneView)
+  {
+    return sceneView.GetSelectedCamera();
+  }
+
+  // Model can be added on Dali::Scene directly without SceneView.
+  Dali::Integration::SceneHolder sceneHolder = Dali::Integration::SceneHolder::Get(Self());
+  if(sceneHolder && sceneHolder.GetRenderTaskList().GetTaskCount() > 0u)
+  {
+    return sceneHolder.GetRenderTaskList().GetTask(0u).GetCameraActor();
+  }
+  return Dali::CameraActor();
+}
+
+void Model::OnLevelOfDetailNotification(Dali::PropertyNotification& source)
+{
+  for(auto& levelOfDetailNode : mLevelOfDetailNodes)
+  {
+    if(levelOfDetailNode.notification == source)
+    {
+      const float level = levelOfDetailNode.node.GetCurrentProperty<float>(levelOfDetailNode.levelIndex);
+      SetLevelOfDetail(levelOfDetailNode.node, static_cast<uint32_t>(std::max(level, 0.0f)));
+      break;
+    }
+  }
+}
+
+void Model::SetLevelOfDetailThresholds(std::vector<float> thresholds)
+{
+  mLevelOfDetailThresholds = std::move(thresholds);
+  UpdateLevelOfDetailConstraints();
+}
+
+const std::vector<float>& Model::GetLevelOfDetailThresholds() const
+{
+  return mLevelOfDetailThresholds;
+}
+
+void Model::CollectCullingNodes()
+{
+  ResetCullingNodes();
+  AddCullingNodes(mModelRoot);
+}
+
+void Model::AddCullingNodes(const Scene3D::ModelNode& modelNode)
+{
+  if(!mIsFrustumCullingEnabled)
+  {
+    return;
+  }
+
+  std::vector<Scene3D::ModelNode> nodes;
+  CollectCullingNodesRecursively(nodes, modelNode);
+
+  const std::size_t firstIndex = mCullingNodes.size();
+  for(auto& node : nodes)
+  {
+    CullingNode cullingNode{node, Property::INVALID_INDEX, Vector3::ZERO, Vector3::ZERO, {}, {}};
+    GetNodeBoundingBox(node, cullingNode.boundingBoxMin, cullingNode.boundingBoxMax);
+
+    cullingNode.visibleIndex = node.RegisterProperty(VISIBLE_PROPERTY_NAME.data(), 1.0f);
+    cullingNode.notification = node.AddPropertyNotification(cullingNode.visibleIndex, StepCondition(VISIBLE_STEP_CONDITION, VISIBLE_STEP_REFERENCE));
+    cullingNode.notification.NotifySignal().Connect(this, &Model::OnCullingNotification);
+    mCullingNodes.push_back(std::move(cullingNode));
+  }
+
+  UpdateCullingConstraints(firstIndex);
+}
+
+void Model::RemoveCullingNodes(const Scene3D::ModelNode& modelNode)
+{
+  // Move the nodes of the subtree to the end, keeping the order of the others.
+  auto iter = std::stable_partition(mCullingNodes.begin(), mCullingNodes.end(), [&modelNode](const CullingNode& cullingNode)
+  { return !IsInSubtree(cullingNode.node, modelNode); });
+  ResetCullingNodes(static_cast<std::size_t>(std::distance(mCullingNodes.begin(), iter)));
+}
+
+void Model::ResetCullingNodes(std::size_t firstIndex)
+{
+  for(std::size_t index = firstIndex; index < mCullingNodes.size(); ++index)
+  {
+    auto& cullingNode = mCullingNodes[index];
+    if(cullingNode.constraint)
+    {
+      cullingNode.constraint.Remove();
+    }
+    cullingNode.notification.NotifySignal().Disconnect(this, &Model::OnCullingNotification);
+    cullingNode.node.RemovePropertyNotification(cullingNode.notification);
+    GetImplementation(cullingNode.node).SetCulled(false);
+  }
+  mCullingNodes.resize(std::min(firstIndex, mCullingNodes.size()));
+}
+
+void Model::UpdateCullingConstraints(std::size_t firstIndex)
+{
+  Dali::CameraActor camera = (firstIndex >= mCullingNodes.size()) ? Dali::CameraActor() : GetRenderingCamera();
+
+  // The nodes out of view still cast their shadows in view.
+  Dali::CameraActor  shadowCamera;
+  Property::Index    shadowViewProjectionMatrixIndex = Property::INVALID_INDEX;
+  Scene3D::SceneView sceneView                       = mParentSceneView.GetHandle();
+  if(camera && sceneView && mIsShadowCasting)
+  {
+    shadowCamera = GetImpl(sceneView).GetShadowLightCamera();
+    if(shadowCamera)
+    {
+      shadowViewProjectionMatrixIndex = shadowCamera.GetPropertyIndex("tempViewProjectionMatrix");
+    }
+  }
+  const bool hasShadowCamera = shadowViewProjectionMatrixIndex != Property::INVALID_INDEX;
+
+  for(std::size_t index = firstIndex; index < mCullingNodes.size(); ++index)
+  {
+    auto& cullingNode = mCullingNodes[index];
+    if(cullingNode.constraint)
+    {
+      cullingNode.constraint.Remove();
+      cullingNode.constraint.Reset();
+    }
+
+    if(!camera)
+    {
+      // Without a camera, all the nodes are rendered.
+      cullingNode.node.SetProperty(cullingNode.visibleIndex, 1.0f);
+      GetImplementation(cullingNode.node).SetCulled(false);
+      continue;
+    }
+
+    cullingNode.constraint = Constraint::New<float>(cullingNode.node, cullingNode.visibleIndex, FrustumCullingConstraint(cullingNode.boundingBoxMin, cullingNode.boundingBoxMax, hasShadowCamera));
+    cullingNode.constraint.AddSource(Source{cullingNode.node, Dali::Actor::Property::WORLD_MATRIX});
+    cullingNode.constraint.AddSource(Source{camera, Dali::CameraActor::Property::VIEW_MATRIX});
+    cullingNode.constraint.AddSource(Source{camera, Dali::CameraActor::Property::PROJECTION_MATRIX});
+    if(hasShadowCamera)
+    {
+      cullingNode.constraint.AddSource(Source{shadowCamera, shadowViewProjectionMatrixIndex});
+    }
+    Dali::Integration::ConstraintSetInternalTag(cullingNode.constraint, MODEL_CONSTRAINT_TAG);
+    cullingNode.constraint.Apply();
+  }
+}
+
+void Model::OnCullingNotification(Dali::PropertyNotification& source)
+{
+  for(auto& cullingNode : mCullingNodes)
+  {
+    if(cullingNode.notification == source)
+    {
+      const float visible = cullingNode.node.GetCurrentProperty<float>(cullingNode.visibleIndex);
+      GetImplementation(cullingNode.node).SetCulled(visible < VISIBLE_STEP_REFERENCE);
+      break;
+    }
+  }
+}
+
+void Model::SetFrustumCulling(bool enabled)
+{
+  if(mIsFrustumCullingEnabled != enabled)
+  {
+    mIsFrustumCullingEnabled = enabled;
+    CollectCullingNodes();
+  }
+}
+
+bool Model::IsFrustumCullingEnabled() const
+{
+  return mIsFrustumCullingEnabled;
+}
+
+void Model::SetProperty(BaseObject* object, Property::Index index, const Property::Value& value)
+{
+  Scene3D::Model model = Scene3D::Model::DownCast(Dali::BaseHandle(object));
+
+  if(model)
+  {
+    Model& modelImpl(GetImpl(model));
+
+    switch(index)
+    {
+      case Scene3D::Model::Property::LOD_THRESHOLDS:
+      {
+        std::vector<float> thresholds;
+        if(const auto* array = value.GetArray())
+        {
+          for(uint32_t i = 0u; i < array->Count(); ++i)
+          {
+            float threshold;
+            if(array->GetElementAt(i).Get(threshold))
+            {
+              thresholds.push_back(threshold);
+            }
+          }
+        }
+        modelImpl.SetLevelOfDetailThresholds(std::move(thresholds));
+        break;
+      }
+      case Scene3D::Model::Property::FRUSTUM_CULLING:
+      {
+        bool enabled;
+        if(value.Get(enabled))
+        {
+          modelImpl.SetFrustumCulling(enabled);
+        }
+        break;
+      }
+    }
+  }
+}
+
+Property::Value Model::GetProperty(BaseObject* object, Property::Index index)
+{
+  Property::Value value;
+
+  Scene3D::Model model = Scene3D::Model::DownCast(Dali::BaseHandle(object));
+
+  if(model)
+  {
+    Model& modelImpl(GetImpl(model));
+
+    switch(index)
+    {
+      case Scene3D::Model::Property::LOD_THRESHOLDS:
+      {
+        Property::Array thresholds;
+        for(const auto threshold : modelImpl.GetLevelOfDetailThresholds())
+        {
+          thresholds.PushBack(threshold);
+        }
+        value = thresholds;
+        break;
+      }
+      case Scene3D::Model::Property::FRUSTUM_CULLING:
+      {
+        value = modelImpl.IsFrustumCullingEnabled();
+        break;
+      }
+    }
+  }
+
+  return value;
+}
+
 } // namespace Internal
 } // namespace Scene3D
 } // namespace Dali
@@ -24,6 +24,7 @@
 #include <dali/public-api/actors/camera-actor.h>
 #include <dali/public-api/actors/layer.h>
 #include <dali/public-api/animation/animation.h>
+#include <dali/public-api/animation/constraint.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/property-notification.h>
 #include <dali/public-api/object/weak-handle.h>
@@ -31,6 +32,7 @@
 #include <unordered_map>
 
 // INTERNAL INCLUDES
+#include <dali-scene3d/internal/common/camera-observer.h>
 #include <dali-scene3d/internal/common/environment-map-load-task.h>
 #include <dali-scene3d/internal/common/light-observer.h>
 #include <dali-scene3d/internal/common/model-load-task.h>
@@ -53,7 +55,7 @@ namespace Internal
 /**
  * @brief Impl class for Model.
  */
-class Model : public Dali::Toolkit::ControlImpl, public LightObserver, public Dali::Scene3D::Collidable
+class Model : public Dali::Toolkit::ControlImpl, public LightObserver, public CameraObserver, public Dali::Scene3D::Collidable
 {
 public:
   using AnimationData          = std::pair<std::string, Dali::Animation>;
@@ -267,6 +269,52 @@ public:
    */
   void RemoveColliderMesh(Scene3D::ModelNode& node);
 
+  /**
+   * @brief Sets the projected sizes below which the meshes switch to their next level of detail.
+   *
+   * @param[in] thresholds The projected sizes, relative to half the height of the view.
+   */
+  void SetLevelOfDetailThresholds(std::vector<float> thresholds);
+
+  /**
+   * @brief Retrieves the projected sizes below which the meshes switch to their next level of detail.
+   *
+   * @return The projected sizes, relative to half the height of the view.
+   */
+  const std::vector<float>& GetLevelOfDetailThresholds() const;
+
+  /**
+   * @brief Sets whether the nodes whose meshes are out of view are culled.
+   *
+   * @param[in] enabled True to cull the nodes.
+   */
+  void SetFrustumCulling(bool enabled);
+
+  /**
+   * @brief Retrieves whether the nodes whose meshes are out of view are culled.
+   *
+   * @return True if the nodes are culled.
+   */
+  bool IsFrustumCullingEnabled() const;
+
+  // Properties
+
+  /**
+   * Called when a property of an object of this type is set.
+   * @param[in] object The object whose property is set.
+   * @param[in] index The property index.
+   * @param[in] value The new property value.
+   */
+  static void SetProperty(BaseObject* object, Property::Index index, const Property::Value& value);
+
+  /**
+   * Called to retrieve a property of an object of this type.
+   * @param[in] object The object whose property is to be retrieved.
+   * @param[in] index The property index.
+   * @return The current value of the property.
+   */
+  static Property::Value GetProperty(BaseObject* object, Property::Index index);
+
 protected:
   /**
    * @brief Constructs a new Model.
@@ -377,6 +425,12 @@ public: // Overrides LightObserver Methods.
    */
   void NotifyImageBasedLightScaleFactor(float scaleFactor) override;
 
+public: // Overrides CameraObserver Methods.
+  /**
+   * @copydoc Dali::Scene3D::Internal::CameraObserver::NotifySelectedCameraChanged()
+   */
+  void NotifySelectedCameraChanged(Dali::CameraActor camera) override;
+
 private:
   /**
    * @brief Asynchronously model loading finished.
@@ -433,6 +487,121 @@ private:
    */
   void UpdateBlendShapeNodeMap();
 
+  /**
+   * @brief Collects the ModelNodes whose primitives have levels of detail, in the whole model.
+   */
+  void CollectLevelOfDetailNodes();
+
+  /**
+   * @brief Collects the ModelNodes whose primitives have levels of detail in a subtree added to the model,
+   * and applies their constraints.
+   *
+   * @param[in] modelNode The root of the added subtree.
+   */
+  void AddLevelOfDetailNodes(const Scene3D::ModelNode& modelNode);
+
+  /**
+   * @brief Forgets the ModelNodes of a subtree removed from the model.
+   *
+   * @param[in] modelNode The root of the removed subtree.
+   */
+  void RemoveLevelOfDetailNodes(const Scene3D::ModelNode& modelNode);
+
+  /**
+   * @brief Removes the constraints and notifications that select the levels of detail of the ModelNodes,
+   * and forgets the ModelNodes.
+   *
+   * @param[in] firstIndex The index of the first LevelOfDetailNode to reset. The ones after it are reset too.
+   */
+  void ResetLevelOfDetailNodes(std::size_t firstIndex = 0u);
+
+  /**
+   * @brief Applies the constraints that select the level of detail of each ModelNode from the camera,
+   * or uses the original meshes if the levels of detail are disabled.
+   *
+   * @param[in] firstIndex The index of the first LevelOfDetailNode to update. The ones after it are updated too.
+   */
+  void UpdateLevelOfDetailConstraints(std::size_t firstIndex = 0u);
+
+  /**
+   * @brief Retrieves the camera that renders the model, which the levels of detail are selected for and the nodes are culled by.
+   *
+   * @return The selected camera of the parent SceneView, or the default camera of the scene.
+   */
+  Dali::CameraActor GetRenderingCamera() const;
+
+  /**
+   * @brief Changes the level of detail of the primitives of a ModelNode, when its constraint selects another one.
+   */
+  void OnLevelOfDetailNotification(Dali::PropertyNotification& source);
+
+  /**
+   * @brief Collects the ModelNodes whose primitives all have bounding boxes, in the whole model.
+   */
+  void CollectCullingNodes();
+
+  /**
+   * @brief Collects the ModelNodes whose primitives all have bounding boxes in a subtree added to the model,
+   * and applies their constraints.
+   *
+   * @param[in] modelNode The root of the added subtree.
+   */
+  void AddCullingNodes(const Scene3D::ModelNode& modelNode);
+
+  /**
+   * @brief Forgets the ModelNodes of a subtree removed from the model, and renders them again.
+   *
+   * @param[in] modelNode The root of the removed subtree.
+   */
+  void RemoveCullingNodes(const Scene3D::ModelNode& modelNode);
+
+  /**
+   * @brief Removes the constraints and notifications that cull the ModelNodes, renders them, and forgets them.
+   *
+   * @param[in] firstIndex The index of the first CullingNode to reset. The ones after it are reset too.
+   */
+  void ResetCullingNodes(std::size_t firstIndex = 0u);
+
+  /**
+   * @brief Applies the constraints that check whether each ModelNode is in the frustum of the camera
+   * or of the shadow light camera, or renders all of them if the frustum culling is disabled.
+   *
+   * @param[in] firstIndex The index of the first CullingNode to update. The ones after it are updated too.
+   */
+  void UpdateCullingConstraints(std::size_t firstIndex = 0u);
+
+  /**
+   * @brief Culls the primitives of a ModelNode or renders them again, when its constraint finds it out of or back in view.
+   */
+  void OnCullingNotification(Dali::PropertyNotification& source);
+
+private:
+  /**
+   * @brief A ModelNode whose primitives have levels of detail.
+   */
+  struct LevelOfDetailNode
+  {
+    Scene3D::ModelNode         node;
+    Property::Index            levelIndex;     ///< The index of the property that the constraint sets to the selected level.
+    float                      boundingRadius; ///< The largest bounding radius of the primitives.
+    uint32_t                   numberOfLevels; ///< The largest number of levels of the primitives.
+    Dali::Constraint           constraint;
+    Dali::PropertyNotification notification;
+  };
+
+  /**
+   * @brief A ModelNode that is culled when it's out of view.
+   */
+  struct CullingNode
+  {
+    Scene3D::ModelNode         node;
+    Property::Index            visibleIndex;   ///< The index of the property that the constraint sets to 1 when the node is in view, 0 otherwise.
+    Vector3                    boundingBoxMin; ///< The minimum corner of the box of the primitives, in the space of the node.
+    Vector3                    boundingBoxMax; ///< The maximum corner of the box of the primitives, in the space of the node.
+    Dali::Constraint           constraint;
+    Dali::PropertyNotification notification;
+  };
+
 private:
   std::string                    mModelUrl;
   std::string                    mResourceDirectoryUrl;
@@ -453,6 +622,14 @@ private:
   // List of ModelNode for name of blend shape.
   BlendShapeModelNodeMap mBlendShapeModelNodeMap;
 
+  // Levels of detail
+  std::vector<LevelOfDetailNode> mLevelOfDetailNodes;
+  std::vector<float>             mLevelOfDetailThresholds;
+
+  // Frustum culling
+  std::vector<CullingNode> mCullingNodes;
+  bool                     mIsFrustumCullingEnabled;
+
   // Asynchronous loading variable
   ModelLoadTaskPtr          mModelLoadTask;
   EnvironmentMapLoadTaskPtr mIblDiffuseLoadTask;
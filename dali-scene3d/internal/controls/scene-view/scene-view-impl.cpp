@@ -344,6 +344,7 @@ SceneView::SceneView()
   mSkyboxIntensity(1.0f),
   mFailedCaptureCallbacks(nullptr),
   mLightObservers(),
+  mCameraObservers(),
   mShaderManager(new Scene3D::Loader::ShaderManager())
 {
 }
@@ -533,6 +534,26 @@ void SceneView::UnregisterSceneItem(Scene3D::Internal::LightObserver* item)
   }
 }
 
+void SceneView::RegisterCameraObserver(Scene3D::Internal::CameraObserver* item)
+{
+  if(item)
+  {
+    mCameraObservers.PushBack(item);
+  }
+}
+
+void SceneView::UnregisterCameraObserver(Scene3D::Internal::CameraObserver* item)
+{
+  if(item)
+  {
+    auto iter = mCameraObservers.Find(item);
+    if(iter != mCameraObservers.End())
+    {
+      mCameraObservers.Erase(iter);
+    }
+  }
+}
+
 void SceneView::SetImageBasedLightSource(const std::string& diffuseUrl, const std::string& specularUrl, float scaleFactor)
 {
   bool needIblReset = false;
@@ -1047,6 +1068,11 @@ Dali::Scene3D::Loader::ShaderManagerPtr SceneView::GetShaderManager() const
   return mShaderManager;
 }
 
+CameraActor SceneView::GetShadowLightCamera() const
+{
+  return mShadowLight ? GetImplementation(mShadowLight).GetCamera() : CameraActor();
+}
+
 void SceneView::UpdateShadowUniform(Scene3D::Light light)
 {
   mShaderManager->UpdateShadowUniform(light);
@@ -1240,6 +1266,7 @@ void SceneView::OnSceneConnection(int depth)
 void SceneView::OnSceneDisconnection()
 {
   mLightObservers.Clear();
+  mCameraObservers.Clear();
 
   Window window = mWindow.GetHandle();
   if(window)
@@ -1388,6 +1415,14 @@ void SceneView::UpdateCamera(CameraActor camera)
 
       mSelectedCamera = camera;
       camera.SceneDisconnectedSignal().Connect(this, &SceneView::OnCameraDisconnected);
+
+      for(auto&& item : mCameraObservers)
+      {
+        if(item)
+        {
+          item->NotifySelectedCameraChanged(mSelectedCamera);
+        }
+      }
     }
 
     bool isCameraIncluded = CheckInside(mRootLayer, camera);
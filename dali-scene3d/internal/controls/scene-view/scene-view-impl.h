@@ -35,6 +35,7 @@
 #include <dali/public-api/rendering/texture.h>
 
 // INTERNAL INCLUDES
+#include <dali-scene3d/internal/common/camera-observer.h>
 #include <dali-scene3d/internal/common/environment-map-load-task.h>
 #include <dali-scene3d/internal/common/light-observer.h>
 #include <dali-scene3d/public-api/controls/scene-view/scene-view.h>
@@ -149,6 +150,20 @@ public:
    */
   void UnregisterSceneItem(Scene3D::Internal::LightObserver* item);
 
+  /**
+   * @brief Register an item to be notified when the selected camera changes.
+   *
+   * @param[in] item camera observer to be registered.
+   */
+  void RegisterCameraObserver(Scene3D::Internal::CameraObserver* item);
+
+  /**
+   * @brief Unregister an item from the selected camera changes.
+   *
+   * @param[in] item camera observer to be unregistered.
+   */
+  void UnregisterCameraObserver(Scene3D::Internal::CameraObserver* item);
+
   /**
    * @copydoc SceneView::SetImageBasedLightSource()
    */
@@ -295,6 +310,12 @@ public:
    */
   Dali::Scene3D::Loader::ShaderManagerPtr GetShaderManager() const;
 
+  /**
+   * @brief Retrieves the camera that renders the shadow map of this SceneView.
+   * @return The camera of the shadow light, or an empty handle if there's no shadow.
+   */
+  CameraActor GetShadowLightCamera() const;
+
   /**
    * @brief Updates shader uniforms about shadow.
    * @param[in] light Light that makes shadow.
@@ -604,7 +625,8 @@ private: // Implementation of Processor
   Dali::Timer                                                            mCaptureTimer;     // Timer to check the capture is time out or not.
   int32_t                                                                mTimerTickCount{0};
 
-  Dali::Integration::OrderedSet<Scene3D::Internal::LightObserver, false> mLightObservers; ///< The set of items to be notified when light properties change. (not owned)
+  Dali::Integration::OrderedSet<Scene3D::Internal::LightObserver, false>  mLightObservers;  ///< The set of items to be notified when light properties change. (not owned)
+  Dali::Integration::OrderedSet<Scene3D::Internal::CameraObserver, false> mCameraObservers; ///< The set of items to be notified when the selected camera changes. (not owned)
 
   bool     mWindowSizeChanged{false};
   uint32_t mWindowWidth{0};
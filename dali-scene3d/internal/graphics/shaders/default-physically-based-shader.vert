@@ -47,6 +47,14 @@ INPUT vec4 aWeights0;
 ADD_EXTRA_SKINNING_ATTRIBUTES
 #endif
 
+#ifdef INSTANCING
+// The columns of the transform of each instance, in the space of the node.
+INPUT highp vec4 aInstanceMatrix0;
+INPUT highp vec4 aInstanceMatrix1;
+INPUT highp vec4 aInstanceMatrix2;
+INPUT highp vec4 aInstanceMatrix3;
+#endif
+
 #ifdef MORPH
 UNIFORM highp sampler2D sBlendShapeGeometry;
 #endif
@@ -107,6 +115,12 @@ void main()
   highp vec3 normal = aNormal;
   highp vec3 tangent = aTangent.xyz;
 
+#ifdef INSTANCING
+  highp mat4 modelMatrix = uModelMatrix * mat4(aInstanceMatrix0, aInstanceMatrix1, aInstanceMatrix2, aInstanceMatrix3);
+#else
+  highp mat4 modelMatrix = uModelMatrix;
+#endif
+
 #ifdef MORPH
   highp int width = textureSize( sBlendShapeGeometry, 0 ).x;
 
@@ -198,7 +212,7 @@ void main()
 
   highp vec4 positionW = position;
 #else
-  highp vec4 positionW = uModelMatrix * position;
+  highp vec4 positionW = modelMatrix * position;
 #endif
 
   highp vec4 positionV = uViewMatrix * positionW;
@@ -211,7 +225,7 @@ void main()
 #ifdef VEC4_TANGENT
   bitangent *= aTangent.w;
 #endif
-  vTBN = mat3(uModelMatrix) * mat3(tangent, bitangent, normal);
+  vTBN = mat3(modelMatrix) * mat3(tangent, bitangent, normal);
 
 #ifdef FLIP_V
   vUV = vec2(aTexCoord.x, 1.0 - aTexCoord.y);
@@ -19,6 +19,13 @@ INPUT vec4 aWeights0;
 ADD_EXTRA_SKINNING_ATTRIBUTES;
 #endif
 
+#ifdef INSTANCING
+INPUT highp vec4 aInstanceMatrix0;
+INPUT highp vec4 aInstanceMatrix1;
+INPUT highp vec4 aInstanceMatrix2;
+INPUT highp vec4 aInstanceMatrix3;
+#endif
+
 #ifdef MORPH
 UNIFORM highp sampler2D sBlendShapeGeometry;
 #endif
@@ -130,8 +137,12 @@ void main()
 
   position = bone * position;
   highp vec4 positionW = position;
+#else
+#ifdef INSTANCING
+  highp vec4 positionW = uModelMatrix * (mat4(aInstanceMatrix0, aInstanceMatrix1, aInstanceMatrix2, aInstanceMatrix3) * position);
 #else
   highp vec4 positionW = uModelMatrix * position;
+#endif
 #endif
 
   // To synchronize View-Projection matrix with pbr shader
@@ -93,8 +93,8 @@ bool GlbLoaderImpl::LoadModel(const Dali::String& url, Dali::Scene3D::Loader::Lo
   stream.read(reinterpret_cast<char*>(&jsonChunkData[0]), static_cast<std::streamsize>(static_cast<size_t>(jsonChunkHeader.chunkLength)));
   std::string gltfText(jsonChunkData.begin(), jsonChunkData.end());
 
-  uint32_t             binaryChunkOffset = sizeof(GlbHeader) + sizeof(ChunkHeader) + jsonChunkHeader.chunkLength;
-  std::vector<uint8_t> binaryChunkData;
+  uint32_t              binaryChunkOffset = sizeof(GlbHeader) + sizeof(ChunkHeader) + jsonChunkHeader.chunkLength;
+  Dali::Vector<uint8_t> binaryChunkData;
   if(glbHeader.length > binaryChunkOffset)
   {
     ChunkHeader binaryChunkHeader;
@@ -106,8 +106,9 @@ bool GlbLoaderImpl::LoadModel(const Dali::String& url, Dali::Scene3D::Loader::Lo
       return false;
     }
 
-    binaryChunkData.resize(binaryChunkHeader.chunkLength);
-    stream.read(reinterpret_cast<char*>(&binaryChunkData[0]), static_cast<std::streamsize>(static_cast<size_t>(binaryChunkHeader.chunkLength)));
+    // Read straight into the buffer that the BufferDefinition takes over, so mesh attributes can use it without copying.
+    binaryChunkData.ResizeUninitialized(binaryChunkHeader.chunkLength);
+    stream.read(reinterpret_cast<char*>(binaryChunkData.Begin()), static_cast<std::streamsize>(static_cast<size_t>(binaryChunkHeader.chunkLength)));
   }
 
   json::unique_ptr root(json_parse(gltfText.c_str(), gltfText.size()));
@@ -131,12 +132,9 @@ bool GlbLoaderImpl::LoadModel(const Dali::String& url, Dali::Scene3D::Loader::Lo
 
   auto& outBuffers = context.mOutput.mResources.mBuffers;
   outBuffers.Reserve(document.mBuffers.size());
-  if(!binaryChunkData.empty())
+  if(!binaryChunkData.Empty())
   {
-    Dali::Vector<uint8_t> buffer;
-    buffer.Resize(binaryChunkData.size());
-    std::copy(binaryChunkData.begin(), binaryChunkData.end(), buffer.Begin());
-    outBuffers.PushBack(BufferDefinition(std::move(buffer)));
+    outBuffers.PushBack(BufferDefinition(std::move(binaryChunkData)));
   }
 
   Gltf2Util::ConvertGltfToContext(document, context, isMRendererModel);
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-scene3d/internal/loader/mesh-attribute-generator.h>
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/compile-time-math.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/internal/common/parallel-job-runner.h>
+
+namespace Dali::Scene3D::Loader::Internal
+{
+namespace
+{
+constexpr uint32_t MINIMUM_ELEMENTS_PER_JOB = 16384u; ///< Fewer triangles or vertices than this aren't worth a job of their own.
+constexpr uint32_t TRIANGLES_PER_BLOCK      = 256u;   ///< The triangles of a block are skipped together by the jobs whose vertices they don't use.
+
+/**
+ * @brief Splits [0, count) into ranges of the same size, but the last one.
+ */
+class Ranges
+{
+public:
+  Ranges(uint32_t count, uint32_t numberOfRanges)
+  : mCount(count),
+    mRangeSize(std::max(1u, (count + numberOfRanges - 1u) / numberOfRanges))
+  {
+  }
+
+  uint32_t Begin(uint32_t range) const
+  {
+    return static_cast<uint32_t>(std::min<uint64_t>(static_cast<uint64_t>(range) * mRangeSize, mCount));
+  }
+
+  uint32_t End(uint32_t range) const
+  {
+    return Begin(range + 1u);
+  }
+
+  uint32_t Find(uint32_t value) const
+  {
+    return value / mRangeSize;
+  }
+
+private:
+  uint32_t mCount;
+  uint32_t mRangeSize;
+};
+
+uint32_t GetNumberOfJobs(uint32_t numberOfElements, uint32_t maximumNumberOfHelpers)
+{
+  return std::max(1u, std::min(maximumNumberOfHelpers + 1u, numberOfElements / MINIMUM_ELEMENTS_PER_JOB));
+}
+
+/**
+ * @brief Gets the vertices of a triangle.
+ * @return False if any of them is out of range.
+ */
+template<typename IndexType>
+bool GetTriangle(const IndexType* indices, uint32_t triangle, uint32_t numVertices, IndexType (&vertices)[3])
+{
+  for(uint32_t corner = 0u; corner < 3u; ++corner)
+  {
+    // Meshes without indices use their vertices in order.
+    vertices[corner] = indices ? indices[triangle * 3u + corner] : static_cast<IndexType>(triangle * 3u + corner);
+  }
+  return vertices[0] < numVertices && vertices[1] < numVertices && vertices[2] < numVertices;
+}
+
+/**
+ * @brief Adds a value of each triangle to each of its vertices.
+ *
+ * In parallel, the jobs first find the range of vertices used by every block of triangles. Then each job adds
+ * the values to one range of vertices, going through the blocks that use them in the order of the triangles;
+ * floating point sums therefore come out the same as in a single thread. Only the blocks that use vertices of
+ * several ranges have their values computed more than once.
+ *
+ * @param[in] getValue The function that computes the value of a triangle from its vertices. It's called from several threads at once.
+ */
+template<typename IndexType, typename ValueType, typename GetValue>
+void AddTriangleValues(const IndexType* indices, uint32_t numTriangles, uint32_t numVertices, ValueType* values, uint32_t maximumNumberOfHelpers, const GetValue& getValue)
+{
+  const uint32_t numberOfJobs = GetNumberOfJobs(numTriangles, maximumNumberOfHelpers);
+  if(numberOfJobs <= 1u)
+  {
+    for(uint32_t triangle = 0u; triangle < numTriangles; ++triangle)
+    {
+      IndexType vertices[3];
+      if(GetTriangle(indices, triangle, numVertices, vertices))
+      {
+        const ValueType value = getValue(vertices);
+        values[vertices[0]] += value;
+        values[vertices[1]] += value;
+        values[vertices[2]] += value;
+      }
+    }
+    return;
+  }
+
+  struct BlockBounds
+  {
+    uint32_t mMin;
+    uint32_t mMax;
+    bool     mValid; ///< Whether all the triangles of the block are valid.
+  };
+
+  const uint32_t numBlocks = (numTriangles + TRIANGLES_PER_BLOCK - 1u) / TRIANGLES_PER_BLOCK;
+  const Ranges   blockRanges(numBlocks, numberOfJobs);
+  const Ranges   vertexRanges(numVertices, numberOfJobs);
+
+  std::vector<BlockBounds> blockBounds(numBlocks);
+
+  Dali::Scene3D::Internal::RunParallelJobs(
+    numberOfJobs,
+    [&](uint32_t job)
+    {
+      for(uint32_t block = blockRanges.Begin(job), blockEnd = blockRanges.End(job); block < blockEnd; ++block)
+      {
+        BlockBounds bounds{std::numeric_limits<uint32_t>::max(), 0u, true};
+        for(uint32_t triangle = block * TRIANGLES_PER_BLOCK, triangleEnd = std::min(triangle + TRIANGLES_PER_BLOCK, numTriangles); triangle < triangleEnd; ++triangle)
+        {
+          IndexType vertices[3];
+          if(GetTriangle(indices, triangle, numVertices, vertices))
+          {
+            bounds.mMin = std::min<uint32_t>(bounds.mMin, std::min(vertices[0], std::min(vertices[1], vertices[2])));
+            bounds.mMax = std::max<uint32_t>(bounds.mMax, std::max(vertices[0], std::max(vertices[1], vertices[2])));
+          }
+          else
+          {
+            bounds.mValid = false;
+          }
+        }
+        blockBounds[block] = bounds;
+      }
+    },
+    numberOfJobs - 1u);
+
+  Dali::Scene3D::Internal::RunParallelJobs(
+    numberOfJobs,
+    [&](uint32_t job)
+    {
+      const uint32_t begin = vertexRanges.Begin(job);
+      const uint32_t end   = vertexRanges.End(job);
+      for(uint32_t block = 0u; block < numBlocks; ++block)
+      {
+        const auto& bounds = blockBounds[block];
+        if(bounds.mMax < begin || bounds.mMin >= end)
+        {
+          continue;
+        }
+
+        const uint32_t triangleBegin = block * TRIANGLES_PER_BLOCK;
+        const uint32_t triangleEnd   = std::min(triangleBegin + TRIANGLES_PER_BLOCK, numTriangles);
+        const bool     inRange       = bounds.mValid && bounds.mMin >= begin && bounds.mMax < end;
+        for(uint32_t triangle = triangleBegin; triangle < triangleEnd; ++triangle)
+        {
+          IndexType vertices[3];
+          if(!GetTriangle(indices, triangle, numVertices, vertices))
+          {
+            continue;
+          }
+
+          if(inRange)
+          {
+            // All the vertices of the block are in the range.
+            const ValueType value = getValue(vertices);
+            values[vertices[0]] += value;
+            values[vertices[1]] += value;
+            values[vertices[2]] += value;
+          }
+          else if((vertices[0] >= begin && vertices[0] < end) || (vertices[1] >= begin && vertices[1] < end) || (vertices[2] >= begin && vertices[2] < end))
+          {
+            const ValueType value = getValue(vertices);
+            for(const auto vertex : vertices)
+            {
+              if(vertex >= begin && vertex < end)
+              {
+                values[vertex] += value;
+              }
+            }
+          }
+        }
+      }
+    },
+    numberOfJobs - 1u);
+}
+
+/**
+ * @brief Calls a function on ranges of vertices, in parallel.
+ *
+ * @param[in] processVertices The function that takes the beginning and the end of a range. It's called from several threads at once.
+ */
+template<typename ProcessVertices>
+void ProcessVertexRanges(uint32_t numVertices, uint32_t maximumNumberOfHelpers, const ProcessVertices& processVertices)
+{
+  const uint32_t numberOfJobs = GetNumberOfJobs(numVertices, maximumNumberOfHelpers);
+  const Ranges   vertexRanges(numVertices, numberOfJobs);
+  Dali::Scene3D::Internal::RunParallelJobs(
+    numberOfJobs,
+    [&](uint32_t job)
+    { processVertices(vertexRanges.Begin(job), vertexRanges.End(job)); },
+    numberOfJobs - 1u);
+}
+
+} // namespace
+
+template<typename IndexType>
+void GenerateNormals(const Vector3* positions, uint32_t numVertices, const IndexType* indices, uint32_t numIndices, Vector3* normals, uint32_t maximumNumberOfHelpers)
+{
+  AddTriangleValues(indices, numIndices / 3u, numVertices, normals, maximumNumberOfHelpers, [positions](const IndexType(&vertices)[3])
+  {
+    Vector3 a = positions[vertices[1]] - positions[vertices[0]];
+    Vector3 b = positions[vertices[2]] - positions[vertices[0]];
+    return a.Cross(b);
+  });
+
+  ProcessVertexRanges(numVertices, maximumNumberOfHelpers, [normals](uint32_t begin, uint32_t end)
+  {
+    for(uint32_t vertex = begin; vertex < end; ++vertex)
+    {
+      normals[vertex].Normalize();
+    }
+  });
+}
+
+template<typename IndexType, typename TangentType>
+void GenerateTangents(const Vector3* positions, const Vector3* normals, const Vector2* uvs, uint32_t numVertices, const IndexType* indices, uint32_t numIndices, TangentType* tangents, uint32_t maximumNumberOfHelpers)
+{
+  static_assert(std::is_same<TangentType, Vector3>::value || std::is_same<TangentType, Vector4>::value);
+
+  if(uvs)
+  {
+    AddTriangleValues(indices, numIndices / 3u, numVertices, tangents, maximumNumberOfHelpers, [positions, uvs](const IndexType(&vertices)[3])
+    {
+      const Vector3 pos[]{positions[vertices[0]], positions[vertices[1]], positions[vertices[2]]};
+      const Vector2 uv[]{uvs[vertices[0]], uvs[vertices[1]], uvs[vertices[2]]};
+
+      float x0 = pos[1].x - pos[0].x;
+      float y0 = pos[1].y - pos[0].y;
+      float z0 = pos[1].z - pos[0].z;
+
+      float x1 = pos[2].x - pos[0].x;
+      float y1 = pos[2].y - pos[0].y;
+      float z1 = pos[2].z - pos[0].z;
+
+      float s0 = uv[1].x - uv[0].x;
+      float t0 = uv[1].y - uv[0].y;
+
+      float s1 = uv[2].x - uv[0].x;
+      float t1 = uv[2].y - uv[0].y;
+
+      float   det = (s0 * t1 - t0 * s1);
+      float   r   = 1.f / ((std::abs(det) < Dali::Epsilon<1000>::value) ? (Dali::Epsilon<1000>::value * (det > 0.0f ? 1.f : -1.f)) : det);
+      Vector3 tangent((x0 * t1 - t0 * x1) * r, (y0 * t1 - t0 * y1) * r, (z0 * t1 - t0 * z1) * r);
+      return TangentType(tangent);
+    });
+  }
+
+  ProcessVertexRanges(numVertices, maximumNumberOfHelpers, [normals, tangents, hasUvs = (uvs != nullptr)](uint32_t begin, uint32_t end)
+  {
+    for(uint32_t vertex = begin; vertex < end; ++vertex)
+    {
+      const Vector3& normal = normals[vertex];
+      Vector3        tangentVec3;
+      if(hasUvs)
+      {
+        // Calculated by indexs
+        tangentVec3 = Vector3(tangents[vertex].x, tangents[vertex].y, tangents[vertex].z);
+      }
+      else
+      {
+        // Only choiced by normal vector. by indexs
+        Vector3 t[]{normal.Cross(Vector3::XAXIS), normal.Cross(Vector3::YAXIS)};
+        tangentVec3 = t[t[1].LengthSquared() > t[0].LengthSquared()];
+      }
+
+      tangentVec3 -= normal * normal.Dot(tangentVec3);
+      tangentVec3.Normalize();
+      if constexpr(std::is_same<TangentType, Vector3>::value)
+      {
+        tangents[vertex] = tangentVec3;
+      }
+      else
+      {
+        tangents[vertex] = Vector4(tangentVec3.x, tangentVec3.y, tangentVec3.z, 1.0f);
+      }
+    }
+  });
+}
+
+template void GenerateNormals<uint16_t>(const Vector3*, uint32_t, const uint16_t*, uint32_t, Vector3*, uint32_t);
+template void GenerateNormals<uint32_t>(const Vector3*, uint32_t, const uint32_t*, uint32_t, Vector3*, uint32_t);
+
+template void GenerateTangents<uint16_t, Vector3>(const Vector3*, const Vector3*, const Vector2*, uint32_t, const uint16_t*, uint32_t, Vector3*, uint32_t);
+template void GenerateTangents<uint16_t, Vector4>(const Vector3*, const Vector3*, const Vector2*, uint32_t, const uint16_t*, uint32_t, Vector4*, uint32_t);
+template void GenerateTangents<uint32_t, Vector3>(const Vector3*, const Vector3*, const Vector2*, uint32_t, const uint32_t*, uint32_t, Vector3*, uint32_t);
+template void GenerateTangents<uint32_t, Vector4>(const Vector3*, const Vector3*, const Vector2*, uint32_t, const uint32_t*, uint32_t, Vector4*, uint32_t);
+
+} // namespace Dali::Scene3D::Loader::Internal
@@ -0,0 +1,65 @@
+#ifndef DALI_SCENE3D_LOADER_MESH_ATTRIBUTE_GENERATOR_H
+#define DALI_SCENE3D_LOADER_MESH_ATTRIBUTE_GENERATOR_H
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+#include <cstdint>
+
+namespace Dali::Scene3D::Loader::Internal
+{
+/**
+ * @brief Generates smooth normals of a triangle mesh, i.e. the normalized sum of the
+ * (area weighted) normals of the triangles that share each vertex.
+ *
+ * Large meshes are split into jobs that run in parallel. The triangles are still added to
+ * each vertex in the order they are in the mesh, so the result doesn't depend on the number of jobs.
+ *
+ * @param[in] positions The positions of the vertices.
+ * @param[in] numVertices The number of vertices.
+ * @param[in] indices The indices of the triangles, or nullptr if the vertices are the triangles in order.
+ * @param[in] numIndices The number of indices.
+ * @param[out] normals The normals of the vertices, which must be @a numVertices zeroes.
+ * @param[in] maximumNumberOfHelpers The maximum number of threads to help the calling one.
+ */
+template<typename IndexType>
+void GenerateNormals(const Vector3* positions, uint32_t numVertices, const IndexType* indices, uint32_t numIndices, Vector3* normals, uint32_t maximumNumberOfHelpers);
+
+/**
+ * @brief Generates the tangents of a triangle mesh, orthogonal to its normals.
+ *
+ * With texture coordinates, the tangents follow the direction of their u axis, summed up like the normals.
+ * Without them, they're only chosen from the normals.
+ *
+ * @param[in] positions The positions of the vertices.
+ * @param[in] normals The normals of the vertices.
+ * @param[in] uvs The texture coordinates of the vertices, or nullptr.
+ * @param[in] numVertices The number of vertices.
+ * @param[in] indices The indices of the triangles, or nullptr if the vertices are the triangles in order.
+ * @param[in] numIndices The number of indices.
+ * @param[out] tangents The tangents of the vertices, which must be @a numVertices zeroes. Vector4 tangents have 1 for w.
+ * @param[in] maximumNumberOfHelpers The maximum number of threads to help the calling one.
+ */
+template<typename IndexType, typename TangentType>
+void GenerateTangents(const Vector3* positions, const Vector3* normals, const Vector2* uvs, uint32_t numVertices, const IndexType* indices, uint32_t numIndices, TangentType* tangents, uint32_t maximumNumberOfHelpers);
+
+} // namespace Dali::Scene3D::Loader::Internal
+
+#endif // DALI_SCENE3D_LOADER_MESH_ATTRIBUTE_GENERATOR_H
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-scene3d/internal/loader/mesh-simplifier.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+namespace Dali::Scene3D::Loader::Internal
+{
+namespace
+{
+const char* DALI_SCENE3D_MESH_LOD_LEVELS("DALI_SCENE3D_MESH_LOD_LEVELS");
+
+constexpr uint32_t MAXIMUM_NUMBER_OF_LEVELS = 8u;
+constexpr uint32_t MAXIMUM_NUMBER_OF_PASSES = 64u;
+constexpr uint32_t INVALID_COLLAPSE         = std::numeric_limits<uint32_t>::max();
+constexpr float    MINIMUM_NORMAL_COSINE    = 0.25f; ///< A collapse mustn't turn a triangle around by more than about 75 degrees.
+
+/**
+ * @brief The quadric error of a vertex, i.e. the sum of the squared distances to the planes of its triangles.
+ */
+struct Quadric
+{
+  void AddPlane(const Vector3& normal, float distance, double weight)
+  {
+    const double a = normal.x;
+    const double b = normal.y;
+    const double c = normal.z;
+    const double d = distance;
+
+    a2 += weight * a * a;
+    b2 += weight * b * b;
+    c2 += weight * c * c;
+    ab += weight * a * b;
+    ac += weight * a * c;
+    bc += weight * b * c;
+    ad += weight * a * d;
+    bd += weight * b * d;
+    cd += weight * c * d;
+    d2 += weight * d * d;
+  }
+
+  void Add(const Quadric& other)
+  {
+    a2 += other.a2;
+    b2 += other.b2;
+    c2 += other.c2;
+    ab += other.ab;
+    ac += other.ac;
+    bc += other.bc;
+    ad += other.ad;
+    bd += other.bd;
+    cd += other.cd;
+    d2 += other.d2;
+  }
+
+  double Evaluate(const Vector3& position) const
+  {
+    const double x = position.x;
+    const double y = position.y;
+    const double z = position.z;
+    return a2 * x * x + b2 * y * y + c2 * z * z + 2.0 * (ab * x * y + ac * x * z + bc * y * z + ad * x + bd * y + cd * z) + d2;
+  }
+
+  double a2{0.0}, b2{0.0}, c2{0.0}, ab{0.0}, ac{0.0}, bc{0.0}, ad{0.0}, bd{0.0}, cd{0.0}, d2{0.0};
+};
+
+struct Collapse
+{
+  uint32_t from;
+  uint32_t to;
+  double   cost;
+};
+
+Vector3 GetTriangleNormal(const Vector3& p0, const Vector3& p1, const Vector3& p2)
+{
+  return (p1 - p0).Cross(p2 - p0);
+}
+
+uint64_t GetEdgeKey(uint32_t a, uint32_t b)
+{
+  return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+}
+
+/**
+ * @brief Finds the vertices that have the same position, and maps each of them to the first one.
+ */
+std::vector<uint32_t> WeldPositions(const Vector3* positions, uint32_t numVertices)
+{
+  auto getBits = [positions](uint32_t vertex)
+  {
+    uint32_t bits[3];
+    memcpy(bits, &positions[vertex], sizeof(bits));
+    return std::make_tuple(bits[0], bits[1], bits[2]);
+  };
+
+  std::vector<uint32_t> order(numVertices);
+  std::iota(order.begin(), order.end(), 0u);
+  std::sort(order.begin(), order.end(), [&getBits](uint32_t lhs, uint32_t rhs)
+  {
+    const auto lhsBits = getBits(lhs);
+    const auto rhsBits = getBits(rhs);
+    return lhsBits < rhsBits || (lhsBits == rhsBits && lhs < rhs);
+  });
+
+  std::vector<uint32_t> weld(numVertices);
+  for(uint32_t i = 0u; i < numVertices; ++i)
+  {
+    weld[order[i]] = (i > 0u && getBits(order[i]) == getBits(order[i - 1u])) ? weld[order[i - 1u]] : order[i];
+  }
+  return weld;
+}
+
+/**
+ * @brief Finds the vertices that may be collapsed: the ones that neither share their position, nor are on a border
+ * (or a non-manifold edge) of the mesh.
+ */
+std::vector<bool> FindCollapsibleVertices(const std::vector<uint32_t>& weld, const std::vector<uint32_t>& indices)
+{
+  const uint32_t numVertices = static_cast<uint32_t>(weld.size());
+
+  std::vector<bool> collapsible(numVertices, true);
+  for(uint32_t vertex = 0u; vertex < numVertices; ++vertex)
+  {
+    if(weld[vertex] != vertex)
+    {
+      collapsible[vertex]       = false;
+      collapsible[weld[vertex]] = false;
+    }
+  }
+
+  std::vector<uint64_t> edges;
+  edges.reserve(indices.size());
+  for(size_t i = 0u; i < indices.size(); i += 3u)
+  {
+    for(uint32_t corner = 0u; corner < 3u; ++corner)
+    {
+      edges.push_back(GetEdgeKey(weld[indices[i + corner]], weld[indices[i + (corner + 1u) % 3u]]));
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+
+  for(size_t begin = 0u; begin < edges.size();)
+  {
+    size_t end = begin + 1u;
+    while(end < edges.size() && edges[end] == edges[begin])
+    {
+      ++end;
+    }
+
+    // A manifold edge is shared by two triangles exactly.
+    if(end - begin != 2u)
+    {
+      collapsible[static_cast<uint32_t>(edges[begin] >> 32)]          = false;
+      collapsible[static_cast<uint32_t>(edges[begin] & 0xFFFFFFFFu)] = false;
+    }
+    begin = end;
+  }
+  return collapsible;
+}
+
+/**
+ * @brief Checks that no triangle around a vertex would be flipped if it's moved to another position.
+ */
+bool IsCollapseValid(const Vector3* positions, const std::vector<uint32_t>& indices, const uint32_t* triangles, uint32_t numTriangles, uint32_t from, uint32_t to)
+{
+  for(uint32_t i = 0u; i < numTriangles; ++i)
+  {
+    const uint32_t* triangle = &indices[triangles[i] * 3u];
+    if(triangle[0] == to || triangle[1] == to || triangle[2] == to)
+    {
+      continue; // It will be removed.
+    }
+
+    const Vector3 oldNormal = GetTriangleNormal(positions[triangle[0]], positions[triangle[1]], positions[triangle[2]]);
+    const Vector3 newNormal = GetTriangleNormal(positions[triangle[0] == from ? to : triangle[0]],
+                                                positions[triangle[1] == from ? to : triangle[1]],
+                                                positions[triangle[2] == from ? to : triangle[2]]);
+    if(oldNormal.Dot(newNormal) <= MINIMUM_NORMAL_COSINE * oldNormal.Length() * newNormal.Length())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+uint32_t GetNumberOfGeneratedLevelsOfDetail()
+{
+  static const uint32_t numberOfLevels = []()
+  {
+    uint32_t levels = 0u;
+
+    // Check environment variable for DALI_SCENE3D_MESH_LOD_LEVELS
+    auto levelsString = EnvironmentVariable::GetEnvironmentVariable(DALI_SCENE3D_MESH_LOD_LEVELS);
+    if(levelsString)
+    {
+      levels = static_cast<uint32_t>(std::clamp(std::atoi(levelsString), 0, static_cast<int>(MAXIMUM_NUMBER_OF_LEVELS)));
+      DALI_LOG_RELEASE_INFO("Scene3D mesh LOD levels:%u\n", levels);
+    }
+    return levels;
+  }();
+
+  return numberOfLevels;
+}
+
+std::vector<uint32_t> SimplifyMesh(const Vector3* positions, uint32_t numVertices, const uint32_t* indices, uint32_t numIndices, uint32_t targetNumIndices)
+{
+  std::vector<uint32_t> result;
+  result.reserve(numIndices);
+  for(uint32_t i = 0u; i + 2u < numIndices; i += 3u)
+  {
+    const uint32_t a = indices[i];
+    const uint32_t b = indices[i + 1u];
+    const uint32_t c = indices[i + 2u];
+    if(a < numVertices && b < numVertices && c < numVertices && a != b && b != c && c != a)
+    {
+      result.insert(result.end(), indices + i, indices + i + 3u);
+    }
+  }
+
+  const auto              weld        = WeldPositions(positions, numVertices);
+  const std::vector<bool> collapsible = FindCollapsibleVertices(weld, result);
+
+  // The quadrics of the welded vertices, from the planes of their triangles weighted by area.
+  std::vector<Quadric> quadrics(numVertices);
+  for(size_t i = 0u; i < result.size(); i += 3u)
+  {
+    Vector3     normal = GetTriangleNormal(positions[result[i]], positions[result[i + 1u]], positions[result[i + 2u]]);
+    const float length = normal.Length();
+    if(length > 0.0f)
+    {
+      normal /= length;
+      const float distance = -normal.Dot(positions[result[i]]);
+      for(uint32_t corner = 0u; corner < 3u; ++corner)
+      {
+        quadrics[weld[result[i + corner]]].AddPlane(normal, distance, length * 0.5f);
+      }
+    }
+  }
+
+  std::vector<uint32_t> triangleOffsets(numVertices + 1u);
+  std::vector<uint32_t> vertexTriangles;
+  std::vector<uint32_t> cheapestCollapse(numVertices);
+  std::vector<uint32_t> collapseTarget(numVertices);
+  std::vector<bool>     touched(numVertices);
+  std::vector<Collapse> collapses;
+
+  for(uint32_t pass = 0u; pass < MAXIMUM_NUMBER_OF_PASSES && result.size() > targetNumIndices; ++pass)
+  {
+    const uint32_t numTriangles = static_cast<uint32_t>(result.size() / 3u);
+
+    // The triangles around each vertex.
+    std::fill(triangleOffsets.begin(), triangleOffsets.end(), 0u);
+    for(const auto index : result)
+    {
+      ++triangleOffsets[index + 1u];
+    }
+    std::partial_sum(triangleOffsets.begin(), triangleOffsets.end(), triangleOffsets.begin());
+    vertexTriangles.resize(result.size());
+    std::vector<uint32_t> fill(triangleOffsets.begin(), triangleOffsets.end() - 1);
+    for(uint32_t triangle = 0u; triangle < numTriangles; ++triangle)
+    {
+      for(uint32_t corner = 0u; corner < 3u; ++corner)
+      {
+        vertexTriangles[fill[result[triangle * 3u + corner]]++] = triangle;
+      }
+    }
+
+    // The cheapest edge to move each collapsible vertex along, to the other end of it.
+    std::fill(cheapestCollapse.begin(), cheapestCollapse.end(), INVALID_COLLAPSE);
+    collapses.clear();
+    for(uint32_t i = 0u; i < result.size(); ++i)
+    {
+      const uint32_t from = result[i];
+      const uint32_t to   = result[i - i % 3u + (i + 1u) % 3u];
+      if(collapsible[from])
+      {
+        Quadric quadric = quadrics[from];
+        quadric.Add(quadrics[weld[to]]);
+        const Collapse collapse{from, to, quadric.Evaluate(positions[to])};
+        if(cheapestCollapse[from] == INVALID_COLLAPSE)
+        {
+          cheapestCollapse[from] = static_cast<uint32_t>(collapses.size());
+          collapses.push_back(collapse);
+        }
+        else if(collapse.cost < collapses[cheapestCollapse[from]].cost)
+        {
+          collapses[cheapestCollapse[from]] = collapse;
+        }
+      }
+    }
+    std::sort(collapses.begin(), collapses.end(), [](const Collapse& lhs, const Collapse& rhs)
+    {
+      return lhs.cost < rhs.cost || (lhs.cost == rhs.cost && (lhs.from < rhs.from || (lhs.from == rhs.from && lhs.to < rhs.to)));
+    });
+
+    // Collapses the cheapest edges that don't share any triangle, so that each one is checked against the current mesh.
+    std::iota(collapseTarget.begin(), collapseTarget.end(), 0u);
+    std::fill(touched.begin(), touched.end(), false);
+    uint32_t numRemovedIndices = 0u;
+    uint32_t numCollapses      = 0u;
+    for(const auto& collapse : collapses)
+    {
+      if(result.size() - numRemovedIndices <= targetNumIndices)
+      {
+        break;
+      }
+
+      const uint32_t* triangles       = &vertexTriangles[triangleOffsets[collapse.from]];
+      const uint32_t  numFanTriangles = triangleOffsets[collapse.from + 1u] - triangleOffsets[collapse.from];
+      if(touched[collapse.from] || touched[collapse.to] ||
+         std::any_of(triangles, triangles + numFanTriangles, [&](uint32_t triangle)
+                     { return touched[result[triangle * 3u]] || touched[result[triangle * 3u + 1u]] || touched[result[triangle * 3u + 2u]]; }) ||
+         !IsCollapseValid(positions, result, triangles, numFanTriangles, collapse.from, collapse.to))
+      {
+        continue;
+      }
+
+      for(uint32_t i = 0u; i < numFanTriangles; ++i)
+      {
+        const uint32_t* triangle = &result[triangles[i] * 3u];
+        touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = true;
+        if(triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to)
+        {
+          numRemovedIndices += 3u;
+        }
+      }
+      collapseTarget[collapse.from] = collapse.to;
+      quadrics[weld[collapse.to]].Add(quadrics[collapse.from]);
+      ++numCollapses;
+    }
+
+    if(numCollapses == 0u)
+    {
+      break;
+    }
+
+    // Moves the collapsed vertices, and removes the triangles that became degenerate.
+    uint32_t numIndicesLeft = 0u;
+    for(size_t i = 0u; i < result.size(); i += 3u)
+    {
+      const uint32_t a = collapseTarget[result[i]];
+      const uint32_t b = collapseTarget[result[i + 1u]];
+      const uint32_t c = collapseTarget[result[i + 2u]];
+      if(a != b && b != c && c != a)
+      {
+        result[numIndicesLeft++] = a;
+        result[numIndicesLeft++] = b;
+        result[numIndicesLeft++] = c;
+      }
+    }
+    result.resize(numIndicesLeft);
+  }
+
+  return result;
+}
+
+} // namespace Dali::Scene3D::Loader::Internal
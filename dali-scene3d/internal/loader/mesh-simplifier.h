@@ -0,0 +1,53 @@
+#ifndef DALI_SCENE3D_LOADER_MESH_SIMPLIFIER_H
+#define DALI_SCENE3D_LOADER_MESH_SIMPLIFIER_H
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/vector3.h>
+#include <cstdint>
+#include <vector>
+
+namespace Dali::Scene3D::Loader::Internal
+{
+/**
+ * @brief Retrieves how many simplified levels of detail are generated for each mesh when it's loaded.
+ *
+ * It's set by the DALI_SCENE3D_MESH_LOD_LEVELS environment variable, and 0 (none) by default.
+ * @return The number of levels, not counting the original mesh.
+ */
+uint32_t GetNumberOfGeneratedLevelsOfDetail();
+
+/**
+ * @brief Simplifies a triangle mesh by collapsing its edges, cheapest first by the quadric error metric.
+ *
+ * Only the indices are simplified: the triangles keep using the original vertices, so that a level of detail
+ * can share the vertex buffers of the mesh. The vertices on the borders of the mesh, and the ones that share
+ * their position with another (e.g. on texture seams) are never removed.
+ *
+ * @param[in] positions The positions of the vertices.
+ * @param[in] numVertices The number of vertices.
+ * @param[in] indices The indices of the triangles.
+ * @param[in] numIndices The number of indices.
+ * @param[in] targetNumIndices The number of indices to simplify the mesh down to, if possible.
+ * @return The indices of the simplified triangles.
+ */
+std::vector<uint32_t> SimplifyMesh(const Vector3* positions, uint32_t numVertices, const uint32_t* indices, uint32_t numIndices, uint32_t targetNumIndices);
+
+} // namespace Dali::Scene3D::Loader::Internal
+
+#endif // DALI_SCENE3D_LOADER_MESH_SIMPLIFIER_H
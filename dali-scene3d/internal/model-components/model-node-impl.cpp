@@ -216,7 +216,7 @@ void ModelNode::AddModelPrimitive(Dali::Scene3D::ModelPrimitive modelPrimitive,
   GetImplementation(modelPrimitive).UpdateShader(mShaderManager, hash);
 
   Dali::Renderer renderer = GetImplementation(modelPrimitive).GetRenderer();
-  if(renderer)
+  if(renderer && !mIsCulled)
   {
     uint32_t rendererCount = self.GetRendererCount();
     bool     exist         = false;
@@ -416,7 +416,43 @@ void ModelNode::SetBoneMatrix(const Matrix& inverseMatrix, Scene3D::ModelPrimiti
 
 void ModelNode::OnRendererCreated(Renderer renderer)
 {
-  Self().AddRenderer(renderer);
+  if(!mIsCulled)
+  {
+    Self().AddRenderer(renderer);
+  }
+}
+
+void ModelNode::SetCulled(bool culled)
+{
+  if(mIsCulled == culled)
+  {
+    return;
+  }
+
+  mIsCulled  = culled;
+  Actor self = Self();
+  for(auto&& primitive : mModelPrimitiveContainer)
+  {
+    Dali::Renderer renderer = GetImplementation(primitive).GetRenderer();
+    if(!renderer)
+    {
+      continue;
+    }
+
+    if(mIsCulled)
+    {
+      self.RemoveRenderer(renderer);
+    }
+    else
+    {
+      self.AddRenderer(renderer);
+    }
+  }
+}
+
+bool ModelNode::IsCulled() const
+{
+  return mIsCulled;
 }
 
 void ModelNode::UpdateBoneMatrix(Scene3D::ModelPrimitive primitive)
@@ -323,6 +323,21 @@ public: // Public Method
     mParentModel = model;
   }
 
+  /**
+   * @brief Sets whether the primitives of the ModelNode are culled, i.e. their renderers are removed.
+   *
+   * It doesn't affect the children of the ModelNode.
+   * @param[in] culled True if the primitives are out of view and shouldn't be rendered.
+   */
+  void SetCulled(bool culled);
+
+  /**
+   * @brief Retrieves whether the primitives of the ModelNode are culled.
+   *
+   * @return True if the primitives are culled.
+   */
+  bool IsCulled() const;
+
 private:
   /**
    * @brief Updates the bone matrix for a ModelPrimitive.
@@ -357,6 +372,7 @@ private:
   uint32_t mSpecularMipmapLevels{1u};
   bool     mIsShadowCasting{true};
   bool     mIsShadowReceiving{true};
+  bool     mIsCulled{false};
   /// @endcond
 };
 
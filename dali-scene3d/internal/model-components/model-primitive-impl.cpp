@@ -23,6 +23,7 @@
 #include <dali/devel-api/object/type-registry-helper.h>
 #include <dali/devel-api/object/type-registry.h>
 #include <dali/public-api/animation/constraint.h>
+#include <algorithm>
 
 // INTERNAL INCLUDES
 #include <dali-scene3d/internal/common/image-resource-loader.h>
@@ -92,6 +93,8 @@ void ModelPrimitive::SetRenderer(Dali::Renderer renderer)
   mGeometry   = renderer.GetGeometry();
   mTextureSet = renderer.GetTextures();
   mShader     = renderer.GetShader();
+  UpdateRendererIndexRange();
+  UpdateRendererInstanceCount();
 }
 
 Dali::Renderer ModelPrimitive::GetRenderer() const
@@ -102,6 +105,10 @@ Dali::Renderer ModelPrimitive::GetRenderer() const
 void ModelPrimitive::SetGeometry(Dali::Geometry geometry)
 {
   mGeometry = geometry;
+  mLodIndexCounts.Clear();
+  mLevelOfDetail = 0u;
+  mInstanceCount = 0u;
+  mHasBoundingBox = false;
   CreateRenderer();
 }
 
@@ -230,6 +237,81 @@ void ModelPrimitive::SetVertexColor(bool hasVertexColor)
   mHasVertexColor = hasVertexColor;
 }
 
+void ModelPrimitive::SetLevelsOfDetail(const Dali::Vector<uint32_t>& lodIndexCounts, float boundingRadius)
+{
+  mLodIndexCounts = lodIndexCounts;
+  mBoundingRadius = boundingRadius;
+  mLevelOfDetail  = 0u;
+  UpdateRendererIndexRange();
+}
+
+uint32_t ModelPrimitive::GetNumberOfLevelsOfDetail() const
+{
+  return static_cast<uint32_t>(mLodIndexCounts.Count());
+}
+
+float ModelPrimitive::GetBoundingRadius() const
+{
+  return mBoundingRadius;
+}
+
+void ModelPrimitive::SetLevelOfDetail(uint32_t level)
+{
+  if(mLodIndexCounts.Empty())
+  {
+    return;
+  }
+
+  level = std::min(level, static_cast<uint32_t>(mLodIndexCounts.Count()) - 1u);
+  if(mLevelOfDetail != level)
+  {
+    mLevelOfDetail = level;
+    UpdateRendererIndexRange();
+  }
+}
+
+uint32_t ModelPrimitive::GetLevelOfDetail() const
+{
+  return mLevelOfDetail;
+}
+
+void ModelPrimitive::SetInstanceCount(uint32_t instanceCount)
+{
+  if(mInstanceCount != instanceCount)
+  {
+    // The shader reads the instance transforms only when the geometry is instanced.
+    const bool isInstancingChanged = (mInstanceCount == 0u) != (instanceCount == 0u);
+    mInstanceCount                 = instanceCount;
+    UpdateRendererInstanceCount();
+    if(isInstancingChanged && mMaterial && GetImplementation(mMaterial).IsResourceReady())
+    {
+      ApplyMaterialToRenderer(MaterialModifyObserver::ModifyFlag::SHADER);
+    }
+  }
+}
+
+uint32_t ModelPrimitive::GetInstanceCount() const
+{
+  return mInstanceCount;
+}
+
+void ModelPrimitive::SetBoundingBox(const Vector3& min, const Vector3& max)
+{
+  mBoundingBoxMin = min;
+  mBoundingBoxMax = max;
+  mHasBoundingBox = true;
+}
+
+bool ModelPrimitive::GetBoundingBox(Vector3& min, Vector3& max) const
+{
+  if(mHasBoundingBox)
+  {
+    min = mBoundingBoxMin;
+    max = mBoundingBoxMax;
+  }
+  return mHasBoundingBox;
+}
+
 // From MaterialModifyObserver
 
 void ModelPrimitive::OnMaterialModified(Dali::Scene3D::Material material, MaterialModifyObserver::ModifyFlag flag)
@@ -263,6 +345,10 @@ void ModelPrimitive::ApplyMaterialToRenderer(MaterialModifyObserver::ModifyFlag
     {
       shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::COLOR_ATTRIBUTE);
     }
+    if(mInstanceCount > 0u)
+    {
+      shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::INSTANCING);
+    }
     if(mHasPositions || mHasNormals || mHasTangents)
     {
       if(mHasPositions)
@@ -396,6 +482,8 @@ void ModelPrimitive::CreateRenderer()
   mRenderer.SetTextures(mTextureSet);
   UpdateRendererUniform();
   UpdateRendererProperty();
+  UpdateRendererIndexRange();
+  UpdateRendererInstanceCount();
 
   for(auto* observer : mObservers)
   {
@@ -495,6 +583,28 @@ void ModelPrimitive::UpdateRendererProperty()
   }
 }
 
+void ModelPrimitive::UpdateRendererIndexRange()
+{
+  if(mRenderer && !mLodIndexCounts.Empty())
+  {
+    uint32_t firstIndex = 0u;
+    for(uint32_t level = 0u; level < mLevelOfDetail; ++level)
+    {
+      firstIndex += mLodIndexCounts[level];
+    }
+    mRenderer.SetProperty(Renderer::Property::INDEX_RANGE_FIRST, static_cast<int32_t>(firstIndex));
+    mRenderer.SetProperty(Renderer::Property::INDEX_RANGE_COUNT, static_cast<int32_t>(mLodIndexCounts[mLevelOfDetail]));
+  }
+}
+
+void ModelPrimitive::UpdateRendererInstanceCount()
+{
+  if(mRenderer)
+  {
+    mRenderer.SetProperty(Renderer::Property::INSTANCE_COUNT, static_cast<int32_t>(mInstanceCount));
+  }
+}
+
 } // namespace Internal
 
 } // namespace Scene3D
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/math/vector3.h>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/object/property-value.h>
 #include <dali/public-api/object/property.h>
@@ -194,6 +195,74 @@ public:
    */
   void SetVertexColor(bool hasVertexColor);
 
+  /**
+   * @brief Sets the levels of detail of the geometry, whose indices follow each other in its index buffer.
+   *
+   * @param[in] lodIndexCounts The number of indices of each level of detail, from the most detailed.
+   * @param[in] boundingRadius The radius of a sphere around the origin that contains the geometry.
+   */
+  void SetLevelsOfDetail(const Dali::Vector<uint32_t>& lodIndexCounts, float boundingRadius);
+
+  /**
+   * @brief Retrieves the number of levels of detail of the geometry.
+   *
+   * @return The number of levels of detail, or 0 if the geometry doesn't have any.
+   */
+  uint32_t GetNumberOfLevelsOfDetail() const;
+
+  /**
+   * @brief Retrieves the radius of a sphere around the origin that contains the geometry.
+   *
+   * @return The bounding radius, set with the levels of detail.
+   */
+  float GetBoundingRadius() const;
+
+  /**
+   * @brief Selects the level of detail to render.
+   *
+   * @param[in] level The level of detail, which is clamped to the available ones. 0 is the most detailed.
+   */
+  void SetLevelOfDetail(uint32_t level);
+
+  /**
+   * @brief Retrieves the level of detail that is rendered.
+   *
+   * @return The level of detail.
+   */
+  uint32_t GetLevelOfDetail() const;
+
+  /**
+   * @brief Sets how many instances of the geometry are drawn.
+   *
+   * The geometry has to have the per-instance transforms in its aInstanceMatrix0-3 attributes.
+   * @param[in] instanceCount The number of instances, or 0 if the geometry isn't instanced.
+   */
+  void SetInstanceCount(uint32_t instanceCount);
+
+  /**
+   * @brief Retrieves how many instances of the geometry are drawn.
+   *
+   * @return The number of instances, or 0 if the geometry isn't instanced.
+   */
+  uint32_t GetInstanceCount() const;
+
+  /**
+   * @brief Sets the box that contains the primitive, in the space of its ModelNode.
+   *
+   * @param[in] min The minimum corner of the box.
+   * @param[in] max The maximum corner of the box.
+   */
+  void SetBoundingBox(const Vector3& min, const Vector3& max);
+
+  /**
+   * @brief Retrieves the box that contains the primitive, in the space of its ModelNode.
+   *
+   * @param[out] min The minimum corner of the box.
+   * @param[out] max The maximum corner of the box.
+   * @return True if the primitive has a bounding box, i.e. it doesn't move its vertices e.g. with skinning.
+   */
+  bool GetBoundingBox(Vector3& min, Vector3& max) const;
+
 private: // From MaterialModifyObserver
   /**
    * @copydoc Dali::Scene3D::Internal::Material::MaterialModifyObserver::OnMaterialModified()
@@ -229,6 +298,16 @@ private:
    */
   void UpdateImageBasedLightTexture();
 
+  /**
+   * @brief Updates the index range of the renderer to the selected level of detail.
+   */
+  void UpdateRendererIndexRange();
+
+  /**
+   * @brief Updates the number of instances that the renderer draws.
+   */
+  void UpdateRendererInstanceCount();
+
 private:
   // Delete copy & move operator
   ModelPrimitive(const ModelPrimitive&)                    = delete;
@@ -270,6 +349,18 @@ private:
   bool                                         mHasTangents       = false;
   Scene3D::Loader::BlendShapes::Version        mBlendShapeVersion = Scene3D::Loader::BlendShapes::Version::INVALID;
 
+  // For levels of detail
+  Dali::Vector<uint32_t> mLodIndexCounts;
+  float                  mBoundingRadius{0.0f};
+  uint32_t               mLevelOfDetail{0u};
+
+  uint32_t mInstanceCount{0u};
+
+  // For frustum culling
+  Vector3 mBoundingBoxMin{Vector3::ZERO};
+  Vector3 mBoundingBoxMax{Vector3::ZERO};
+  bool    mHasBoundingBox{false};
+
   bool mIsMaterialChanged = false;
 };
 
@@ -51,6 +51,11 @@ bool NavigationMesh::FindFloor(const Dali::Vector3& position, Dali::Vector3& out
   return mImpl->FindFloor(position, outPosition, outFaceIndex);
 }
 
+uint32_t NavigationMesh::FindFloors(const Dali::Vector<Dali::Vector3>& positions, Dali::Vector<Dali::Vector3>& outPositions, Dali::Vector<FaceIndex>& outFaceIndices) const
+{
+  return mImpl->FindFloors(positions, outPositions, outFaceIndices);
+}
+
 bool NavigationMesh::FindFloorForFace(const Dali::Vector3& position, FaceIndex faceIndex, bool dontCheckNeighbours, Dali::Vector3& outPosition)
 {
   return mImpl->FindFloorForFace(position, faceIndex, dontCheckNeighbours, outPosition);
@@ -18,6 +18,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/unique-ptr.h>
 #include <dali/public-api/math/matrix.h>
 #include <dali/public-api/math/vector3.h>
@@ -157,6 +158,24 @@ public:
    */
   bool FindFloor(const Dali::Vector3& position, Dali::Vector3& outPosition, FaceIndex& outFaceIndex);
 
+  /**
+   * @brief Looks for the floor under each of specified positions
+   *
+   * Resolves many positions (e.g. all agents of a scene) in a single call. Unlike FindFloor(),
+   * it doesn't change the face used by FindFloorForFace() as a starting point.
+   *
+   * For positions without floor, the output position is equal to the input position
+   * and the output face index is NULL_FACE.
+   *
+   * @SINCE_2_5.35
+   * @param[in] positions Positions to investigate
+   * @param[out] outPositions Positions on the floor, resized to the number of input positions
+   * @param[out] outFaceIndices Indices of NavigationMesh faces associated with floor, resized to the number of input positions
+   *
+   * @return Number of positions for which the floor has been found
+   */
+  uint32_t FindFloors(const Dali::Vector<Dali::Vector3>& positions, Dali::Vector<Dali::Vector3>& outPositions, Dali::Vector<FaceIndex>& outFaceIndices) const;
+
   /**
    * @brief Looks for a floor starting from specified face
    *
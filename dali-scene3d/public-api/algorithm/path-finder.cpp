@@ -17,8 +17,12 @@
 // CLASS HEADER
 #include <dali-scene3d/public-api/algorithm/path-finder.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 // default algorithm
+#include <dali-scene3d/internal/algorithm/path-finder-astar.h>
 #include <dali-scene3d/internal/algorithm/path-finder-dijkstra.h>
 #include <dali-scene3d/internal/algorithm/path-finder-spfa-double-way.h>
 #include <dali-scene3d/internal/algorithm/path-finder-spfa.h>
@@ -46,6 +50,11 @@ UniquePtr<PathFinder> PathFinder::New(NavigationMesh& navigationMesh, PathFinder
       impl = new Dali::Scene3D::Internal::Algorithm::PathFinderAlgorithmSPFADoubleWay(navigationMesh);
       break;
     }
+    case PathFinderAlgorithm::A_STAR:
+    {
+      impl = new Dali::Scene3D::Internal::Algorithm::PathFinderAlgorithmAStar(navigationMesh);
+      break;
+    }
   }
 
   if(!impl)
@@ -68,6 +77,18 @@ WayPointList PathFinder::FindPath(FaceIndex polyIndexFrom, FaceIndex polyIndexTo
   return mImpl->FindPath(polyIndexFrom, polyIndexTo);
 }
 
+std::vector<WayPointList> PathFinder::FindPaths(const Dali::Vector<Dali::Vector3>& positionsFrom, const Dali::Vector<Dali::Vector3>& positionsTo)
+{
+  const auto                count = std::min(positionsFrom.Count(), positionsTo.Count());
+  std::vector<WayPointList> paths;
+  paths.reserve(count);
+  for(auto i = 0u; i < count; ++i)
+  {
+    paths.emplace_back(mImpl->FindPath(positionsFrom[i], positionsTo[i]));
+  }
+  return paths;
+}
+
 PathFinder::PathFinder(UniquePtr<PathFinderBase>&& baseImpl)
 {
   mImpl = std::move(baseImpl);
@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali-scene3d/public-api/algorithm/navigation-mesh.h>
@@ -39,6 +40,7 @@ enum class PathFinderAlgorithm
   DIJKSTRA_SHORTEST_PATH, ///< Using A* variant (Dijkstra) finding a shortest path. @SINCE_2_2.12
   SPFA,                   ///< Using SPFA-SLF (Shortest Path Fast Algorithm with Short Label First) finding a shortest path. @SINCE_2_2.12
   SPFA_DOUBLE_WAY,        ///< Using SPFA-SLF double way. It might not find shortest, but will use less memory. @SINCE_2_2.12
+  A_STAR,                 ///< Using A* with face centre distance heuristic finding a shortest path. Search state is reused between queries. @SINCE_2_5.35
 
   DEFAULT = DIJKSTRA_SHORTEST_PATH, ///< Default algorithm to use
 };
@@ -133,6 +135,20 @@ public:
    */
   WayPointList FindPath(FaceIndex faceIndexFrom, FaceIndex faceIndexTo);
 
+  /**
+   * @brief Looks for paths for many pairs of points at once.
+   *
+   * Equivalent to calling FindPath() for each pair of positionsFrom[i] and positionsTo[i],
+   * but lets algorithms reuse their search state (e.g. PathFinderAlgorithm::A_STAR) between queries.
+   * Only the first min(positionsFrom.Count(), positionsTo.Count()) pairs are used.
+   *
+   * @SINCE_2_5.35
+   * @param[in] positionsFrom Source positions
+   * @param[in] positionsTo Target positions
+   * @return List of waypoints for each pair. Empty list for pairs without path
+   */
+  std::vector<WayPointList> FindPaths(const Dali::Vector<Dali::Vector3>& positionsFrom, const Dali::Vector<Dali::Vector3>& positionsTo);
+
 private:
   PathFinder() = delete;
 
@@ -93,6 +93,52 @@ public:
     FAILED     ///< Resource loading has failed.
   };
 
+  /**
+   * @brief The start and end property ranges for this control.
+   * @SINCE_2_5.35
+   */
+  enum PropertyRange
+  {
+    PROPERTY_START_INDEX = Control::CONTROL_PROPERTY_END_INDEX + 1,
+    PROPERTY_END_INDEX   = PROPERTY_START_INDEX + 1000
+  };
+
+  /**
+   * @brief Enumeration for the instance of properties belonging to the Model class.
+   * @SINCE_2_5.35
+   */
+  struct Property
+  {
+    enum
+    {
+      /**
+       * @brief The projected sizes below which the meshes of the model switch to their next level of detail.
+       * @details Name "lodThresholds", type Property::ARRAY of Property::FLOAT.
+       * The projected size of a node is the radius of its meshes on the screen, relative to half the height of the view.
+       * A node uses the level of detail N when its projected size is smaller than N of the thresholds, e.g. with {0.5, 0.25},
+       * it uses its original meshes down to 0.5, their first level of detail down to 0.25, and the second one below.
+       * @note Meshes only have levels of detail if they're generated while the model is loaded,
+       * which is set by the DALI_SCENE3D_MESH_LOD_LEVELS environment variable.
+       * @note Optional. Empty by default, i.e. the original meshes are always used.
+       * @SINCE_2_5.35
+       */
+      LOD_THRESHOLDS = PROPERTY_START_INDEX,
+
+      /**
+       * @brief Whether the nodes of the model whose meshes are out of view are not rendered.
+       * @details Name "frustumCulling", type Property::BOOLEAN.
+       * A node is culled when the bounding box of its meshes is outside the frustum of the camera of the SceneView
+       * (or of the default render task), and outside the frustum of the shadow light camera if the model casts shadow.
+       * @note Nodes with skinned or morphed meshes are never culled, since their vertices can move out of the box.
+       * @note The visibility is computed while rendering a frame and applied to the nodes after it, so a node which
+       * comes into view is rendered from the next frame on.
+       * @note Optional. False by default.
+       * @SINCE_2_5.35
+       */
+      FRUSTUM_CULLING,
+    };
+  };
+
   /**
    * @brief Create an initialized Model.
    *
@@ -40,12 +40,41 @@ bool CaseInsensitiveStringCompare(std::string_view a, std::string_view b)
 
 namespace Toolkit
 {
+namespace
+{
+/**
+ * Binary search the index of the children for the hash of the name, then compare the names of the children with that hash.
+ */
+template<typename Compare>
+const TreeNode* FindIndexedChild(const Internal::TreeNodeIndexEntry* begin, const Internal::TreeNodeIndexEntry* end, std::string_view childName, Compare compare)
+{
+  const uint32_t hash = Internal::HashChildName(childName);
+
+  const Internal::TreeNodeIndexEntry* entry = std::lower_bound(begin, end, hash, [](const Internal::TreeNodeIndexEntry& lhs, uint32_t rhs)
+  {
+    return lhs.hash < rhs;
+  });
+  for(; entry != end && entry->hash == hash; ++entry)
+  {
+    const char* name = entry->node->GetName();
+    if(name && compare(name, childName))
+    {
+      return entry->node;
+    }
+  }
+  return NULL;
+}
+
+} // namespace
+
 TreeNode::TreeNode()
 : mName(NULL),
   mParent(NULL),
   mNextSibling(NULL),
   mFirstChild(NULL),
   mLastChild(NULL),
+  mChildIndexBegin(NULL),
+  mChildIndexEnd(NULL),
   mStringValue(NULL),
   mType(TreeNode::IS_NULL),
   mSubstituion(false)
@@ -118,6 +147,14 @@ size_t TreeNode::Count(std::string_view childName) const
 
 const TreeNode* TreeNode::GetChild(std::string_view childName) const
 {
+  if(mChildIndexBegin)
+  {
+    return FindIndexedChild(mChildIndexBegin, mChildIndexEnd, childName, [](std::string_view a, std::string_view b)
+    {
+      return a == b;
+    });
+  }
+
   const TreeNode* p = mFirstChild;
   while(p)
   {
@@ -132,6 +169,11 @@ const TreeNode* TreeNode::GetChild(std::string_view childName) const
 
 const TreeNode* TreeNode::GetChildIgnoreCase(std::string_view childName) const
 {
+  if(mChildIndexBegin)
+  {
+    return FindIndexedChild(mChildIndexBegin, mChildIndexEnd, childName, CaseInsensitiveStringCompare);
+  }
+
   const TreeNode* p = mFirstChild;
   while(p)
   {
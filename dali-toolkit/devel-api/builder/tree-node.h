@@ -31,6 +31,7 @@ namespace Toolkit
 namespace Internal DALI_INTERNAL
 {
 class TreeNodeManipulator;
+struct TreeNodeIndexEntry;
 
 } //namespace Internal DALI_INTERNAL
 
@@ -219,6 +220,9 @@ private:
   TreeNode* mFirstChild;  ///< The nodes first child
   TreeNode* mLastChild;   ///< The nodes last child
 
+  const Internal::TreeNodeIndexEntry* mChildIndexBegin; ///< The children sorted by the hash of their names, if indexed by the owning parser
+  const Internal::TreeNodeIndexEntry* mChildIndexEnd;   ///< The end of the sorted children
+
   union
   {
     const char* mStringValue; ///< The node string value
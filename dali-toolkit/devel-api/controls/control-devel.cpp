@@ -152,6 +152,31 @@ Dali::Property GetVisualProperty(Control control, Dali::Property::Index index, D
   return controlDataImpl.GetVisualProperty(index, visualPropertyKey);
 }
 
+void SetLoadingPriority(Dali::Actor actor, DevelVisual::LoadingPriority::Type loadingPriority)
+{
+  if(!actor)
+  {
+    return;
+  }
+
+  Toolkit::Control control = Toolkit::Control::DownCast(actor);
+  if(control)
+  {
+    GetControlImplementation(control).SetLoadingPriority(loadingPriority);
+  }
+
+  const uint32_t childCount = actor.GetChildCount();
+  for(uint32_t i = 0u; i < childCount; ++i)
+  {
+    SetLoadingPriority(actor.GetChildAt(i), loadingPriority);
+  }
+}
+
+DevelVisual::LoadingPriority::Type GetLoadingPriority(Control control)
+{
+  return GetControlImplementation(control).GetLoadingPriority();
+}
+
 Toolkit::DevelControl::AccessibilityActivateSignalType& AccessibilityActivateSignal(Toolkit::Control control)
 {
   return GetControlImplementation(control).GetOrCreateAccessibilityData().mAccessibilityActivateSignal;
@@ -28,6 +28,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/public-api/controls/control-accessibility-types.h>
 #include <dali-toolkit/public-api/controls/control.h>
 
@@ -549,6 +550,26 @@ DALI_TOOLKIT_API VisualEventSignalType& VisualEventSignal(Control control);
  */
 DALI_TOOLKIT_API Dali::Property GetVisualProperty(Control control, Dali::Property::Index index, Dali::Property::Key visualPropertyKey);
 
+/**
+ * @brief Hints how soon the resources of the visuals are needed, e.g. whether the control is in the viewport of a scrollable.
+ *
+ * The hint is applied to the actor, if it is a control, and to all its descendant controls,
+ * so that a scrollable can hint a whole item at once. Queued resources of OFF_SCREEN controls are
+ * loaded after the others, and those of VISIBLE controls before the others.
+ *
+ * @param[in] actor The control, or an actor whose descendant controls are hinted
+ * @param[in] loadingPriority The loading priority hint
+ */
+DALI_TOOLKIT_API void SetLoadingPriority(Dali::Actor actor, DevelVisual::LoadingPriority::Type loadingPriority);
+
+/**
+ * @brief Retrieves how soon the resources of the visuals of the control are needed.
+ *
+ * @param[in] control The control
+ * @return The loading priority hint
+ */
+DALI_TOOLKIT_API DevelVisual::LoadingPriority::Type GetLoadingPriority(Control control);
+
 /**
  * @brief The signal is emmited as a succession of "activate" signal send by accessibility client.
  * @return The signal to connect to
@@ -50,6 +50,16 @@ bool IsDefaultAlgorithmEnabled(KeyboardFocusManager keyboardFocusManager)
   return GetImpl(keyboardFocusManager).IsDefaultAlgorithmEnabled();
 }
 
+void EnableFocusIndex(KeyboardFocusManager keyboardFocusManager, bool enable)
+{
+  GetImpl(keyboardFocusManager).EnableFocusIndex(enable);
+}
+
+bool IsFocusIndexEnabled(KeyboardFocusManager keyboardFocusManager)
+{
+  return GetImpl(keyboardFocusManager).IsFocusIndexEnabled();
+}
+
 bool MoveFocus(KeyboardFocusManager keyboardFocusManager, Control::KeyboardFocus::Direction direction, const Dali::String& deviceName)
 {
   return GetImpl(keyboardFocusManager).MoveFocus(direction, deviceName);
@@ -101,6 +101,27 @@ DALI_TOOLKIT_API void EnableDefaultAlgorithm(KeyboardFocusManager keyboardFocusM
  */
 DALI_TOOLKIT_API bool IsDefaultAlgorithmEnabled(KeyboardFocusManager keyboardFocusManager);
 
+/**
+ * @brief Decide using a spatial index of the focusable controls for the default focus algorithm or not
+ *
+ * The index keeps the screen extents of the focusable controls in a grid, so moving the focus in a direction
+ * examines the controls near the focused actor only, rather than every actor under the root.
+ * It's updated as the focusable controls are added, removed or moved. Only the controls are indexed,
+ * so the actors which are not controls are not found while it's enabled.
+ *
+ * @param[in] keyboardFocusManager The instance of KeyboardFocusManager
+ * @param[in] enable Whether using the focus index or not
+ */
+DALI_TOOLKIT_API void EnableFocusIndex(KeyboardFocusManager keyboardFocusManager, bool enable);
+
+/**
+ * @brief Check the focus index is enabled or not
+ *
+ * @param[in] keyboardFocusManager The instance of KeyboardFocusManager
+ * @return True when the focus index is enabled
+ */
+DALI_TOOLKIT_API bool IsFocusIndexEnabled(KeyboardFocusManager keyboardFocusManager);
+
 /**
  * @brief Moves the focus to the next focusable actor in the focus
  * chain in the given direction (according to the focus traversal
@@ -51,6 +51,48 @@ TextureSet RemoveTexture(const String& textureUrl)
   return textureMgr.RemoveExternalTextureByUrl(ToStdString(textureUrl));
 }
 
+void SetReleasedTextureCacheBudget(uint32_t budgetBytes)
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  textureMgr.SetReleasedTextureCacheBudget(budgetBytes);
+}
+
+uint32_t GetReleasedTextureCacheBudget()
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  return textureMgr.GetReleasedTextureCacheBudget();
+}
+
+ReleasedTextureCacheStatistics GetReleasedTextureCacheStatistics()
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  return textureMgr.GetReleasedTextureCacheStatistics();
+}
+
+void ResetReleasedTextureCacheStatistics()
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  textureMgr.ResetReleasedTextureCacheStatistics();
+}
+
+void SetAnimatedImageFrameBudget(uint32_t budgetBytes)
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  textureMgr.SetAnimatedImageFrameBudget(budgetBytes);
+}
+
+uint32_t GetAnimatedImageFrameBudget()
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  return textureMgr.GetAnimatedImageFrameBudget();
+}
+
 } // namespace TextureManager
 
 } // namespace Toolkit
@@ -64,6 +64,64 @@ DALI_TOOLKIT_API String AddTexture(TextureSet& textureSet, bool preMultiplied =
  */
 DALI_TOOLKIT_API TextureSet RemoveTexture(const String& textureUrl);
 
+/**
+ * @brief Statistics of the released texture cache.
+ */
+struct ReleasedTextureCacheStatistics
+{
+  uint32_t hitCount{0u};      ///< The number of requests revived from the released texture cache without decoding
+  uint32_t missCount{0u};     ///< The number of requests which could not find any cached texture, while the budget was not 0 and a released texture could have served them
+  uint32_t evictionCount{0u}; ///< The number of released textures discarded to keep the cache under budget
+  uint32_t textureCount{0u};  ///< The number of textures currently kept in the released texture cache
+  uint32_t usedBytes{0u};     ///< The estimated memory currently used by the released texture cache, in bytes
+  uint32_t budgetBytes{0u};   ///< The memory budget of the released texture cache, in bytes
+};
+
+/**
+ * @brief Sets the memory budget of the released texture cache.
+ *
+ * Textures whose reference count becomes zero are kept in a least-recently-used cache
+ * until the total estimated size of the kept textures exceeds this budget.
+ * A new request for the same image revives the kept texture without decoding it again.
+ * @note The default budget is 0, which means textures are removed as soon as they are released.
+ * @param[in] budgetBytes The memory budget, in bytes
+ */
+DALI_TOOLKIT_API void SetReleasedTextureCacheBudget(uint32_t budgetBytes);
+
+/**
+ * @brief Gets the memory budget of the released texture cache.
+ * @return The memory budget, in bytes
+ */
+DALI_TOOLKIT_API uint32_t GetReleasedTextureCacheBudget();
+
+/**
+ * @brief Gets the statistics of the released texture cache.
+ * @return The current statistics
+ */
+DALI_TOOLKIT_API ReleasedTextureCacheStatistics GetReleasedTextureCacheStatistics();
+
+/**
+ * @brief Resets the hit, miss and eviction counters of the released texture cache.
+ */
+DALI_TOOLKIT_API void ResetReleasedTextureCacheStatistics();
+
+/**
+ * @brief Sets the memory budget of the decoded animated image frames kept across loops.
+ *
+ * Animated image visuals playing the same url at the same size share their decoded frames.
+ * The frames are kept while they fit in this budget, so a looping animation doesn't decode them again,
+ * and the whole loop stays in memory when it fits.
+ * @note The default budget is 0, which means the frames are removed as soon as they are displayed.
+ * @param[in] budgetBytes The memory budget, in bytes
+ */
+DALI_TOOLKIT_API void SetAnimatedImageFrameBudget(uint32_t budgetBytes);
+
+/**
+ * @brief Gets the memory budget of the decoded animated image frames kept across loops.
+ * @return The memory budget, in bytes
+ */
+DALI_TOOLKIT_API uint32_t GetAnimatedImageFrameBudget();
+
 } // namespace TextureManager
 
 } // namespace Toolkit
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/particle-system/particle-batch-modifier.h>
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/constants.h>
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/particle-system/particle-list-impl.h>
+
+namespace Dali::Toolkit::ParticleSystem
+{
+namespace
+{
+/**
+ * @brief Runs the kernel for the slot of each particle of the batch.
+ *
+ * Contiguous slots are visited by a plain loop, which the compiler can vectorize.
+ */
+template<typename Kernel>
+inline void ForEachSlot(const ParticleBatch& batch, Kernel&& kernel)
+{
+  if(batch.isContiguous)
+  {
+    const uint32_t endSlot = batch.firstSlot + batch.count;
+    for(uint32_t slot = batch.firstSlot; slot < endSlot; ++slot)
+    {
+      kernel(slot);
+    }
+  }
+  else
+  {
+    for(uint32_t i = 0u; i < batch.count; ++i)
+    {
+      kernel(batch.slots[i]);
+    }
+  }
+}
+
+/**
+ * @brief Retrieves how far the particle is through its life, from 0 when emitted to 1 when it dies.
+ */
+inline float GetLifeProgress(const ParticleBatch& batch, uint32_t slot)
+{
+  const float lifetimeBase = std::max(batch.lifetimeBase[slot], Math::MACHINE_EPSILON_1);
+  return std::clamp(1.0f - batch.lifetime[slot] / lifetimeBase, 0.0f, 1.0f);
+}
+} // namespace
+
+void ParticleBatchModifierInterface::Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount)
+{
+  UpdateBatch(GetImplementation(particleList).GetBatch(firstParticleIndex, particleCount, 0.0f));
+}
+
+GravityModifier::GravityModifier(const Vector3& acceleration)
+: mAcceleration(acceleration)
+{
+}
+
+void GravityModifier::UpdateBatch(const ParticleBatch& batch)
+{
+  if(!batch.velocity)
+  {
+    return;
+  }
+
+  const float dx       = mAcceleration.x * batch.deltaSeconds;
+  const float dy       = mAcceleration.y * batch.deltaSeconds;
+  const float dz       = mAcceleration.z * batch.deltaSeconds;
+  Vector3*    velocity = batch.velocity;
+  ForEachSlot(batch, [&](uint32_t slot)
+  {
+    velocity[slot].x += dx;
+    velocity[slot].y += dy;
+    velocity[slot].z += dz;
+  });
+}
+
+DragModifier::DragModifier(float coefficient)
+: mCoefficient(coefficient)
+{
+}
+
+void DragModifier::UpdateBatch(const ParticleBatch& batch)
+{
+  if(!batch.velocity)
+  {
+    return;
+  }
+
+  const float factor = std::max(0.0f, 1.0f - mCoefficient * batch.deltaSeconds);
+  if(batch.isContiguous)
+  {
+    // Every component is scaled alike, so the stream is processed as one array of floats
+    float*         velocity = &batch.velocity[batch.firstSlot].x;
+    const uint32_t count    = batch.count * 3u;
+    for(uint32_t i = 0u; i < count; ++i)
+    {
+      velocity[i] *= factor;
+    }
+  }
+  else
+  {
+    Vector3* velocity = batch.velocity;
+    ForEachSlot(batch, [&](uint32_t slot)
+    {
+      velocity[slot].x *= factor;
+      velocity[slot].y *= factor;
+      velocity[slot].z *= factor;
+    });
+  }
+}
+
+void VelocityIntegratorModifier::UpdateBatch(const ParticleBatch& batch)
+{
+  if(!batch.position || !batch.velocity)
+  {
+    return;
+  }
+
+  const float deltaSeconds = batch.deltaSeconds;
+  if(batch.isContiguous)
+  {
+    // Both streams hold the same components, so they are processed as arrays of floats
+    float*         position = &batch.position[batch.firstSlot].x;
+    const float*   velocity = &batch.velocity[batch.firstSlot].x;
+    const uint32_t count    = batch.count * 3u;
+    for(uint32_t i = 0u; i < count; ++i)
+    {
+      position[i] += velocity[i] * deltaSeconds;
+    }
+  }
+  else
+  {
+    Vector3*       position = batch.position;
+    const Vector3* velocity = batch.velocity;
+    ForEachSlot(batch, [&](uint32_t slot)
+    {
+      position[slot].x += velocity[slot].x * deltaSeconds;
+      position[slot].y += velocity[slot].y * deltaSeconds;
+      position[slot].z += velocity[slot].z * deltaSeconds;
+    });
+  }
+}
+
+ColorOverLifeModifier::ColorOverLifeModifier(const Vector4& startColor, const Vector4& endColor)
+: mStartColor(startColor),
+  mEndColor(endColor)
+{
+}
+
+void ColorOverLifeModifier::UpdateBatch(const ParticleBatch& batch)
+{
+  if(!batch.color || !batch.lifetime || !batch.lifetimeBase)
+  {
+    return;
+  }
+
+  const Vector4 start = mStartColor;
+  const Vector4 range = mEndColor - mStartColor;
+  Vector4*      color = batch.color;
+  ForEachSlot(batch, [&](uint32_t slot)
+  {
+    const float progress = GetLifeProgress(batch, slot);
+    color[slot].r        = start.r + range.r * progress;
+    color[slot].g        = start.g + range.g * progress;
+    color[slot].b        = start.b + range.b * progress;
+    color[slot].a        = start.a + range.a * progress;
+  });
+}
+
+ScaleOverLifeModifier::ScaleOverLifeModifier(const Vector3& startScale, const Vector3& endScale)
+: mStartScale(startScale),
+  mEndScale(endScale)
+{
+}
+
+void ScaleOverLifeModifier::UpdateBatch(const ParticleBatch& batch)
+{
+  if(!batch.scale || !batch.lifetime || !batch.lifetimeBase)
+  {
+    return;
+  }
+
+  const Vector3 start = mStartScale;
+  const Vector3 range = mEndScale - mStartScale;
+  Vector3*      scale = batch.scale;
+  ForEachSlot(batch, [&](uint32_t slot)
+  {
+    const float progress = GetLifeProgress(batch, slot);
+    scale[slot].x        = start.x + range.x * progress;
+    scale[slot].y        = start.y + range.y * progress;
+    scale[slot].z        = start.z + range.z * progress;
+  });
+}
+
+} // namespace Dali::Toolkit::ParticleSystem
@@ -0,0 +1,197 @@
+#ifndef DALI_TOOLKIT_PARTICLE_SYSTEM_PARTICLE_BATCH_MODIFIER_H
+#define DALI_TOOLKIT_PARTICLE_SYSTEM_PARTICLE_BATCH_MODIFIER_H
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/particle-system/particle-modifier.h>
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+
+namespace Dali::Toolkit::ParticleSystem
+{
+/**
+ * @brief A range of particles, given as the raw data streams of the built-in attributes.
+ *
+ * The streams are indexed by the slot of each particle, so the data of the n-th particle
+ * of the batch is at position[slots[n]], velocity[slots[n]] and so on.
+ * If isContiguous is true, the slots are exactly firstSlot to firstSlot + count - 1,
+ * so the range can be processed as plain arrays.
+ *
+ * A stream is nullptr if the particle list doesn't have it.
+ */
+struct DALI_TOOLKIT_API ParticleBatch
+{
+  Vector3*        position{nullptr};     ///< The position stream
+  Vector3*        velocity{nullptr};     ///< The velocity stream
+  Vector4*        color{nullptr};        ///< The color stream
+  Vector3*        scale{nullptr};        ///< The scale stream
+  const float*    lifetime{nullptr};     ///< The remaining lifetime stream, in seconds
+  const float*    lifetimeBase{nullptr}; ///< The initial lifetime stream, in seconds
+  const uint32_t* slots{nullptr};        ///< The slot of each particle of the batch
+  uint32_t        count{0u};             ///< The number of particles in the batch
+  uint32_t        firstSlot{0u};         ///< The first slot, if the slots are contiguous
+  bool            isContiguous{false};   ///< Whether the slots are firstSlot to firstSlot + count - 1
+  float           deltaSeconds{0.0f};    ///< The time elapsed since the last update, in seconds
+};
+
+/**
+ * @brief Interface of a modifier that updates a whole range of particles through their data streams,
+ * rather than each particle through its Particle handle.
+ *
+ * The emitter calls UpdateBatch() instead of Update() for such modifiers.
+ */
+class DALI_TOOLKIT_API ParticleBatchModifierInterface : public ParticleModifierInterface
+{
+public:
+  /**
+   * @brief Updates a range of particles.
+   * @param[in] batch The streams and slots of the particles
+   */
+  virtual void UpdateBatch(const ParticleBatch& batch) = 0;
+
+  /**
+   * @brief Updates a range of particles of the list, without any elapsed time.
+   * @param[in] particleList       List of particles
+   * @param[in] firstParticleIndex Index of the first particle
+   * @param[in] particleCount      Number of particles
+   */
+  void Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount) final;
+
+  /**
+   * @copydoc ParticleModifierInterface::IsMultiThreaded()
+   *
+   * The particles of a batch are independent, so the batch modifiers are multi-threaded by default.
+   */
+  bool IsMultiThreaded() override
+  {
+    return true;
+  }
+};
+
+/**
+ * @brief Accelerates the particles, e.g. by gravity.
+ *
+ * It alters the velocity stream only. The positions are moved by a VelocityIntegratorModifier added after it.
+ */
+class DALI_TOOLKIT_API GravityModifier : public ParticleBatchModifierInterface
+{
+public:
+  /**
+   * @brief Constructor
+   * @param[in] acceleration The acceleration, in units per second squared
+   */
+  GravityModifier(const Vector3& acceleration);
+
+  /**
+   * @copydoc ParticleBatchModifierInterface::UpdateBatch()
+   */
+  void UpdateBatch(const ParticleBatch& batch) override;
+
+private:
+  Vector3 mAcceleration;
+};
+
+/**
+ * @brief Slows the particles down, in proportion to their velocity.
+ *
+ * It alters the velocity stream only. The positions are moved by a VelocityIntegratorModifier added after it.
+ */
+class DALI_TOOLKIT_API DragModifier : public ParticleBatchModifierInterface
+{
+public:
+  /**
+   * @brief Constructor
+   * @param[in] coefficient The fraction of the velocity lost per second
+   */
+  DragModifier(float coefficient);
+
+  /**
+   * @copydoc ParticleBatchModifierInterface::UpdateBatch()
+   */
+  void UpdateBatch(const ParticleBatch& batch) override;
+
+private:
+  float mCoefficient;
+};
+
+/**
+ * @brief Moves the particles by their velocity.
+ *
+ * It should be added after the modifiers that alter the velocity, e.g. GravityModifier and DragModifier,
+ * so that the particles move by the velocity of the current frame.
+ */
+class DALI_TOOLKIT_API VelocityIntegratorModifier : public ParticleBatchModifierInterface
+{
+public:
+  /**
+   * @copydoc ParticleBatchModifierInterface::UpdateBatch()
+   */
+  void UpdateBatch(const ParticleBatch& batch) override;
+};
+
+/**
+ * @brief Interpolates the color of the particles over their lifetime.
+ */
+class DALI_TOOLKIT_API ColorOverLifeModifier : public ParticleBatchModifierInterface
+{
+public:
+  /**
+   * @brief Constructor
+   * @param[in] startColor The color when the particle is emitted
+   * @param[in] endColor   The color when the particle dies
+   */
+  ColorOverLifeModifier(const Vector4& startColor, const Vector4& endColor);
+
+  /**
+   * @copydoc ParticleBatchModifierInterface::UpdateBatch()
+   */
+  void UpdateBatch(const ParticleBatch& batch) override;
+
+private:
+  Vector4 mStartColor;
+  Vector4 mEndColor;
+};
+
+/**
+ * @brief Interpolates the scale of the particles over their lifetime.
+ */
+class DALI_TOOLKIT_API ScaleOverLifeModifier : public ParticleBatchModifierInterface
+{
+public:
+  /**
+   * @brief Constructor
+   * @param[in] startScale The scale when the particle is emitted
+   * @param[in] endScale   The scale when the particle dies
+   */
+  ScaleOverLifeModifier(const Vector3& startScale, const Vector3& endScale);
+
+  /**
+   * @copydoc ParticleBatchModifierInterface::UpdateBatch()
+   */
+  void UpdateBatch(const ParticleBatch& batch) override;
+
+private:
+  Vector3 mStartScale;
+  Vector3 mEndScale;
+};
+
+} // namespace Dali::Toolkit::ParticleSystem
+
+#endif // DALI_TOOLKIT_PARTICLE_SYSTEM_PARTICLE_BATCH_MODIFIER_H
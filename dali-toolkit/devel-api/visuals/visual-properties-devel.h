@@ -151,6 +151,23 @@ enum FittingMode
   DONT_CARE                   ///< The visual should be not use fittingMode.
 };
 
+/**
+ * @brief Hints how soon the resources of a visual are needed, according to where its control is relative to the viewport.
+ */
+namespace LoadingPriority
+{
+/**
+ * @brief The values of this enum decide the order in which the queued resources are loaded.
+ */
+enum Type
+{
+  DEFAULT,   ///< No hint. Local resources are loaded before remote ones.
+  VISIBLE,   ///< The control is in the viewport. Its resources are loaded before the others, even if they are remote.
+  OFF_SCREEN ///< The control is out of the viewport, e.g. reserved by a scrollable. Its resources are loaded after the others.
+};
+
+} // namespace LoadingPriority
+
 /**
  * @brief Devel Visual Transform for the offset or size.
  */
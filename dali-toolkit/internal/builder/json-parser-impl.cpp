@@ -78,6 +78,8 @@ JsonParser::JsonParser(const TreeNode& tree)
   TreeNodeManipulator modify(mRoot);
 
   modify.MoveStrings(start, buffer.end());
+
+  modify.BuildChildIndex(mChildIndex);
 }
 
 JsonParser::~JsonParser()
@@ -89,11 +91,21 @@ bool JsonParser::Parse(const std::string& source)
 {
   mSources.push_back(VectorChar(source.begin(), source.end()));
 
+  // The tree is modified by merging, so its children are looked up without the index until it's built again
+  if(mRoot)
+  {
+    TreeNodeManipulator(mRoot).ClearChildIndex();
+  }
+
   JsonParserState parserState(mRoot);
 
   if(parserState.ParseJson(mSources.back()))
   {
     mRoot = parserState.GetRoot();
+    if(mRoot)
+    {
+      TreeNodeManipulator(mRoot).BuildChildIndex(mChildIndex);
+    }
 
     mNumberOfChars += parserState.GetParsedStringSize();
     mNumberOfNodes += parserState.GetCreatedNodeCount();
@@ -183,6 +195,7 @@ void JsonParser::DeleteRootNode() noexcept
     delete mRoot;
     mRoot = NULL;
   }
+  mChildIndex.clear();
 }
 
 } // namespace Internal
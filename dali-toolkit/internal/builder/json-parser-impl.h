@@ -27,6 +27,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/builder/json-parser.h>
 #include <dali-toolkit/devel-api/builder/tree-node.h>
+#include <dali-toolkit/internal/builder/tree-node-manipulator.h>
 
 #include <dali-toolkit/internal/builder/builder-get-is.inl.h>
 
@@ -121,6 +122,8 @@ private:
 
   TreeNode* mRoot; ///< Tree root
 
+  VectorIndexEntry mChildIndex; ///< Index of the children of the objects, to look them up by name
+
   const char* mErrorDescription; ///< Last parse error description
   int         mErrorPosition;    ///< Last parse error position
   int         mErrorLine;        ///< Last parse error line
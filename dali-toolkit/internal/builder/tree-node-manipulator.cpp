@@ -16,6 +16,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 
@@ -32,6 +33,11 @@ namespace Internal
 {
 namespace
 {
+const size_t MINIMUM_NUMBER_OF_INDEXED_CHILDREN = 8u; ///< Fewer children are found as fast by walking the siblings
+
+const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+const uint32_t FNV_PRIME        = 16777619u;
+
 void Indent(std::ostream& o, int level, int indentWidth)
 {
   for(int i = 0; i < level * indentWidth; ++i)
@@ -174,8 +180,84 @@ void TreeNodeManipulator::RemoveChildren()
     }
   }
 
-  mNode->mFirstChild = NULL;
-  mNode->mLastChild  = NULL;
+  mNode->mFirstChild      = NULL;
+  mNode->mLastChild       = NULL;
+  mNode->mChildIndexBegin = NULL;
+  mNode->mChildIndexEnd   = NULL;
+}
+
+void TreeNodeManipulator::BuildChildIndex(VectorIndexEntry& index)
+{
+  DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
+
+  // Reserve all the entries first, so that the nodes can point into the storage while it's filled
+  index.clear();
+  index.reserve(CountChildIndexEntries());
+
+  RecurseBuildChildIndex(index);
+}
+
+void TreeNodeManipulator::ClearChildIndex()
+{
+  DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
+
+  mNode->mChildIndexBegin = NULL;
+  mNode->mChildIndexEnd   = NULL;
+
+  for(TreeNode* child = mNode->mFirstChild; child; child = child->mNextSibling)
+  {
+    TreeNodeManipulator(child).ClearChildIndex();
+  }
+}
+
+size_t TreeNodeManipulator::CountChildIndexEntries() const
+{
+  DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
+
+  size_t numberOfChildren = 0;
+  size_t numberOfEntries  = 0;
+  for(const TreeNode* child = mNode->mFirstChild; child; child = child->mNextSibling)
+  {
+    ++numberOfChildren;
+    numberOfEntries += TreeNodeManipulator(const_cast<TreeNode*>(child)).CountChildIndexEntries();
+  }
+
+  if(TreeNode::OBJECT == mNode->mType && numberOfChildren >= MINIMUM_NUMBER_OF_INDEXED_CHILDREN)
+  {
+    numberOfEntries += numberOfChildren;
+  }
+  return numberOfEntries;
+}
+
+void TreeNodeManipulator::RecurseBuildChildIndex(VectorIndexEntry& index)
+{
+  DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
+
+  mNode->mChildIndexBegin = NULL;
+  mNode->mChildIndexEnd   = NULL;
+
+  if(TreeNode::OBJECT == mNode->mType && mNode->Size() >= MINIMUM_NUMBER_OF_INDEXED_CHILDREN)
+  {
+    const size_t begin = index.size();
+    for(const TreeNode* child = mNode->mFirstChild; child; child = child->mNextSibling)
+    {
+      index.push_back({child->mName ? HashChildName(child->mName) : 0u, child});
+    }
+
+    // Keep the order of the children with the same hash, so that the first one with a matching name is found
+    std::stable_sort(index.begin() + begin, index.end(), [](const TreeNodeIndexEntry& lhs, const TreeNodeIndexEntry& rhs)
+    {
+      return lhs.hash < rhs.hash;
+    });
+
+    mNode->mChildIndexBegin = index.data() + begin;
+    mNode->mChildIndexEnd   = index.data() + index.size();
+  }
+
+  for(TreeNode* child = mNode->mFirstChild; child; child = child->mNextSibling)
+  {
+    TreeNodeManipulator(child).RecurseBuildChildIndex(index);
+  }
 }
 
 TreeNode* TreeNodeManipulator::Copy(const TreeNode& tree, int& numberNodes, int& numberChars)
@@ -237,6 +319,10 @@ TreeNode* TreeNodeManipulator::AddChild(TreeNode* rhs)
 {
   DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
 
+  // The new child isn't indexed
+  mNode->mChildIndexBegin = NULL;
+  mNode->mChildIndexEnd   = NULL;
+
   rhs->mParent = mNode;
   if(mNode->mLastChild)
   {
@@ -305,6 +391,13 @@ void TreeNodeManipulator::SetName(const char* name)
 {
   DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
   mNode->mName = name;
+
+  // The parent index has the hash of the previous name
+  if(mNode->mParent)
+  {
+    mNode->mParent->mChildIndexBegin = NULL;
+    mNode->mParent->mChildIndexEnd   = NULL;
+  }
 }
 
 void TreeNodeManipulator::SetSubstitution(bool b)
@@ -570,6 +663,17 @@ const TreeNode* FindIt(std::string_view childName, const TreeNode* node)
   return found;
 }
 
+uint32_t HashChildName(std::string_view name)
+{
+  uint32_t hash = FNV_OFFSET_BASIS;
+  for(const char character : name)
+  {
+    const char lowerCase = (character >= 'A' && character <= 'Z') ? character - 'A' + 'a' : character;
+    hash                 = (hash ^ static_cast<uint8_t>(lowerCase)) * FNV_PRIME;
+  }
+  return hash;
+}
+
 char* CopyString(const char* fromString, VectorCharIter& iter, const VectorCharIter& sentinel)
 {
   DALI_ASSERT_DEBUG(fromString);
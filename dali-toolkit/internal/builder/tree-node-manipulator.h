@@ -19,8 +19,10 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <string_view>
 #include <utility> // pair
 
 #include <dali-toolkit/public-api/dali-toolkit-common.h>
@@ -38,6 +40,18 @@ namespace Internal
 typedef std::vector<char>    VectorChar;
 typedef VectorChar::iterator VectorCharIter;
 
+/*
+ * An entry of the index of the children of an object node.
+ * The entries of a node are sorted by hash, and children with the same hash keep their order.
+ */
+struct TreeNodeIndexEntry
+{
+  uint32_t        hash; ///< The hash of the lower cased child name
+  const TreeNode* node; ///< The child
+};
+
+typedef std::vector<TreeNodeIndexEntry> VectorIndexEntry;
+
 /*
  * TreeNodeManipulator performs modification operations on a TreeNode which are
  * otherwise prohibited on the TreeNode public interface.
@@ -77,6 +91,18 @@ public:
    */
   void RemoveChildren();
 
+  /*
+   * Index the children of the node and of all its descendants, so that they are looked up by hash.
+   * Only the objects with many children are indexed.
+   * @param index The storage of the entries of all the nodes, which must be kept until the index is cleared
+   */
+  void BuildChildIndex(VectorIndexEntry& index);
+
+  /*
+   * Remove the index of the children of the node and of all its descendants
+   */
+  void ClearChildIndex();
+
   /*
    * Make a deep copy of the tree.
    * @param tree The tree to copy
@@ -181,6 +207,16 @@ private:
    */
   void RecurseMoveChildStrings(VectorCharIter& start, const VectorCharIter& sentinel);
 
+  /*
+   * Recursively count the index entries needed by the node and its descendants
+   */
+  size_t CountChildIndexEntries() const;
+
+  /*
+   * Recursively index the children of the node and of its descendants
+   */
+  void RecurseBuildChildIndex(VectorIndexEntry& index);
+
   /*
    * Recursively copy children
    */
@@ -239,6 +275,13 @@ void DepthFirst(TreeNode* node, Operation& operation)
  */
 const TreeNode* FindIt(std::string_view childName, const TreeNode* tree);
 
+/*
+ * Hash a child name for the index, ignoring the ASCII case
+ * @param name The child name
+ * @return The hash
+ */
+uint32_t HashChildName(std::string_view name);
+
 /*
  * Copy string to a buffer
  * Raises if there is not enough space in the buffer
@@ -759,6 +759,23 @@ Toolkit::Visual::ResourceStatus Control::GetVisualResourceStatus(Property::Index
   return Toolkit::Visual::ResourceStatus::READY;
 }
 
+void Control::SetLoadingPriority(DevelVisual::LoadingPriority::Type loadingPriority)
+{
+  if(DALI_LIKELY(mVisualData))
+  {
+    mVisualData->SetLoadingPriority(loadingPriority);
+  }
+}
+
+DevelVisual::LoadingPriority::Type Control::GetLoadingPriority() const
+{
+  if(DALI_LIKELY(mVisualData))
+  {
+    return mVisualData->GetLoadingPriority();
+  }
+  return DevelVisual::LoadingPriority::DEFAULT;
+}
+
 void Control::AddTransitions(Dali::Animation&               animation,
                              const Toolkit::TransitionData& handle,
                              bool                           createAnimation)
@@ -178,6 +178,19 @@ public:
    */
   void EnableCornerPropertiesOverridden(Toolkit::Visual::Base& visual, bool enable, Dali::Constraint cornerRadiusConstraint = Dali::Constraint());
 
+  /**
+   * @brief Sets how soon the resources of the control's visuals are needed.
+   * The hint is applied to the registered visuals, and to the visuals registered later.
+   * @param[in] loadingPriority The loading priority hint
+   */
+  void SetLoadingPriority(DevelVisual::LoadingPriority::Type loadingPriority);
+
+  /**
+   * @brief Retrieves how soon the resources of the control's visuals are needed.
+   * @return The loading priority hint
+   */
+  DevelVisual::LoadingPriority::Type GetLoadingPriority() const;
+
   /**
    * @copydoc Dali::Toolkit::DevelControl::EnableVisual()
    */
@@ -289,6 +289,7 @@ void SetVisualsOffScene(const RegisteredVisualContainer& container, Toolkit::Con
 Control::VisualData::VisualData(Control& outer)
 : mVisualEventSignal(),
   mOuter(outer),
+  mLoadingPriority(DevelVisual::LoadingPriority::DEFAULT),
   mOffscreenRenderingEnabled(false),
   mCornerRadiusValueAdded(false),
   mCornerSquarenessValueAdded(false)
@@ -609,6 +610,8 @@ void Control::VisualData::RegisterVisual(Property::Index index, Toolkit::Visual:
     mVisuals.PushBack(newRegisteredVisual);
 
     Visual::Base& visualImpl = Toolkit::GetImplementation(visual);
+    visualImpl.SetLoadingPriority(mLoadingPriority);
+
     // Put on stage if enabled and the control is already on the stage
     if((enabled == VisualState::ENABLED) && self.GetProperty<bool>(Actor::Property::CONNECTED_TO_SCENE))
     {
@@ -722,6 +725,28 @@ void Control::VisualData::EnableReadyTransitionOverridden(Toolkit::Visual::Base&
   }
 }
 
+void Control::VisualData::SetLoadingPriority(DevelVisual::LoadingPriority::Type loadingPriority)
+{
+  if(mLoadingPriority == loadingPriority)
+  {
+    return;
+  }
+
+  mLoadingPriority = loadingPriority;
+  for(RegisteredVisualContainer::Iterator iter = mVisuals.Begin(); iter != mVisuals.End(); iter++)
+  {
+    if((*iter)->visual)
+    {
+      Toolkit::GetImplementation((*iter)->visual).SetLoadingPriority(loadingPriority);
+    }
+  }
+}
+
+DevelVisual::LoadingPriority::Type Control::VisualData::GetLoadingPriority() const
+{
+  return mLoadingPriority;
+}
+
 void Control::VisualData::EnableCornerPropertiesOverridden(Toolkit::Visual::Base& visual, bool enable, Dali::Constraint cornerRadiusConstraint)
 {
   DALI_LOG_INFO(gLogFilter, Debug::General, "Control::EnableCornerPropertiesOverridden(%p, %s)\n", &visual, enable ? "T" : "F");
@@ -120,6 +120,16 @@ public:
    */
   void EnableCornerPropertiesOverridden(Toolkit::Visual::Base& visual, bool enable, Dali::Constraint cornerRadiusConstraint);
 
+  /**
+   * @copydoc Dali::Toolkit::Internal::Control::SetLoadingPriority()
+   */
+  void SetLoadingPriority(DevelVisual::LoadingPriority::Type loadingPriority);
+
+  /**
+   * @copydoc Dali::Toolkit::Internal::Control::GetLoadingPriority()
+   */
+  DevelVisual::LoadingPriority::Type GetLoadingPriority() const;
+
   /**
    * @copydoc Dali::Toolkit::Internal::Control::GetVisualResourceStatus()
    */
@@ -359,6 +369,8 @@ private:
   using PropertyOnAnimationContainer = std::unordered_map<Property::Index, std::unordered_map<const Dali::RefObject*, uint32_t>>;
   PropertyOnAnimationContainer mPropertyOnAnimation; ///< Properties that are currently on animation or constraint applied
 
+  DevelVisual::LoadingPriority::Type mLoadingPriority; ///< How soon the resources of the visuals are needed
+
   bool mOffscreenRenderingEnabled : 1;  ///< True if offscreen rendering is enabled.
   bool mCornerRadiusValueAdded : 1;     ///< True if corner radius value setted at least 1 time. Could not be reset to false.
   bool mCornerSquarenessValueAdded : 1; ///< True if corner squareness value setted at least 1 time. Could not be reset to false.
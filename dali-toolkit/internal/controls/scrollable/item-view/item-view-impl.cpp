@@ -32,8 +32,10 @@
 #include <dali/public-api/events/wheel-event.h>
 #include <algorithm>
 #include <cstring> // for strcmp
+#include <vector>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/controls/scroll-bar/scroll-bar.h>
 #include <dali-toolkit/internal/controls/scrollable/bouncing-effect-actor.h>
 #include <dali-toolkit/internal/controls/scrollable/item-view/depth-layout.h>
@@ -458,6 +460,7 @@ void ItemView::ActivateLayout(unsigned int layoutIndex, const Vector3& targetSiz
   // Refresh the new layout
   ItemRange range = GetItemRange(*mActiveLayout, targetSize, GetCurrentLayoutPosition(0), false /* don't reserve extra*/);
   AddActorsWithinRange(range, targetSize);
+  UpdateLoadingPriorities(GetCurrentLayoutPosition(0));
 
   // Scroll to an appropriate layout position
 
@@ -550,11 +553,43 @@ void ItemView::DoRefresh(float currentLayoutPosition, bool cacheExtra)
     ItemRange range = GetItemRange(*mActiveLayout, mActiveLayoutTargetSize, currentLayoutPosition, cacheExtra /*reserve extra*/);
     RemoveActorsOutsideRange(range);
     AddActorsWithinRange(range, Self().GetCurrentProperty<Vector3>(Actor::Property::SIZE));
+    UpdateLoadingPriorities(currentLayoutPosition);
 
     mScrollUpdatedSignal.Emit(Vector2(0.0f, currentLayoutPosition));
   }
 }
 
+void ItemView::UpdateLoadingPriorities(float layoutPosition)
+{
+  ItemRange visibleRange = GetItemRange(*mActiveLayout, mActiveLayoutTargetSize, layoutPosition, false /* don't reserve extra*/);
+
+  // The distance of each item from the visible range, in items
+  std::vector<std::pair<unsigned int, Actor>> itemsByDistance;
+  itemsByDistance.reserve(mItemPool.Count());
+  for(ConstItemIter iter = mItemPool.Begin(); iter != mItemPool.End(); ++iter)
+  {
+    const ItemId itemId   = iter->first;
+    unsigned int distance = 0u;
+    if(itemId < visibleRange.begin)
+    {
+      distance = visibleRange.begin - itemId;
+    }
+    else if(itemId >= visibleRange.end)
+    {
+      distance = itemId - visibleRange.end + 1u;
+    }
+    itemsByDistance.emplace_back(distance, iter->second);
+  }
+
+  // A re-prioritised load is queued behind the others of its priority, so hint the nearest items first.
+  std::stable_sort(itemsByDistance.begin(), itemsByDistance.end(), [](const std::pair<unsigned int, Actor>& lhs, const std::pair<unsigned int, Actor>& rhs) { return lhs.first < rhs.first; });
+
+  for(const auto& item : itemsByDistance)
+  {
+    DevelControl::SetLoadingPriority(item.second, item.first == 0u ? DevelVisual::LoadingPriority::VISIBLE : DevelVisual::LoadingPriority::OFF_SCREEN);
+  }
+}
+
 void ItemView::SetMinimumSwipeSpeed(float speed)
 {
   mMinimumSwipeSpeed = speed;
@@ -261,6 +261,15 @@ public:
    */
   void DoRefresh(float currentLayoutPosition, bool cacheExtra);
 
+  /**
+   * @brief Hints the items within the visible range to load their resources first,
+   * and the items kept in the reserved range to load theirs afterwards.
+   * The items are hinted from the nearest to the farthest from the visible range.
+   *
+   * @param[in] layoutPosition The current layout position.
+   */
+  void UpdateLoadingPriorities(float layoutPosition);
+
   /**
    * @copydoc Toolkit::ItemView::SetItemsParentOrigin
    */
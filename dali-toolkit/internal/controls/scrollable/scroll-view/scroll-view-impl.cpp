@@ -31,9 +31,13 @@
 #include <dali/public-api/events/touch-event.h>
 #include <dali/public-api/events/wheel-event.h>
 #include <dali/public-api/object/property-map.h>
+#include <algorithm>
+#include <cmath>
 #include <cstring> // for strcmp
+#include <vector>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/controls/scroll-bar/scroll-bar.h>
 #include <dali-toolkit/internal/controls/scrollable/scroll-view/scroll-overshoot-indicator-impl.h>
 #include <dali-toolkit/internal/controls/scrollable/scroll-view/scroll-view-effect-impl.h>
@@ -159,6 +163,28 @@ Dali::Vector3 GetPositionOfAnchor(Dali::Actor& actor, const Dali::Vector3& ancho
   return childPosition + childAnchor * childSize;
 }
 
+/**
+ * Returns the distance from the viewport to the actor, when the scroll view is scrolled to the given position
+ * @param[in] actor The child actor, which the scroll position moves
+ * @param[in] viewportSize The size of the viewport
+ * @param[in] scrollPosition The scroll position
+ * @return The distance, or zero if the actor overlaps the viewport
+ */
+float GetDistanceFromViewport(Dali::Actor& actor, const Dali::Vector2& viewportSize, const Dali::Vector2& scrollPosition)
+{
+  const Dali::Vector3 childPosition = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::POSITION);
+  const Dali::Vector3 childPivot    = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::PIVOT);
+  const Dali::Vector3 childSize     = actor.GetProperty<Dali::Vector3>(Dali::Actor::Property::SIZE);
+
+  const Dali::Vector2 topLeft     = childPosition.GetVectorXY() - childPivot.GetVectorXY() * childSize.GetVectorXY() + scrollPosition;
+  const Dali::Vector2 bottomRight = topLeft + childSize.GetVectorXY();
+
+  const float distanceX = std::max(0.0f, std::max(-bottomRight.x, topLeft.x - viewportSize.width));
+  const float distanceY = std::max(0.0f, std::max(-bottomRight.y, topLeft.y - viewportSize.height));
+
+  return std::sqrt(distanceX * distanceX + distanceY * distanceY);
+}
+
 /**
  * Returns the closest actor to the given position
  * @param[in] actor The scrollview actor
@@ -705,6 +731,9 @@ void ScrollView::OnRelayout(const Vector2& size, RelayoutContainer& container)
   }
 
   ScrollBase::OnRelayout(size, container);
+
+  // Hint at where an ongoing scroll animation ends, otherwise at the current position.
+  UpdateLoadingPriorities((mScrollStateFlags & SCROLL_ANIMATION_FLAGS) ? mScrollTargetPosition : mScrollPostPosition);
 }
 
 void ScrollView::OnSceneConnection(int depth)
@@ -1198,6 +1227,8 @@ bool ScrollView::AnimateTo(const Vector2& position, const Vector2& positionDurat
 
   SetScrollUpdateNotification(true);
 
+  UpdateLoadingPriorities(mScrollTargetPosition);
+
   // Always send a snap event when AnimateTo is called.
   Toolkit::ScrollView::SnapEvent snapEvent;
   snapEvent.type     = snapType;
@@ -1210,6 +1241,33 @@ bool ScrollView::AnimateTo(const Vector2& position, const Vector2& positionDurat
   return (mScrollStateFlags & SCROLL_ANIMATION_FLAGS) != 0;
 }
 
+void ScrollView::UpdateLoadingPriorities(const Vector2& scrollPosition)
+{
+  Actor         self         = Self();
+  const Vector2 viewportSize = self.GetProperty<Vector3>(Actor::Property::SIZE).GetVectorXY();
+
+  // The distance of each child from the viewport, once the scroll reaches the position
+  std::vector<std::pair<float, Actor>> childrenByDistance;
+  const uint32_t                       childCount = self.GetChildCount();
+  childrenByDistance.reserve(childCount);
+  for(uint32_t i = 0u; i < childCount; ++i)
+  {
+    Actor child = self.GetChildAt(i);
+    if(child != mInternalActor)
+    {
+      childrenByDistance.emplace_back(GetDistanceFromViewport(child, viewportSize, scrollPosition), child);
+    }
+  }
+
+  // A re-prioritised load is queued behind the others of its priority, so hint the nearest children first.
+  std::stable_sort(childrenByDistance.begin(), childrenByDistance.end(), [](const std::pair<float, Actor>& lhs, const std::pair<float, Actor>& rhs) { return lhs.first < rhs.first; });
+
+  for(const auto& child : childrenByDistance)
+  {
+    DevelControl::SetLoadingPriority(child.second, child.first <= 0.0f ? DevelVisual::LoadingPriority::VISIBLE : DevelVisual::LoadingPriority::OFF_SCREEN);
+  }
+}
+
 void ScrollView::EnableScrollOvershoot(bool enable)
 {
   if(enable)
@@ -570,6 +570,14 @@ public:
    */
   bool AnimateTo(const Vector2& position, const Vector2& positionDuration, AlphaFunction alpha, bool findShortcuts = true, DirectionBias horizontalBias = DIRECTION_BIAS_NONE, DirectionBias verticalBias = DIRECTION_BIAS_NONE, SnapType snapType = SNAP);
 
+  /**
+   * Hints the children within the viewport to load their resources first, and the others to load theirs afterwards.
+   * The children are hinted from the nearest to the farthest from the viewport.
+   *
+   * @param[in] scrollPosition The scroll position at which the viewport is checked
+   */
+  void UpdateLoadingPriorities(const Vector2& scrollPosition);
+
   /**
    * @copydoc Toolkit::Scrollable::AddOverlay()
    */
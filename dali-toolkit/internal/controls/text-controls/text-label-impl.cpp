@@ -2092,6 +2092,11 @@ void TextLabel::AsyncTextFitChanged(float pointSize)
     mController->SetTextFitPointSize(pointSize);
     EmitTextFitChangedSignal();
   }
+  else if(mController->IsTextFitArrayEnabled())
+  {
+    // As in the synchronous layout, the chosen size is reported without the signal.
+    mController->SetTextFitPointSize(pointSize);
+  }
 }
 
 void TextLabel::AsyncSizeComputed(Text::AsyncTextRenderInfo renderInfo)
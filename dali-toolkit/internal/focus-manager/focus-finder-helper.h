@@ -0,0 +1,122 @@
+#ifndef DALI_TOOLKIT_INTERNAL_FOCUS_FINDER_HELPER_H
+#define DALI_TOOLKIT_INTERNAL_FOCUS_FINDER_HELPER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/math/rect.h>
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/control.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * The geometry shared by the traversal of Toolkit::FocusFinder and by the FocusIndex,
+ * so that both choose the same nearest actor.
+ */
+namespace FocusFinder
+{
+/**
+ * @brief Retrieves the distance from the edge of source furthest in the direction to the nearest edge of dest.
+ * @return The distance, or 0 if dest is not in the direction from source.
+ */
+int MajorAxisDistance(Toolkit::Control::KeyboardFocus::Direction direction, Bounds source, Bounds dest);
+
+/**
+ * @brief Retrieves the distance along the major axis from the edge of source to the far edge of dest.
+ * @return The distance, or 1 if dest is not in the direction from source.
+ */
+int MajorAxisDistanceToFarEdge(Toolkit::Control::KeyboardFocus::Direction direction, Bounds source, Bounds dest);
+
+/**
+ * @brief Retrieves the distance between the centers of source and dest on the minor axis.
+ */
+int MinorAxisDistance(Toolkit::Control::KeyboardFocus::Direction direction, Bounds source, Bounds dest);
+
+/**
+ * @brief Combines the major and minor axis distances into the distance the candidates are ranked by.
+ */
+uint64_t GetWeightedDistanceFor(int majorAxisDistance, int minorAxisDistance);
+
+/**
+ * @brief Checks whether destRect is a candidate for the next focus in the direction.
+ */
+bool IsCandidate(Bounds srcRect, Bounds destRect, Toolkit::Control::KeyboardFocus::Direction direction);
+
+/**
+ * @brief Checks whether dest is entirely in the direction from src.
+ */
+bool IsToDirectionOf(Toolkit::Control::KeyboardFocus::Direction direction, Bounds src, Bounds dest);
+
+/**
+ * @brief Checks whether rect1 and rect2 overlap on the minor axis of the direction.
+ */
+bool BeamsOverlap(Toolkit::Control::KeyboardFocus::Direction direction, Bounds rect1, Bounds rect2);
+
+/**
+ * @brief Checks whether rect1 is a better candidate than rect2 by being exclusively in the beam of source.
+ */
+bool BeamBeats(Toolkit::Control::KeyboardFocus::Direction direction, Bounds source, Bounds rect1, Bounds rect2);
+
+/**
+ * @brief Checks whether candidateRect is a better candidate than bestCandidateRect for the next focus.
+ * @param[in] direction The direction
+ * @param[in] focusedRect The rect of the focused actor
+ * @param[in] candidateRect The rect of the candidate
+ * @param[in] bestCandidateRect The rect of the best candidate found so far
+ * @return True if candidateRect is better
+ */
+bool IsBetterCandidate(Toolkit::Control::KeyboardFocus::Direction direction, Bounds& focusedRect, Bounds& candidateRect, Bounds& bestCandidateRect);
+
+/**
+ * @brief Checks whether the actor itself can take the focus, regardless of its ancestors.
+ */
+bool IsFocusable(Actor& actor);
+
+/**
+ * @brief Retrieves the rect the search starts from.
+ * @param[in] rootActor The root actor
+ * @param[in] focusedActor The focused actor. If it's empty, the search starts from the upper left corner of the root.
+ * @return The rect
+ */
+Bounds GetFocusedRect(Actor rootActor, Actor focusedActor);
+
+/**
+ * @brief Retrieves a rect which is not a candidate, so that the first candidate found becomes the best one.
+ * @param[in] focusedRect The rect the search starts from
+ * @param[in] direction The direction
+ * @return The rect
+ */
+Bounds GetImpossibleCandidateRect(Bounds focusedRect, Toolkit::Control::KeyboardFocus::Direction direction);
+
+} // namespace FocusFinder
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_FOCUS_FINDER_HELPER_H
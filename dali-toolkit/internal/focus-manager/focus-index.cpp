@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/focus-manager/focus-index.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/actors/actor-devel.h>
+#include <dali/public-api/object/property-conditions.h>
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/focus-manager/focus-finder-helper.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+using namespace Dali::Toolkit::Internal::FocusFinder;
+
+namespace
+{
+constexpr int32_t  CELL_SIZE           = 256;   ///< The width and height of a grid cell, in pixels.
+constexpr uint32_t MAX_CELLS_PER_ENTRY = 64u;   ///< The entries covering more cells are kept out of the grid.
+constexpr float    POSITION_STEP       = 4.0f;  ///< The move of the world position that refreshes the extents, in pixels.
+constexpr float    SCALE_STEP          = 0.05f; ///< The change of the world scale that refreshes the extents.
+
+/**
+ * @brief Retrieves the cell which holds the coordinate.
+ */
+int32_t CellOf(int32_t coordinate)
+{
+  return (coordinate >= 0) ? coordinate / CELL_SIZE : -((-coordinate + CELL_SIZE - 1) / CELL_SIZE);
+}
+
+uint64_t GetCellKey(int32_t cellX, int32_t cellY)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(cellY));
+}
+
+void EraseId(std::vector<uint32_t>& ids, uint32_t id)
+{
+  auto iter = std::find(ids.begin(), ids.end(), id);
+  if(iter != ids.end())
+  {
+    *iter = ids.back();
+    ids.pop_back();
+  }
+}
+
+/**
+ * @brief Retrieves the extents the actor covers now or will cover after the next update.
+ */
+Bounds GetIndexedExtents(Actor& actor)
+{
+  const Bounds current = DevelActor::CalculateCurrentScreenExtents(actor);
+  const Bounds target  = DevelActor::CalculateScreenExtents(actor);
+
+  const int32_t left   = std::min(current.Left(), target.Left());
+  const int32_t top    = std::min(current.Top(), target.Top());
+  const int32_t right  = std::max(current.Right(), target.Right());
+  const int32_t bottom = std::max(current.Bottom(), target.Bottom());
+  return Bounds(left, top, right - left, bottom - top);
+}
+
+/**
+ * @brief Checks whether the traversal from the root reaches the actor, i.e. the actor is under the root,
+ * and the root and every ancestor up to it are visible and allow their descendants to be focused.
+ */
+bool IsReachable(Actor actor, Actor& rootActor)
+{
+  for(Actor parent = actor.GetParent(); parent; parent = parent.GetParent())
+  {
+    if(!parent.GetProperty<bool>(Actor::Property::VISIBLE) ||
+       parent.GetCurrentProperty<bool>(DevelActor::Property::WORLD_IGNORED) ||
+       !parent.GetProperty<bool>(Actor::Property::ALLOW_DESCENDANT_FOCUS))
+    {
+      return false;
+    }
+    if(parent == rootActor)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+} // unnamed namespace
+
+FocusIndex::FocusIndex()
+: mQueryId(0u)
+{
+}
+
+FocusIndex::~FocusIndex()
+{
+  for(auto& item : mEntries)
+  {
+    Entry& entry = item.second;
+    Actor  actor = entry.actor.GetHandle();
+    if(actor)
+    {
+      actor.RemovePropertyNotification(entry.positionXNotification);
+      actor.RemovePropertyNotification(entry.positionYNotification);
+      actor.RemovePropertyNotification(entry.scaleNotification);
+    }
+  }
+}
+
+void FocusIndex::Add(Actor actor)
+{
+  if(!actor)
+  {
+    return;
+  }
+
+  const uint32_t id = actor.GetProperty<int32_t>(Actor::Property::ID);
+  if(mEntries.find(id) != mEntries.end())
+  {
+    MarkDirty(actor);
+    return;
+  }
+
+  Entry& entry = mEntries[id];
+  entry.actor  = actor;
+
+  entry.positionXNotification = actor.AddPropertyNotification(Actor::Property::WORLD_POSITION_X, StepCondition(POSITION_STEP));
+  entry.positionXNotification.NotifySignal().Connect(this, &FocusIndex::OnExtentsNotification);
+  entry.positionYNotification = actor.AddPropertyNotification(Actor::Property::WORLD_POSITION_Y, StepCondition(POSITION_STEP));
+  entry.positionYNotification.NotifySignal().Connect(this, &FocusIndex::OnExtentsNotification);
+  entry.scaleNotification = actor.AddPropertyNotification(Actor::Property::WORLD_SCALE, StepCondition(SCALE_STEP, 1.0f));
+  entry.scaleNotification.NotifySignal().Connect(this, &FocusIndex::OnExtentsNotification);
+
+  mDirtyIds.push_back(id);
+}
+
+void FocusIndex::Remove(Actor actor)
+{
+  if(!actor)
+  {
+    return;
+  }
+
+  auto iter = mEntries.find(actor.GetProperty<int32_t>(Actor::Property::ID));
+  if(iter != mEntries.end())
+  {
+    RemoveEntry(iter);
+  }
+}
+
+void FocusIndex::MarkDirty(Actor actor)
+{
+  if(!actor)
+  {
+    return;
+  }
+
+  const uint32_t id   = actor.GetProperty<int32_t>(Actor::Property::ID);
+  auto           iter = mEntries.find(id);
+  if(iter != mEntries.end() && !iter->second.dirty)
+  {
+    iter->second.dirty = true;
+    mDirtyIds.push_back(id);
+  }
+}
+
+Actor FocusIndex::GetNearestFocusableActor(Actor rootActor, Actor focusedActor, Toolkit::Control::KeyboardFocus::Direction direction)
+{
+  Actor nearestActor;
+  if(!rootActor)
+  {
+    return nearestActor;
+  }
+
+  const bool horizontal = (direction == Toolkit::Control::KeyboardFocus::LEFT || direction == Toolkit::Control::KeyboardFocus::RIGHT);
+  const bool vertical   = (direction == Toolkit::Control::KeyboardFocus::UP || direction == Toolkit::Control::KeyboardFocus::DOWN);
+  if(!horizontal && !vertical)
+  {
+    // Only the four directions have candidates.
+    return nearestActor;
+  }
+
+  AddSceneControls(rootActor);
+  RefreshDirtyEntries();
+
+  Bounds focusedRect       = GetFocusedRect(rootActor, focusedActor);
+  Bounds bestCandidateRect = GetImpossibleCandidateRect(focusedRect, direction);
+
+  ++mQueryId;
+  std::vector<uint32_t> goneIds;
+
+  for(uint32_t id : mLargeIds)
+  {
+    if(!Examine(id, rootActor, focusedActor, focusedRect, bestCandidateRect, nearestActor, direction))
+    {
+      goneIds.push_back(id);
+    }
+  }
+
+  if(mBounds.minX <= mBounds.maxX)
+  {
+    // The bands of cells across the direction are visited from the focused rect outwards.
+    // The entries first found in a band are at least bandDistance away along the direction.
+    const bool    forward = (direction == Toolkit::Control::KeyboardFocus::RIGHT || direction == Toolkit::Control::KeyboardFocus::DOWN);
+    const int32_t step    = forward ? 1 : -1;
+
+    const int32_t majorMin = horizontal ? mBounds.minX : mBounds.minY;
+    const int32_t majorMax = horizontal ? mBounds.maxX : mBounds.maxY;
+    const int32_t minorMin = horizontal ? mBounds.minY : mBounds.minX;
+    const int32_t minorMax = horizontal ? mBounds.maxY : mBounds.maxX;
+
+    // The cells an entry overlapping the beam of the focused rect must be in.
+    const int32_t beamMin = std::max(minorMin, CellOf(horizontal ? focusedRect.Top() : focusedRect.Left()));
+    const int32_t beamMax = std::min(minorMax, CellOf(horizontal ? focusedRect.Bottom() : focusedRect.Right()));
+
+    int32_t majorStart = 0;
+    switch(direction)
+    {
+      case Toolkit::Control::KeyboardFocus::LEFT:
+      {
+        majorStart = CellOf(focusedRect.Right());
+        break;
+      }
+      case Toolkit::Control::KeyboardFocus::RIGHT:
+      {
+        majorStart = CellOf(focusedRect.Left());
+        break;
+      }
+      case Toolkit::Control::KeyboardFocus::UP:
+      {
+        majorStart = CellOf(focusedRect.Bottom());
+        break;
+      }
+      default:
+      {
+        majorStart = CellOf(focusedRect.Top());
+        break;
+      }
+    }
+    majorStart = std::clamp(majorStart, majorMin, majorMax);
+
+    bool beamOnly = false;
+    for(int32_t major = majorStart; major >= majorMin && major <= majorMax; major += step)
+    {
+      if(nearestActor)
+      {
+        int64_t bandDistance = 0;
+        switch(direction)
+        {
+          case Toolkit::Control::KeyboardFocus::LEFT:
+          {
+            bandDistance = static_cast<int64_t>(focusedRect.Left()) - static_cast<int64_t>(major + 1) * CELL_SIZE;
+            break;
+          }
+          case Toolkit::Control::KeyboardFocus::RIGHT:
+          {
+            bandDistance = static_cast<int64_t>(major) * CELL_SIZE - focusedRect.Right();
+            break;
+          }
+          case Toolkit::Control::KeyboardFocus::UP:
+          {
+            bandDistance = static_cast<int64_t>(focusedRect.Top()) - static_cast<int64_t>(major + 1) * CELL_SIZE;
+            break;
+          }
+          default:
+          {
+            bandDistance = static_cast<int64_t>(major) * CELL_SIZE - focusedRect.Bottom();
+            break;
+          }
+        }
+        bandDistance = std::max(bandDistance, int64_t(0));
+
+        const uint64_t bestDistance = GetWeightedDistanceFor(MajorAxisDistance(direction, focusedRect, bestCandidateRect), MinorAxisDistance(direction, focusedRect, bestCandidateRect));
+        if(static_cast<uint64_t>(13 * bandDistance * bandDistance) > bestDistance)
+        {
+          // No entry from here on is closer than the best candidate, so only the beam can still beat it.
+          if(BeamsOverlap(direction, focusedRect, bestCandidateRect))
+          {
+            break;
+          }
+          if(vertical && IsToDirectionOf(direction, focusedRect, bestCandidateRect) &&
+             bandDistance >= MajorAxisDistanceToFarEdge(direction, focusedRect, bestCandidateRect))
+          {
+            break;
+          }
+          beamOnly = true;
+        }
+      }
+
+      const int32_t first = beamOnly ? beamMin : minorMin;
+      const int32_t last  = beamOnly ? beamMax : minorMax;
+      for(int32_t minor = first; minor <= last; ++minor)
+      {
+        auto cellIter = mCells.find(horizontal ? GetCellKey(major, minor) : GetCellKey(minor, major));
+        if(cellIter == mCells.end())
+        {
+          continue;
+        }
+        for(uint32_t id : cellIter->second)
+        {
+          if(!Examine(id, rootActor, focusedActor, focusedRect, bestCandidateRect, nearestActor, direction))
+          {
+            goneIds.push_back(id);
+          }
+        }
+      }
+    }
+  }
+
+  for(uint32_t id : goneIds)
+  {
+    auto iter = mEntries.find(id);
+    if(iter != mEntries.end())
+    {
+      RemoveEntry(iter);
+    }
+  }
+
+  return nearestActor;
+}
+
+uint32_t FocusIndex::GetCount() const
+{
+  return static_cast<uint32_t>(mEntries.size());
+}
+
+void FocusIndex::OnExtentsNotification(Dali::PropertyNotification& source)
+{
+  MarkDirty(Actor::DownCast(source.GetTarget()));
+}
+
+void FocusIndex::AddSceneControls(Actor actor)
+{
+  Actor sceneRoot = actor;
+  for(Actor parent = sceneRoot.GetParent(); parent; parent = parent.GetParent())
+  {
+    sceneRoot = parent;
+  }
+
+  if(!sceneRoot.GetProperty<bool>(Actor::Property::CONNECTED_TO_SCENE) ||
+     !mSceneRoots.insert(sceneRoot.GetProperty<int32_t>(Actor::Property::ID)).second)
+  {
+    return;
+  }
+
+  std::vector<Actor> actors{sceneRoot};
+  while(!actors.empty())
+  {
+    Actor current = actors.back();
+    actors.pop_back();
+
+    const auto childCount = current.GetChildCount();
+    for(auto i = 0u; i < childCount; ++i)
+    {
+      Actor child = current.GetChildAt(i);
+      if(Toolkit::Control::DownCast(child) && child.GetProperty<bool>(Actor::Property::FOCUSABLE))
+      {
+        Add(child);
+      }
+      actors.push_back(child);
+    }
+  }
+}
+
+void FocusIndex::RemoveEntry(EntryContainer::iterator iter)
+{
+  Entry& entry = iter->second;
+  Actor  actor = entry.actor.GetHandle();
+  if(actor)
+  {
+    actor.RemovePropertyNotification(entry.positionXNotification);
+    actor.RemovePropertyNotification(entry.positionYNotification);
+    actor.RemovePropertyNotification(entry.scaleNotification);
+  }
+
+  EraseFromGrid(iter->first, entry);
+  mEntries.erase(iter);
+}
+
+void FocusIndex::InsertIntoGrid(uint32_t id, Entry& entry, const Bounds& extents)
+{
+  // The extents are widened by how far the control may move or grow before a notification refreshes them.
+  const int32_t margin = static_cast<int32_t>(POSITION_STEP + SCALE_STEP * static_cast<float>(extents.width + extents.height)) + 1;
+
+  CellRange& cells = entry.cells;
+  cells.minX       = CellOf(extents.Left() - margin);
+  cells.minY       = CellOf(extents.Top() - margin);
+  cells.maxX       = CellOf(extents.Right() + margin);
+  cells.maxY       = CellOf(extents.Bottom() + margin);
+
+  const uint64_t cellCount = static_cast<uint64_t>(cells.maxX - cells.minX + 1) * static_cast<uint64_t>(cells.maxY - cells.minY + 1);
+  if(cellCount > MAX_CELLS_PER_ENTRY)
+  {
+    entry.large = true;
+    mLargeIds.push_back(id);
+    return;
+  }
+
+  for(int32_t cellX = cells.minX; cellX <= cells.maxX; ++cellX)
+  {
+    for(int32_t cellY = cells.minY; cellY <= cells.maxY; ++cellY)
+    {
+      mCells[GetCellKey(cellX, cellY)].push_back(id);
+    }
+  }
+
+  if(mBounds.minX > mBounds.maxX)
+  {
+    mBounds = cells;
+  }
+  else
+  {
+    mBounds.minX = std::min(mBounds.minX, cells.minX);
+    mBounds.minY = std::min(mBounds.minY, cells.minY);
+    mBounds.maxX = std::max(mBounds.maxX, cells.maxX);
+    mBounds.maxY = std::max(mBounds.maxY, cells.maxY);
+  }
+}
+
+void FocusIndex::EraseFromGrid(uint32_t id, Entry& entry)
+{
+  if(entry.large)
+  {
+    EraseId(mLargeIds, id);
+    entry.large = false;
+  }
+  else
+  {
+    for(int32_t cellX = entry.cells.minX; cellX <= entry.cells.maxX; ++cellX)
+    {
+      for(int32_t cellY = entry.cells.minY; cellY <= entry.cells.maxY; ++cellY)
+      {
+        auto cellIter = mCells.find(GetCellKey(cellX, cellY));
+        if(cellIter != mCells.end())
+        {
+          EraseId(cellIter->second, id);
+          if(cellIter->second.empty())
+          {
+            mCells.erase(cellIter);
+          }
+        }
+      }
+    }
+  }
+  entry.cells = CellRange();
+}
+
+void FocusIndex::RefreshDirtyEntries()
+{
+  for(uint32_t id : mDirtyIds)
+  {
+    auto iter = mEntries.find(id);
+    if(iter == mEntries.end() || !iter->second.dirty)
+    {
+      continue;
+    }
+
+    Entry& entry = iter->second;
+    entry.dirty  = false;
+
+    Actor actor = entry.actor.GetHandle();
+    if(!actor)
+    {
+      RemoveEntry(iter);
+      continue;
+    }
+
+    EraseFromGrid(id, entry);
+    InsertIntoGrid(id, entry, GetIndexedExtents(actor));
+  }
+  mDirtyIds.clear();
+}
+
+bool FocusIndex::Examine(uint32_t id, Actor& rootActor, Actor& focusedActor, Bounds& focusedRect, Bounds& bestCandidateRect, Actor& nearestActor, Toolkit::Control::KeyboardFocus::Direction direction)
+{
+  auto iter = mEntries.find(id);
+  if(iter == mEntries.end() || iter->second.queryId == mQueryId)
+  {
+    return true;
+  }
+  iter->second.queryId = mQueryId;
+
+  Actor actor = iter->second.actor.GetHandle();
+  if(!actor)
+  {
+    return false;
+  }
+
+  if(actor != focusedActor && IsFocusable(actor) && IsReachable(actor, rootActor))
+  {
+    // The extents are calculated again, so the choice doesn't depend on when the notifications arrive.
+    Bounds candidateRect = DevelActor::CalculateCurrentScreenExtents(actor);
+    if(IsBetterCandidate(direction, focusedRect, candidateRect, bestCandidateRect))
+    {
+      bestCandidateRect = candidateRect;
+      nearestActor      = actor;
+    }
+  }
+  return true;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
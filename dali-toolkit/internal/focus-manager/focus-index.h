@@ -0,0 +1,186 @@
+#ifndef DALI_TOOLKIT_INTERNAL_FOCUS_INDEX_H
+#define DALI_TOOLKIT_INTERNAL_FOCUS_INDEX_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/math/rect.h>
+#include <dali/public-api/object/property-notification.h>
+#include <dali/public-api/object/weak-handle.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/control.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief A uniform grid of the screen extents of the focusable controls, which finds the nearest focusable
+ * actor in a direction without visiting every actor under the root.
+ *
+ * The controls are added and removed by Toolkit::Control when they are connected to or disconnected from the scene,
+ * or when they become focusable or stop being so. The extents are refreshed lazily, before a query, for the controls
+ * whose world position, world scale or size changed. The visibility of a control and of its ancestors is checked
+ * when it is examined, as the traversal of Toolkit::FocusFinder does.
+ *
+ * The controls on the scene before the index is created are added when the first query reaches their scene.
+ */
+class FocusIndex : public ConnectionTracker
+{
+public:
+  /**
+   * @brief Constructor.
+   */
+  FocusIndex();
+
+  /**
+   * @brief Destructor.
+   */
+  ~FocusIndex() override;
+
+  /**
+   * @brief Adds a focusable control, or marks its extents out of date if it is already added.
+   * @param[in] actor The control
+   */
+  void Add(Actor actor);
+
+  /**
+   * @brief Removes a control.
+   * @param[in] actor The control
+   */
+  void Remove(Actor actor);
+
+  /**
+   * @brief Marks the extents of a control out of date, e.g. when its size has been changed.
+   * @param[in] actor The control
+   */
+  void MarkDirty(Actor actor);
+
+  /**
+   * @brief Retrieves the nearest focusable actor in the direction.
+   *
+   * It chooses the same actor as Toolkit::FocusFinder::GetNearestFocusableActor() among the indexed controls,
+   * except where two candidates are exactly as good, as the candidates are visited in another order.
+   *
+   * @param[in] rootActor The root actor
+   * @param[in] focusedActor The focused actor
+   * @param[in] direction The direction
+   * @return The nearest focusable actor, or an empty handle if none exists.
+   */
+  Actor GetNearestFocusableActor(Actor rootActor, Actor focusedActor, Toolkit::Control::KeyboardFocus::Direction direction);
+
+  /**
+   * @brief Retrieves the number of indexed controls.
+   * @return The number of controls
+   */
+  uint32_t GetCount() const;
+
+private:
+  /**
+   * @brief The range of grid cells covered by an entry.
+   */
+  struct CellRange
+  {
+    int32_t minX{0};
+    int32_t minY{0};
+    int32_t maxX{-1};
+    int32_t maxY{-1};
+  };
+
+  /**
+   * @brief An indexed control.
+   */
+  struct Entry
+  {
+    WeakHandle<Actor>          actor;
+    CellRange                  cells; ///< The cells the entry is in, empty if it isn't in the grid.
+    Dali::PropertyNotification positionXNotification;
+    Dali::PropertyNotification positionYNotification;
+    Dali::PropertyNotification scaleNotification;
+    uint32_t                   queryId{0u};  ///< The last query which examined the entry.
+    bool                       dirty{true};  ///< Whether the extents must be refreshed before the next query.
+    bool                       large{false}; ///< Whether the entry is in the large entry list rather than in the grid.
+  };
+
+  using EntryContainer     = std::unordered_map<uint32_t, Entry>;                  ///< The entries, by actor id.
+  using CellContainer      = std::unordered_map<uint64_t, std::vector<uint32_t>>; ///< The actor ids in each cell, by cell key.
+  using IdContainer        = std::vector<uint32_t>;
+  using SceneRootContainer = std::unordered_set<uint32_t>;
+
+  /**
+   * @brief Called when the world position or the world scale of a control has changed.
+   */
+  void OnExtentsNotification(Dali::PropertyNotification& source);
+
+  /**
+   * @brief Adds the focusable controls under the root of the scene of the actor, unless it's done already.
+   */
+  void AddSceneControls(Actor actor);
+
+  /**
+   * @brief Removes an entry from the grid and from the container.
+   */
+  void RemoveEntry(EntryContainer::iterator iter);
+
+  /**
+   * @brief Puts an entry into the grid, or into the large entry list.
+   */
+  void InsertIntoGrid(uint32_t id, Entry& entry, const Bounds& extents);
+
+  /**
+   * @brief Takes an entry out of the grid, or out of the large entry list.
+   */
+  void EraseFromGrid(uint32_t id, Entry& entry);
+
+  /**
+   * @brief Refreshes the extents of the entries which are out of date.
+   */
+  void RefreshDirtyEntries();
+
+  /**
+   * @brief Examines a candidate, which replaces the best candidate if it's eligible and better.
+   * @return False if the actor of the entry is gone, so the entry must be removed.
+   */
+  bool Examine(uint32_t id, Actor& rootActor, Actor& focusedActor, Bounds& focusedRect, Bounds& bestCandidateRect, Actor& nearestActor, Toolkit::Control::KeyboardFocus::Direction direction);
+
+private:
+  EntryContainer     mEntries;
+  CellContainer      mCells;
+  IdContainer        mLargeIds;   ///< The entries covering too many cells, which are examined by every query.
+  IdContainer        mDirtyIds;   ///< The entries whose extents must be refreshed.
+  SceneRootContainer mSceneRoots; ///< The ids of the scene roots whose controls have been added.
+  CellRange          mBounds;     ///< The range of the cells that have ever held an entry.
+  uint32_t           mQueryId;
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_FOCUS_INDEX_H
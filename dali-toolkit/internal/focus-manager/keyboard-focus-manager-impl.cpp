@@ -42,6 +42,7 @@
 #include <dali-toolkit/devel-api/focus-manager/focus-finder.h>
 #include <dali-toolkit/devel-api/focus-manager/keyinput-focus-manager.h>
 #include <dali-toolkit/devel-api/styling/style-manager-devel.h>
+#include <dali-toolkit/internal/focus-manager/focus-index.h>
 #include <dali-toolkit/internal/focus-manager/keyinput-focus-manager-impl.h>
 #include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/public-api/controls/control.h>
@@ -146,6 +147,7 @@ KeyboardFocusManager::KeyboardFocusManager()
   mCurrentFocusActor(),
   mFocusIndicatorActor(),
   mFocusFinderRootActor(),
+  mFocusIndex(),
   mFocusHistory(),
   mSlotDelegate(this),
   mCustomAlgorithmInterface(NULL),
@@ -618,7 +620,14 @@ bool KeyboardFocusManager::MoveFocus(Toolkit::Control::KeyboardFocus::Direction
         if(rootActor)
         {
           // We should find it among the actors nearby.
-          nextFocusableActor = Toolkit::FocusFinder::GetNearestFocusableActor(rootActor, currentFocusActor, direction);
+          if(mFocusIndex)
+          {
+            nextFocusableActor = mFocusIndex->GetNearestFocusableActor(rootActor, currentFocusActor, direction);
+          }
+          else
+          {
+            nextFocusableActor = Toolkit::FocusFinder::GetNearestFocusableActor(rootActor, currentFocusActor, direction);
+          }
         }
       }
     }
@@ -1333,6 +1342,49 @@ bool KeyboardFocusManager::IsDefaultAlgorithmEnabled() const
   return mEnableDefaultAlgorithm;
 }
 
+void KeyboardFocusManager::EnableFocusIndex(bool enable)
+{
+  if(!enable)
+  {
+    mFocusIndex.reset();
+  }
+  else if(!mFocusIndex)
+  {
+    mFocusIndex = std::make_unique<FocusIndex>();
+  }
+}
+
+bool KeyboardFocusManager::IsFocusIndexEnabled() const
+{
+  return static_cast<bool>(mFocusIndex);
+}
+
+void KeyboardFocusManager::UpdateFocusIndex(Actor control, bool focusable)
+{
+  Toolkit::KeyboardFocusManager manager = Get();
+  if(manager && Toolkit::GetImpl(manager).mFocusIndex)
+  {
+    FocusIndex& focusIndex = *Toolkit::GetImpl(manager).mFocusIndex;
+    if(focusable)
+    {
+      focusIndex.Add(control);
+    }
+    else
+    {
+      focusIndex.Remove(control);
+    }
+  }
+}
+
+void KeyboardFocusManager::MarkFocusIndexDirty(Actor control)
+{
+  Toolkit::KeyboardFocusManager manager = Get();
+  if(manager && Toolkit::GetImpl(manager).mFocusIndex)
+  {
+    Toolkit::GetImpl(manager).mFocusIndex->MarkDirty(control);
+  }
+}
+
 void KeyboardFocusManager::SetFocusFinderRootActor(Actor actor)
 {
   mFocusFinderRootActor = actor;
@@ -23,6 +23,7 @@
 #include <dali/public-api/adaptor-framework/window.h>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/object/weak-handle.h>
+#include <memory>
 #include <string>
 
 // INTERNAL INCLUDES
@@ -42,6 +43,8 @@ namespace Toolkit
 {
 namespace Internal
 {
+class FocusIndex;
+
 /**
  * @copydoc Toolkit::KeyboardFocusManager
  */
@@ -175,6 +178,31 @@ public:
    */
   bool IsDefaultAlgorithmEnabled() const;
 
+  /**
+   * @copydoc Toolkit::DevelKeyboardFocusManager::EnableFocusIndex
+   */
+  void EnableFocusIndex(bool enable);
+
+  /**
+   * @copydoc Toolkit::DevelKeyboardFocusManager::IsFocusIndexEnabled
+   */
+  bool IsFocusIndexEnabled() const;
+
+  /**
+   * @brief Adds the control to the focus index or removes it, if the index is enabled.
+   *
+   * Called when the control is connected to or disconnected from the scene, or becomes focusable or stops being so.
+   * @param[in] control The control
+   * @param[in] focusable Whether the control is focusable and on the scene
+   */
+  static void UpdateFocusIndex(Actor control, bool focusable);
+
+  /**
+   * @brief Marks the extents of the control in the focus index out of date, if the index is enabled.
+   * @param[in] control The control whose size has been changed
+   */
+  static void MarkFocusIndexDirty(Actor control);
+
   /**
    * @copydoc Toolkit::DevelKeyboardFocusManager::SetFocusFinderRootActor
    */
@@ -425,6 +453,8 @@ private:
 
   WeakHandle<Actor> mFocusFinderRootActor; ///<The root actor from which the focus finder is started.
 
+  std::unique_ptr<FocusIndex> mFocusIndex; ///< The spatial index of the focusable controls, if enabled
+
   FocusStack mFocusHistory; ///< Stack to contain pre-focused actor's BaseObject*
 
   SlotDelegate<KeyboardFocusManager> mSlotDelegate;
@@ -38,6 +38,9 @@
 #include <unordered_map>
 #endif
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/image-loader/loading-task.h>
+
 using Dali::Integration::ToDaliString;
 
 namespace Dali
@@ -84,8 +87,8 @@ Dali::PixelData GetDummyAPixelData()
 
 } // namespace
 
-FastTrackLoadingTask::FastTrackLoadingTask(const VisualUrl& url, ImageDimensions dimensions, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, bool loadPlanes, CallbackBase* callback)
-: AsyncTask(MakeCallback(this, &FastTrackLoadingTask::OnComplete), url.GetProtocolType() == VisualUrl::ProtocolType::REMOTE ? AsyncTask::PriorityType::LOW : AsyncTask::PriorityType::HIGH),
+FastTrackLoadingTask::FastTrackLoadingTask(const VisualUrl& url, ImageDimensions dimensions, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, bool loadPlanes, CallbackBase* callback, DevelVisual::LoadingPriority::Type loadingPriority)
+: AsyncTask(MakeCallback(this, &FastTrackLoadingTask::OnComplete), GetLoadingTaskPriorityType(url, loadingPriority)),
   mUrl(url),
   mTextures(),
   mDimensions(dimensions),
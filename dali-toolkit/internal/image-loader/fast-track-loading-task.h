@@ -29,6 +29,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-type.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 
@@ -57,7 +58,8 @@ public:
                        bool                                     orientationCorrection,
                        DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
                        bool                                     loadPlanes,
-                       CallbackBase*                            callback);
+                       CallbackBase*                            callback,
+                       DevelVisual::LoadingPriority::Type       loadingPriority = DevelVisual::LoadingPriority::DEFAULT);
 
   /**
    * @brief Destructor.
@@ -54,6 +54,44 @@ uint64_t GetNanoseconds()
 #endif
 } // namespace
 
+AsyncTask::PriorityType GetLoadingTaskPriorityType(DevelVisual::LoadingPriority::Type loadingPriority, AsyncTask::PriorityType defaultPriorityType)
+{
+  switch(loadingPriority)
+  {
+    case DevelVisual::LoadingPriority::VISIBLE:
+    {
+      return AsyncTask::PriorityType::HIGH;
+    }
+    case DevelVisual::LoadingPriority::OFF_SCREEN:
+    {
+      return AsyncTask::PriorityType::LOW;
+    }
+    case DevelVisual::LoadingPriority::DEFAULT:
+    default:
+    {
+      return defaultPriorityType;
+    }
+  }
+}
+
+AsyncTask::PriorityType GetLoadingTaskPriorityType(const VisualUrl& url, DevelVisual::LoadingPriority::Type loadingPriority)
+{
+  return GetLoadingTaskPriorityType(loadingPriority, url.GetProtocolType() == VisualUrl::ProtocolType::REMOTE ? AsyncTask::PriorityType::LOW : AsyncTask::PriorityType::HIGH);
+}
+
+DevelVisual::LoadingPriority::Type GetMoreUrgentLoadingPriority(DevelVisual::LoadingPriority::Type lhs, DevelVisual::LoadingPriority::Type rhs)
+{
+  if(lhs == DevelVisual::LoadingPriority::VISIBLE || rhs == DevelVisual::LoadingPriority::VISIBLE)
+  {
+    return DevelVisual::LoadingPriority::VISIBLE;
+  }
+  if(lhs == DevelVisual::LoadingPriority::OFF_SCREEN && rhs == DevelVisual::LoadingPriority::OFF_SCREEN)
+  {
+    return DevelVisual::LoadingPriority::OFF_SCREEN;
+  }
+  return DevelVisual::LoadingPriority::DEFAULT;
+}
+
 LoadingTask::LoadingTask(uint32_t id, Dali::AnimatedImageLoading animatedImageLoading, uint32_t frameIndex, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, CallbackBase* callback)
 : AsyncTask(callback),
   url(),
@@ -94,8 +132,8 @@ LoadingTask::LoadingTask(uint32_t id, Dali::AnimatedImageLoading animatedImageLo
 {
 }
 
-LoadingTask::LoadingTask(uint32_t id, const VisualUrl& url, ImageDimensions dimensions, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, bool loadPlanes, CallbackBase* callback)
-: AsyncTask(callback, url.GetProtocolType() == VisualUrl::ProtocolType::REMOTE ? AsyncTask::PriorityType::LOW : AsyncTask::PriorityType::HIGH),
+LoadingTask::LoadingTask(uint32_t id, const VisualUrl& url, ImageDimensions dimensions, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, bool loadPlanes, CallbackBase* callback, DevelVisual::LoadingPriority::Type loadingPriority)
+: AsyncTask(callback, GetLoadingTaskPriorityType(url, loadingPriority)),
   url(url),
   encodedImageBuffer(),
   id(id),
@@ -161,6 +199,8 @@ LoadingTask::~LoadingTask()
 
 void LoadingTask::Process()
 {
+  mStarted = true;
+
 #ifdef TRACE_ENABLED
   uint64_t mStartTimeNanoSceonds = 0;
   uint64_t mEndTimeNanoSceonds   = 0;
@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-type.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali/devel-api/adaptor-framework/async-task-manager.h>
@@ -31,6 +32,7 @@
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/ref-object.h>
+#include <atomic>
 
 namespace Dali
 {
@@ -41,6 +43,30 @@ namespace Internal
 class LoadingTask;
 using LoadingTaskPtr = IntrusivePtr<LoadingTask>;
 
+/**
+ * @brief Retrieves the priority of a task that loads the resources of a visual.
+ * @param[in] loadingPriority The loading priority hint of the visual
+ * @param[in] defaultPriorityType The priority of the task if the visual has no hint
+ * @return HIGH if the visual is visible, LOW if it is off screen, defaultPriorityType otherwise
+ */
+AsyncTask::PriorityType GetLoadingTaskPriorityType(DevelVisual::LoadingPriority::Type loadingPriority, AsyncTask::PriorityType defaultPriorityType);
+
+/**
+ * @brief Retrieves the priority of a task that loads the given url for a visual.
+ * @param[in] url The url to load. Remote urls are loaded with LOW priority if the visual has no hint.
+ * @param[in] loadingPriority The loading priority hint of the visual
+ * @return The priority of the task
+ */
+AsyncTask::PriorityType GetLoadingTaskPriorityType(const VisualUrl& url, DevelVisual::LoadingPriority::Type loadingPriority);
+
+/**
+ * @brief Retrieves the more urgent of two loading priority hints, for a resource shared by several visuals.
+ * @param[in] lhs A loading priority hint
+ * @param[in] rhs Another loading priority hint
+ * @return VISIBLE if either is VISIBLE, OFF_SCREEN if both are OFF_SCREEN, DEFAULT otherwise
+ */
+DevelVisual::LoadingPriority::Type GetMoreUrgentLoadingPriority(DevelVisual::LoadingPriority::Type lhs, DevelVisual::LoadingPriority::Type rhs);
+
 /**
  * The task of an image loading
  */
@@ -91,6 +117,7 @@ public:
    * @param [in] preMultiplyOnLoad ON if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha or if the image need to be applied alpha mask.
    * @param [in] loadPlanes true to load image planes or false to load bitmap image.
    * @param [in] callback The callback that is called when the operation is completed.
+   * @param [in] loadingPriority The loading priority hint of the visual that requested the image.
    */
   LoadingTask(uint32_t                                 id,
               const VisualUrl&                         url,
@@ -99,7 +126,8 @@ public:
               bool                                     orientationCorrection,
               DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
               bool                                     loadPlanes,
-              CallbackBase*                            callback);
+              CallbackBase*                            callback,
+              DevelVisual::LoadingPriority::Type       loadingPriority = DevelVisual::LoadingPriority::DEFAULT);
 
   /**
    * Constructor.
@@ -147,6 +175,15 @@ public:
    */
   void SetTextureId(TextureManagerType::TextureId id);
 
+  /**
+   * @brief Checks whether a worker thread has started to process the task.
+   * @return True if the task has started
+   */
+  bool IsStarted() const
+  {
+    return mStarted;
+  }
+
 public: // Implementation of AsyncTask
   /**
    * @copydoc Dali::AsyncTask::Process()
@@ -203,6 +240,9 @@ public:
   bool isMaskTask : 1;            ///< whether this task is for mask or not
   bool cropToMask : 1;            ///< Whether to crop the content to the mask size
   bool loadPlanes : 1;            ///< Whether to load image planes
+
+private:
+  std::atomic<bool> mStarted{false}; ///< Whether a worker thread has started to process the task
 };
 
 } // namespace Internal
@@ -269,11 +269,11 @@ void ParticleEmitter::Update()
 
       if(!mt) // single-threaded, update all particles in one go
       {
-        GetImplementation(modifier).Update(mParticleList, 0, mParticleList.GetActiveParticleCount());
+        GetImplementation(modifier).Update(mParticleList, 0, mParticleList.GetActiveParticleCount(), deltaSeconds);
       }
       else
       {
-        UpdateModifierMT(modifier);
+        UpdateModifierMT(modifier, deltaSeconds);
       }
     }
   }
@@ -296,7 +296,7 @@ void ParticleEmitter::UpdateSource(uint32_t count)
   GetImplementation(mParticleSource).Update(mParticleList, count);
 }
 
-void ParticleEmitter::UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleModifier& modifier)
+void ParticleEmitter::UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleModifier& modifier, float deltaSeconds)
 {
   auto& threadPool = GetThreadPool();
 
@@ -308,7 +308,7 @@ void ParticleEmitter::UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleMo
   // If less, continue ST
   if(DALI_UNLIKELY(workerThreads == 0u) || activeCount / 10 < workerThreads)
   {
-    GetImplementation(modifier).Update(mParticleList, 0, activeCount);
+    GetImplementation(modifier).Update(mParticleList, 0, activeCount, deltaSeconds);
     return;
   }
 
@@ -317,11 +317,12 @@ void ParticleEmitter::UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleMo
   // make tasks
   struct UpdateTask
   {
-    UpdateTask(Internal::ParticleModifier& modifier, ParticleSystem::ParticleList& list, uint32_t first, uint32_t count)
+    UpdateTask(Internal::ParticleModifier& modifier, ParticleSystem::ParticleList& list, uint32_t first, uint32_t count, float deltaSeconds)
     : mModifier(modifier),
       mList(list),
       mFirst(first),
-      mCount(count)
+      mCount(count),
+      mDeltaSeconds(deltaSeconds)
     {
     }
 
@@ -329,10 +330,11 @@ void ParticleEmitter::UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleMo
     ParticleSystem::ParticleList& mList;
     const uint32_t                mFirst;
     const uint32_t                mCount;
+    const float                   mDeltaSeconds;
 
     void Update()
     {
-      mModifier.Update(mList, mFirst, mCount);
+      mModifier.Update(mList, mFirst, mCount, mDeltaSeconds);
     }
   };
 
@@ -347,7 +349,7 @@ void ParticleEmitter::UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleMo
     const auto index = i * partial;
     const auto count = (i == workerThreads - 1) ? activeCount - index : partial;
 
-    updateTasks.emplace_back(GetImplementation(modifier), mParticleList, index, count);
+    updateTasks.emplace_back(GetImplementation(modifier), mParticleList, index, count, deltaSeconds);
     tasks.emplace_back([&task = updateTasks.back()](uint32_t n)
     { task.Update(); });
   }
@@ -95,7 +95,7 @@ public:
 
   void UpdateSource(uint32_t count);
 
-  void UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleModifier& modifier);
+  void UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleModifier& modifier, float deltaSeconds);
 
   void UpdateDomain();
 
@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include <dali-toolkit/internal/particle-system/particle-list-impl.h>
 
+// EXTERNAL INCLUDES
+#include <utility>
+
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/particle-system/particle-impl.h>
 
@@ -164,6 +167,7 @@ ParticleSystem::Particle ParticleList::NewParticle(float lifetime)
     // Add particle
     // TODO : Could we use a pool allocator here?
     mParticles.PushBack(new Internal::Particle(*this, newIndex));
+    mParticleSlots.push_back(newIndex);
 
     // Set particle lifetime
     auto& particle = mParticles.Back();
@@ -192,31 +196,68 @@ uint32_t ParticleList::GetStreamElementSize(bool includeLocalStream)
 
 void ParticleList::ReleaseParticles(const std::vector<uint32_t>& sortedEraseIndices)
 {
-  auto it = mParticles.Begin();
+  if(sortedEraseIndices.empty())
+  {
+    return;
+  }
 
   mAliveParticleCount -= sortedEraseIndices.size();
 
-  uint32_t particleIndex = 0;
-  for(auto& index : sortedEraseIndices)
+  // Compact the list in a single pass, moving the surviving particles down over the released ones.
+  // Unlike swap-and-pop, this keeps the order of the particles, which is their drawing order.
+  const uint32_t particleCount = mParticles.Count();
+
+  uint32_t writeIndex = sortedEraseIndices.front();
+  auto     eraseIt    = sortedEraseIndices.begin();
+  for(uint32_t readIndex = writeIndex; readIndex < particleCount; ++readIndex)
   {
-    // Find particle in the list
-    // TODO : Let we remove advancement in future.
-    while(particleIndex < index)
+    if(eraseIt != sortedEraseIndices.end() && *eraseIt == readIndex)
     {
-      ++it;
-      ++particleIndex;
+      // Point at this slot of memory as next free slot
+      auto& p                  = mParticles[readIndex];
+      mFreeChain[p.GetIndex()] = mFreeIndex;
+      mFreeIndex               = p.GetIndex();
+      ++eraseIt;
     }
+    else
+    {
+      mParticleSlots[writeIndex] = mParticleSlots[readIndex];
+      std::swap(mParticles[writeIndex++], mParticles[readIndex]);
+    }
+  }
 
-    // Point at this slot of memory as next free slot
-    auto& p                  = *it;
-    mFreeChain[p.GetIndex()] = mFreeIndex;
-    mFreeIndex               = p.GetIndex();
+  // The released particles are now at the end of the list
+  mParticles.Erase(mParticles.Begin() + writeIndex, mParticles.End());
+  mParticleSlots.resize(writeIndex);
+}
 
-    // Remove particle from the list
-    // TODO : Optimize here! For now, it spend O(N) per each erase.
-    it = mParticles.Erase(it);
-    ++particleIndex;
+ParticleBatch ParticleList::GetBatch(uint32_t firstParticleIndex, uint32_t particleCount, float deltaSeconds)
+{
+  ParticleBatch batch;
+  batch.position     = GetBuiltInStream<Vector3>(ParticleStream::POSITION_STREAM_BIT);
+  batch.velocity     = GetBuiltInStream<Vector3>(ParticleStream::VELOCITY_STREAM_BIT);
+  batch.color        = GetBuiltInStream<Vector4>(ParticleStream::COLOR_STREAM_BIT);
+  batch.scale        = GetBuiltInStream<Vector3>(ParticleStream::SCALE_STREAM_BIT);
+  batch.lifetime     = GetBuiltInStream<float>(ParticleStream::LIFETIME_STREAM_BIT);
+  batch.lifetimeBase = GetBuiltInStream<float>(ParticleStream::LIFETIME_BASE_STREAM_BIT);
+  batch.deltaSeconds = deltaSeconds;
+
+  if(firstParticleIndex >= mParticleSlots.size())
+  {
+    return batch;
+  }
+
+  batch.slots = mParticleSlots.data() + firstParticleIndex;
+  batch.count = std::min(particleCount, static_cast<uint32_t>(mParticleSlots.size()) - firstParticleIndex);
+
+  // The slots are unique, so they are contiguous if they span exactly the number of particles
+  const auto minmax = std::minmax_element(batch.slots, batch.slots + batch.count);
+  if(batch.count && *minmax.second - *minmax.first + 1u == batch.count)
+  {
+    batch.firstSlot    = *minmax.first;
+    batch.isContiguous = true;
   }
+  return batch;
 }
 
 void* ParticleList::GetDefaultStream(ParticleStreamTypeFlagBit streamBit)
@@ -18,6 +18,7 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/particle-system/particle-batch-modifier.h>
 #include <dali-toolkit/public-api/particle-system/particle-list.h>
 #include <dali-toolkit/public-api/particle-system/particle.h>
 
@@ -155,6 +156,15 @@ public:
 
   void ReleaseParticles(const std::vector<uint32_t>& sortedEraseIndices);
 
+  /**
+   * Returns the streams of the built-in attributes and the slots of a range of active particles
+   * @param[in] firstParticleIndex Index of the first particle
+   * @param[in] particleCount Number of particles
+   * @param[in] deltaSeconds Time elapsed since the last update
+   * @return The batch of particles
+   */
+  ParticleBatch GetBatch(uint32_t firstParticleIndex, uint32_t particleCount, float deltaSeconds);
+
   uint32_t GetStreamElementSize(bool includeLocalStream);
 
 private:
@@ -164,6 +174,16 @@ private:
     return AddStream(sizeof(T), &defaultValue, StreamDataTypeWrapper<T>::GetType(), streamName, localStream);
   }
 
+  /**
+   * Returns typed pointer to the built-in stream, or nullptr if the list doesn't have it
+   */
+  template<class T>
+  T* GetBuiltInStream(ParticleStreamTypeFlagBit streamBit)
+  {
+    auto iter = mBuiltInStreamMap.find(streamBit);
+    return iter != mBuiltInStreamMap.end() ? reinterpret_cast<T*>(GetRawStream(iter->second)) : nullptr;
+  }
+
 public:
   /**
    * Adds new stream and returns index
@@ -185,6 +205,7 @@ private:
   std::map<uint32_t, uint32_t> mBuiltInStreamMap;
 
   Dali::Vector<ParticleSystem::Particle> mParticles;
+  std::vector<uint32_t>                  mParticleSlots; ///< Slot of each active particle, in the same order as mParticles
 
   uint32_t mParticleStreamElementSizeWithLocal{0u};
   uint32_t mParticleStreamElementSize{0u};
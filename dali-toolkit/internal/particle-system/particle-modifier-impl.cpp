@@ -17,16 +17,27 @@
 
 #include <dali-toolkit/internal/particle-system/particle-modifier-impl.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/particle-system/particle-list-impl.h>
+
 namespace Dali::Toolkit::ParticleSystem::Internal
 {
 ParticleModifier::ParticleModifier(UniquePtr<ParticleModifierInterface>&& updater)
-: mUpdater(std::move(updater))
+: mUpdater(std::move(updater)),
+  mBatchUpdater(dynamic_cast<ParticleBatchModifierInterface*>(mUpdater.get()))
 {
 }
 
-void ParticleModifier::Update(ParticleSystem::ParticleList& list, uint32_t first, uint32_t count)
+void ParticleModifier::Update(ParticleSystem::ParticleList& list, uint32_t first, uint32_t count, float deltaSeconds)
 {
-  mUpdater->Update(list, first, count);
+  if(mBatchUpdater)
+  {
+    mBatchUpdater->UpdateBatch(GetImplementation(list).GetBatch(first, count, deltaSeconds));
+  }
+  else
+  {
+    mUpdater->Update(list, first, count);
+  }
 }
 
 ParticleModifierInterface& ParticleModifier::GetUpdater()
@@ -22,6 +22,7 @@
 #include <dali/public-api/object/base-object.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/particle-system/particle-batch-modifier.h>
 #include <dali-toolkit/public-api/particle-system/particle-modifier.h>
 
 namespace Dali::Toolkit::ParticleSystem::Internal
@@ -33,12 +34,16 @@ class ParticleModifier : public Dali::BaseObject
 public:
   ParticleModifier(UniquePtr<ParticleModifierInterface>&& updater);
 
-  void Update(ParticleSystem::ParticleList& list, uint32_t first, uint32_t count);
+  /**
+   * Updates a range of particles, through their data streams if the updater is a batch modifier
+   */
+  void Update(ParticleSystem::ParticleList& list, uint32_t first, uint32_t count, float deltaSeconds);
 
   ParticleModifierInterface& GetUpdater();
 
 private:
   UniquePtr<ParticleModifierInterface> mUpdater;
+  ParticleBatchModifierInterface*      mBatchUpdater{nullptr}; ///< The updater, if it is a batch modifier
 };
 
 } // namespace Dali::Toolkit::ParticleSystem::Internal
@@ -20,6 +20,8 @@
 
 // EXTERNAL HEADERS
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/adaptor-framework/graphics-backend.h>
 #include <dali/devel-api/rendering/renderer-devel.h>
 #include <dali/graphics-api/graphics-buffer.h>
 #include <dali/graphics-api/graphics-controller.h>
@@ -29,6 +31,7 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/string-utils.h>
 #include <dali/public-api/common/capabilities.h>
+#include <cstdlib>
 
 using Dali::Integration::ToDaliStringView;
 
@@ -44,6 +47,52 @@ namespace
  * @brief The number of vertex elements per each particle is 6.
  */
 static constexpr uint32_t NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE = 6u;
+
+/**
+ * @brief GLSL ES 3.00 comes with GLES 3.0, the first version with per-instance vertex attributes.
+ */
+static constexpr uint32_t MINIMUM_SHADER_LANGUAGE_VERSION_FOR_INSTANCING = 300u;
+
+const char* DALI_PARTICLE_SYSTEM_INSTANCING("DALI_PARTICLE_SYSTEM_INSTANCING");
+
+/**
+ * @brief Checks whether the stream data is drawn with instancing, one record per particle.
+ * Setting DALI_PARTICLE_SYSTEM_INSTANCING to 0 duplicates the record for each vertex of the particle instead.
+ */
+bool IsInstancingEnabled()
+{
+  auto instancingString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_PARTICLE_SYSTEM_INSTANCING);
+  if(instancingString)
+  {
+    const bool enabled = std::atoi(instancingString) != 0;
+    DALI_LOG_RELEASE_INFO("Particle system instancing:%d\n", enabled);
+    return enabled;
+  }
+  return true;
+}
+
+/**
+ * @brief Checks whether the graphics backend supports the attribute divisor.
+ * Vulkan always does, GLES from 3.0. Unknown backends use the per-vertex path.
+ */
+bool IsAttributeDivisorSupported()
+{
+  switch(Graphics::GetCurrentGraphicsBackend())
+  {
+    case Graphics::Backend::VULKAN:
+    {
+      return true;
+    }
+    case Graphics::Backend::GLES:
+    {
+      return Dali::Shader::GetShaderLanguageVersion() >= MINIMUM_SHADER_LANGUAGE_VERSION_FOR_INSTANCING;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
 } // namespace
 
 ParticleRenderer::ParticleRenderer()
@@ -73,6 +122,13 @@ BlendingMode ParticleRenderer::GetBlendingMode() const
 
 void ParticleRenderer::CreateShader()
 {
+  // The graphics backend is ready once the renderer is created, so it can be asked for the attribute divisor.
+  mUsingStreamDivisor = IsInstancingEnabled() && IsAttributeDivisorSupported();
+  if(!mUsingStreamDivisor)
+  {
+    DALI_LOG_RELEASE_INFO("Particle system duplicates the stream data per vertex\n");
+  }
+
   // Create shader dynamically
   auto& list        = GetImplementation(mEmitter->GetParticleList());
   auto  streamCount = list.GetStreamCount();
@@ -205,22 +261,30 @@ void ParticleRenderer::CreateShader()
 
   static_assert(sizeof(Quad2D) == sizeof(Vertex2D) * NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE, "Quad2D must be 6x Vertex2D");
 
-  std::vector<Quad2D> quads;
-  quads.resize(mEmitter->GetParticleList().GetCapacity());
-  std::fill(quads.begin(), quads.end(), QUAD);
-  vertexBuffer0.SetData(quads.data(), quads.size() * NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE);
-
   // Second vertex buffer with stream data
   VertexBuffer vertexBuffer1 = VertexBuffer::New(streamAtttributes);
 
   /**
-   * For more efficient stream management we need to support glVertexAttribDivisor() function.
-   * This will allow step 1 attribute per 4 vertices (GLES3+). Problem: DALi doesn't support instancing
+   * With the attribute divisor, the quad is drawn once per particle and the stream data steps one record per instance,
+   * so each particle uploads a single record. The number of instances follows the number of records written by the
+   * stream buffer update callback.
    *
-   * For older GLES2 we need to duplicate stream data (4x more memory in case of using a quad geometry)
+   * Otherwise we need to duplicate stream data (6x more memory in case of using a quad geometry)
    *
    * Point-sprites may be of use in the future (problem: point sprites use screen space)
    */
+  if(mUsingStreamDivisor)
+  {
+    vertexBuffer0.SetData(&QUAD, NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE);
+    vertexBuffer1.SetDivisor(1u);
+  }
+  else
+  {
+    std::vector<Quad2D> quads;
+    quads.resize(mEmitter->GetParticleList().GetCapacity());
+    std::fill(quads.begin(), quads.end(), QUAD);
+    vertexBuffer0.SetData(quads.data(), quads.size() * NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE);
+  }
 
   // Based on the particle system, populate buffer
   mGeometry.AddVertexBuffer(vertexBuffer0);
@@ -235,9 +299,10 @@ void ParticleRenderer::CreateShader()
   Dali::Vector<uint8_t> data;
 
   // Resize using only-non local streams
-  const auto elementSize = mEmitter->GetParticleList().GetParticleDataSize(false);
-  data.ResizeUninitialized(elementSize * mEmitter->GetParticleList().GetCapacity() * NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE);
-  mStreamBuffer.SetData(data.Begin(), mEmitter->GetParticleList().GetCapacity() * NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE); // needed to initialize
+  const auto elementSize     = mEmitter->GetParticleList().GetParticleDataSize(false);
+  const auto numberOfRecords = mEmitter->GetParticleList().GetCapacity() * GetNumberOfRecordsPerParticle();
+  data.ResizeUninitialized(elementSize * numberOfRecords);
+  mStreamBuffer.SetData(data.Begin(), numberOfRecords); // needed to initialize
 
   // Sets up callback
   if(DALI_LIKELY(Dali::Adaptor::IsAvailable()))
@@ -295,8 +360,10 @@ uint32_t ParticleRenderer::OnStreamBufferUpdate(void* streamData, size_t maxByte
 
   const auto elementByte = list.GetStreamElementSize(false);
 
-  // Prepare source buffer (MUST BE OPTIMIZED TO AVOID ALLOCATING AND COPYING!!)
-  auto totalSize = particleMaxCount * elementByte * NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE;
+  // Bytes written per particle
+  const auto particleByte = elementByte * GetNumberOfRecordsPerParticle();
+
+  auto totalSize = particleMaxCount * particleByte;
 
   // buffer sizes must match
   if(DALI_UNLIKELY(totalSize != maxBytes))
@@ -357,7 +424,7 @@ uint32_t ParticleRenderer::OnStreamBufferUpdate(void* streamData, size_t maxByte
       const auto index = i * partial;
       const auto count = i == workerCount - 1 ? particleCount - index : partial;
 
-      tasks.emplace_back(*this, list, index, count, dst + (elementByte * NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE) * index);
+      tasks.emplace_back(*this, list, index, count, dst + particleByte * index);
       taskQueue.emplace_back([&t = tasks.back()](uint32_t threadId)
       { t.Update(); });
     }
@@ -377,7 +444,7 @@ uint32_t ParticleRenderer::OnStreamBufferUpdate(void* streamData, size_t maxByte
   {
     UpdateParticlesTask(list, 0, particleCount, dst);
   }
-  return particleCount * elementByte * NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE; // return byte of elements to render
+  return particleCount * particleByte; // return byte of elements to render
 }
 
 Renderer ParticleRenderer::GetRenderer() const
@@ -385,6 +452,11 @@ Renderer ParticleRenderer::GetRenderer() const
   return mRenderer;
 }
 
+uint32_t ParticleRenderer::GetNumberOfRecordsPerParticle() const
+{
+  return mUsingStreamDivisor ? 1u : NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE;
+}
+
 void ParticleRenderer::UpdateParticlesTask(Internal::ParticleList& list,
                                            uint32_t                particleStartIndex,
                                            uint32_t                particleCount,
@@ -395,14 +467,12 @@ void ParticleRenderer::UpdateParticlesTask(Internal::ParticleList& list,
 
   auto& particles = list.GetParticles();
 
-  // TODO : Let we remove advancement in future.
-  auto it = particles.begin();
-  std::advance(it, particleStartIndex);
+  auto it = particles.Begin() + particleStartIndex;
 
   for(; particleCount; particleCount--, it++)
   {
     ParticleSystem::Particle& p = *it;
-    // without instancing we need to duplicate data 4 times per each quad
+
     auto* particleDst = dst;
     for(auto s = 0u; s < streamCount; ++s)
     {
@@ -418,7 +488,12 @@ void ParticleRenderer::UpdateParticlesTask(Internal::ParticleList& list,
         dst += dataSize;
       }
     }
-    // Replicate data 5 more times for each vertex (GLES2)
+    if(mUsingStreamDivisor)
+    {
+      continue;
+    }
+
+    // without instancing, replicate data 5 more times for each vertex
     for(auto vertexCopyCount = 0u; vertexCopyCount < NUMBER_OF_VERTEX_ELEMENTS_PER_PARTICLE - 1; ++vertexCopyCount)
     {
       memcpy(dst, particleDst, elementByte);
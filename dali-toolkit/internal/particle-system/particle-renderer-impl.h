@@ -79,7 +79,14 @@ public:
 
   uint32_t OnStreamBufferUpdate(void* data, size_t size);
 
-  bool mUsingStreamDivisor{true}; ///< If attribute divisor is supported, it's going to be used
+  /**
+   * @brief Retrieves how many times the stream data of each particle is written to the stream buffer.
+   *
+   * @return 1 if the particles are drawn with instancing, or the number of vertices of a particle otherwise.
+   */
+  [[nodiscard]] uint32_t GetNumberOfRecordsPerParticle() const;
+
+  bool mUsingStreamDivisor{false}; ///< Whether the attribute divisor is used, decided when the shader is created
 
   Internal::ParticleEmitter* mEmitter{nullptr}; ///< Emitter implementation that uses the renderer
 
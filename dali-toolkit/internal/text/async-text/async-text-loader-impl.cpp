@@ -44,6 +44,12 @@ namespace
 {
 constexpr float MAX_FLOAT = std::numeric_limits<float>::max();
 
+/**
+ * The most sizes shaped in either direction when correcting the result of a scaled TextFit search.
+ * Hinting moves the size by a step at most in practice; past that, the minimum size is used.
+ */
+constexpr uint32_t MAX_TEXT_FIT_CORRECTION_STEPS = 2u;
+
 const float VERTICAL_ALIGNMENT_TABLE[Text::VerticalAlignment::BOTTOM + 1] =
   {
     0.0f, // VerticalAlignment::TOP
@@ -88,6 +94,8 @@ AsyncTextLoader::AsyncTextLoader()
   mMetrics(),
   mLocale(),
   mCustomFonts(),
+  mTextFitReferenceGlyphs(),
+  mTextFitReferencePointSize(0.0f),
   mNumberOfCharacters(0u),
   mFitActualEllipsis(true),
   mIsTextDirectionRTL(false),
@@ -1505,6 +1513,59 @@ bool AsyncTextLoader::CheckForTextFit(AsyncTextParameters& parameters, float poi
   return true;
 }
 
+bool AsyncTextLoader::PrepareTextFitReference(AsyncTextParameters& parameters, float pointSize)
+{
+  DALI_TRACE_SCOPE(gTraceFilter, "DALI_TEXT_ASYNC_PREPARE_TEXT_FIT");
+
+  parameters.fontSize = pointSize;
+
+  Initialize();
+  Update(parameters);
+
+  // The sizes given in the markup and the embedded items don't follow the point size.
+  for(const auto& fontDescriptionRun : mTextModel->mLogicalModel->mFontDescriptionRuns)
+  {
+    if(fontDescriptionRun.sizeDefined)
+    {
+      return false;
+    }
+  }
+  if(!mTextModel->mLogicalModel->mEmbeddedItems.Empty())
+  {
+    return false;
+  }
+
+  mTextFitReferenceGlyphs    = mTextModel->mVisualModel->mGlyphs;
+  mTextFitReferencePointSize = pointSize;
+  return true;
+}
+
+bool AsyncTextLoader::CheckForTextFitScaled(AsyncTextParameters& parameters, float pointSize, const Size& allowedSize)
+{
+  parameters.fontSize = pointSize;
+
+  // Scale the reference glyphs instead of shaping the text again. Only the lines are broken again.
+  const float scale = pointSize / mTextFitReferencePointSize;
+
+  Vector<GlyphInfo>& glyphs = mTextModel->mVisualModel->mGlyphs;
+  glyphs                    = mTextFitReferenceGlyphs;
+  for(auto& glyph : glyphs)
+  {
+    Metrics::ScaleGlyphMetrics(glyph, scale);
+  }
+
+  mMetrics->SetMetricsScale(scale);
+  bool layoutUpdated = false;
+  Size layoutSize    = Layout(parameters, layoutUpdated);
+  mMetrics->SetMetricsScale(1.0f);
+
+  if(!layoutUpdated || layoutSize.width > allowedSize.width || layoutSize.height > allowedSize.height)
+  {
+    return false;
+  }
+  return true;
+}
+
 AsyncTextRenderInfo AsyncTextLoader::RenderTextFit(AsyncTextParameters& parameters, bool useCachedNaturalSize, const Size& naturalSize)
 {
   Size textNaturalSize   = naturalSize;
@@ -1586,9 +1647,17 @@ AsyncTextRenderInfo AsyncTextLoader::RenderTextFit(AsyncTextParameters& paramete
     // If the search does not find an optimal value, the minimum PointSize will be used to text fit.
     DevelTextLabel::FitOption firstOption           = fitOptions.front();
     bool                      bestSizeUpdatedLatest = false;
+    int                       bestIndex             = 0;
     float                     bestPointSize         = firstOption.GetPointSize();
     float                     bestMinLineSize       = firstOption.GetMinLineSize();
 
+    // Shape the text once at the largest point size. The search only breaks the scaled glyphs into lines.
+    const bool scaledSearch   = PrepareTextFitReference(parameters, fitOptions.back().GetPointSize());
+    auto       checkForFitted = [&](float testPointSize) -> bool
+    {
+      return scaledSearch ? CheckForTextFitScaled(parameters, testPointSize, allowedSize) : CheckForTextFit(parameters, testPointSize, allowedSize);
+    };
+
     if(binarySearch)
     {
       int left  = 0u;
@@ -1602,9 +1671,10 @@ AsyncTextRenderInfo AsyncTextLoader::RenderTextFit(AsyncTextParameters& paramete
         float                     testMinLineSize = option.GetMinLineSize();
         parameters.minLineSize                    = testMinLineSize;
 
-        if(CheckForTextFit(parameters, testPointSize, allowedSize))
+        if(checkForFitted(testPointSize))
         {
           bestSizeUpdatedLatest = true;
+          bestIndex             = mid;
           bestPointSize         = testPointSize;
           bestMinLineSize       = testMinLineSize;
           left                  = mid + 1;
@@ -1619,16 +1689,17 @@ AsyncTextRenderInfo AsyncTextLoader::RenderTextFit(AsyncTextParameters& paramete
     else
     {
       // If binary search is not possible, search sequentially starting from the largest PointSize.
-      for(auto it = fitOptions.rbegin(); it != fitOptions.rend(); ++it)
+      for(int index = numberOfFitOptions - 1; index >= 0; --index)
       {
-        DevelTextLabel::FitOption option          = *it;
+        DevelTextLabel::FitOption option          = fitOptions[index];
         float                     testPointSize   = option.GetPointSize();
         float                     testMinLineSize = option.GetMinLineSize();
         parameters.minLineSize                    = testMinLineSize;
 
-        if(CheckForTextFit(parameters, testPointSize, allowedSize))
+        if(checkForFitted(testPointSize))
         {
           bestSizeUpdatedLatest = true;
+          bestIndex             = index;
           bestPointSize         = testPointSize;
           bestMinLineSize       = testMinLineSize;
           break;
@@ -1640,6 +1711,50 @@ AsyncTextRenderInfo AsyncTextLoader::RenderTextFit(AsyncTextParameters& paramete
       }
     }
 
+    if(scaledSearch)
+    {
+      // Shape the text at the best size, as hinting may make it a little larger or smaller than the scaled glyphs.
+      // If it doesn't fit, try a few smaller options. Otherwise, try a few larger options while they still fit.
+      parameters.minLineSize = bestMinLineSize;
+      bool     fitted        = CheckForTextFit(parameters, bestPointSize, allowedSize);
+      uint32_t steps         = 0u;
+      if(fitted)
+      {
+        while(bestIndex < numberOfFitOptions - 1 && steps++ < MAX_TEXT_FIT_CORRECTION_STEPS)
+        {
+          const DevelTextLabel::FitOption& nextOption = fitOptions[bestIndex + 1];
+          parameters.minLineSize                      = nextOption.GetMinLineSize();
+          fitted                                      = CheckForTextFit(parameters, nextOption.GetPointSize(), allowedSize);
+          if(!fitted)
+          {
+            break;
+          }
+          ++bestIndex;
+          bestPointSize   = nextOption.GetPointSize();
+          bestMinLineSize = nextOption.GetMinLineSize();
+        }
+      }
+      else
+      {
+        while(!fitted && bestIndex > 0 && steps++ < MAX_TEXT_FIT_CORRECTION_STEPS)
+        {
+          --bestIndex;
+          bestPointSize          = fitOptions[bestIndex].GetPointSize();
+          bestMinLineSize        = fitOptions[bestIndex].GetMinLineSize();
+          parameters.minLineSize = bestMinLineSize;
+          fitted                 = CheckForTextFit(parameters, bestPointSize, allowedSize);
+        }
+        if(!fitted)
+        {
+          // Still too large; fall back to the minimum option, laid out below.
+          bestIndex       = 0;
+          bestPointSize   = firstOption.GetPointSize();
+          bestMinLineSize = firstOption.GetMinLineSize();
+        }
+      }
+      bestSizeUpdatedLatest = fitted;
+    }
+
     // Best point size was not updated. re-run so the TextFit should be fitted really.
     if(!bestSizeUpdatedLatest)
     {
@@ -1688,6 +1803,10 @@ AsyncTextRenderInfo AsyncTextLoader::RenderTextFit(AsyncTextParameters& paramete
     uint32_t maxIndex      = pointSizeRange + 1u;
 
     bool bestSizeUpdatedLatest = false;
+
+    // Shape the text once at the maximum point size. The search only breaks the scaled glyphs into lines.
+    const bool scaledSearch = PrepareTextFitReference(parameters, maxPointSize);
+
     // Find best size as binary search.
     // Range format as [l r). (left closed, right opened)
     // It mean, we already check all i < l is valid, and r <= i is invalid.
@@ -1701,7 +1820,7 @@ AsyncTextRenderInfo AsyncTextLoader::RenderTextFit(AsyncTextParameters& paramete
       uint32_t    testIndex     = minIndex + ((maxIndex - minIndex) >> 1u);
       const float testPointSize = Min(maxPointSize, minPointSize + static_cast<float>(testIndex) * pointInterval);
 
-      if(CheckForTextFit(parameters, testPointSize, allowedSize))
+      if(scaledSearch ? CheckForTextFitScaled(parameters, testPointSize, allowedSize) : CheckForTextFit(parameters, testPointSize, allowedSize))
       {
         bestSizeUpdatedLatest = true;
 
@@ -1716,6 +1835,44 @@ AsyncTextRenderInfo AsyncTextLoader::RenderTextFit(AsyncTextParameters& paramete
     }
     bestPointSize = Min(maxPointSize, minPointSize + static_cast<float>(bestSizeIndex) * pointInterval);
 
+    if(scaledSearch)
+    {
+      // Shape the text at the best size, as hinting may make it a little larger or smaller than the scaled glyphs.
+      // If it doesn't fit, step down a few sizes. Otherwise, step up a few sizes while they still fit.
+      bool     fitted = CheckForTextFit(parameters, bestPointSize, allowedSize);
+      uint32_t steps  = 0u;
+      if(fitted)
+      {
+        while(bestSizeIndex < pointSizeRange && steps++ < MAX_TEXT_FIT_CORRECTION_STEPS)
+        {
+          const float nextPointSize = Min(maxPointSize, minPointSize + static_cast<float>(bestSizeIndex + 1u) * pointInterval);
+          fitted                    = CheckForTextFit(parameters, nextPointSize, allowedSize);
+          if(!fitted)
+          {
+            break;
+          }
+          ++bestSizeIndex;
+          bestPointSize = nextPointSize;
+        }
+      }
+      else
+      {
+        while(!fitted && bestSizeIndex > 0u && steps++ < MAX_TEXT_FIT_CORRECTION_STEPS)
+        {
+          --bestSizeIndex;
+          bestPointSize = Min(maxPointSize, minPointSize + static_cast<float>(bestSizeIndex) * pointInterval);
+          fitted        = CheckForTextFit(parameters, bestPointSize, allowedSize);
+        }
+        if(!fitted)
+        {
+          // Still too large; fall back to the minimum size, laid out below.
+          bestSizeIndex = 0u;
+          bestPointSize = Min(maxPointSize, minPointSize);
+        }
+      }
+      bestSizeUpdatedLatest = fitted;
+    }
+
     // Best point size was not updated. re-run so the TextFit should be fitted really.
     if(!bestSizeUpdatedLatest)
     {
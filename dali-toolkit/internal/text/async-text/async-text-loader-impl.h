@@ -199,6 +199,29 @@ private:
    */
   bool CheckForTextFit(AsyncTextParameters& parameters, float pointSize, const Size& allowedSize);
 
+  /**
+   * @brief Shapes the text at a reference point size, so that the text fit search can lay it out at other sizes without shaping it again.
+   *
+   * @param[in] parameters Parameters of the text to check text fit.
+   * @param[in] pointSize The reference point size.
+   *
+   * @return True if the shaped text can be scaled. False if a part of the text has a size that doesn't follow the point size, e.g. a font size in the markup.
+   */
+  bool PrepareTextFitReference(AsyncTextParameters& parameters, float pointSize);
+
+  /**
+   * @brief Check if the text fits, by scaling the glyphs shaped by PrepareTextFitReference() and laying them out again.
+   *
+   * The glyph metrics are scaled linearly, so the result may differ by a pixel from the one of CheckForTextFit() where hinting differs.
+   *
+   * @param[in] parameters Parameters of the text to check text fit.
+   * @param[in] pointSize The point size of the text to check text fit.
+   * @param[in] allowedSize The size of the layout to check text fit.
+   *
+   * @return True if the size of the scaled layout fits, otherwise false.
+   */
+  bool CheckForTextFitScaled(AsyncTextParameters& parameters, float pointSize, const Size& allowedSize);
+
 private:
   /**
    * private method
@@ -225,6 +248,9 @@ private:
 
   TextAbstraction::FontPathList mCustomFonts;
 
+  Vector<GlyphInfo> mTextFitReferenceGlyphs;    ///< The glyphs shaped at the reference point size of the text fit search.
+  float             mTextFitReferencePointSize; ///< The reference point size of the text fit search.
+
   Length mNumberOfCharacters;
   bool   mFitActualEllipsis : 1;  // Used to store actual ellipses during TextFit calculations. Do not use it in other sections.
   bool   mIsTextDirectionRTL : 1; // The direction of the first line after layout completion.
@@ -21,6 +21,9 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/shaping-cache.h>
+
 namespace Dali
 {
 namespace Toolkit
@@ -54,12 +57,15 @@ AsyncTextModule::AsyncTextModule()
 
 AsyncTextModule::~AsyncTextModule()
 {
+  // Another font client may be created at the same address, so the runs of this one are discarded.
+  ShapingCache::Get().Clear(mFontClient);
 }
 
 void AsyncTextModule::ClearCache()
 {
   mFontClient.ClearCacheOnLocaleChanged();
   mMultilanguageSupport.ClearCache();
+  ShapingCache::Get().Clear(mFontClient);
 }
 
 TextAbstraction::BidirectionalSupport& AsyncTextModule::GetBidirectionalSupport()
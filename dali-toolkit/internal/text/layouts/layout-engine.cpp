@@ -23,6 +23,7 @@
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/common/dali-utility.h>
 #include <cmath>
+#include <cstring>
 #include <limits>
 
 // INTERNAL INCLUDES
@@ -30,6 +31,7 @@
 #include <dali-toolkit/internal/text/cursor-helper-functions.h>
 #include <dali-toolkit/internal/text/glyph-metrics-helper.h>
 #include <dali-toolkit/internal/text/layouts/layout-engine-helper-functions.h>
+#include <dali-toolkit/internal/text/layouts/layout-paragraph-cache.h>
 #include <dali-toolkit/internal/text/layouts/layout-parameters.h>
 #include <dali-toolkit/internal/text/rendering/styles/character-spacing-helper-functions.h>
 
@@ -179,7 +181,8 @@ struct Engine::Impl
     mDefaultLineSize{MIN_LINE_SIZE},
     mRelativeLineSize{GetDefaultRelativeLineSize()},
     mPixelSize{DEFAULT_FONT_PIXEL_SIZE},
-    mIsCursorInsetEnabled{true}
+    mIsCursorInsetEnabled{true},
+    mIsParagraphCacheEnabled{true}
   {
   }
 
@@ -1718,6 +1721,169 @@ struct Engine::Impl
     return false;
   }
 
+  /**
+   * @brief Whether the layout of whole paragraphs can be copied from, and stored into, the paragraph cache.
+   *
+   * Only a multi-line text laid-out from scratch is cached. Paragraphs whose layout depends on more than their own glyphs
+   * (i.e. ellipsis, bidirectional reordering, hyphenation, bounded paragraphs or character spacing runs) are laid-out as usual.
+   *
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   * @param[in] updateCurrentBuffer Whether the layout is updated.
+   * @param[in] elideTextEnabled Whether the text elide is enabled.
+   * @param[in] isHiddenInputEnabled Whether the hidden input is enabled.
+   *
+   * @return @e true if the paragraph cache can be used.
+   */
+  bool IsParagraphCacheUsable(const Parameters& layoutParameters,
+                              bool              updateCurrentBuffer,
+                              bool              elideTextEnabled,
+                              bool              isHiddenInputEnabled) const
+  {
+    const ModelPtr& textModel = layoutParameters.textModel;
+
+    return mIsParagraphCacheEnabled &&
+           !updateCurrentBuffer &&
+           !elideTextEnabled &&
+           !isHiddenInputEnabled &&
+           (mLayout == MULTI_LINE_BOX) &&
+           textModel->mLogicalModel->mBidirectionalParagraphInfo.Empty() &&
+           textModel->GetBoundedParagraphRuns().Empty() &&
+           textModel->mVisualModel->GetCharacterSpacingGlyphRuns().Empty() &&
+           (textModel->mLineWrapMode != (Text::LineWrap::Mode)DevelText::LineWrap::HYPHENATION) &&
+           (textModel->mLineWrapMode != (Text::LineWrap::Mode)DevelText::LineWrap::MIXED);
+  }
+
+  /**
+   * @brief Calculates a hash of the settings that affect the layout of every paragraph.
+   *
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   *
+   * @return The hash.
+   */
+  uint64_t CalculateParagraphCacheSettingsKey(const Parameters& layoutParameters) const
+  {
+    const ModelPtr& textModel = layoutParameters.textModel;
+
+    uint64_t key = ParagraphLayoutCache::INITIAL_HASH;
+    ParagraphLayoutCache::Combine(key, layoutParameters.boundingBox.width);
+    ParagraphLayoutCache::Combine(key, layoutParameters.interGlyphExtraAdvance);
+    ParagraphLayoutCache::Combine(key, static_cast<uint32_t>(mLayout));
+    ParagraphLayoutCache::Combine(key, mCursorWidth);
+    ParagraphLayoutCache::Combine(key, static_cast<uint32_t>(mIsCursorInsetEnabled));
+    ParagraphLayoutCache::Combine(key, mDefaultLineSpacing);
+    ParagraphLayoutCache::Combine(key, mDefaultLineSize);
+    ParagraphLayoutCache::Combine(key, mRelativeLineSize);
+    ParagraphLayoutCache::Combine(key, mPixelSize);
+    ParagraphLayoutCache::Combine(key, static_cast<uint32_t>(TextAbstraction::DesignCompatibilityEnabled()));
+    ParagraphLayoutCache::Combine(key, static_cast<uint32_t>(textModel->GetOutlineWidth()));
+    ParagraphLayoutCache::Combine(key, textModel->mVisualModel->GetCharacterSpacing());
+    ParagraphLayoutCache::Combine(key, static_cast<uint32_t>(textModel->mLineWrapMode));
+    ParagraphLayoutCache::Combine(key, static_cast<uint32_t>(textModel->mRemoveFrontInset) | (static_cast<uint32_t>(textModel->mRemoveBackInset) << 1u));
+
+    return key;
+  }
+
+  /**
+   * @brief Retrieves the paragraph that starts with the given glyph.
+   *
+   * The last paragraph of the text is never retrieved, as its layout depends on whether it's the last one.
+   *
+   * @param[in] layoutParameters The parameters needed to layout the text.
+   * @param[in] glyphIndex The glyph index.
+   * @param[out] characterRun The paragraph's characters.
+   * @param[out] glyphRun The paragraph's glyphs.
+   *
+   * @return @e true if a whole paragraph, which is not the last one, starts with the given glyph.
+   */
+  bool GetParagraphStartingAt(const Parameters& layoutParameters,
+                              GlyphIndex        glyphIndex,
+                              CharacterRun&     characterRun,
+                              GlyphRun&         glyphRun) const
+  {
+    const Vector<Character>& text                     = layoutParameters.textModel->mLogicalModel->mText;
+    const Character* const   textBuffer               = text.Begin();
+    const GlyphIndex* const  charactersToGlyphBuffer  = layoutParameters.textModel->mVisualModel->mCharactersToGlyph.Begin();
+    const Length* const      glyphsPerCharacterBuffer = layoutParameters.textModel->mVisualModel->mGlyphsPerCharacter.Begin();
+
+    const CharacterIndex characterIndex = *(layoutParameters.textModel->mVisualModel->mGlyphsToCharacters.Begin() + glyphIndex);
+    if((*(charactersToGlyphBuffer + characterIndex) != glyphIndex) ||
+       ((0u != characterIndex) && !TextAbstraction::IsNewParagraph(*(textBuffer + characterIndex - 1u))))
+    {
+      return false;
+    }
+
+    const Length   numberOfCharacters = text.Count();
+    CharacterIndex lastCharacterIndex = characterIndex;
+    while((lastCharacterIndex < numberOfCharacters) && !TextAbstraction::IsNewParagraph(*(textBuffer + lastCharacterIndex)))
+    {
+      ++lastCharacterIndex;
+    }
+
+    if(lastCharacterIndex + 1u >= numberOfCharacters)
+    {
+      // The last paragraph.
+      return false;
+    }
+
+    characterRun.characterIndex     = characterIndex;
+    characterRun.numberOfCharacters = lastCharacterIndex + 1u - characterIndex;
+    glyphRun.glyphIndex             = glyphIndex;
+    glyphRun.numberOfGlyphs         = *(charactersToGlyphBuffer + lastCharacterIndex) + *(glyphsPerCharacterBuffer + lastCharacterIndex) - glyphIndex;
+
+    return 0u != glyphRun.numberOfGlyphs;
+  }
+
+  /**
+   * @brief Stores the layout of a paragraph in the paragraph cache.
+   *
+   * @param[in] textModel The text's model.
+   * @param[in] key The key of the paragraph.
+   * @param[in] characterRun The paragraph's characters.
+   * @param[in] glyphRun The paragraph's glyphs.
+   * @param[in] linesBuffer Pointer to the paragraph's first line.
+   * @param[in] numberOfLines The number of lines of the paragraph.
+   * @param[in] glyphPositionsBuffer Pointer to the position of the paragraph's first glyph.
+   * @param[in] penYAdvance How far the paragraph moved the vertical pen.
+   */
+  void StoreParagraph(const ModelPtr&     textModel,
+                      uint64_t            key,
+                      const CharacterRun& characterRun,
+                      const GlyphRun&     glyphRun,
+                      const LineRun*      linesBuffer,
+                      Length              numberOfLines,
+                      const Vector2*      glyphPositionsBuffer,
+                      float               penYAdvance)
+  {
+    ParagraphLayoutCache::Entry entry;
+    entry.penYAdvance = penYAdvance;
+
+    entry.lines.Resize(numberOfLines);
+    for(Length lineIndex = 0u; lineIndex < numberOfLines; ++lineIndex)
+    {
+      LineRun& lineRun = entry.lines[lineIndex];
+
+      lineRun = *(linesBuffer + lineIndex);
+      lineRun.glyphRun.glyphIndex -= glyphRun.glyphIndex;
+      lineRun.characterRun.characterIndex -= characterRun.characterIndex;
+      if(lineRun.isSplitToTwoHalves)
+      {
+        lineRun.glyphRunSecondHalf.glyphIndex -= glyphRun.glyphIndex;
+        lineRun.characterRunForSecondHalfLine.characterIndex -= characterRun.characterIndex;
+      }
+    }
+
+    entry.glyphPositions.Resize(glyphRun.numberOfGlyphs);
+    memcpy(entry.glyphPositions.Begin(), glyphPositionsBuffer, glyphRun.numberOfGlyphs * sizeof(Vector2));
+
+    mParagraphCache.Add(key,
+                        textModel,
+                        characterRun.characterIndex,
+                        characterRun.numberOfCharacters,
+                        glyphRun.glyphIndex,
+                        glyphRun.numberOfGlyphs,
+                        std::move(entry));
+  }
+
   bool LayoutText(Parameters&                       layoutParameters,
                   Size&                             layoutSize,
                   bool                              elideTextEnabled,
@@ -1839,8 +2005,91 @@ struct Engine::Impl
     float penY            = CalculateLineOffset(lines,
                                                 layoutParameters.startLineIndex);
     bool  anyLineIsEliped = false;
+
+    // Unchanged paragraphs are copied from the cache when the whole text is laid-out again.
+    const bool useParagraphCache = IsParagraphCacheUsable(layoutParameters, updateCurrentBuffer, elideTextEnabled, isHiddenInputEnabled);
+    if(useParagraphCache)
+    {
+      mParagraphCache.Begin(CalculateParagraphCacheSettingsKey(layoutParameters));
+    }
+
+    // The paragraph being laid-out, to be stored in the cache.
+    CharacterRun paragraphCharacterRun;
+    GlyphRun     paragraphGlyphRun;
+    uint64_t     paragraphKey       = 0u;
+    Length       paragraphFirstLine = 0u;
+    float        paragraphPenY      = 0.f;
+    bool         isParagraphStored  = false;
+
     for(GlyphIndex index = layoutParameters.startGlyphIndex; index < lastGlyphPlusOne;)
     {
+      if(useParagraphCache &&
+         !isParagraphStored &&
+         GetParagraphStartingAt(layoutParameters, index, paragraphCharacterRun, paragraphGlyphRun))
+      {
+        paragraphKey = mParagraphCache.CalculateKey(layoutParameters.textModel,
+                                                    paragraphCharacterRun.characterIndex,
+                                                    paragraphCharacterRun.numberOfCharacters,
+                                                    paragraphGlyphRun.glyphIndex,
+                                                    paragraphGlyphRun.numberOfGlyphs);
+
+        const ParagraphLayoutCache::Entry* const cachedParagraph = mParagraphCache.Find(paragraphKey,
+                                                                                        layoutParameters.textModel,
+                                                                                        paragraphCharacterRun.characterIndex,
+                                                                                        paragraphCharacterRun.numberOfCharacters,
+                                                                                        paragraphGlyphRun.glyphIndex,
+                                                                                        paragraphGlyphRun.numberOfGlyphs);
+        if(nullptr != cachedParagraph)
+        {
+          while(numberOfLines + cachedParagraph->lines.Count() > linesCapacity)
+          {
+            // Reserve more space for the next lines.
+            linesBuffer = ResizeLinesBuffer(lines,
+                                            newLines,
+                                            linesCapacity,
+                                            updateCurrentBuffer);
+          }
+
+          for(Vector<LineRun>::ConstIterator it    = cachedParagraph->lines.Begin(),
+                                             endIt = cachedParagraph->lines.End();
+              it != endIt;
+              ++it)
+          {
+            LineRun& lineRun = *(linesBuffer + numberOfLines);
+            ++numberOfLines;
+
+            lineRun = *it;
+            lineRun.glyphRun.glyphIndex += paragraphGlyphRun.glyphIndex;
+            lineRun.characterRun.characterIndex += paragraphCharacterRun.characterIndex;
+            if(lineRun.isSplitToTwoHalves)
+            {
+              lineRun.glyphRunSecondHalf.glyphIndex += paragraphGlyphRun.glyphIndex;
+              lineRun.characterRunForSecondHalfLine.characterIndex += paragraphCharacterRun.characterIndex;
+            }
+
+            // Update the actual size.
+            if(lineRun.width > layoutSize.width)
+            {
+              layoutSize.width = lineRun.width;
+            }
+
+            layoutSize.height += GetLineHeight(lineRun, false);
+          }
+
+          memcpy(glyphPositionsBuffer + (paragraphGlyphRun.glyphIndex - layoutParameters.startGlyphIndex),
+                 cachedParagraph->glyphPositions.Begin(),
+                 cachedParagraph->glyphPositions.Count() * sizeof(Vector2));
+
+          penY += cachedParagraph->penYAdvance;
+          index += paragraphGlyphRun.numberOfGlyphs;
+          continue;
+        }
+
+        isParagraphStored  = true;
+        paragraphFirstLine = numberOfLines;
+        paragraphPenY      = penY;
+      }
+
       layoutBidiParameters.Clear();
 
       if(hasBidiParagraphs)
@@ -2090,9 +2339,30 @@ struct Engine::Impl
 
         // Increase the glyph index.
         index = nextIndex;
+
+        if(isParagraphStored && (index >= paragraphGlyphRun.glyphIndex + paragraphGlyphRun.numberOfGlyphs))
+        {
+          if(index == paragraphGlyphRun.glyphIndex + paragraphGlyphRun.numberOfGlyphs)
+          {
+            StoreParagraph(layoutParameters.textModel,
+                           paragraphKey,
+                           paragraphCharacterRun,
+                           paragraphGlyphRun,
+                           linesBuffer + paragraphFirstLine,
+                           numberOfLines - paragraphFirstLine,
+                           glyphPositionsBuffer + (paragraphGlyphRun.glyphIndex - layoutParameters.startGlyphIndex),
+                           penY - paragraphPenY);
+          }
+          isParagraphStored = false;
+        }
       } // no ellipsis
     } // end for() traversing glyphs.
 
+    if(useParagraphCache)
+    {
+      mParagraphCache.End();
+    }
+
     //Shift lines to up if ellipsis and multilines and set ellipsis of first line to true
     if(anyLineIsEliped && numberOfLines > 1u)
     {
@@ -2354,7 +2624,9 @@ struct Engine::Impl
   IntrusivePtr<Metrics> mMetrics;
   float                 mRelativeLineSize;
   float                 mPixelSize;
+  ParagraphLayoutCache  mParagraphCache;
   bool                  mIsCursorInsetEnabled : 1;
+  bool                  mIsParagraphCacheEnabled : 1;
 };
 
 Engine::Engine()
@@ -2470,6 +2742,25 @@ void Engine::SetFontPixelSize(float pixelSize)
   mImpl->mPixelSize = pixelSize;
 }
 
+void Engine::SetParagraphCacheEnabled(bool enabled)
+{
+  mImpl->mIsParagraphCacheEnabled = enabled;
+  if(!enabled)
+  {
+    mImpl->mParagraphCache.Clear();
+  }
+}
+
+bool Engine::IsParagraphCacheEnabled() const
+{
+  return mImpl->mIsParagraphCacheEnabled;
+}
+
+uint32_t Engine::GetParagraphCacheHitCount() const
+{
+  return mImpl->mParagraphCache.GetHitCount();
+}
+
 } // namespace Layout
 
 } // namespace Text
@@ -198,6 +198,29 @@ public:
    */
   void SetFontPixelSize(float pixelSize);
 
+  /**
+   * @brief Sets whether the layout of unchanged paragraphs is reused when the whole text is laid-out again.
+   *
+   * It's enabled by default. Disabling it discards the cached layouts.
+   *
+   * @param[in] enabled Whether the paragraph cache is enabled.
+   */
+  void SetParagraphCacheEnabled(bool enabled);
+
+  /**
+   * @brief Whether the layout of unchanged paragraphs is reused.
+   *
+   * @return @e true if the paragraph cache is enabled.
+   */
+  bool IsParagraphCacheEnabled() const;
+
+  /**
+   * @brief Retrieves the number of paragraphs whose layout has been reused.
+   *
+   * @return The number of paragraph cache hits.
+   */
+  uint32_t GetParagraphCacheHitCount() const;
+
 private:
   // Undefined
   Engine(const Engine& handle);
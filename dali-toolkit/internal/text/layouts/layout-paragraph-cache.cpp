@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/text/layouts/layout-paragraph-cache.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace Layout
+{
+namespace
+{
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+/**
+ * @brief Whether a buffer holds the same values as a vector.
+ */
+template<typename T>
+bool IsSame(const Vector<T>& vector, const T* const buffer, Length count)
+{
+  return (vector.Count() == count) && (0 == memcmp(vector.Begin(), buffer, count * sizeof(T)));
+}
+
+/**
+ * @brief Whether two glyphs are the same for the layout, comparing the fields hashed by ParagraphLayoutCache::CalculateKey().
+ */
+bool IsSameGlyph(const GlyphInfo& lhs, const GlyphInfo& rhs)
+{
+  return (lhs.index == rhs.index) &&
+         (lhs.fontId == rhs.fontId) &&
+         (lhs.width == rhs.width) &&
+         (lhs.height == rhs.height) &&
+         (lhs.xBearing == rhs.xBearing) &&
+         (lhs.yBearing == rhs.yBearing) &&
+         (lhs.advance == rhs.advance) &&
+         (lhs.isItalicRequired == rhs.isItalicRequired) &&
+         (lhs.isBoldRequired == rhs.isBoldRequired);
+}
+
+/**
+ * @brief Copies a buffer into a vector.
+ */
+template<typename T>
+void Copy(Vector<T>& vector, const T* const buffer, Length count)
+{
+  vector.Resize(count);
+  memcpy(vector.Begin(), buffer, count * sizeof(T));
+}
+} // namespace
+
+void ParagraphLayoutCache::Combine(uint64_t& hash, uint32_t value)
+{
+  for(uint32_t byte = 0u; byte < sizeof(value); ++byte)
+  {
+    hash ^= (value >> (byte * 8u)) & 0xFFu;
+    hash *= FNV_PRIME;
+  }
+}
+
+void ParagraphLayoutCache::Combine(uint64_t& hash, float value)
+{
+  uint32_t bits;
+  static_assert(sizeof(bits) == sizeof(value));
+  memcpy(&bits, &value, sizeof(bits));
+  Combine(hash, bits);
+}
+
+void ParagraphLayoutCache::Begin(uint64_t settingsKey)
+{
+  if(settingsKey != mSettingsKey)
+  {
+    mEntries.clear();
+    mSettingsKey = settingsKey;
+  }
+  ++mGeneration;
+}
+
+void ParagraphLayoutCache::End()
+{
+  for(auto it = mEntries.begin(); it != mEntries.end();)
+  {
+    if(it->second.generation != mGeneration)
+    {
+      it = mEntries.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+uint64_t ParagraphLayoutCache::CalculateKey(const ModelPtr& textModel,
+                                            CharacterIndex  characterIndex,
+                                            Length          numberOfCharacters,
+                                            GlyphIndex      glyphIndex,
+                                            Length          numberOfGlyphs) const
+{
+  const Character* const     textBuffer               = textModel->mLogicalModel->mText.Begin() + characterIndex;
+  const LineBreakInfo* const lineBreakInfoBuffer      = textModel->mLogicalModel->mLineBreakInfo.Begin() + characterIndex;
+  const Length* const        glyphsPerCharacterBuffer = textModel->mVisualModel->mGlyphsPerCharacter.Begin() + characterIndex;
+  const GlyphInfo* const     glyphsBuffer             = textModel->mVisualModel->mGlyphs.Begin() + glyphIndex;
+  const Length* const        charactersPerGlyphBuffer = textModel->mVisualModel->mCharactersPerGlyph.Begin() + glyphIndex;
+
+  uint64_t hash = INITIAL_HASH;
+  Combine(hash, numberOfCharacters);
+  Combine(hash, numberOfGlyphs);
+
+  for(Length index = 0u; index < numberOfCharacters; ++index)
+  {
+    Combine(hash, static_cast<uint32_t>(*(textBuffer + index)));
+    Combine(hash, static_cast<uint32_t>(*(lineBreakInfoBuffer + index)));
+    Combine(hash, *(glyphsPerCharacterBuffer + index));
+  }
+
+  for(Length index = 0u; index < numberOfGlyphs; ++index)
+  {
+    const GlyphInfo& glyph = *(glyphsBuffer + index);
+    Combine(hash, glyph.index);
+    Combine(hash, glyph.fontId);
+    Combine(hash, glyph.width);
+    Combine(hash, glyph.height);
+    Combine(hash, glyph.xBearing);
+    Combine(hash, glyph.yBearing);
+    Combine(hash, glyph.advance);
+    Combine(hash, static_cast<uint32_t>(glyph.isItalicRequired) | (static_cast<uint32_t>(glyph.isBoldRequired) << 1u));
+    Combine(hash, *(charactersPerGlyphBuffer + index));
+  }
+
+  return hash;
+}
+
+const ParagraphLayoutCache::Entry* ParagraphLayoutCache::Find(uint64_t        key,
+                                                               const ModelPtr& textModel,
+                                                               CharacterIndex  characterIndex,
+                                                               Length          numberOfCharacters,
+                                                               GlyphIndex      glyphIndex,
+                                                               Length          numberOfGlyphs)
+{
+  auto it = mEntries.find(key);
+  if(it == mEntries.end())
+  {
+    return nullptr;
+  }
+
+  // The hashes of two different paragraphs may collide, so the paragraph must be the one the entry was laid-out from.
+  Entry& entry = it->second;
+  if(!IsSame(entry.characters, textModel->mLogicalModel->mText.Begin() + characterIndex, numberOfCharacters) ||
+     !IsSame(entry.lineBreakInfo, textModel->mLogicalModel->mLineBreakInfo.Begin() + characterIndex, numberOfCharacters) ||
+     !IsSame(entry.glyphsPerCharacter, textModel->mVisualModel->mGlyphsPerCharacter.Begin() + characterIndex, numberOfCharacters) ||
+     !IsSame(entry.charactersPerGlyph, textModel->mVisualModel->mCharactersPerGlyph.Begin() + glyphIndex, numberOfGlyphs) ||
+     (entry.glyphs.Count() != numberOfGlyphs))
+  {
+    return nullptr;
+  }
+
+  const GlyphInfo* const glyphsBuffer = textModel->mVisualModel->mGlyphs.Begin() + glyphIndex;
+  for(Length index = 0u; index < numberOfGlyphs; ++index)
+  {
+    if(!IsSameGlyph(entry.glyphs[index], *(glyphsBuffer + index)))
+    {
+      return nullptr;
+    }
+  }
+
+  entry.generation = mGeneration;
+  ++mHitCount;
+  return &entry;
+}
+
+void ParagraphLayoutCache::Add(uint64_t        key,
+                               const ModelPtr& textModel,
+                               CharacterIndex  characterIndex,
+                               Length          numberOfCharacters,
+                               GlyphIndex      glyphIndex,
+                               Length          numberOfGlyphs,
+                               Entry&&         entry)
+{
+  Copy(entry.characters, textModel->mLogicalModel->mText.Begin() + characterIndex, numberOfCharacters);
+  Copy(entry.lineBreakInfo, textModel->mLogicalModel->mLineBreakInfo.Begin() + characterIndex, numberOfCharacters);
+  Copy(entry.glyphsPerCharacter, textModel->mVisualModel->mGlyphsPerCharacter.Begin() + characterIndex, numberOfCharacters);
+  Copy(entry.glyphs, textModel->mVisualModel->mGlyphs.Begin() + glyphIndex, numberOfGlyphs);
+  Copy(entry.charactersPerGlyph, textModel->mVisualModel->mCharactersPerGlyph.Begin() + glyphIndex, numberOfGlyphs);
+
+  entry.generation = mGeneration;
+  mEntries[key]    = std::move(entry);
+}
+
+void ParagraphLayoutCache::Clear()
+{
+  mEntries.clear();
+}
+
+Length ParagraphLayoutCache::GetCount() const
+{
+  return static_cast<Length>(mEntries.size());
+}
+
+Length ParagraphLayoutCache::GetHitCount() const
+{
+  return mHitCount;
+}
+
+} // namespace Layout
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
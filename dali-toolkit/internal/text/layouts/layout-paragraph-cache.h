@@ -0,0 +1,192 @@
+#ifndef DALI_TOOLKIT_TEXT_LAYOUT_PARAGRAPH_CACHE_H
+#define DALI_TOOLKIT_TEXT_LAYOUT_PARAGRAPH_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/vector2.h>
+#include <cstdint>
+#include <unordered_map>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/line-run.h>
+#include <dali-toolkit/internal/text/text-model.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace Layout
+{
+/**
+ * @brief Caches the laid-out lines and glyph positions of whole paragraphs.
+ *
+ * A paragraph is keyed on a hash of its characters, line break info and glyphs, combined with
+ * a hash of the layout settings. When a text is laid-out again, i.e. because the control's height
+ * changed or another paragraph was edited, unchanged paragraphs are copied from the cache instead
+ * of being laid-out glyph by glyph.
+ *
+ * An entry keeps a copy of the characters and glyphs it was laid-out from, which are compared
+ * on a hit, so two paragraphs whose hashes collide never share a layout.
+ *
+ * Lines don't store their vertical position, and glyph positions are relative to their line,
+ * so a cached paragraph can be reused at any vertical offset.
+ */
+class ParagraphLayoutCache
+{
+public:
+  struct Entry
+  {
+    Vector<LineRun> lines;                  ///< The paragraph's lines. Glyph and character indices are relative to the start of the paragraph.
+    Vector<Vector2> glyphPositions;         ///< The positions of the paragraph's glyphs.
+    float           penYAdvance{0.f};       ///< How far the paragraph moves the vertical pen.
+    uint32_t        generation{0u};         ///< The layout the entry was last used in.
+
+    Vector<Character>     characters;         ///< The paragraph's characters.
+    Vector<LineBreakInfo> lineBreakInfo;      ///< The line break info of the paragraph's characters.
+    Vector<Length>        glyphsPerCharacter; ///< The number of glyphs of each character.
+    Vector<GlyphInfo>     glyphs;             ///< The paragraph's glyphs.
+    Vector<Length>        charactersPerGlyph; ///< The number of characters of each glyph.
+  };
+
+  /**
+   * @brief Combines a value with a hash.
+   *
+   * @param[in,out] hash The hash.
+   * @param[in] value The value to add to the hash.
+   */
+  static void Combine(uint64_t& hash, uint32_t value);
+
+  /**
+   * @copydoc Combine(uint64_t&,uint32_t)
+   */
+  static void Combine(uint64_t& hash, float value);
+
+  static constexpr uint64_t INITIAL_HASH = 14695981039346656037ull; ///< FNV-1a offset basis
+
+  /**
+   * @brief Starts laying out the whole text.
+   *
+   * All entries are discarded if the settings have changed since the last layout.
+   *
+   * @param[in] settingsKey A hash of the settings that affect the layout of every paragraph.
+   */
+  void Begin(uint64_t settingsKey);
+
+  /**
+   * @brief Finishes laying out the whole text, discarding the entries of paragraphs that are no longer in it.
+   */
+  void End();
+
+  /**
+   * @brief Calculates the key of a paragraph.
+   *
+   * @param[in] textModel The text's model.
+   * @param[in] characterIndex The first character of the paragraph.
+   * @param[in] numberOfCharacters The number of characters of the paragraph.
+   * @param[in] glyphIndex The first glyph of the paragraph.
+   * @param[in] numberOfGlyphs The number of glyphs of the paragraph.
+   *
+   * @return The key.
+   */
+  uint64_t CalculateKey(const ModelPtr& textModel,
+                        CharacterIndex  characterIndex,
+                        Length          numberOfCharacters,
+                        GlyphIndex      glyphIndex,
+                        Length          numberOfGlyphs) const;
+
+  /**
+   * @brief Finds the layout of a paragraph.
+   *
+   * The layout is only returned if the entry was laid-out from the same characters and glyphs.
+   *
+   * @param[in] key The key of the paragraph.
+   * @param[in] textModel The text's model.
+   * @param[in] characterIndex The first character of the paragraph.
+   * @param[in] numberOfCharacters The number of characters of the paragraph.
+   * @param[in] glyphIndex The first glyph of the paragraph.
+   * @param[in] numberOfGlyphs The number of glyphs of the paragraph.
+   *
+   * @return The cached layout, or nullptr if there isn't one.
+   */
+  const Entry* Find(uint64_t        key,
+                    const ModelPtr& textModel,
+                    CharacterIndex  characterIndex,
+                    Length          numberOfCharacters,
+                    GlyphIndex      glyphIndex,
+                    Length          numberOfGlyphs);
+
+  /**
+   * @brief Adds the layout of a paragraph.
+   *
+   * The paragraph's characters and glyphs are copied into the entry, to be compared by Find().
+   *
+   * @param[in] key The key of the paragraph.
+   * @param[in] textModel The text's model.
+   * @param[in] characterIndex The first character of the paragraph.
+   * @param[in] numberOfCharacters The number of characters of the paragraph.
+   * @param[in] glyphIndex The first glyph of the paragraph.
+   * @param[in] numberOfGlyphs The number of glyphs of the paragraph.
+   * @param[in] entry The layout of the paragraph.
+   */
+  void Add(uint64_t        key,
+           const ModelPtr& textModel,
+           CharacterIndex  characterIndex,
+           Length          numberOfCharacters,
+           GlyphIndex      glyphIndex,
+           Length          numberOfGlyphs,
+           Entry&&         entry);
+
+  /**
+   * @brief Discards all the entries.
+   */
+  void Clear();
+
+  /**
+   * @brief Retrieves the number of cached paragraphs.
+   *
+   * @return The number of cached paragraphs.
+   */
+  Length GetCount() const;
+
+  /**
+   * @brief Retrieves the number of times a paragraph's layout has been found in the cache.
+   *
+   * @return The number of hits.
+   */
+  Length GetHitCount() const;
+
+private:
+  std::unordered_map<uint64_t, Entry> mEntries;
+  uint64_t                            mSettingsKey{0u};
+  uint32_t                            mGeneration{0u};
+  Length                              mHitCount{0u};
+};
+
+} // namespace Layout
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_LAYOUT_PARAGRAPH_CACHE_H
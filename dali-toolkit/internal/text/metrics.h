@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/intrusive-ptr.h>
 
 // INTERNAL INCLUDES
@@ -75,6 +76,15 @@ public:
   void GetFontMetrics(FontId fontId, FontMetrics& metrics)
   {
     GetFontClient().GetFontMetrics(fontId, metrics); // inline for performance
+
+    if(DALI_UNLIKELY(mMetricsScale != 1.0f))
+    {
+      metrics.ascender *= mMetricsScale;
+      metrics.descender *= mMetricsScale;
+      metrics.height *= mMetricsScale;
+      metrics.underlinePosition *= mMetricsScale;
+      metrics.underlineThickness *= mMetricsScale;
+    }
   }
 
   /**
@@ -88,7 +98,44 @@ public:
    */
   bool GetGlyphMetrics(GlyphInfo* array, uint32_t size)
   {
-    return GetFontClient().GetGlyphMetrics(array, size, mGlyphType, true); // inline for performance
+    const bool found = GetFontClient().GetGlyphMetrics(array, size, mGlyphType, true); // inline for performance
+
+    if(DALI_UNLIKELY(mMetricsScale != 1.0f))
+    {
+      for(uint32_t i = 0u; i < size; ++i)
+      {
+        ScaleGlyphMetrics(array[i], mMetricsScale);
+      }
+    }
+    return found;
+  }
+
+  /**
+   * @brief Sets the scale applied to the metrics returned by GetFontMetrics() and GetGlyphMetrics().
+   *
+   * It lets the text be laid out at another point size without shaping it again,
+   * e.g. while searching the point size that fits.
+   *
+   * @param[in] scale The scale of the metrics. 1.0f means no scale.
+   */
+  void SetMetricsScale(float scale)
+  {
+    mMetricsScale = scale;
+  }
+
+  /**
+   * @brief Scales the metrics of a glyph.
+   *
+   * @param[in,out] glyph The glyph to scale.
+   * @param[in] scale The scale.
+   */
+  static void ScaleGlyphMetrics(GlyphInfo& glyph, float scale)
+  {
+    glyph.xBearing *= scale;
+    glyph.yBearing *= scale;
+    glyph.width *= scale;
+    glyph.height *= scale;
+    glyph.advance *= scale;
   }
 
   /**
@@ -117,7 +164,8 @@ private:
    */
   Metrics(TextAbstraction::FontClient& fontClient)
   : mFontClient(fontClient),
-    mGlyphType(TextAbstraction::BITMAP_GLYPH)
+    mGlyphType(TextAbstraction::BITMAP_GLYPH),
+    mMetricsScale(1.0f)
   {
   }
 
@@ -125,7 +173,8 @@ private:
    * Constructor.
    */
   Metrics()
-  : mGlyphType(TextAbstraction::BITMAP_GLYPH)
+  : mGlyphType(TextAbstraction::BITMAP_GLYPH),
+    mMetricsScale(1.0f)
   {
   }
 
@@ -152,6 +201,7 @@ private:
 private:
   TextAbstraction::FontClient mFontClient;
   TextAbstraction::GlyphType  mGlyphType;
+  float                       mMetricsScale; ///< The scale applied to the returned metrics.
 };
 
 } // namespace Text
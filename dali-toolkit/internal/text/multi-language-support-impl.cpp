@@ -28,6 +28,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/emoji-helper.h>
 #include <dali-toolkit/internal/text/multi-language-helper-functions.h>
+#include <dali-toolkit/internal/text/shaping-cache.h>
 
 namespace Dali
 {
@@ -554,6 +555,9 @@ void MultilanguageSupport::OnLocaleChanged(std::string locale)
 {
   SetLocale(locale);
   ClearCache();
+
+  // The font ids of the font client may change when its cache is cleared.
+  ShapingCache::Get().Clear(TextAbstraction::FontClient::Get());
 }
 
 void MultilanguageSupport::ClearCache()
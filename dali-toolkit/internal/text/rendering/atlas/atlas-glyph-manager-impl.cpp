@@ -20,9 +20,13 @@
 // EXTERNAL INCLUDES
 #include <locale>
 
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
 #include <locale>
 
 namespace
@@ -31,6 +35,11 @@ namespace
 Debug::Filter* gLogFilter = Debug::Filter::New(Debug::Concise, true, "LOG_TEXT_RENDERING");
 #endif
 
+const char* DALI_TEXT_ATLAS_MEMORY_LIMIT_KB("DALI_TEXT_ATLAS_MEMORY_LIMIT_KB");
+const char* DALI_TEXT_ATLAS_PACKING_MODE("DALI_TEXT_ATLAS_PACKING_MODE");
+
+constexpr float COMPACTION_OCCUPANCY_THRESHOLD = 0.5f; ///< Atlases less used than this are drained by Compact()
+
 } // unnamed namespace
 
 namespace Dali
@@ -45,6 +54,22 @@ AtlasGlyphManager::AtlasGlyphManager()
   mAtlasManager = Dali::Toolkit::AtlasManager::New();
   mSampler      = Sampler::New();
   mSampler.SetFilterMode(FilterMode::LINEAR, FilterMode::LINEAR);
+
+  // Check environment variable for DALI_TEXT_ATLAS_MEMORY_LIMIT_KB
+  auto memoryLimitString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_TEXT_ATLAS_MEMORY_LIMIT_KB);
+  if(memoryLimitString)
+  {
+    mTextureMemoryLimit = static_cast<uint32_t>(std::max(0, std::atoi(memoryLimitString))) * 1024u;
+    DALI_LOG_RELEASE_INFO("Text atlas texture memory limit:%u\n", mTextureMemoryLimit);
+  }
+
+  // Check environment variable for DALI_TEXT_ATLAS_PACKING_MODE
+  auto packingModeString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_TEXT_ATLAS_PACKING_MODE);
+  if(packingModeString && std::string(packingModeString) == "SKYLINE")
+  {
+    mAtlasManager.SetPackingMode(Dali::Toolkit::AtlasManager::PACK_SKYLINE);
+    DALI_LOG_RELEASE_INFO("Text atlas packing mode:SKYLINE\n");
+  }
 }
 
 void AtlasGlyphManager::Add(const Text::GlyphInfo&                        glyph,
@@ -54,6 +79,11 @@ void AtlasGlyphManager::Add(const Text::GlyphInfo&                        glyph,
 {
   DALI_LOG_INFO(gLogFilter, Debug::General, "Added glyph, font: %d index: %d\n", glyph.fontId, glyph.index);
 
+  if(mTextureMemoryLimit)
+  {
+    MakeRoomForGlyph(bitmap);
+  }
+
   // If glyph added to an existing or new atlas then a new glyph record is required.
   // Check if an existing atlas will fit the image, create a new one if required.
   if(mAtlasManager.Add(bitmap, slot))
@@ -66,6 +96,12 @@ void AtlasGlyphManager::Add(const Text::GlyphInfo&                        glyph,
     mAtlasManager.SetTextures(slot.mAtlasId, textureSet);
   }
 
+  if(0u == slot.mImageId)
+  {
+    // The glyph didn't fit into any atlas, so there's nothing to record or reference
+    return;
+  }
+
   GlyphRecordEntry record;
   record.mIndex        = glyph.index;
   record.mImageId      = slot.mImageId;
@@ -98,6 +134,8 @@ void AtlasGlyphManager::Add(const Text::GlyphInfo&                        glyph,
     fontGlyphRecord.mGlyphRecords.PushBack(record);
     mFontGlyphRecords.push_back(fontGlyphRecord);
   }
+
+  ++mReferencedGlyphCounts[slot.mAtlasId];
 }
 
 void AtlasGlyphManager::GenerateMeshData(uint32_t                       imageId,
@@ -129,8 +167,14 @@ bool AtlasGlyphManager::IsCached(Text::FontId                                  f
            (glyphRecordIt->isItalic == style.isItalic) &&
            (glyphRecordIt->isBold == style.isBold))
         {
+          const uint32_t atlasId = mAtlasManager.GetAtlas(glyphRecordIt->mImageId);
+          if(mAtlasManager.IsAtlasDraining(atlasId))
+          {
+            continue; // Being compacted; the glyph will be added again to another atlas
+          }
+
           slot.mImageId = glyphRecordIt->mImageId;
-          slot.mAtlasId = mAtlasManager.GetAtlas(slot.mImageId);
+          slot.mAtlasId = atlasId;
           return true;
         }
       }
@@ -183,6 +227,8 @@ const Toolkit::AtlasGlyphManager::Metrics& AtlasGlyphManager::GetMetrics()
     verboseMetrics << "] ";
   }
   mMetrics.mVerboseGlyphCounts = verboseMetrics.str();
+  mMetrics.mUnusedGlyphCount   = static_cast<uint32_t>(mUnusedGlyphs.size());
+  mMetrics.mTextureMemoryLimit = mTextureMemoryLimit;
 
   mAtlasManager.GetMetrics(mMetrics.mAtlasMetrics);
 
@@ -221,20 +267,41 @@ void AtlasGlyphManager::AdjustReferenceCount(Text::FontId fontId, uint32_t image
     {
       if(glyphRecordIt->mImageId == imageId)
       {
+        const int32_t previousCount = glyphRecordIt->mCount;
         glyphRecordIt->mCount += delta;
 
         DALI_ASSERT_DEBUG(glyphRecordIt->mCount >= 0 &&
                           "Glyph ref-count should not be negative");
 
+        if(0 == previousCount)
+        {
+          ++mReferencedGlyphCounts[mAtlasManager.GetAtlas(imageId)];
+
+          // An unused glyph is being reused
+          auto unusedIt = mUnusedGlyphIterators.find(imageId);
+          if(unusedIt != mUnusedGlyphIterators.end())
+          {
+            mUnusedGlyphs.erase(unusedIt->second);
+            mUnusedGlyphIterators.erase(unusedIt);
+          }
+        }
+
         if(0 == glyphRecordIt->mCount)
         {
-          mAtlasManager.Remove(glyphRecordIt->mImageId);
-          fontGlyphRecordIt->mGlyphRecords.Remove(glyphRecordIt);
+          ReleaseReferencedGlyph(mAtlasManager.GetAtlas(imageId));
 
-          // If this FontGlyphRecord has no more glyphs, remove the record
-          if(fontGlyphRecordIt->mGlyphRecords.Empty())
+          // Only glyphs of the current generation can be found again by IsCached()
+          if(mTextureMemoryLimit &&
+             fontGlyphRecordIt->mGeneration == mCacheGeneration &&
+             !mAtlasManager.IsAtlasDraining(mAtlasManager.GetAtlas(imageId)))
           {
-            mFontGlyphRecords.erase(fontGlyphRecordIt);
+            // Keep the glyph in its atlas until the space is needed
+            mUnusedGlyphIterators[imageId] = mUnusedGlyphs.insert(mUnusedGlyphs.end(), UnusedGlyph{fontId, imageId});
+            TrimToTextureMemoryLimit();
+          }
+          else
+          {
+            RemoveGlyph(fontGlyphRecordIt, glyphRecordIt);
           }
         }
         return;
@@ -254,6 +321,205 @@ void AtlasGlyphManager::InvalidateGlyphCache()
 {
   DALI_LOG_INFO(gLogFilter, Debug::General, "Invalidating atlas glyph cache generation\n");
   ++mCacheGeneration;
+
+  // Unused glyphs of previous generations can never be reused
+  while(EvictUnusedGlyph())
+  {
+  }
+}
+
+void AtlasGlyphManager::SetTextureMemoryLimit(uint32_t bytes)
+{
+  mTextureMemoryLimit = bytes;
+  if(0u == mTextureMemoryLimit)
+  {
+    // Without a limit, glyphs are removed as soon as they are unused
+    while(EvictUnusedGlyph())
+    {
+    }
+  }
+  else
+  {
+    TrimToTextureMemoryLimit();
+  }
+}
+
+uint32_t AtlasGlyphManager::GetTextureMemoryLimit() const
+{
+  return mTextureMemoryLimit;
+}
+
+void AtlasGlyphManager::SetPackingMode(Toolkit::AtlasManager::PackingMode mode)
+{
+  mAtlasManager.SetPackingMode(mode);
+}
+
+Toolkit::AtlasManager::PackingMode AtlasGlyphManager::GetPackingMode() const
+{
+  return mAtlasManager.GetPackingMode();
+}
+
+void AtlasGlyphManager::Compact()
+{
+  // Unused glyphs can't be moved, only dropped
+  while(EvictUnusedGlyph())
+  {
+  }
+  mAtlasManager.ReleaseEmptyAtlases();
+
+  // Glyph bitmaps are not kept once uploaded, so glyphs in use can't be repacked directly.
+  // Instead, drain the sparse atlases of each pixel format, keeping the most used one:
+  // glyphs are added to the remaining atlases when their text is next laid out, and the
+  // drained atlases are released once the last glyph in them is removed.
+  std::vector<std::pair<float, uint32_t>> atlases; // occupancy, atlas id
+  for(const Pixel::Format pixelFormat : {Pixel::L8, Pixel::BGRA8888})
+  {
+    atlases.clear();
+    for(uint32_t atlasId = 1u; atlasId <= mAtlasManager.GetAtlasCount(); ++atlasId)
+    {
+      if(mAtlasManager.GetAtlasContainer(atlasId) && mAtlasManager.GetPixelFormat(atlasId) == pixelFormat)
+      {
+        atlases.push_back(std::make_pair(mAtlasManager.GetOccupancy(atlasId), atlasId));
+      }
+    }
+
+    std::sort(atlases.begin(), atlases.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    for(uint32_t i = 1u; i < atlases.size(); ++i)
+    {
+      if(atlases[i].first < COMPACTION_OCCUPANCY_THRESHOLD)
+      {
+        DALI_LOG_INFO(gLogFilter, Debug::General, "Draining atlas %u, occupancy %f\n", atlases[i].second, atlases[i].first);
+        mAtlasManager.SetAtlasDraining(atlases[i].second, true);
+      }
+    }
+  }
+}
+
+void AtlasGlyphManager::RemoveGlyph(std::vector<FontGlyphRecord>::iterator fontGlyphRecordIt, Vector<GlyphRecordEntry>::Iterator glyphRecordIt)
+{
+  const uint32_t imageId = glyphRecordIt->mImageId;
+  const uint32_t atlasId = mAtlasManager.GetAtlas(imageId);
+
+  if(glyphRecordIt->mCount > 0)
+  {
+    ReleaseReferencedGlyph(atlasId);
+  }
+
+  mAtlasManager.Remove(imageId);
+  fontGlyphRecordIt->mGlyphRecords.Remove(glyphRecordIt);
+
+  // If this FontGlyphRecord has no more glyphs, remove the record
+  if(fontGlyphRecordIt->mGlyphRecords.Empty())
+  {
+    mFontGlyphRecords.erase(fontGlyphRecordIt);
+  }
+
+  if(mAtlasManager.IsAtlasDraining(atlasId) && mAtlasManager.GetOccupancy(atlasId) <= 0.0f)
+  {
+    mAtlasManager.ReleaseEmptyAtlases();
+  }
+}
+
+bool AtlasGlyphManager::EvictUnusedGlyph()
+{
+  if(mUnusedGlyphs.empty())
+  {
+    return false;
+  }
+
+  EvictUnusedGlyph(mUnusedGlyphs.begin());
+  return true;
+}
+
+AtlasGlyphManager::UnusedGlyphList::iterator AtlasGlyphManager::EvictUnusedGlyph(UnusedGlyphList::iterator unusedGlyphIt)
+{
+  const UnusedGlyph unusedGlyph = *unusedGlyphIt;
+  mUnusedGlyphIterators.erase(unusedGlyph.mImageId);
+  unusedGlyphIt = mUnusedGlyphs.erase(unusedGlyphIt);
+
+  for(std::vector<FontGlyphRecord>::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
+      fontGlyphRecordIt != mFontGlyphRecords.end();
+      ++fontGlyphRecordIt)
+  {
+    if(fontGlyphRecordIt->mFontId != unusedGlyph.mFontId)
+    {
+      continue;
+    }
+
+    for(Vector<GlyphRecordEntry>::Iterator glyphRecordIt = fontGlyphRecordIt->mGlyphRecords.Begin();
+        glyphRecordIt != fontGlyphRecordIt->mGlyphRecords.End();
+        ++glyphRecordIt)
+    {
+      if(glyphRecordIt->mImageId == unusedGlyph.mImageId)
+      {
+        DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Evicting unused glyph, font: %u imageId: %u\n", unusedGlyph.mFontId, unusedGlyph.mImageId);
+        RemoveGlyph(fontGlyphRecordIt, glyphRecordIt);
+        ++mMetrics.mEvictedGlyphCount;
+        return unusedGlyphIt;
+      }
+    }
+  }
+
+  DALI_ASSERT_DEBUG(false && "Failed to find unused glyph");
+  return unusedGlyphIt;
+}
+
+void AtlasGlyphManager::TrimToTextureMemoryLimit()
+{
+  if(mAtlasManager.GetTextureMemoryUsed() <= mTextureMemoryLimit)
+  {
+    return;
+  }
+
+  UnusedGlyphList::iterator unusedGlyphIt = mUnusedGlyphs.begin();
+  while(unusedGlyphIt != mUnusedGlyphs.end() && mAtlasManager.GetTextureMemoryUsed() > mTextureMemoryLimit)
+  {
+    const uint32_t atlasId = mAtlasManager.GetAtlas(unusedGlyphIt->mImageId);
+    if(mReferencedGlyphCounts.count(atlasId))
+    {
+      // Atlases holding a referenced glyph can't be released, so their unused glyphs are kept
+      ++unusedGlyphIt;
+      continue;
+    }
+
+    // Empty the whole atlas, least recently used first, then give it back
+    while(unusedGlyphIt != mUnusedGlyphs.end())
+    {
+      unusedGlyphIt = (mAtlasManager.GetAtlas(unusedGlyphIt->mImageId) == atlasId) ? EvictUnusedGlyph(unusedGlyphIt) : std::next(unusedGlyphIt);
+    }
+    mAtlasManager.ReleaseEmptyAtlases();
+    unusedGlyphIt = mUnusedGlyphs.begin();
+  }
+}
+
+void AtlasGlyphManager::ReleaseReferencedGlyph(uint32_t atlasId)
+{
+  auto countIt = mReferencedGlyphCounts.find(atlasId);
+  DALI_ASSERT_DEBUG(countIt != mReferencedGlyphCounts.end() && "Atlas has no referenced glyph");
+  if(countIt != mReferencedGlyphCounts.end() && 0u == --countIt->second)
+  {
+    mReferencedGlyphCounts.erase(countIt);
+  }
+}
+
+void AtlasGlyphManager::MakeRoomForGlyph(const PixelData& bitmap)
+{
+  const uint32_t      width       = bitmap.GetWidth();
+  const uint32_t      height      = bitmap.GetHeight();
+  const Pixel::Format pixelFormat = bitmap.GetPixelFormat();
+
+  // Prefer reusing the blocks of unused glyphs to creating an atlas beyond the limit
+  while(!mAtlasManager.CanAdd(width, height, pixelFormat) &&
+        mAtlasManager.GetTextureMemoryUsed() + mAtlasManager.GetNewAtlasTextureMemory(pixelFormat) > mTextureMemoryLimit &&
+        EvictUnusedGlyph())
+  {
+  }
+
+  if(!mAtlasManager.CanAdd(width, height, pixelFormat))
+  {
+    // A new atlas is needed, so give back any atlas that is no longer used first
+    mAtlasManager.ReleaseEmptyAtlases();
+  }
 }
 
 void AtlasGlyphManager::EnsureLocaleChangedConnection()
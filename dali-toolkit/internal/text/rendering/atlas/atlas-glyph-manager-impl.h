@@ -19,7 +19,9 @@
 
 // EXTERNAL INCLUDES
 #include <cstdint>
+#include <list>
 #include <string>
+#include <unordered_map>
 #include <dali/devel-api/common/vector-wrapper.h>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/signals/slot-delegate.h>
@@ -137,6 +139,31 @@ public:
    */
   void InvalidateGlyphCache();
 
+  /**
+   * @copydoc Toolkit::AtlasGlyphManager::SetTextureMemoryLimit
+   */
+  void SetTextureMemoryLimit(uint32_t bytes);
+
+  /**
+   * @copydoc Toolkit::AtlasGlyphManager::GetTextureMemoryLimit
+   */
+  uint32_t GetTextureMemoryLimit() const;
+
+  /**
+   * @copydoc Toolkit::AtlasGlyphManager::SetPackingMode
+   */
+  void SetPackingMode(Toolkit::AtlasManager::PackingMode mode);
+
+  /**
+   * @copydoc Toolkit::AtlasGlyphManager::GetPackingMode
+   */
+  Toolkit::AtlasManager::PackingMode GetPackingMode() const;
+
+  /**
+   * @copydoc Toolkit::AtlasGlyphManager::Compact
+   */
+  void Compact();
+
 protected:
   /**
    * A reference counted object may only be deleted by calling Unreference()
@@ -160,14 +187,74 @@ private:
    */
   void OnLocaleChanged(std::string locale);
 
+  /**
+   * @brief Removes a glyph image from its atlas, and its glyph record.
+   *
+   * Releases the atlas if it was draining and is now empty.
+   * Invalidates the given iterators.
+   *
+   * @param[in] fontGlyphRecordIt The font record holding the glyph.
+   * @param[in] glyphRecordIt The glyph record to remove.
+   */
+  void RemoveGlyph(std::vector<FontGlyphRecord>::iterator fontGlyphRecordIt, Vector<GlyphRecordEntry>::Iterator glyphRecordIt);
+
+  /**
+   * @brief Evicts the least recently used unreferenced glyph.
+   *
+   * @return false if there were no unreferenced glyphs to evict.
+   */
+  bool EvictUnusedGlyph();
+
+  /**
+   * @brief Evicts unreferenced glyphs until the atlases fit within the texture memory limit.
+   *
+   * Only atlases without any referenced glyph are drained, as evicting a glyph gives no memory back
+   * until its atlas is empty. It stops as soon as the atlases fit within the limit.
+   */
+  void TrimToTextureMemoryLimit();
+
+  /**
+   * @brief Decrements the number of referenced glyphs of an atlas.
+   *
+   * @param[in] atlasId The atlas of the glyph no longer referenced.
+   */
+  void ReleaseReferencedGlyph(uint32_t atlasId);
+
+  /**
+   * @brief Frees space before adding a glyph, if adding it would create a new atlas over the limit.
+   *
+   * @param[in] bitmap The glyph bitmap that is about to be added.
+   */
+  void MakeRoomForGlyph(const PixelData& bitmap);
+
 private:
-  Dali::Toolkit::AtlasManager         mAtlasManager;
-  std::vector<FontGlyphRecord>        mFontGlyphRecords;
-  Toolkit::AtlasGlyphManager::Metrics mMetrics;
-  Sampler                             mSampler;
-  uint64_t                            mCacheGeneration{1u};
-  SlotDelegate<AtlasGlyphManager>     mSlotDelegate;
-  bool                                mLocaleChangedConnected{false};
+  struct UnusedGlyph
+  {
+    Text::FontId mFontId;
+    uint32_t     mImageId;
+  };
+
+  using UnusedGlyphList = std::list<UnusedGlyph>;
+
+  /**
+   * @brief Evicts an unreferenced glyph.
+   *
+   * @param[in] unusedGlyphIt The position of the glyph in the unused glyph list.
+   * @return The position of the next unused glyph.
+   */
+  UnusedGlyphList::iterator EvictUnusedGlyph(UnusedGlyphList::iterator unusedGlyphIt);
+
+  Dali::Toolkit::AtlasManager                             mAtlasManager;
+  std::vector<FontGlyphRecord>                            mFontGlyphRecords;
+  Toolkit::AtlasGlyphManager::Metrics                     mMetrics;
+  Sampler                                                 mSampler;
+  uint64_t                                                mCacheGeneration{1u};
+  UnusedGlyphList                                         mUnusedGlyphs;          ///< Unreferenced glyphs kept for reuse, least recently used first
+  std::unordered_map<uint32_t, UnusedGlyphList::iterator> mUnusedGlyphIterators;  ///< Image id to position in mUnusedGlyphs
+  std::unordered_map<uint32_t, uint32_t>                  mReferencedGlyphCounts; ///< Atlas id to number of its glyphs still referenced
+  uint32_t                                                mTextureMemoryLimit{0u};
+  SlotDelegate<AtlasGlyphManager>                         mSlotDelegate;
+  bool                                                    mLocaleChangedConnected{false};
 };
 
 } // namespace Internal
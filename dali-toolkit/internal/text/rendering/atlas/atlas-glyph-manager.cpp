@@ -133,6 +133,31 @@ void AtlasGlyphManager::InvalidateGlyphCache()
   GetImplementation(*this).InvalidateGlyphCache();
 }
 
+void AtlasGlyphManager::SetTextureMemoryLimit(uint32_t bytes)
+{
+  GetImplementation(*this).SetTextureMemoryLimit(bytes);
+}
+
+uint32_t AtlasGlyphManager::GetTextureMemoryLimit() const
+{
+  return GetImplementation(*this).GetTextureMemoryLimit();
+}
+
+void AtlasGlyphManager::SetPackingMode(AtlasManager::PackingMode mode)
+{
+  GetImplementation(*this).SetPackingMode(mode);
+}
+
+AtlasManager::PackingMode AtlasGlyphManager::GetPackingMode() const
+{
+  return GetImplementation(*this).GetPackingMode();
+}
+
+void AtlasGlyphManager::Compact()
+{
+  GetImplementation(*this).Compact();
+}
+
 } // namespace Toolkit
 
 } // namespace Dali
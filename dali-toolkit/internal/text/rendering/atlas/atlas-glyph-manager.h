@@ -40,7 +40,10 @@ public:
   struct Metrics
   {
     Metrics()
-    : mGlyphCount(0u)
+    : mGlyphCount(0u),
+      mUnusedGlyphCount(0u),
+      mEvictedGlyphCount(0u),
+      mTextureMemoryLimit(0u)
     {
     }
 
@@ -49,6 +52,9 @@ public:
     }
 
     uint32_t              mGlyphCount;         ///< number of glyphs being managed
+    uint32_t              mUnusedGlyphCount;   ///< number of unreferenced glyphs kept for reuse
+    uint32_t              mEvictedGlyphCount;  ///< number of unreferenced glyphs evicted to stay within the texture memory limit
+    uint32_t              mTextureMemoryLimit; ///< texture memory limit in bytes, 0 if unlimited
     std::string           mVerboseGlyphCounts; ///< a verbose list of the glyphs + ref counts
     AtlasManager::Metrics mAtlasMetrics;       ///< metrics from the Atlas Manager
   };
@@ -194,6 +200,53 @@ public:
    */
   void InvalidateGlyphCache();
 
+  /**
+   * @brief Set a limit on the texture memory used by glyph atlases.
+   *
+   * When a limit is set, glyphs whose reference count reaches zero are kept in their atlas,
+   * so that they can be reused without being rendered and uploaded again. The least recently
+   * used of these are evicted whenever the atlases exceed the limit, or before a new atlas
+   * would take them over the limit. Glyphs that are in use are never evicted, so the limit
+   * may still be exceeded if the text being shown needs more memory.
+   *
+   * @param[in] bytes The texture memory limit in bytes, or 0 for no limit (the default).
+   */
+  void SetTextureMemoryLimit(uint32_t bytes);
+
+  /**
+   * @brief Get the texture memory limit set by SetTextureMemoryLimit().
+   *
+   * @return The texture memory limit in bytes, or 0 if there is no limit.
+   */
+  uint32_t GetTextureMemoryLimit() const;
+
+  /**
+   * @brief Sets how glyphs are placed within atlases created after this call.
+   *
+   * AtlasManager::PACK_SKYLINE stores each glyph at its own size, rather than in a block sized
+   * for the largest glyph of the font, so that more glyphs fit into each atlas.
+   *
+   * @param[in] mode The packing mode, AtlasManager::PACK_BLOCKS by default.
+   */
+  void SetPackingMode(AtlasManager::PackingMode mode);
+
+  /**
+   * @brief Gets the packing mode set by SetPackingMode().
+   *
+   * @return The packing mode.
+   */
+  AtlasManager::PackingMode GetPackingMode() const;
+
+  /**
+   * @brief Compacts the glyph atlases.
+   *
+   * Evicts all unreferenced glyphs and releases atlases that become empty. Then sparsely used
+   * atlases stop receiving new glyphs, and glyph lookups stop returning glyphs stored in them,
+   * so that text laid out afterwards is packed into the remaining atlases. A sparse atlas is
+   * released once the last glyph that references it is removed.
+   */
+  void Compact();
+
 public:
   // Default copy and move operator
   AtlasGlyphManager(const AtlasGlyphManager& rhs)            = default;
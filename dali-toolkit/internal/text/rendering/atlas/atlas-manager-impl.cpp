@@ -21,6 +21,8 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/texture-integ.h>
 #include <string.h>
+#include <algorithm>
+#include <limits>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-mesh-factory.h>
@@ -40,6 +42,7 @@ constexpr uint32_t DEFAULT_BLOCK_HEIGHT(16u);
 constexpr uint32_t SINGLE_PIXEL_PADDING(1u);
 constexpr uint32_t DOUBLE_PIXEL_PADDING(SINGLE_PIXEL_PADDING << 1);
 constexpr uint32_t TRIPLE_PIXEL_PADDING(DOUBLE_PIXEL_PADDING + SINGLE_PIXEL_PADDING);
+constexpr uint32_t REGION_PADDING(DOUBLE_PIXEL_PADDING << 1); ///< Double pixel padding on each side of a packed image
 
 Toolkit::AtlasManager::AtlasSize EMPTY_SIZE;
 
@@ -47,10 +50,27 @@ bool IsBlockSizeSufficient(uint32_t width, uint32_t height, uint32_t requiredBlo
 {
   return (width + DOUBLE_PIXEL_PADDING <= requiredBlockWidth) && (height + DOUBLE_PIXEL_PADDING <= requiredBlockHeight);
 }
+
+bool IsRegionSizeSufficient(uint32_t width, uint32_t height, const Toolkit::AtlasManager::AtlasSize& size)
+{
+  // The first row is reserved for the filled pixel
+  return (width + REGION_PADDING <= size.mWidth) && (height + REGION_PADDING + SINGLE_PIXEL_PADDING <= size.mHeight);
+}
+
+uint32_t GetTextureMemory(const Toolkit::AtlasManager::AtlasSize& size, Pixel::Format pixelFormat)
+{
+  return size.mWidth * size.mHeight * Dali::Pixel::GetBytesPerPixel(pixelFormat);
+}
+
+uint32_t GetUsedBlocks(const AtlasManager::AtlasDescriptor& atlas)
+{
+  return atlas.mTotalBlocks - (atlas.mAvailableBlocks + static_cast<uint32_t>(atlas.mFreeBlocksList.Size()));
+}
 } // namespace
 
 AtlasManager::AtlasManager()
-: mAddFailPolicy(Toolkit::AtlasManager::FAIL_ON_ADD_CREATES)
+: mAddFailPolicy(Toolkit::AtlasManager::FAIL_ON_ADD_CREATES),
+  mPackingMode(Toolkit::AtlasManager::PACK_BLOCKS)
 {
   mNewAtlasSize.mWidth       = DEFAULT_ATLAS_WIDTH;
   mNewAtlasSize.mHeight      = DEFAULT_ATLAS_HEIGHT;
@@ -104,24 +124,47 @@ Toolkit::AtlasManager::AtlasId AtlasManager::CreateAtlas(const Toolkit::AtlasMan
   atlasDescriptor.mAtlas           = atlas;
   atlasDescriptor.mSize            = size;
   atlasDescriptor.mPixelFormat     = pixelformat;
-  atlasDescriptor.mTotalBlocks     = ((width - 1u) / blockWidth) * ((height - 1u) / blockHeight);
-  atlasDescriptor.mAvailableBlocks = atlasDescriptor.mTotalBlocks;
+  atlasDescriptor.mPackingMode     = mPackingMode;
 
-  bufferSize                           = blockWidth * SINGLE_PIXEL_PADDING * Dali::Pixel::GetBytesPerPixel(pixelformat);
-  unsigned char* bufferHorizontalStrip = new unsigned char[bufferSize];
-  memset(bufferHorizontalStrip, 0, bufferSize);
-  atlasDescriptor.mHorizontalStrip = PixelData::New(bufferHorizontalStrip, bufferSize, blockWidth, SINGLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY);
-
-  bufferSize                         = SINGLE_PIXEL_PADDING * (blockHeight - DOUBLE_PIXEL_PADDING) * Dali::Pixel::GetBytesPerPixel(pixelformat);
-  unsigned char* bufferVerticalStrip = new unsigned char[bufferSize];
-  memset(bufferVerticalStrip, 0, bufferSize);
-  atlasDescriptor.mVerticalStrip = PixelData::New(bufferVerticalStrip, bufferSize, SINGLE_PIXEL_PADDING, blockHeight - DOUBLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY);
+  if(Toolkit::AtlasManager::PACK_SKYLINE == mPackingMode)
+  {
+    // Images are placed at their own size, so there are no blocks or padding strips. Skip the first row, which holds the filled pixel
+    atlasDescriptor.mTotalBlocks     = 0u;
+    atlasDescriptor.mAvailableBlocks = 0u;
+    atlasDescriptor.mSkyline.push_back(SkylineNode{0u, SINGLE_PIXEL_PADDING, width});
+  }
+  else
+  {
+    atlasDescriptor.mTotalBlocks     = ((width - 1u) / blockWidth) * ((height - 1u) / blockHeight);
+    atlasDescriptor.mAvailableBlocks = atlasDescriptor.mTotalBlocks;
+
+    bufferSize                           = blockWidth * SINGLE_PIXEL_PADDING * Dali::Pixel::GetBytesPerPixel(pixelformat);
+    unsigned char* bufferHorizontalStrip = new unsigned char[bufferSize];
+    memset(bufferHorizontalStrip, 0, bufferSize);
+    atlasDescriptor.mHorizontalStrip = PixelData::New(bufferHorizontalStrip, bufferSize, blockWidth, SINGLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY);
+
+    bufferSize                         = SINGLE_PIXEL_PADDING * (blockHeight - DOUBLE_PIXEL_PADDING) * Dali::Pixel::GetBytesPerPixel(pixelformat);
+    unsigned char* bufferVerticalStrip = new unsigned char[bufferSize];
+    memset(bufferVerticalStrip, 0, bufferSize);
+    atlasDescriptor.mVerticalStrip = PixelData::New(bufferVerticalStrip, bufferSize, SINGLE_PIXEL_PADDING, blockHeight - DOUBLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY);
+  }
 
   bufferSize            = Dali::Pixel::GetBytesPerPixel(pixelformat);
   unsigned char* buffer = new unsigned char[bufferSize];
   memset(buffer, 0xFF, bufferSize);
   PixelData filledPixelImage = PixelData::New(buffer, bufferSize, 1u, 1u, pixelformat, PixelData::DELETE_ARRAY);
   atlas.Upload(filledPixelImage, 0u, 0u, 0u, 0u, 1u, 1u);
+
+  // Reuse the slot of a released atlas, if there is one
+  for(SizeType i = 0u; i < mAtlasList.size(); ++i)
+  {
+    if(!mAtlasList[i].mAtlas)
+    {
+      mAtlasList[i] = atlasDescriptor;
+      return i + 1u;
+    }
+  }
+
   mAtlasList.push_back(atlasDescriptor);
   return mAtlasList.size();
 }
@@ -131,6 +174,16 @@ void AtlasManager::SetAddPolicy(Toolkit::AtlasManager::AddFailPolicy policy)
   mAddFailPolicy = policy;
 }
 
+void AtlasManager::SetPackingMode(Toolkit::AtlasManager::PackingMode mode)
+{
+  mPackingMode = mode;
+}
+
+Toolkit::AtlasManager::PackingMode AtlasManager::GetPackingMode() const
+{
+  return mPackingMode;
+}
+
 bool AtlasManager::Add(const PixelData&                  image,
                        Toolkit::AtlasManager::AtlasSlot& slot,
                        Toolkit::AtlasManager::AtlasId    atlas)
@@ -143,7 +196,7 @@ bool AtlasManager::Add(const PixelData&                  image,
   SizeType      index       = 0;
   slot.mImageId             = 0;
 
-  AtlasSlotDescriptor desc;
+  AtlasSlotDescriptor desc{};
 
   // If there is a preferred atlas then check for room in that first
   if(atlas--)
@@ -163,7 +216,9 @@ bool AtlasManager::Add(const PixelData&                  image,
   {
     if(Toolkit::AtlasManager::FAIL_ON_ADD_CREATES == mAddFailPolicy)
     {
-      if(IsBlockSizeSufficient(width, height, mNewAtlasSize.mBlockWidth, mNewAtlasSize.mBlockHeight)) // Checks if image fits within the atlas blocks
+      const bool fits = (Toolkit::AtlasManager::PACK_SKYLINE == mPackingMode) ? IsRegionSizeSufficient(width, height, mNewAtlasSize)
+                                                                              : IsBlockSizeSufficient(width, height, mNewAtlasSize.mBlockWidth, mNewAtlasSize.mBlockHeight);
+      if(fits) // Checks if image fits within the atlas blocks
       {
         foundAtlas = CreateAtlas(mNewAtlasSize, pixelFormat); // Creating atlas with mNewAtlasSize, may not be the needed size!
         if(0u == foundAtlas)
@@ -192,19 +247,30 @@ bool AtlasManager::Add(const PixelData&                  image,
 
   foundAtlas--; // Atlas created successfully, decrement by 1 to get <vector> index (starts at 0 not 1)
 
+  AtlasDescriptor& atlasDescriptor = mAtlasList[foundAtlas];
+  if(Toolkit::AtlasManager::PACK_SKYLINE == atlasDescriptor.mPackingMode)
+  {
+    if(!AllocateRegion(atlasDescriptor, width, height, desc.mRegion))
+    {
+      DALI_LOG_ERROR("Failed to allocate a region of %i x %i in atlas %i.\n", width, height, foundAtlas + 1u);
+      return false;
+    }
+  }
   // Work out which the block we're going to use
   // Is there currently a next free block available ?
-  if(mAtlasList[foundAtlas].mAvailableBlocks)
+  else if(atlasDescriptor.mAvailableBlocks)
   {
     // Yes, so select our next block
-    desc.mBlock = mAtlasList[foundAtlas].mTotalBlocks - mAtlasList[foundAtlas].mAvailableBlocks--;
+    desc.mBlock = atlasDescriptor.mTotalBlocks - atlasDescriptor.mAvailableBlocks--;
   }
   else
   {
     // Our next block must be from the free list, fetch from the start of the list
-    desc.mBlock = mAtlasList[foundAtlas].mFreeBlocksList[0];
-    mAtlasList[foundAtlas].mFreeBlocksList.Remove(mAtlasList[foundAtlas].mFreeBlocksList.Begin());
+    desc.mBlock = atlasDescriptor.mFreeBlocksList[0];
+    atlasDescriptor.mFreeBlocksList.Remove(atlasDescriptor.mFreeBlocksList.Begin());
   }
+  ++atlasDescriptor.mImageCount;
+  atlasDescriptor.mImagePixels += width * height;
 
   desc.mImageWidth  = width;
   desc.mImageHeight = height;
@@ -234,25 +300,46 @@ bool AtlasManager::Add(const PixelData&                  image,
   slot.mAtlasId = foundAtlas + 1u; // Ids start from 1 not the 0 index
 
   // Upload the buffer image into the atlas
-  UploadImage(image, desc);
+  if(Toolkit::AtlasManager::PACK_SKYLINE == atlasDescriptor.mPackingMode)
+  {
+    UploadImageToRegion(image, desc);
+  }
+  else
+  {
+    UploadImage(image, desc);
+  }
   return created;
 }
 
 AtlasManager::SizeType AtlasManager::CheckAtlas(SizeType      atlas,
                                                 SizeType      width,
                                                 SizeType      height,
-                                                Pixel::Format pixelFormat)
+                                                Pixel::Format pixelFormat) const
 {
   AtlasManager::SizeType result = 0u;
-  if(pixelFormat == mAtlasList[atlas].mPixelFormat)
+  if(pixelFormat == mAtlasList[atlas].mPixelFormat && !mAtlasList[atlas].mDraining)
   {
-    // Check to see if the image will fit in these blocks
+    if(Toolkit::AtlasManager::PACK_SKYLINE == mAtlasList[atlas].mPackingMode)
+    {
+      // Check to see if there is a region large enough for the image
+      AtlasRegion region;
+      SizeType    freeRegion;
+      SizeType    skylineNode;
+      if(FindRegion(mAtlasList[atlas], width, height, region, freeRegion, skylineNode))
+      {
+        result = atlas + 1u; // Atlas ids start from 1 not 0
+      }
+    }
+    else
+    {
+      // Check to see if the image will fit in these blocks
 
-    const SizeType availableBlocks = mAtlasList[atlas].mAvailableBlocks + static_cast<SizeType>(mAtlasList[atlas].mFreeBlocksList.Size());
+      const SizeType availableBlocks = mAtlasList[atlas].mAvailableBlocks + static_cast<SizeType>(mAtlasList[atlas].mFreeBlocksList.Size());
 
-    if(availableBlocks && IsBlockSizeSufficient(width, height, mAtlasList[atlas].mSize.mBlockWidth, mAtlasList[atlas].mSize.mBlockHeight))
-    {
-      result = atlas + 1u; // Atlas ids start from 1 not 0
+      if(availableBlocks && IsBlockSizeSufficient(width, height, mAtlasList[atlas].mSize.mBlockWidth, mAtlasList[atlas].mSize.mBlockHeight))
+      {
+        result = atlas + 1u; // Atlas ids start from 1 not 0
+      }
     }
   }
   return result;
@@ -371,6 +458,182 @@ void AtlasManager::UploadImage(const PixelData&           image,
   }
 }
 
+bool AtlasManager::FindRegion(const AtlasDescriptor& atlas,
+                              SizeType               width,
+                              SizeType               height,
+                              AtlasRegion&           region,
+                              SizeType&              freeRegion,
+                              SizeType&              skylineNode) const
+{
+  const SizeType regionWidth  = width + REGION_PADDING;
+  const SizeType regionHeight = height + REGION_PADDING;
+  const SizeType regionArea   = regionWidth * regionHeight;
+
+  // Find the smallest previously freed region that is large enough
+  const SizeType freeRegionCount = static_cast<SizeType>(atlas.mFreeRegions.size());
+  SizeType       bestFreeArea    = std::numeric_limits<SizeType>::max();
+  freeRegion                     = freeRegionCount;
+  for(SizeType i = 0u; i < freeRegionCount; ++i)
+  {
+    const AtlasRegion& freed = atlas.mFreeRegions[i];
+    if(regionWidth <= freed.mWidth && regionHeight <= freed.mHeight && freed.mWidth * freed.mHeight < bestFreeArea)
+    {
+      bestFreeArea = freed.mWidth * freed.mHeight;
+      freeRegion   = i;
+    }
+  }
+
+  // A close fit is always used, as it costs no more of the atlas
+  if(freeRegion < freeRegionCount && bestFreeArea <= regionArea * 2u)
+  {
+    region = atlas.mFreeRegions[freeRegion];
+    return true;
+  }
+
+  // Find the skyline position that leaves the lowest top edge, preferring the narrowest node on a tie
+  const std::vector<SkylineNode>& skyline   = atlas.mSkyline;
+  const SizeType                  nodeCount = static_cast<SizeType>(skyline.size());
+  SizeType                        bestTop   = std::numeric_limits<SizeType>::max();
+  SizeType                        bestWidth = std::numeric_limits<SizeType>::max();
+  for(SizeType i = 0u; i < nodeCount; ++i)
+  {
+    const SizeType x = skyline[i].mX;
+    if(x + regionWidth > atlas.mSize.mWidth)
+    {
+      break;
+    }
+
+    // The region rests on the highest node it spans
+    SizeType y         = 0u;
+    SizeType remaining = regionWidth;
+    for(SizeType j = i; j < nodeCount && remaining > 0u; ++j)
+    {
+      y = std::max(y, skyline[j].mY);
+      remaining -= std::min(remaining, skyline[j].mWidth);
+    }
+
+    const SizeType top = y + regionHeight;
+    if(top <= atlas.mSize.mHeight && (top < bestTop || (top == bestTop && skyline[i].mWidth < bestWidth)))
+    {
+      bestTop     = top;
+      bestWidth   = skyline[i].mWidth;
+      skylineNode = i;
+      region      = AtlasRegion{x, y, regionWidth, regionHeight};
+    }
+  }
+
+  if(bestTop != std::numeric_limits<SizeType>::max())
+  {
+    freeRegion = freeRegionCount;
+    return true;
+  }
+
+  // Otherwise settle for a loose fit
+  if(freeRegion < freeRegionCount)
+  {
+    region = atlas.mFreeRegions[freeRegion];
+    return true;
+  }
+  return false;
+}
+
+bool AtlasManager::AllocateRegion(AtlasDescriptor& atlas,
+                                  SizeType         width,
+                                  SizeType         height,
+                                  AtlasRegion&     region)
+{
+  SizeType freeRegion  = 0u;
+  SizeType skylineNode = 0u;
+  if(!FindRegion(atlas, width, height, region, freeRegion, skylineNode))
+  {
+    return false;
+  }
+
+  if(freeRegion < atlas.mFreeRegions.size())
+  {
+    atlas.mFreeRegions.erase(atlas.mFreeRegions.begin() + freeRegion);
+  }
+  else
+  {
+    std::vector<SkylineNode>& skyline = atlas.mSkyline;
+
+    // Raise the skyline over the new region
+    skyline.insert(skyline.begin() + skylineNode, SkylineNode{region.mX, region.mY + region.mHeight, region.mWidth});
+
+    // Shrink or remove the nodes that are now covered by it
+    for(SizeType i = skylineNode + 1u; i < skyline.size();)
+    {
+      const SizeType previousEnd = skyline[i - 1u].mX + skyline[i - 1u].mWidth;
+      if(skyline[i].mX >= previousEnd)
+      {
+        break;
+      }
+
+      const SizeType overlap = previousEnd - skyline[i].mX;
+      if(skyline[i].mWidth <= overlap)
+      {
+        skyline.erase(skyline.begin() + i);
+      }
+      else
+      {
+        skyline[i].mX += overlap;
+        skyline[i].mWidth -= overlap;
+        break;
+      }
+    }
+
+    // Merge neighbouring nodes at the same height
+    for(SizeType i = 0u; i + 1u < skyline.size();)
+    {
+      if(skyline[i].mY == skyline[i + 1u].mY)
+      {
+        skyline[i].mWidth += skyline[i + 1u].mWidth;
+        skyline.erase(skyline.begin() + i + 1u);
+      }
+      else
+      {
+        ++i;
+      }
+    }
+  }
+
+  atlas.mAllocatedPixels += region.mWidth * region.mHeight;
+  return true;
+}
+
+void AtlasManager::UploadImageToRegion(const PixelData&           image,
+                                       const AtlasSlotDescriptor& desc)
+{
+  AtlasDescriptor& atlas = mAtlasList[desc.mAtlasId - 1u];
+
+  // Check to see that the pixel formats are compatible
+  if(image.GetPixelFormat() != atlas.mPixelFormat)
+  {
+    DALI_LOG_ERROR("Cannot upload an image with a different PixelFormat to the Atlas.\n");
+    return;
+  }
+
+  const AtlasRegion& region = desc.mRegion;
+
+  // The region may have held a larger image before, so clear all of it, padding included
+  if(!atlas.mClearPixels || atlas.mClearPixels.GetWidth() < region.mWidth || atlas.mClearPixels.GetHeight() < region.mHeight)
+  {
+    const SizeType clearWidth  = atlas.mClearPixels ? std::max(atlas.mClearPixels.GetWidth(), region.mWidth) : region.mWidth;
+    const SizeType clearHeight = atlas.mClearPixels ? std::max(atlas.mClearPixels.GetHeight(), region.mHeight) : region.mHeight;
+    const SizeType bufferSize  = clearWidth * clearHeight * Dali::Pixel::GetBytesPerPixel(atlas.mPixelFormat);
+    unsigned char* buffer      = new unsigned char[bufferSize];
+    memset(buffer, 0, bufferSize);
+    atlas.mClearPixels = PixelData::New(buffer, bufferSize, clearWidth, clearHeight, atlas.mPixelFormat, PixelData::DELETE_ARRAY);
+  }
+
+  [[maybe_unused]] bool uploaded = atlas.mAtlas.Upload(atlas.mClearPixels, 0u, 0u, region.mX, region.mY, region.mWidth, region.mHeight);
+  DALI_ASSERT_DEBUG(uploaded && "Clearing region of Atlas Failed!");
+
+  // Blit image 2 pixel to the right and down into the region to compensate for texture filtering
+  uploaded = atlas.mAtlas.Upload(image, 0u, 0u, region.mX + DOUBLE_PIXEL_PADDING, region.mY + DOUBLE_PIXEL_PADDING, image.GetWidth(), image.GetHeight());
+  DALI_ASSERT_DEBUG(uploaded && "Uploading image to Atlas Failed!");
+}
+
 void AtlasManager::GenerateMeshData(ImageId                        id,
                                     const Vector2&                 position,
                                     Toolkit::AtlasManager::Mesh2D& meshData,
@@ -384,12 +647,25 @@ void AtlasManager::GenerateMeshData(ImageId                        id,
     SizeType width   = mImageList[imageId].mImageWidth;
     SizeType height  = mImageList[imageId].mImageHeight;
 
-    AtlasMeshFactory::CreateQuad(width,
-                                 height,
-                                 mImageList[imageId].mBlock,
-                                 mAtlasList[atlas].mSize,
-                                 position,
-                                 meshData);
+    if(Toolkit::AtlasManager::PACK_SKYLINE == mAtlasList[atlas].mPackingMode)
+    {
+      AtlasMeshFactory::CreateQuad(width,
+                                   height,
+                                   mImageList[imageId].mRegion.mX + DOUBLE_PIXEL_PADDING,
+                                   mImageList[imageId].mRegion.mY + DOUBLE_PIXEL_PADDING,
+                                   mAtlasList[atlas].mSize,
+                                   position,
+                                   meshData);
+    }
+    else
+    {
+      AtlasMeshFactory::CreateQuad(width,
+                                   height,
+                                   mImageList[imageId].mBlock,
+                                   mAtlasList[atlas].mSize,
+                                   position,
+                                   meshData);
+    }
 
     // Mesh created so increase the reference count, if we're asked to
     if(addReference)
@@ -438,8 +714,30 @@ bool AtlasManager::Remove(ImageId id)
     // 'Remove the blocks' from this image and add to the atlas' freelist
     removed                    = true;
     mImageList[imageId].mCount = 0;
-    SizeType atlas             = mImageList[imageId].mAtlasId - 1u;
-    mAtlasList[atlas].mFreeBlocksList.PushBack(mImageList[imageId].mBlock);
+
+    const AtlasSlotDescriptor& desc            = mImageList[imageId];
+    AtlasDescriptor&           atlasDescriptor = mAtlasList[desc.mAtlasId - 1u];
+    --atlasDescriptor.mImageCount;
+    atlasDescriptor.mImagePixels -= desc.mImageWidth * desc.mImageHeight;
+
+    if(Toolkit::AtlasManager::PACK_SKYLINE == atlasDescriptor.mPackingMode)
+    {
+      atlasDescriptor.mAllocatedPixels -= desc.mRegion.mWidth * desc.mRegion.mHeight;
+      if(0u == atlasDescriptor.mImageCount)
+      {
+        // Nothing left, so start packing again from the top
+        atlasDescriptor.mSkyline.assign(1u, SkylineNode{0u, SINGLE_PIXEL_PADDING, atlasDescriptor.mSize.mWidth});
+        atlasDescriptor.mFreeRegions.clear();
+      }
+      else
+      {
+        atlasDescriptor.mFreeRegions.push_back(desc.mRegion);
+      }
+    }
+    else
+    {
+      atlasDescriptor.mFreeBlocksList.PushBack(desc.mBlock);
+    }
   }
   return removed;
 }
@@ -506,25 +804,27 @@ void AtlasManager::GetMetrics(Toolkit::AtlasManager::Metrics& metrics)
   Toolkit::AtlasManager::AtlasMetricsEntry entry;
   uint32_t                                 textureMemoryUsed = 0;
   uint32_t                                 atlasCount        = mAtlasList.size();
-  metrics.mAtlasCount                                        = atlasCount;
+  metrics.mAtlasCount                                        = 0u;
   metrics.mAtlasMetrics.Resize(0);
 
   for(uint32_t i = 0; i < atlasCount; ++i)
   {
+    if(!mAtlasList[i].mAtlas)
+    {
+      continue; // Released
+    }
+
     entry.mSize        = mAtlasList[i].mSize;
     entry.mTotalBlocks = mAtlasList[i].mTotalBlocks;
-    entry.mBlocksUsed  = entry.mTotalBlocks - mAtlasList[i].mAvailableBlocks + static_cast<SizeType>(mAtlasList[i].mFreeBlocksList.Size());
+    entry.mBlocksUsed  = GetUsedBlocks(mAtlasList[i]);
+    entry.mImageCount  = mAtlasList[i].mImageCount;
+    entry.mOccupancy   = static_cast<float>(mAtlasList[i].mImagePixels) / static_cast<float>(entry.mSize.mWidth * entry.mSize.mHeight);
     entry.mPixelFormat = GetPixelFormat(i + 1);
 
     metrics.mAtlasMetrics.PushBack(entry);
+    ++metrics.mAtlasCount;
 
-    uint32_t size = entry.mSize.mWidth * entry.mSize.mHeight;
-    if(entry.mPixelFormat == Pixel::BGRA8888)
-    {
-      size <<= 2;
-    }
-
-    textureMemoryUsed += size;
+    textureMemoryUsed += GetTextureMemory(entry.mSize, entry.mPixelFormat);
   }
   metrics.mTextureMemoryUsed = textureMemoryUsed;
 }
@@ -549,6 +849,92 @@ void AtlasManager::SetTextures(AtlasId atlas, TextureSet& textureSet)
   }
 }
 
+bool AtlasManager::CanAdd(SizeType width, SizeType height, Pixel::Format pixelFormat) const
+{
+  for(SizeType i = 0u; i < mAtlasList.size(); ++i)
+  {
+    if(CheckAtlas(i, width, height, pixelFormat))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+AtlasManager::SizeType AtlasManager::GetTextureMemoryUsed() const
+{
+  SizeType textureMemoryUsed = 0u;
+  for(const auto& atlas : mAtlasList)
+  {
+    if(atlas.mAtlas)
+    {
+      textureMemoryUsed += GetTextureMemory(atlas.mSize, atlas.mPixelFormat);
+    }
+  }
+  return textureMemoryUsed;
+}
+
+AtlasManager::SizeType AtlasManager::GetNewAtlasTextureMemory(Pixel::Format pixelFormat) const
+{
+  return GetTextureMemory(mNewAtlasSize, pixelFormat);
+}
+
+AtlasManager::SizeType AtlasManager::ReleaseEmptyAtlases()
+{
+  SizeType released = 0u;
+  for(auto& atlas : mAtlasList)
+  {
+    if(atlas.mAtlas && 0u == atlas.mImageCount)
+    {
+      // Keep the slot, so that the ids of other atlases don't change
+      atlas                  = AtlasDescriptor();
+      atlas.mSize            = EMPTY_SIZE;
+      atlas.mPixelFormat     = Pixel::INVALID;
+      atlas.mTotalBlocks     = 0u;
+      atlas.mAvailableBlocks = 0u;
+      ++released;
+    }
+  }
+  return released;
+}
+
+void AtlasManager::SetAtlasDraining(AtlasId atlas, bool draining)
+{
+  DALI_ASSERT_DEBUG(atlas && atlas <= mAtlasList.size());
+  if(atlas && atlas-- <= mAtlasList.size())
+  {
+    mAtlasList[atlas].mDraining = draining;
+  }
+}
+
+bool AtlasManager::IsAtlasDraining(AtlasId atlas) const
+{
+  DALI_ASSERT_DEBUG(atlas && atlas <= mAtlasList.size());
+  if(atlas && atlas-- <= mAtlasList.size())
+  {
+    return mAtlasList[atlas].mDraining;
+  }
+  return false;
+}
+
+float AtlasManager::GetOccupancy(AtlasId atlas) const
+{
+  DALI_ASSERT_DEBUG(atlas && atlas <= mAtlasList.size());
+  if(atlas && atlas-- <= mAtlasList.size() && mAtlasList[atlas].mAtlas)
+  {
+    const AtlasDescriptor& atlasDescriptor = mAtlasList[atlas];
+    if(Toolkit::AtlasManager::PACK_SKYLINE == atlasDescriptor.mPackingMode)
+    {
+      return static_cast<float>(atlasDescriptor.mAllocatedPixels) / static_cast<float>(atlasDescriptor.mSize.mWidth * atlasDescriptor.mSize.mHeight);
+    }
+    if(atlasDescriptor.mTotalBlocks)
+    {
+      return static_cast<float>(GetUsedBlocks(atlasDescriptor)) / static_cast<float>(atlasDescriptor.mTotalBlocks);
+    }
+  }
+  return 0.0f;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
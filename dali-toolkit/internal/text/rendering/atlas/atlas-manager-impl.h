@@ -48,6 +48,27 @@ public:
   typedef SizeType AtlasId;
   typedef SizeType ImageId;
 
+  /**
+   * @brief An area of an atlas, in pixels
+   */
+  struct AtlasRegion
+  {
+    SizeType mX;
+    SizeType mY;
+    SizeType mWidth;
+    SizeType mHeight;
+  };
+
+  /**
+   * @brief A horizontal segment of the skyline, the lowest free row above a span of columns
+   */
+  struct SkylineNode
+  {
+    SizeType mX;
+    SizeType mY;
+    SizeType mWidth;
+  };
+
   /**
    * @brief Internal storage of atlas attributes and image upload results
    */
@@ -62,15 +83,25 @@ public:
     SizeType                         mTotalBlocks;     // total number of blocks in atlas
     SizeType                         mAvailableBlocks; // number of blocks available in atlas
     Dali::Vector<SizeType>           mFreeBlocksList;  // unless there are any previously freed blocks
+    bool                             mDraining{false}; // no more images are added whilst draining
+
+    Toolkit::AtlasManager::PackingMode mPackingMode{Toolkit::AtlasManager::PACK_BLOCKS}; // how images are placed in this atlas
+    std::vector<SkylineNode>           mSkyline;             // skyline of the packed area (PACK_SKYLINE only)
+    std::vector<AtlasRegion>           mFreeRegions;         // previously freed regions (PACK_SKYLINE only)
+    PixelData                          mClearPixels;         // Image used to clear a region before upload (PACK_SKYLINE only)
+    SizeType                           mAllocatedPixels{0u}; // pixels allocated to images, including padding (PACK_SKYLINE only)
+    SizeType                           mImagePixels{0u};     // pixels covered by images
+    SizeType                           mImageCount{0u};      // number of images stored
   };
 
   struct AtlasSlotDescriptor
   {
-    SizeType mCount;       // Reference count for this slot
-    SizeType mImageWidth;  // Width of image stored
-    SizeType mImageHeight; // Height of image stored
-    AtlasId  mAtlasId;     // Image is stored in this Atlas
-    SizeType mBlock;       // Block within atlas used for image
+    SizeType    mCount;       // Reference count for this slot
+    SizeType    mImageWidth;  // Width of image stored
+    SizeType    mImageHeight; // Height of image stored
+    AtlasId     mAtlasId;     // Image is stored in this Atlas
+    SizeType    mBlock;       // Block within atlas used for image
+    AtlasRegion mRegion;      // Region within atlas used for image, including padding (PACK_SKYLINE only)
   };
 
   AtlasManager();
@@ -92,6 +123,16 @@ public:
    */
   void SetAddPolicy(Toolkit::AtlasManager::AddFailPolicy policy);
 
+  /**
+   * @copydoc Toolkit::AtlasManager::SetPackingMode
+   */
+  void SetPackingMode(Toolkit::AtlasManager::PackingMode mode);
+
+  /**
+   * @copydoc Toolkit::AtlasManager::GetPackingMode
+   */
+  Toolkit::AtlasManager::PackingMode GetPackingMode() const;
+
   /**
    * @copydoc Toolkit::AtlasManager::Add
    */
@@ -167,19 +208,95 @@ public:
    */
   void SetTextures(AtlasId atlas, TextureSet& textureSet);
 
+  /**
+   * @copydoc Toolkit::AtlasManager::CanAdd
+   */
+  bool CanAdd(SizeType width, SizeType height, Pixel::Format pixelFormat) const;
+
+  /**
+   * @copydoc Toolkit::AtlasManager::GetTextureMemoryUsed
+   */
+  SizeType GetTextureMemoryUsed() const;
+
+  /**
+   * @copydoc Toolkit::AtlasManager::GetNewAtlasTextureMemory
+   */
+  SizeType GetNewAtlasTextureMemory(Pixel::Format pixelFormat) const;
+
+  /**
+   * @copydoc Toolkit::AtlasManager::ReleaseEmptyAtlases
+   */
+  SizeType ReleaseEmptyAtlases();
+
+  /**
+   * @copydoc Toolkit::AtlasManager::SetAtlasDraining
+   */
+  void SetAtlasDraining(AtlasId atlas, bool draining);
+
+  /**
+   * @copydoc Toolkit::AtlasManager::IsAtlasDraining
+   */
+  bool IsAtlasDraining(AtlasId atlas) const;
+
+  /**
+   * @copydoc Toolkit::AtlasManager::GetOccupancy
+   */
+  float GetOccupancy(AtlasId atlas) const;
+
 private:
   std::vector<AtlasDescriptor>         mAtlasList;     // List of atlases created
   Vector<AtlasSlotDescriptor>          mImageList;     // List of bitmaps stored in atlases
   Toolkit::AtlasManager::AtlasSize     mNewAtlasSize;  // Atlas size to use in next creation
   Toolkit::AtlasManager::AddFailPolicy mAddFailPolicy; // Policy for failing to add an Image
+  Toolkit::AtlasManager::PackingMode   mPackingMode;   // Packing mode to use in next creation
 
   SizeType CheckAtlas(SizeType      atlas,
                       SizeType      width,
                       SizeType      height,
-                      Pixel::Format pixelFormat);
+                      Pixel::Format pixelFormat) const;
 
   void UploadImage(const PixelData&           image,
                    const AtlasSlotDescriptor& desc);
+
+  /**
+   * @brief Find where an image would be placed in a PACK_SKYLINE atlas
+   *
+   * @param[in]  atlas The atlas descriptor
+   * @param[in]  width Width of the image, without padding
+   * @param[in]  height Height of the image, without padding
+   * @param[out] region The region to use, including padding
+   * @param[out] freeRegion Index of the freed region to reuse, or the size of the free region list to use the skyline
+   * @param[out] skylineNode Index of the skyline node the region starts at
+   *
+   * @return true if the image fits
+   */
+  bool FindRegion(const AtlasDescriptor& atlas,
+                  SizeType               width,
+                  SizeType               height,
+                  AtlasRegion&           region,
+                  SizeType&              freeRegion,
+                  SizeType&              skylineNode) const;
+
+  /**
+   * @brief Allocate a region for an image in a PACK_SKYLINE atlas
+   *
+   * @param[in,out] atlas The atlas descriptor
+   * @param[in]     width Width of the image, without padding
+   * @param[in]     height Height of the image, without padding
+   * @param[out]    region The region allocated, including padding
+   *
+   * @return true if a region was allocated
+   */
+  bool AllocateRegion(AtlasDescriptor& atlas,
+                      SizeType         width,
+                      SizeType         height,
+                      AtlasRegion&     region);
+
+  /**
+   * @brief Upload an image to a PACK_SKYLINE atlas, clearing the rest of its region
+   */
+  void UploadImageToRegion(const PixelData&           image,
+                           const AtlasSlotDescriptor& desc);
 };
 
 } // namespace Internal
@@ -53,6 +53,16 @@ void AtlasManager::SetAddPolicy(AddFailPolicy policy)
   GetImplementation(*this).SetAddPolicy(policy);
 }
 
+void AtlasManager::SetPackingMode(PackingMode mode)
+{
+  GetImplementation(*this).SetPackingMode(mode);
+}
+
+AtlasManager::PackingMode AtlasManager::GetPackingMode() const
+{
+  return GetImplementation(*this).GetPackingMode();
+}
+
 bool AtlasManager::Add(const PixelData&         image,
                        AtlasManager::AtlasSlot& slot,
                        AtlasManager::AtlasId    atlas)
@@ -126,6 +136,41 @@ void AtlasManager::SetTextures(AtlasId atlas, TextureSet& textureSet)
   GetImplementation(*this).SetTextures(atlas, textureSet);
 }
 
+bool AtlasManager::CanAdd(SizeType width, SizeType height, Pixel::Format pixelFormat) const
+{
+  return GetImplementation(*this).CanAdd(width, height, pixelFormat);
+}
+
+AtlasManager::SizeType AtlasManager::GetTextureMemoryUsed() const
+{
+  return GetImplementation(*this).GetTextureMemoryUsed();
+}
+
+AtlasManager::SizeType AtlasManager::GetNewAtlasTextureMemory(Pixel::Format pixelFormat) const
+{
+  return GetImplementation(*this).GetNewAtlasTextureMemory(pixelFormat);
+}
+
+AtlasManager::SizeType AtlasManager::ReleaseEmptyAtlases()
+{
+  return GetImplementation(*this).ReleaseEmptyAtlases();
+}
+
+void AtlasManager::SetAtlasDraining(AtlasId atlas, bool draining)
+{
+  GetImplementation(*this).SetAtlasDraining(atlas, draining);
+}
+
+bool AtlasManager::IsAtlasDraining(AtlasId atlas) const
+{
+  return GetImplementation(*this).IsAtlasDraining(atlas);
+}
+
+float AtlasManager::GetOccupancy(AtlasId atlas) const
+{
+  return GetImplementation(*this).GetOccupancy(atlas);
+}
+
 } // namespace Toolkit
 
 } // namespace Dali
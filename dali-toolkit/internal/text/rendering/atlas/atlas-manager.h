@@ -56,6 +56,8 @@ public:
     AtlasSize     mSize;        ///< size of atlas and blocks
     SizeType      mBlocksUsed;  ///< number of blocks used in the atlas
     SizeType      mTotalBlocks; ///< total blocks used by atlas
+    SizeType      mImageCount;  ///< number of images stored in the atlas
+    float         mOccupancy;   ///< fraction of the atlas pixels covered by images
     Pixel::Format mPixelFormat; ///< pixel format of the atlas
   };
 
@@ -109,6 +111,15 @@ public:
    */
   ~AtlasManager();
 
+  /**
+   * Policy on how images are placed within an atlas
+   */
+  enum PackingMode
+  {
+    PACK_BLOCKS, ///< Each image uses a block of the size set by SetNewAtlasSize()
+    PACK_SKYLINE ///< Each image uses an area of its own size, placed by a skyline packer
+  };
+
   /**
    * Policy on failing to add an image
    */
@@ -146,6 +157,23 @@ public:
    */
   void SetAddPolicy(AddFailPolicy policy);
 
+  /**
+   * @brief Set how images are placed within atlases created after this call
+   *
+   * @details In PACK_SKYLINE mode, the block size of the atlas size is only used to decide
+   *          whether an image will fit into a newly created atlas.
+   *
+   * @param[in] mode packing mode for new atlases
+   */
+  void SetPackingMode(PackingMode mode);
+
+  /**
+   * @brief Get the packing mode used for new atlases
+   *
+   * @return the packing mode
+   */
+  PackingMode GetPackingMode() const;
+
   /**
    * @brief Attempts to add an image to the most suitable atlas
    *
@@ -269,6 +297,73 @@ public:
    */
   void SetTextures(AtlasId atlas, TextureSet& textureSet);
 
+  /**
+   * @brief Check whether an image can be added to an existing atlas without creating a new one
+   *
+   * @param[in] width width of the image in pixels
+   * @param[in] height height of the image in pixels
+   * @param[in] pixelFormat pixel format of the image
+   *
+   * @return true if an existing atlas has room for the image
+   */
+  bool CanAdd(SizeType width, SizeType height, Pixel::Format pixelFormat) const;
+
+  /**
+   * @brief Get the texture memory used by all live atlases
+   *
+   * @return texture memory in bytes
+   */
+  SizeType GetTextureMemoryUsed() const;
+
+  /**
+   * @brief Get the texture memory a new atlas would use, with the current new atlas size
+   *
+   * @param[in] pixelFormat pixel format of the new atlas
+   *
+   * @return texture memory in bytes
+   */
+  SizeType GetNewAtlasTextureMemory(Pixel::Format pixelFormat) const;
+
+  /**
+   * @brief Release the textures of atlases which no longer hold any images
+   *
+   * @details The atlas Id of a released atlas may be reused by a subsequently created atlas.
+   *
+   * @return number of atlases released
+   */
+  SizeType ReleaseEmptyAtlases();
+
+  /**
+   * @brief Set whether an atlas is draining
+   *
+   * @details No images are added to a draining atlas, so that it can be released once
+   *          the images it holds have been removed.
+   *
+   * @param[in] atlas AtlasId
+   * @param[in] draining true to stop adding images to this atlas
+   */
+  void SetAtlasDraining(AtlasId atlas, bool draining);
+
+  /**
+   * @brief Query whether an atlas is draining
+   *
+   * @param[in] atlas AtlasId
+   *
+   * @return true if the atlas is draining
+   */
+  bool IsAtlasDraining(AtlasId atlas) const;
+
+  /**
+   * @brief Get the fraction of an atlas that is allocated to images
+   *
+   * @details In PACK_BLOCKS mode this is the fraction of blocks in use.
+   *
+   * @param[in] atlas AtlasId
+   *
+   * @return occupancy, between 0 and 1
+   */
+  float GetOccupancy(AtlasId atlas) const;
+
 public:
   // Default copy and move operator
   AtlasManager(const AtlasManager& rhs)            = default;
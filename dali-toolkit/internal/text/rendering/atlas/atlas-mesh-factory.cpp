@@ -25,6 +25,64 @@ namespace Internal
 {
 namespace AtlasMeshFactory
 {
+namespace
+{
+void AddQuad(const Vector2&                 topLeft,
+             float                          vertexWidth,
+             float                          vertexHeight,
+             float                          texCoordX,
+             float                          texCoordY,
+             float                          texCoordWidth,
+             float                          texCoordHeight,
+             Toolkit::AtlasManager::Mesh2D& mesh)
+{
+  Toolkit::AtlasManager::Vertex2D vertex;
+
+  // Top left
+  vertex.mPosition.x  = topLeft.x;
+  vertex.mPosition.y  = topLeft.y;
+  vertex.mTexCoords.x = texCoordX;
+  vertex.mTexCoords.y = texCoordY;
+
+  mesh.mVertices.Reserve(4u);
+  mesh.mVertices.PushBack(vertex);
+
+  // Top Right
+  vertex.mPosition.x  = topLeft.x + vertexWidth;
+  vertex.mPosition.y  = topLeft.y;
+  vertex.mTexCoords.x = texCoordX + texCoordWidth;
+  vertex.mTexCoords.y = texCoordY;
+
+  mesh.mVertices.PushBack(vertex);
+
+  // Bottom Left
+  vertex.mPosition.x  = topLeft.x;
+  vertex.mPosition.y  = topLeft.y + vertexHeight;
+  vertex.mTexCoords.x = texCoordX;
+  vertex.mTexCoords.y = texCoordY + texCoordHeight;
+
+  mesh.mVertices.PushBack(vertex);
+
+  // Bottom Right
+  vertex.mPosition.x  = topLeft.x + vertexWidth;
+  vertex.mPosition.y  = topLeft.y + vertexHeight;
+  vertex.mTexCoords.x = texCoordX + texCoordWidth;
+  vertex.mTexCoords.y = texCoordY + texCoordHeight;
+
+  mesh.mVertices.PushBack(vertex);
+
+  // Six indices in counter clockwise winding
+  mesh.mIndices.Reserve(6u);
+  mesh.mIndices.PushBack(1u);
+  mesh.mIndices.PushBack(0u);
+  mesh.mIndices.PushBack(2u);
+  mesh.mIndices.PushBack(2u);
+  mesh.mIndices.PushBack(3u);
+  mesh.mIndices.PushBack(1u);
+}
+
+} // namespace
+
 void CreateQuad(SizeType                                imageWidth,
                 SizeType                                imageHeight,
                 SizeType                                block,
@@ -32,8 +90,6 @@ void CreateQuad(SizeType                                imageWidth,
                 const Vector2&                          position,
                 Toolkit::AtlasManager::Mesh2D&          mesh)
 {
-  Toolkit::AtlasManager::Vertex2D vertex;
-
   SizeType blockWidth  = atlasSize.mBlockWidth;
   SizeType blockHeight = atlasSize.mBlockHeight;
 
@@ -91,47 +147,31 @@ void CreateQuad(SizeType                                imageWidth,
   float texelWidthOffset  = texelWidth + texelX;
   float texelHeightOffset = texelHeight + texelY;
 
-  // Top left
-  vertex.mPosition.x  = topLeft.x;
-  vertex.mPosition.y  = topLeft.y;
-  vertex.mTexCoords.x = fBlockX;
-  vertex.mTexCoords.y = fBlockY;
-
-  mesh.mVertices.Reserve(4u);
-  mesh.mVertices.PushBack(vertex);
-
-  // Top Right
-  vertex.mPosition.x  = topLeft.x + vertexWidth;
-  vertex.mPosition.y  = topLeft.y;
-  vertex.mTexCoords.x = fBlockX + texelWidthOffset;
-  vertex.mTexCoords.y = fBlockY;
-
-  mesh.mVertices.PushBack(vertex);
+  AddQuad(topLeft, vertexWidth, vertexHeight, fBlockX, fBlockY, texelWidthOffset, texelHeightOffset, mesh);
+}
 
-  // Bottom Left
-  vertex.mPosition.x  = topLeft.x;
-  vertex.mPosition.y  = topLeft.y + vertexHeight;
-  vertex.mTexCoords.x = fBlockX;
-  vertex.mTexCoords.y = fBlockY + texelHeightOffset;
+void CreateQuad(SizeType                                imageWidth,
+                SizeType                                imageHeight,
+                SizeType                                imageX,
+                SizeType                                imageY,
+                const Toolkit::AtlasManager::AtlasSize& atlasSize,
+                const Vector2&                          position,
+                Toolkit::AtlasManager::Mesh2D&          mesh)
+{
+  // Get the normalized size of a texel in both directions
+  float texelX = 1.0f / static_cast<float>(atlasSize.mWidth);
+  float texelY = 1.0f / static_cast<float>(atlasSize.mHeight);
 
-  mesh.mVertices.PushBack(vertex);
+  // As above, 'blit' half a pixel more on each edge
+  float vertexWidth  = static_cast<float>(imageWidth + 1u);
+  float vertexHeight = static_cast<float>(imageHeight + 1u);
 
-  // Bottom Right
-  vertex.mPosition.x  = topLeft.x + vertexWidth;
-  vertex.mPosition.y  = topLeft.y + vertexHeight;
-  vertex.mTexCoords.x = fBlockX + texelWidthOffset;
-  vertex.mTexCoords.y = fBlockY + texelHeightOffset;
+  Vector2 topLeft = Vector2(position.x - 0.5f, position.y - 0.5f);
 
-  mesh.mVertices.PushBack(vertex);
+  float texCoordX = (static_cast<float>(imageX) - 0.5f) * texelX;
+  float texCoordY = (static_cast<float>(imageY) - 0.5f) * texelY;
 
-  // Six indices in counter clockwise winding
-  mesh.mIndices.Reserve(6u);
-  mesh.mIndices.PushBack(1u);
-  mesh.mIndices.PushBack(0u);
-  mesh.mIndices.PushBack(2u);
-  mesh.mIndices.PushBack(2u);
-  mesh.mIndices.PushBack(3u);
-  mesh.mIndices.PushBack(1u);
+  AddQuad(topLeft, vertexWidth, vertexHeight, texCoordX, texCoordY, vertexWidth * texelX, vertexHeight * texelY, mesh);
 }
 
 void AppendMesh(Toolkit::AtlasManager::Mesh2D&       first,
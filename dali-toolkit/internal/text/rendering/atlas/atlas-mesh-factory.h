@@ -47,6 +47,25 @@ void CreateQuad(SizeType                                width,
                 const Vector2&                          position,
                 Toolkit::AtlasManager::Mesh2D&          mesh);
 
+/**
+ * @brief Create a Quad that describes an image at a pixel offset in an atlas and a position.
+ *
+ * @param[in]  width Width of image in pixels.
+ * @param[in]  height Height of image in pixels.
+ * @param[in]  imageX Horizontal offset of the image in the atlas, in pixels.
+ * @param[in]  imageY Vertical offset of the image in the atlas, in pixels.
+ * @param[in]  atlasSize Atlas dimensions.
+ * @param[in]  position Position to place area in space.
+ * @param[out] mesh Mesh object to hold created quad.
+ */
+void CreateQuad(SizeType                                width,
+                SizeType                                height,
+                SizeType                                imageX,
+                SizeType                                imageY,
+                const Toolkit::AtlasManager::AtlasSize& atlasSize,
+                const Vector2&                          position,
+                Toolkit::AtlasManager::Mesh2D&          mesh);
+
 /**
  * @brief Append one mesh to another.
  *
@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/text/rendering/text-typesetter-blending.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define DALI_TEXT_BLENDING_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DALI_TEXT_BLENDING_NEON
+#endif
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace Blending
+{
+namespace
+{
+const char* DALI_TEXT_BLENDING_KERNEL("DALI_TEXT_BLENDING_KERNEL");
+
+/**
+ * @brief Fast multiply & divide by 255. It wiil be useful when we applying alpha value in color
+ *
+ * @param x The value between [0..255]
+ * @param y The value between [0..255]
+ * @return (x*y)/255
+ */
+inline uint8_t MultiplyAndNormalizeColor(const uint8_t x, const uint8_t y) noexcept
+{
+  const uint32_t xy = static_cast<uint32_t>(x) * y;
+  return ((xy << 15) + (xy << 7) + xy) >> 23;
+}
+
+/**
+ * @brief Fast multiply & Summation & divide by 255.
+ *
+ * @param x1 The value between [0..255]
+ * @param y1 The value between [0..255]
+ * @param x2 The value between [0..255]
+ * @param y2 The value between [0..255]
+ * @return min(255, (x1*y1)/255 + (x2*y2)/255)
+ */
+inline uint8_t MultiplyAndSummationAndNormalizeColor(const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2) noexcept
+{
+  const uint32_t xy1 = static_cast<uint32_t>(x1) * y1;
+  const uint32_t xy2 = static_cast<uint32_t>(x2) * y2;
+  const uint32_t res = std::min(65025u, xy1 + xy2); // 65025 is 255 * 255.
+  return ((res + ((res + 257) >> 8)) >> 8);         // fast divide by 255.
+}
+
+void CombinePixelsScalar(const uint32_t* top, const uint32_t* bottom, uint32_t* result, uint32_t numberOfPixels)
+{
+  for(uint32_t pixelIndex = 0u; pixelIndex < numberOfPixels; ++pixelIndex)
+  {
+    // Note : Be careful when we read & write into result. It can be the same pointer as top or bottom.
+    const uint32_t topColor = *(top + pixelIndex);
+    const uint8_t  topAlpha = static_cast<uint8_t>(topColor >> 24);
+
+    if(topAlpha == 0)
+    {
+      *(result + pixelIndex) = *(bottom + pixelIndex);
+    }
+    else if(topAlpha == 255)
+    {
+      *(result + pixelIndex) = topColor;
+    }
+    else
+    {
+      // "Over" blend the the pixel from top with the pixel in bottom
+      uint32_t blendedBottomColor                    = *(bottom + pixelIndex);
+      uint8_t* __restrict__ blendedBottomColorBuffer = reinterpret_cast<uint8_t*>(&blendedBottomColor);
+
+      blendedBottomColorBuffer[0] = MultiplyAndNormalizeColor(blendedBottomColorBuffer[0], 255 - topAlpha);
+      blendedBottomColorBuffer[1] = MultiplyAndNormalizeColor(blendedBottomColorBuffer[1], 255 - topAlpha);
+      blendedBottomColorBuffer[2] = MultiplyAndNormalizeColor(blendedBottomColorBuffer[2], 255 - topAlpha);
+      blendedBottomColorBuffer[3] = MultiplyAndNormalizeColor(blendedBottomColorBuffer[3], 255 - topAlpha);
+
+      *(result + pixelIndex) = topColor + blendedBottomColor;
+    }
+  }
+}
+
+void MaskPixelsScalar(const uint32_t* top, uint32_t* bottom, uint32_t numberOfPixels, uint8_t alpha)
+{
+  for(uint32_t pixelIndex = 0u; pixelIndex < numberOfPixels; ++pixelIndex)
+  {
+    uint32_t topColor                       = *(top + pixelIndex);
+    uint32_t bottomColor                    = *(bottom + pixelIndex);
+    uint8_t* __restrict__ topColorBuffer    = reinterpret_cast<uint8_t*>(&topColor);
+    uint8_t* __restrict__ bottomColorBuffer = reinterpret_cast<uint8_t*>(&bottomColor);
+
+    const uint8_t bottomAlpha = 255 - topColorBuffer[3];
+
+    bottomColorBuffer[0] = MultiplyAndSummationAndNormalizeColor(topColorBuffer[0], alpha, bottomColorBuffer[0], bottomAlpha);
+    bottomColorBuffer[1] = MultiplyAndSummationAndNormalizeColor(topColorBuffer[1], alpha, bottomColorBuffer[1], bottomAlpha);
+    bottomColorBuffer[2] = MultiplyAndSummationAndNormalizeColor(topColorBuffer[2], alpha, bottomColorBuffer[2], bottomAlpha);
+    bottomColorBuffer[3] = MultiplyAndSummationAndNormalizeColor(topColorBuffer[3], alpha, bottomColorBuffer[3], bottomAlpha);
+
+    *(bottom + pixelIndex) = bottomColor;
+  }
+}
+
+void BlitGlyphRowScalar(const uint8_t* coverage, uint32_t coverageStride, uint32_t* pixels, uint32_t numberOfPixels, uint32_t color)
+{
+  const uint8_t* __restrict__ colorBuffer = reinterpret_cast<const uint8_t*>(&color);
+
+  for(uint32_t pixelIndex = 0u; pixelIndex < numberOfPixels; ++pixelIndex)
+  {
+    const uint8_t alpha = *(coverage + pixelIndex * coverageStride);
+
+    // Copy non-transparent pixels only
+    if(alpha > 0u)
+    {
+      uint32_t& currentColor = *(pixels + pixelIndex);
+
+      // Don't overwrite a previous bigger alpha with a smaller one.
+      const uint8_t currentAlpha = std::max(static_cast<uint8_t>(currentColor >> 24), alpha);
+      if(currentAlpha == 255)
+      {
+        currentColor = color;
+      }
+      else
+      {
+        // Color is pre-muliplied with its alpha.
+        uint32_t packedColor                    = 0u;
+        uint8_t* __restrict__ packedColorBuffer = reinterpret_cast<uint8_t*>(&packedColor);
+
+        *(packedColorBuffer + 3u) = MultiplyAndNormalizeColor(*(colorBuffer + 3u), currentAlpha);
+        *(packedColorBuffer + 2u) = MultiplyAndNormalizeColor(*(colorBuffer + 2u), currentAlpha);
+        *(packedColorBuffer + 1u) = MultiplyAndNormalizeColor(*(colorBuffer + 1u), currentAlpha);
+        *(packedColorBuffer)      = MultiplyAndNormalizeColor(*colorBuffer, currentAlpha);
+
+        currentColor = packedColor;
+      }
+    }
+  }
+}
+
+#if defined(DALI_TEXT_BLENDING_SSE2)
+
+/**
+ * @brief (x*y)/255 for eight 16bit lanes, rounded as MultiplyAndNormalizeColor().
+ */
+inline __m128i MultiplyAndNormalize(const __m128i x, const __m128i y)
+{
+  const __m128i xy = _mm_mullo_epi16(x, y);
+  return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(xy, _mm_srli_epi16(xy, 8)), _mm_set1_epi16(1)), 8);
+}
+
+/**
+ * @brief Replicates the low byte of each pixel into the four 16bit lanes of the pixel's channels.
+ *
+ * @param[in] value Four pixels with a value between [0..255] in each 32bit lane.
+ * @param[out] low The value for the channels of the first two pixels.
+ * @param[out] high The value for the channels of the last two pixels.
+ */
+inline void SpreadToChannels(const __m128i value, __m128i& low, __m128i& high)
+{
+  const __m128i value16 = _mm_or_si128(value, _mm_slli_epi32(value, 16));
+  low                   = _mm_unpacklo_epi32(value16, value16);
+  high                  = _mm_unpackhi_epi32(value16, value16);
+}
+
+inline __m128i Select(const __m128i mask, const __m128i ifTrue, const __m128i ifFalse)
+{
+  return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+
+void CombinePixelsSimd(const uint32_t* top, const uint32_t* bottom, uint32_t* result, uint32_t numberOfPixels)
+{
+  const __m128i zero   = _mm_setzero_si128();
+  const __m128i opaque = _mm_set1_epi32(255);
+
+  uint32_t pixelIndex = 0u;
+  for(; pixelIndex + 4u <= numberOfPixels; pixelIndex += 4u)
+  {
+    const __m128i topColor    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + pixelIndex));
+    const __m128i bottomColor = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + pixelIndex));
+
+    const __m128i topAlpha = _mm_srli_epi32(topColor, 24);
+
+    __m128i inverseAlphaLow, inverseAlphaHigh;
+    SpreadToChannels(_mm_sub_epi32(opaque, topAlpha), inverseAlphaLow, inverseAlphaHigh);
+
+    const __m128i blendedLow    = MultiplyAndNormalize(_mm_unpacklo_epi8(bottomColor, zero), inverseAlphaLow);
+    const __m128i blendedHigh   = MultiplyAndNormalize(_mm_unpackhi_epi8(bottomColor, zero), inverseAlphaHigh);
+    const __m128i blendedColor  = _mm_add_epi8(topColor, _mm_packus_epi16(blendedLow, blendedHigh));
+    const __m128i combinedColor = Select(_mm_cmpeq_epi32(topAlpha, opaque), topColor, Select(_mm_cmpeq_epi32(topAlpha, zero), bottomColor, blendedColor));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(result + pixelIndex), combinedColor);
+  }
+
+  CombinePixelsScalar(top + pixelIndex, bottom + pixelIndex, result + pixelIndex, numberOfPixels - pixelIndex);
+}
+
+void MaskPixelsSimd(const uint32_t* top, uint32_t* bottom, uint32_t numberOfPixels, uint8_t alpha)
+{
+  const __m128i zero    = _mm_setzero_si128();
+  const __m128i opaque  = _mm_set1_epi32(255);
+  const __m128i alpha16 = _mm_set1_epi16(alpha);
+  const __m128i maximum = _mm_set1_epi16(static_cast<int16_t>(65025)); // 65025 is 255 * 255.
+  const __m128i bias    = _mm_set1_epi16(257);
+
+  uint32_t pixelIndex = 0u;
+  for(; pixelIndex + 4u <= numberOfPixels; pixelIndex += 4u)
+  {
+    const __m128i topColor    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + pixelIndex));
+    const __m128i bottomColor = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + pixelIndex));
+
+    __m128i bottomAlphaLow, bottomAlphaHigh;
+    SpreadToChannels(_mm_sub_epi32(opaque, _mm_srli_epi32(topColor, 24)), bottomAlphaLow, bottomAlphaHigh);
+
+    __m128i sumLow  = _mm_adds_epu16(_mm_mullo_epi16(_mm_unpacklo_epi8(topColor, zero), alpha16), _mm_mullo_epi16(_mm_unpacklo_epi8(bottomColor, zero), bottomAlphaLow));
+    __m128i sumHigh = _mm_adds_epu16(_mm_mullo_epi16(_mm_unpackhi_epi8(topColor, zero), alpha16), _mm_mullo_epi16(_mm_unpackhi_epi8(bottomColor, zero), bottomAlphaHigh));
+
+    // min(65025, sum). SSE2 has no unsigned 16bit min.
+    sumLow  = _mm_sub_epi16(sumLow, _mm_subs_epu16(sumLow, maximum));
+    sumHigh = _mm_sub_epi16(sumHigh, _mm_subs_epu16(sumHigh, maximum));
+
+    sumLow  = _mm_srli_epi16(_mm_add_epi16(sumLow, _mm_srli_epi16(_mm_add_epi16(sumLow, bias), 8)), 8);
+    sumHigh = _mm_srli_epi16(_mm_add_epi16(sumHigh, _mm_srli_epi16(_mm_add_epi16(sumHigh, bias), 8)), 8);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bottom + pixelIndex), _mm_packus_epi16(sumLow, sumHigh));
+  }
+
+  MaskPixelsScalar(top + pixelIndex, bottom + pixelIndex, numberOfPixels - pixelIndex, alpha);
+}
+
+void BlitGlyphRowSimd(const uint8_t* coverage, uint32_t coverageStride, uint32_t* pixels, uint32_t numberOfPixels, uint32_t color)
+{
+  uint32_t pixelIndex = 0u;
+  if(1u == coverageStride)
+  {
+    const __m128i zero         = _mm_setzero_si128();
+    const __m128i color32      = _mm_set1_epi32(static_cast<int32_t>(color));
+    const __m128i colorChannel = _mm_unpacklo_epi8(color32, zero);
+
+    for(; pixelIndex + 4u <= numberOfPixels; pixelIndex += 4u)
+    {
+      uint32_t packedCoverage;
+      memcpy(&packedCoverage, coverage + pixelIndex, sizeof(packedCoverage));
+      if(0u == packedCoverage)
+      {
+        continue;
+      }
+
+      const __m128i glyphAlpha   = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int32_t>(packedCoverage)), zero), zero);
+      const __m128i currentColor = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + pixelIndex));
+
+      // Both alphas are below 256, so a signed 16bit max is enough.
+      const __m128i alpha = _mm_max_epi16(glyphAlpha, _mm_srli_epi32(currentColor, 24));
+
+      __m128i alphaLow, alphaHigh;
+      SpreadToChannels(alpha, alphaLow, alphaHigh);
+
+      const __m128i packedColor = _mm_packus_epi16(MultiplyAndNormalize(colorChannel, alphaLow), MultiplyAndNormalize(colorChannel, alphaHigh));
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + pixelIndex), Select(_mm_cmpeq_epi32(glyphAlpha, zero), currentColor, packedColor));
+    }
+  }
+
+  BlitGlyphRowScalar(coverage + pixelIndex * coverageStride, coverageStride, pixels + pixelIndex, numberOfPixels - pixelIndex, color);
+}
+
+#elif defined(DALI_TEXT_BLENDING_NEON)
+
+/**
+ * @brief (x*y)/255 for eight 16bit lanes holding x*y, rounded as MultiplyAndNormalizeColor().
+ */
+inline uint8x8_t Normalize(const uint16x8_t xy)
+{
+  return vmovn_u16(vshrq_n_u16(vaddq_u16(vaddq_u16(xy, vshrq_n_u16(xy, 8)), vdupq_n_u16(1)), 8));
+}
+
+/**
+ * @brief Replicates the low byte of each pixel into the four bytes of the pixel.
+ */
+inline uint8x16_t SpreadToChannels(const uint32x4_t value)
+{
+  return vreinterpretq_u8_u32(vmulq_n_u32(value, 0x01010101u));
+}
+
+void CombinePixelsSimd(const uint32_t* top, const uint32_t* bottom, uint32_t* result, uint32_t numberOfPixels)
+{
+  uint32_t pixelIndex = 0u;
+  for(; pixelIndex + 4u <= numberOfPixels; pixelIndex += 4u)
+  {
+    const uint32x4_t topColor    = vld1q_u32(top + pixelIndex);
+    const uint32x4_t bottomColor = vld1q_u32(bottom + pixelIndex);
+
+    const uint32x4_t topAlpha     = vshrq_n_u32(topColor, 24);
+    const uint8x16_t inverseAlpha = SpreadToChannels(vsubq_u32(vdupq_n_u32(255u), topAlpha));
+    const uint8x16_t bottomColor8 = vreinterpretq_u8_u32(bottomColor);
+
+    const uint8x8_t  blendedLow   = Normalize(vmull_u8(vget_low_u8(bottomColor8), vget_low_u8(inverseAlpha)));
+    const uint8x8_t  blendedHigh  = Normalize(vmull_u8(vget_high_u8(bottomColor8), vget_high_u8(inverseAlpha)));
+    const uint32x4_t blendedColor = vreinterpretq_u32_u8(vaddq_u8(vreinterpretq_u8_u32(topColor), vcombine_u8(blendedLow, blendedHigh)));
+
+    uint32x4_t combinedColor = vbslq_u32(vceqq_u32(topAlpha, vdupq_n_u32(0u)), bottomColor, blendedColor);
+    combinedColor            = vbslq_u32(vceqq_u32(topAlpha, vdupq_n_u32(255u)), topColor, combinedColor);
+
+    vst1q_u32(result + pixelIndex, combinedColor);
+  }
+
+  CombinePixelsScalar(top + pixelIndex, bottom + pixelIndex, result + pixelIndex, numberOfPixels - pixelIndex);
+}
+
+void MaskPixelsSimd(const uint32_t* top, uint32_t* bottom, uint32_t numberOfPixels, uint8_t alpha)
+{
+  const uint8x8_t  alpha8  = vdup_n_u8(alpha);
+  const uint16x8_t maximum = vdupq_n_u16(65025u); // 65025 is 255 * 255.
+  const uint16x8_t bias    = vdupq_n_u16(257u);
+
+  uint32_t pixelIndex = 0u;
+  for(; pixelIndex + 4u <= numberOfPixels; pixelIndex += 4u)
+  {
+    const uint32x4_t topColor    = vld1q_u32(top + pixelIndex);
+    const uint8x16_t topColor8   = vreinterpretq_u8_u32(topColor);
+    const uint8x16_t bottomColor = vreinterpretq_u8_u32(vld1q_u32(bottom + pixelIndex));
+    const uint8x16_t bottomAlpha = SpreadToChannels(vsubq_u32(vdupq_n_u32(255u), vshrq_n_u32(topColor, 24)));
+
+    uint16x8_t sumLow  = vminq_u16(vqaddq_u16(vmull_u8(vget_low_u8(topColor8), alpha8), vmull_u8(vget_low_u8(bottomColor), vget_low_u8(bottomAlpha))), maximum);
+    uint16x8_t sumHigh = vminq_u16(vqaddq_u16(vmull_u8(vget_high_u8(topColor8), alpha8), vmull_u8(vget_high_u8(bottomColor), vget_high_u8(bottomAlpha))), maximum);
+
+    sumLow  = vshrq_n_u16(vaddq_u16(sumLow, vshrq_n_u16(vaddq_u16(sumLow, bias), 8)), 8);
+    sumHigh = vshrq_n_u16(vaddq_u16(sumHigh, vshrq_n_u16(vaddq_u16(sumHigh, bias), 8)), 8);
+
+    vst1q_u32(bottom + pixelIndex, vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(sumLow), vmovn_u16(sumHigh))));
+  }
+
+  MaskPixelsScalar(top + pixelIndex, bottom + pixelIndex, numberOfPixels - pixelIndex, alpha);
+}
+
+void BlitGlyphRowSimd(const uint8_t* coverage, uint32_t coverageStride, uint32_t* pixels, uint32_t numberOfPixels, uint32_t color)
+{
+  uint32_t pixelIndex = 0u;
+  if(1u == coverageStride)
+  {
+    const uint8x16_t color8 = vreinterpretq_u8_u32(vdupq_n_u32(color));
+
+    for(; pixelIndex + 4u <= numberOfPixels; pixelIndex += 4u)
+    {
+      uint32_t packedCoverage;
+      memcpy(&packedCoverage, coverage + pixelIndex, sizeof(packedCoverage));
+      if(0u == packedCoverage)
+      {
+        continue;
+      }
+
+      const uint32x4_t glyphAlpha   = vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packedCoverage)))));
+      const uint32x4_t currentColor = vld1q_u32(pixels + pixelIndex);
+      const uint8x16_t alpha        = SpreadToChannels(vmaxq_u32(glyphAlpha, vshrq_n_u32(currentColor, 24)));
+
+      const uint8x8_t  packedLow   = Normalize(vmull_u8(vget_low_u8(color8), vget_low_u8(alpha)));
+      const uint8x8_t  packedHigh  = Normalize(vmull_u8(vget_high_u8(color8), vget_high_u8(alpha)));
+      const uint32x4_t packedColor = vreinterpretq_u32_u8(vcombine_u8(packedLow, packedHigh));
+
+      vst1q_u32(pixels + pixelIndex, vbslq_u32(vceqq_u32(glyphAlpha, vdupq_n_u32(0u)), currentColor, packedColor));
+    }
+  }
+
+  BlitGlyphRowScalar(coverage + pixelIndex * coverageStride, coverageStride, pixels + pixelIndex, numberOfPixels - pixelIndex, color);
+}
+
+#endif
+
+struct Kernels
+{
+  KernelType type;
+  void (*combinePixels)(const uint32_t*, const uint32_t*, uint32_t*, uint32_t);
+  void (*maskPixels)(const uint32_t*, uint32_t*, uint32_t, uint8_t);
+  void (*blitGlyphRow)(const uint8_t*, uint32_t, uint32_t*, uint32_t, uint32_t);
+};
+
+const Kernels SCALAR_KERNELS{KernelType::SCALAR, &CombinePixelsScalar, &MaskPixelsScalar, &BlitGlyphRowScalar};
+
+#if defined(DALI_TEXT_BLENDING_SSE2) || defined(DALI_TEXT_BLENDING_NEON)
+const Kernels  SIMD_KERNELS{KernelType::SIMD, &CombinePixelsSimd, &MaskPixelsSimd, &BlitGlyphRowSimd};
+constexpr bool SIMD_AVAILABLE = true;
+#else
+const Kernels  SIMD_KERNELS   = SCALAR_KERNELS;
+constexpr bool SIMD_AVAILABLE = false;
+#endif
+
+const Kernels* SelectDefaultKernels()
+{
+  // Check environment variable for DALI_TEXT_BLENDING_KERNEL
+  auto kernelString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_TEXT_BLENDING_KERNEL);
+  if(!SIMD_AVAILABLE || (kernelString && std::string(kernelString) == "SCALAR"))
+  {
+    return &SCALAR_KERNELS;
+  }
+  return &SIMD_KERNELS;
+}
+
+std::atomic<const Kernels*>& GetKernelsHolder()
+{
+  static std::atomic<const Kernels*> kernels{SelectDefaultKernels()};
+  return kernels;
+}
+
+inline const Kernels& GetKernels()
+{
+  return *GetKernelsHolder().load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+bool IsSimdAvailable()
+{
+  return SIMD_AVAILABLE;
+}
+
+void SetKernelType(KernelType type)
+{
+  GetKernelsHolder().store((type == KernelType::SIMD) ? &SIMD_KERNELS : &SCALAR_KERNELS, std::memory_order_relaxed);
+}
+
+KernelType GetKernelType()
+{
+  return GetKernels().type;
+}
+
+void CombinePixels(const uint32_t* top, const uint32_t* bottom, uint32_t* result, uint32_t numberOfPixels)
+{
+  GetKernels().combinePixels(top, bottom, result, numberOfPixels);
+}
+
+void MaskPixels(const uint32_t* top, uint32_t* bottom, uint32_t numberOfPixels, uint8_t alpha)
+{
+  GetKernels().maskPixels(top, bottom, numberOfPixels, alpha);
+}
+
+void BlitGlyphRow(const uint8_t* coverage, uint32_t coverageStride, uint32_t* pixels, uint32_t numberOfPixels, uint32_t color)
+{
+  GetKernels().blitGlyphRow(coverage, coverageStride, pixels, numberOfPixels, color);
+}
+
+} // namespace Blending
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
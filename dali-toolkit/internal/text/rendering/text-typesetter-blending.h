@@ -0,0 +1,116 @@
+#ifndef DALI_TOOLKIT_TEXT_TYPESETTER_BLENDING_H
+#define DALI_TOOLKIT_TEXT_TYPESETTER_BLENDING_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief Pixel blending kernels used by the typesetter.
+ *
+ * Every kernel has a scalar implementation and, when the target supports it, an SSE2 or NEON one.
+ * The vector implementations give the same result as the scalar ones for pre-multiplied pixels.
+ * Pixels are RGBA8888, with the alpha in the most significant byte of each 32bit word.
+ */
+namespace Blending
+{
+enum class KernelType
+{
+  SCALAR, ///< One pixel at a time.
+  SIMD    ///< SSE2 or NEON, depending on the target.
+};
+
+/**
+ * @brief Whether the vector kernels have been built for this target.
+ *
+ * @return @e true if SIMD kernels are available.
+ */
+bool IsSimdAvailable();
+
+/**
+ * @brief Sets the kernels to use.
+ *
+ * SIMD is used by default if available, unless the DALI_TEXT_BLENDING_KERNEL environment variable is set to SCALAR.
+ * It falls back to SCALAR if the SIMD kernels are not available.
+ *
+ * @param[in] type The type of kernels.
+ */
+void SetKernelType(KernelType type);
+
+/**
+ * @brief Retrieves the kernels in use.
+ *
+ * @return The type of kernels.
+ */
+KernelType GetKernelType();
+
+/**
+ * @brief "Over" blends the top pixels with the bottom pixels.
+ *
+ * Where the top pixel is transparent the bottom one is copied, and where it's opaque the top one is copied.
+ * The result may be stored into either the top or the bottom buffer.
+ *
+ * @param[in] top The top layer pixels.
+ * @param[in] bottom The bottom layer pixels.
+ * @param[out] result The combined pixels. It can be either @p top or @p bottom.
+ * @param[in] numberOfPixels The number of pixels.
+ */
+void CombinePixels(const uint32_t* top, const uint32_t* bottom, uint32_t* result, uint32_t numberOfPixels);
+
+/**
+ * @brief Blends the top pixels, scaled by an alpha, over the bottom pixels and stores the result into the bottom buffer.
+ *
+ * Each channel is min(255, top * alpha / 255 + bottom * (255 - topAlpha) / 255).
+ *
+ * @param[in] top The top layer pixels.
+ * @param[in,out] bottom The bottom layer pixels.
+ * @param[in] numberOfPixels The number of pixels.
+ * @param[in] alpha The alpha applied to the top pixels.
+ */
+void MaskPixels(const uint32_t* top, uint32_t* bottom, uint32_t numberOfPixels, uint8_t alpha);
+
+/**
+ * @brief Sets a color, pre-multiplied by a glyph's coverage, into a row of pixels.
+ *
+ * Pixels with no coverage are left as they are. Otherwise the coverage is the maximum of the glyph's
+ * and the pixel's alpha, so a previous glyph's pixel is not overwritten with a smaller alpha.
+ *
+ * @param[in] coverage The glyph's alpha of the first pixel.
+ * @param[in] coverageStride The number of bytes between the alpha of consecutive pixels.
+ * @param[in,out] pixels The pixels.
+ * @param[in] numberOfPixels The number of pixels.
+ * @param[in] color The RGBA8888 color.
+ */
+void BlitGlyphRow(const uint8_t* coverage, uint32_t coverageStride, uint32_t* pixels, uint32_t numberOfPixels, uint32_t color);
+
+} // namespace Blending
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_TYPESETTER_BLENDING_H
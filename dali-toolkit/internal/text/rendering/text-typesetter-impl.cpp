@@ -38,6 +38,7 @@
 #include <dali-toolkit/internal/text/rendering/styles/character-spacing-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/strikethrough-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/underline-helper-functions.h>
+#include <dali-toolkit/internal/text/rendering/text-typesetter-blending.h>
 #include <dali-toolkit/internal/text/rendering/view-model.h>
 #include <dali-toolkit/internal/text/strikethrough-glyph-run.h>
 #include <dali-toolkit/internal/text/text-definitions.h>
@@ -282,49 +283,15 @@ void TypesetGlyph(GlyphData& __restrict__ data,
       {
         BEGIN_GLYPH_SCANLINE_DECODE(data);
 
-        for(int32_t index = indexRangeMin; index < indexRangeMax; ++index)
-        {
-          // Update the alpha channel.
-          const uint8_t alpha = *(glyphScanline + index * glyphPixelSize + glyphAlphaIndex);
-
-          // Copy non-transparent pixels only
-          if(alpha > 0u)
-          {
-            const int32_t xOffsetIndex = xOffset + index;
-
-            // Check alpha of overlapped pixels
-            uint32_t& currentColor             = *(bitmapBuffer + xOffsetIndex);
-            uint8_t*  packedCurrentColorBuffer = reinterpret_cast<uint8_t*>(&currentColor);
-
-            // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
-            // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
-            // semi-transparent gaps between joint glyphs with overlapped pixels, which could
-            // happen, for example, in the RTL text when we copy glyphs from right to left).
-            uint8_t currentAlpha = *(packedCurrentColorBuffer + 3u);
-            currentAlpha         = Max(currentAlpha, alpha);
-            if(currentAlpha == 255)
-            {
-              // Fast-cut to avoid float type operation.
-              currentColor = packedInputColor;
-            }
-            else
-            {
-              // Pack the given color into a 32bit buffer. The alpha channel will be updated later for each pixel.
-              // The format is RGBA8888.
-              uint32_t packedColor                    = 0u;
-              uint8_t* __restrict__ packedColorBuffer = reinterpret_cast<uint8_t*>(&packedColor);
-
-              // Color is pre-muliplied with its alpha.
-              *(packedColorBuffer + 3u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 3u), currentAlpha);
-              *(packedColorBuffer + 2u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 2u), currentAlpha);
-              *(packedColorBuffer + 1u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 1u), currentAlpha);
-              *(packedColorBuffer)      = MultiplyAndNormalizeColor(*packedInputColorBuffer, currentAlpha);
-
-              // Set the color into the final pixel buffer.
-              currentColor = packedColor;
-            }
-          }
-        }
+        // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
+        // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
+        // semi-transparent gaps between joint glyphs with overlapped pixels, which could
+        // happen, for example, in the RTL text when we copy glyphs from right to left).
+        Blending::BlitGlyphRow(glyphScanline + indexRangeMin * glyphPixelSize + glyphAlphaIndex,
+                               glyphPixelSize,
+                               bitmapBuffer + xOffset + indexRangeMin,
+                               indexRangeMax - indexRangeMin,
+                               packedInputColor);
 
         bitmapBuffer += data.width;
 
@@ -35,6 +35,7 @@
 #include <dali-toolkit/internal/text/rendering/styles/character-spacing-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/strikethrough-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/underline-helper-functions.h>
+#include <dali-toolkit/internal/text/rendering/text-typesetter-blending.h>
 #include <dali-toolkit/internal/text/rendering/text-typesetter-impl.h>
 #include <dali-toolkit/internal/text/rendering/view-model.h>
 
@@ -48,36 +49,6 @@ namespace
 {
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_TEXT_PERFORMANCE_MARKER, false);
 
-/**
- * @brief Fast multiply & divide by 255. It wiil be useful when we applying alpha value in color
- *
- * @param x The value between [0..255]
- * @param y The value between [0..255]
- * @return (x*y)/255
- */
-inline uint8_t MultiplyAndNormalizeColor(const uint8_t x, const uint8_t y) noexcept
-{
-  const uint32_t xy = static_cast<const uint32_t>(x) * y;
-  return ((xy << 15) + (xy << 7) + xy) >> 23;
-}
-
-/**
- * @brief Fast multiply & Summation & divide by 255.
- *
- * @param x1 The value between [0..255]
- * @param y1 The value between [0..255]
- * @param x2 The value between [0..255]
- * @param y2 The value between [0..255]
- * @return min(255, (x1*y1)/255 + (x2*y2)/255)
- */
-inline uint8_t MultiplyAndSummationAndNormalizeColor(const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2) noexcept
-{
-  const uint32_t xy1 = static_cast<const uint32_t>(x1) * y1;
-  const uint32_t xy2 = static_cast<const uint32_t>(x2) * y2;
-  const uint32_t res = Min(65025u, xy1 + xy2); // 65025 is 255 * 255.
-  return ((res + ((res + 257) >> 8)) >> 8);         // fast divide by 255.
-}
-
 /**
  * @brief Combine the two RGBA image buffers together.
  *
@@ -133,56 +104,10 @@ void CombineImageBuffer(Devel::PixelBuffer& __restrict__ topPixelBuffer, Devel::
     return;
   }
 
-  const uint32_t bufferSizeInt = bufferWidth * bufferHeight;
-
-  uint32_t* __restrict__ combinedBuffer       = storeResultIntoTop ? topBuffer : bottomBuffer;
-  uint8_t* __restrict__ topAlphaBufferPointer = reinterpret_cast<uint8_t*>(topBuffer) + 3;
-
-  for(uint32_t pixelIndex = 0; pixelIndex < bufferSizeInt; ++pixelIndex)
-  {
-    // If the alpha of the pixel in either buffer is not fully opaque, blend the two pixels.
-    // Otherwise, copy pixel from topBuffer to combinedBuffer.
-    // Note : Be careful when we read & write into combinedBuffer. It can be write into same pointer.
+  uint32_t* combinedBuffer = storeResultIntoTop ? topBuffer : bottomBuffer;
 
-    uint8_t topAlpha = *topAlphaBufferPointer;
-
-    if(topAlpha == 0)
-    {
-      // Copy the pixel from bottomBuffer to combinedBuffer
-      if(storeResultIntoTop)
-      {
-        *(combinedBuffer) = *(bottomBuffer);
-      }
-    }
-    else if(topAlpha == 255)
-    {
-      // Copy the pixel from topBuffer to combinedBuffer
-      if(!storeResultIntoTop)
-      {
-        *(combinedBuffer) = *(topBuffer);
-      }
-    }
-    else
-    {
-      // At least one pixel is not fully opaque
-      // "Over" blend the the pixel from topBuffer with the pixel in bottomBuffer
-      uint32_t blendedBottomBufferColor                    = *(bottomBuffer);
-      uint8_t* __restrict__ blendedBottomBufferColorBuffer = reinterpret_cast<uint8_t*>(&blendedBottomBufferColor);
-
-      blendedBottomBufferColorBuffer[0] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[0], 255 - topAlpha);
-      blendedBottomBufferColorBuffer[1] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[1], 255 - topAlpha);
-      blendedBottomBufferColorBuffer[2] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[2], 255 - topAlpha);
-      blendedBottomBufferColorBuffer[3] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[3], 255 - topAlpha);
-
-      *(combinedBuffer) = *(topBuffer) + blendedBottomBufferColor;
-    }
-
-    // Increase each buffer's pointer.
-    ++combinedBuffer;
-    ++topBuffer;
-    ++bottomBuffer;
-    topAlphaBufferPointer += sizeof(uint32_t) / sizeof(uint8_t);
-  }
+  // Note : The combined buffer is the same as either the top or the bottom buffer.
+  Blending::CombinePixels(topBuffer, bottomBuffer, combinedBuffer, bufferWidth * bufferHeight);
 }
 
 } // namespace
@@ -549,33 +474,10 @@ void Typesetter::SetMaskForImageBuffer(Devel::PixelBuffer& __restrict__ topPixel
     return;
   }
 
-  const uint32_t bufferSizeInt = bufferWidth * bufferHeight;
-
-  for(uint32_t pixelIndex = 0; pixelIndex < bufferSizeInt; ++pixelIndex)
-  {
-    uint32_t topBufferColor                       = *(topBuffer);
-    uint32_t bottomBufferColor                    = *(bottomBuffer);
-    uint8_t* __restrict__ topBufferColorBuffer    = reinterpret_cast<uint8_t*>(&topBufferColor);
-    uint8_t* __restrict__ bottomBufferColorBuffer = reinterpret_cast<uint8_t*>(&bottomBufferColor);
-
-    // Return the transparency of the text to original.
-    uint8_t originAlphaInt = originAlpha * 255;
+  // Return the transparency of the text to original.
+  const uint8_t originAlphaInt = originAlpha * 255;
 
-    uint8_t topAlpha    = topBufferColorBuffer[3];
-    uint8_t bottomAlpha = 255 - topAlpha;
-
-    // Manual blending.
-    bottomBufferColorBuffer[0] = MultiplyAndSummationAndNormalizeColor(topBufferColorBuffer[0], originAlphaInt, bottomBufferColorBuffer[0], bottomAlpha);
-    bottomBufferColorBuffer[1] = MultiplyAndSummationAndNormalizeColor(topBufferColorBuffer[1], originAlphaInt, bottomBufferColorBuffer[1], bottomAlpha);
-    bottomBufferColorBuffer[2] = MultiplyAndSummationAndNormalizeColor(topBufferColorBuffer[2], originAlphaInt, bottomBufferColorBuffer[2], bottomAlpha);
-    bottomBufferColorBuffer[3] = MultiplyAndSummationAndNormalizeColor(topBufferColorBuffer[3], originAlphaInt, bottomBufferColorBuffer[3], bottomAlpha);
-
-    *(bottomBuffer) = bottomBufferColor;
-
-    // Increase each buffer's pointer.
-    ++topBuffer;
-    ++bottomBuffer;
-  }
+  Blending::MaskPixels(topBuffer, bottomBuffer, bufferWidth * bufferHeight, originAlphaInt);
 }
 
 Typesetter::Typesetter(const ModelInterface* const model)
@@ -24,6 +24,9 @@
 #include <dali/integration-api/trace.h>
 #include <chrono>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/shaping-cache.h>
+
 namespace Dali
 {
 namespace Toolkit
@@ -154,6 +157,8 @@ void ShapeText(TextAbstraction::Shaping&    shaping,
 
   Length glyphIndex = startGlyphIndex;
 
+  ShapingCache& shapingCache = ShapingCache::Get();
+
   // Traverse the characters and shape the text.
   const CharacterIndex lastCharacter = startCharacterIndex + numberOfCharacters;
   for(previousIndex = startCharacterIndex; previousIndex < lastCharacter;)
@@ -207,12 +212,50 @@ void ShapeText(TextAbstraction::Shaping&    shaping,
     }
 #endif
 
-    // Shape the text for the current chunk.
-    const Length numberOfGlyphs = shaping.Shape(fontClient,
-                                                textBuffer + previousIndex,
-                                                (currentIndex - previousIndex), // The number of characters to shape.
-                                                currentFontId,
-                                                currentScript);
+    // Retrieve the glyphs and the glyph to character conversion map.
+    Vector<GlyphInfo>      tmpGlyphs;
+    Vector<CharacterIndex> tmpGlyphToCharacterMap;
+
+    // Identical runs (i.e. the same string in many list rows) are shaped only once.
+    if(!shapingCache.Find(fontClient,
+                          textBuffer + previousIndex,
+                          (currentIndex - previousIndex),
+                          currentFontId,
+                          currentScript,
+                          isItalicRequired,
+                          isBoldRequired,
+                          tmpGlyphs,
+                          tmpGlyphToCharacterMap))
+    {
+      // Shape the text for the current chunk.
+      const Length numberOfShapedGlyphs = shaping.Shape(fontClient,
+                                                        textBuffer + previousIndex,
+                                                        (currentIndex - previousIndex), // The number of characters to shape.
+                                                        currentFontId,
+                                                        currentScript);
+
+      GlyphInfo glyphInfo;
+      glyphInfo.isItalicRequired = isItalicRequired;
+      glyphInfo.isBoldRequired   = isBoldRequired;
+      glyphInfo.isShaped         = true;
+
+      tmpGlyphs.Resize(numberOfShapedGlyphs, glyphInfo);
+      tmpGlyphToCharacterMap.Resize(numberOfShapedGlyphs);
+      shaping.GetGlyphs(tmpGlyphs.Begin(),
+                        tmpGlyphToCharacterMap.Begin());
+
+      shapingCache.Add(fontClient,
+                       textBuffer + previousIndex,
+                       (currentIndex - previousIndex),
+                       currentFontId,
+                       currentScript,
+                       isItalicRequired,
+                       isBoldRequired,
+                       tmpGlyphs,
+                       tmpGlyphToCharacterMap);
+    }
+
+    const Length numberOfGlyphs = tmpGlyphs.Count();
 
 #if defined(TRACE_ENABLED)
     if(logEnabled)
@@ -221,20 +264,6 @@ void ShapeText(TextAbstraction::Shaping&    shaping,
     }
 #endif
 
-    // Retrieve the glyphs and the glyph to character conversion map.
-    Vector<GlyphInfo>      tmpGlyphs;
-    Vector<CharacterIndex> tmpGlyphToCharacterMap;
-
-    GlyphInfo glyphInfo;
-    glyphInfo.isItalicRequired = isItalicRequired;
-    glyphInfo.isBoldRequired   = isBoldRequired;
-    glyphInfo.isShaped         = true;
-
-    tmpGlyphs.Resize(numberOfGlyphs, glyphInfo);
-    tmpGlyphToCharacterMap.Resize(numberOfGlyphs);
-    shaping.GetGlyphs(tmpGlyphs.Begin(),
-                      tmpGlyphToCharacterMap.Begin());
-
     // Update the new indices of the glyph to character map.
     if(0u != totalNumberOfGlyphs)
     {
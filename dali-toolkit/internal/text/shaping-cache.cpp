@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/text/shaping-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <cstdlib>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace
+{
+const char* DALI_TEXT_SHAPING_CACHE_SIZE("DALI_TEXT_SHAPING_CACHE_SIZE");
+
+constexpr uint32_t DEFAULT_MAXIMUM_NUMBER_OF_RUNS = 512u;
+constexpr Length   MAXIMUM_RUN_LENGTH             = 256u; ///< Longer runs are unlikely to be shaped again, so they aren't cached.
+
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME        = 1099511628211ull;
+
+inline void Combine(uint64_t& hash, uint64_t value)
+{
+  hash ^= value;
+  hash *= FNV_PRIME;
+}
+
+} // namespace
+
+ShapingCache& ShapingCache::Get()
+{
+  static ShapingCache cache;
+  return cache;
+}
+
+ShapingCache::ShapingCache()
+: mMaximumNumberOfRuns{DEFAULT_MAXIMUM_NUMBER_OF_RUNS}
+{
+  // Check environment variable for DALI_TEXT_SHAPING_CACHE_SIZE
+  auto cacheSizeString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_TEXT_SHAPING_CACHE_SIZE);
+  if(cacheSizeString)
+  {
+    mMaximumNumberOfRuns = static_cast<uint32_t>(std::max(0, std::atoi(cacheSizeString)));
+    DALI_LOG_RELEASE_INFO("Text shaping cache size:%u\n", mMaximumNumberOfRuns);
+  }
+}
+
+std::size_t ShapingCache::KeyHash::operator()(const Key& key) const
+{
+  uint64_t hash = FNV_OFFSET_BASIS;
+  Combine(hash, key.generation);
+  Combine(hash, key.fontId);
+  Combine(hash, key.script);
+  Combine(hash, key.styles);
+  for(const Character character : key.text)
+  {
+    Combine(hash, character);
+  }
+  return static_cast<std::size_t>(hash);
+}
+
+ShapingCache::Key ShapingCache::MakeKey(const Character* text,
+                                        Length           numberOfCharacters,
+                                        FontId           fontId,
+                                        Script           script,
+                                        bool             isItalicRequired,
+                                        bool             isBoldRequired)
+{
+  return Key{0u,
+             fontId,
+             script,
+             static_cast<uint32_t>(isItalicRequired) | (static_cast<uint32_t>(isBoldRequired) << 1u),
+             std::vector<Character>(text, text + numberOfCharacters)};
+}
+
+uint32_t ShapingCache::GetGeneration(const TextAbstraction::FontClient& fontClient)
+{
+  auto it = mGenerations.find(fontClient.GetObjectPtr());
+  if(it == mGenerations.end())
+  {
+    it = mGenerations.emplace(fontClient.GetObjectPtr(), mNextGeneration++).first;
+  }
+  return it->second;
+}
+
+void ShapingCache::EraseGeneration(uint32_t generation)
+{
+  for(auto it = mEntries.begin(); it != mEntries.end();)
+  {
+    if(it->key.generation == generation)
+    {
+      mIndex.erase(it->key);
+      it = mEntries.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+bool ShapingCache::Find(const TextAbstraction::FontClient& fontClient,
+                        const Character*                   text,
+                        Length                             numberOfCharacters,
+                        FontId                             fontId,
+                        Script                             script,
+                        bool                               isItalicRequired,
+                        bool                               isBoldRequired,
+                        Vector<GlyphInfo>&                 glyphs,
+                        Vector<CharacterIndex>&            glyphToCharacterMap)
+{
+  if(numberOfCharacters > MAXIMUM_RUN_LENGTH)
+  {
+    return false;
+  }
+
+  std::scoped_lock<std::mutex> lock(mMutex);
+  if(0u == mMaximumNumberOfRuns)
+  {
+    // Disabled; don't pay for building the key.
+    return false;
+  }
+
+  Key key        = MakeKey(text, numberOfCharacters, fontId, script, isItalicRequired, isBoldRequired);
+  key.generation = GetGeneration(fontClient);
+
+  auto it = mIndex.find(key);
+  if(it == mIndex.end())
+  {
+    ++mMissCount;
+    return false;
+  }
+
+  // Move the run to the front of the list, as it's the most recently used.
+  mEntries.splice(mEntries.begin(), mEntries, it->second);
+
+  const Entry& entry  = *it->second;
+  glyphs              = entry.glyphs;
+  glyphToCharacterMap = entry.glyphToCharacterMap;
+
+  ++mHitCount;
+  return true;
+}
+
+void ShapingCache::Add(const TextAbstraction::FontClient& fontClient,
+                       const Character*                   text,
+                       Length                             numberOfCharacters,
+                       FontId                             fontId,
+                       Script                             script,
+                       bool                               isItalicRequired,
+                       bool                               isBoldRequired,
+                       const Vector<GlyphInfo>&           glyphs,
+                       const Vector<CharacterIndex>&      glyphToCharacterMap)
+{
+  if(numberOfCharacters > MAXIMUM_RUN_LENGTH)
+  {
+    return;
+  }
+
+  std::scoped_lock<std::mutex> lock(mMutex);
+  if(0u == mMaximumNumberOfRuns)
+  {
+    return;
+  }
+
+  Key key        = MakeKey(text, numberOfCharacters, fontId, script, isItalicRequired, isBoldRequired);
+  key.generation = GetGeneration(fontClient);
+  if(mIndex.find(key) != mIndex.end())
+  {
+    // Another thread has already added the run.
+    return;
+  }
+
+  while(mEntries.size() >= mMaximumNumberOfRuns)
+  {
+    // Discard the least recently used run.
+    mIndex.erase(mEntries.back().key);
+    mEntries.pop_back();
+  }
+
+  mEntries.push_front(Entry{key, glyphs, glyphToCharacterMap});
+  mIndex.emplace(std::move(key), mEntries.begin());
+}
+
+void ShapingCache::Clear(const TextAbstraction::FontClient& fontClient)
+{
+  std::scoped_lock<std::mutex> lock(mMutex);
+  auto it = mGenerations.find(fontClient.GetObjectPtr());
+  if(it != mGenerations.end())
+  {
+    // The generation id is retired, so the font client gets a new one the next time it's used.
+    EraseGeneration(it->second);
+    mGenerations.erase(it);
+  }
+}
+
+void ShapingCache::Clear()
+{
+  std::scoped_lock<std::mutex> lock(mMutex);
+  mIndex.clear();
+  mEntries.clear();
+  mGenerations.clear();
+}
+
+void ShapingCache::SetMaximumNumberOfRuns(uint32_t maximumNumberOfRuns)
+{
+  std::scoped_lock<std::mutex> lock(mMutex);
+  mMaximumNumberOfRuns = maximumNumberOfRuns;
+  while(mEntries.size() > mMaximumNumberOfRuns)
+  {
+    mIndex.erase(mEntries.back().key);
+    mEntries.pop_back();
+  }
+}
+
+uint32_t ShapingCache::GetMaximumNumberOfRuns() const
+{
+  std::scoped_lock<std::mutex> lock(mMutex);
+  return mMaximumNumberOfRuns;
+}
+
+uint32_t ShapingCache::GetNumberOfRuns() const
+{
+  std::scoped_lock<std::mutex> lock(mMutex);
+  return static_cast<uint32_t>(mEntries.size());
+}
+
+uint32_t ShapingCache::GetHitCount() const
+{
+  std::scoped_lock<std::mutex> lock(mMutex);
+  return mHitCount;
+}
+
+uint32_t ShapingCache::GetMissCount() const
+{
+  std::scoped_lock<std::mutex> lock(mMutex);
+  return mMissCount;
+}
+
+void ShapingCache::ResetCounters()
+{
+  std::scoped_lock<std::mutex> lock(mMutex);
+  mHitCount  = 0u;
+  mMissCount = 0u;
+}
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
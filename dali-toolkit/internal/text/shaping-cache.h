@@ -0,0 +1,235 @@
+#ifndef DALI_TOOLKIT_TEXT_SHAPING_CACHE_H
+#define DALI_TOOLKIT_TEXT_SHAPING_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/text-definitions.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief A process-wide cache of shaped text runs.
+ *
+ * A run is keyed on its characters, font id, script and the software styling required by its font run.
+ * Font ids are only meaningful for the font client that created them, so the key also holds a generation id
+ * assigned to the font client. Clearing the runs of a font client retires its generation id, so a font client
+ * created later at the same address doesn't find them, and the runs of the other font clients are kept.
+ *
+ * The cache is used by both the controller and the AsyncTextLoader, so it's thread safe.
+ * The least recently used runs are discarded when the cache is full.
+ */
+class ShapingCache
+{
+public:
+  /**
+   * @brief Retrieves the process-wide cache.
+   *
+   * @return The shaping cache.
+   */
+  static ShapingCache& Get();
+
+  /**
+   * @brief Finds a shaped run.
+   *
+   * @param[in] fontClient The font client the font id belongs to.
+   * @param[in] text Pointer to the first character of the run.
+   * @param[in] numberOfCharacters The number of characters of the run.
+   * @param[in] fontId The font id.
+   * @param[in] script The script.
+   * @param[in] isItalicRequired Whether the font run requires software italic.
+   * @param[in] isBoldRequired Whether the font run requires software bold.
+   * @param[out] glyphs The shaped glyphs.
+   * @param[out] glyphToCharacterMap The first character, relative to the start of the run, of each glyph.
+   *
+   * @return @e true if the run has been found.
+   */
+  bool Find(const TextAbstraction::FontClient& fontClient,
+            const Character*                   text,
+            Length                             numberOfCharacters,
+            FontId                             fontId,
+            Script                             script,
+            bool                               isItalicRequired,
+            bool                               isBoldRequired,
+            Vector<GlyphInfo>&                 glyphs,
+            Vector<CharacterIndex>&            glyphToCharacterMap);
+
+  /**
+   * @brief Adds a shaped run.
+   *
+   * @param[in] fontClient The font client the font id belongs to.
+   * @param[in] text Pointer to the first character of the run.
+   * @param[in] numberOfCharacters The number of characters of the run.
+   * @param[in] fontId The font id.
+   * @param[in] script The script.
+   * @param[in] isItalicRequired Whether the font run requires software italic.
+   * @param[in] isBoldRequired Whether the font run requires software bold.
+   * @param[in] glyphs The shaped glyphs.
+   * @param[in] glyphToCharacterMap The first character, relative to the start of the run, of each glyph.
+   */
+  void Add(const TextAbstraction::FontClient& fontClient,
+           const Character*                   text,
+           Length                             numberOfCharacters,
+           FontId                             fontId,
+           Script                             script,
+           bool                               isItalicRequired,
+           bool                               isBoldRequired,
+           const Vector<GlyphInfo>&           glyphs,
+           const Vector<CharacterIndex>&      glyphToCharacterMap);
+
+  /**
+   * @brief Discards the runs of a font client, i.e. when its font ids are no longer valid or it's destroyed.
+   *
+   * @param[in] fontClient The font client.
+   */
+  void Clear(const TextAbstraction::FontClient& fontClient);
+
+  /**
+   * @brief Discards all the runs.
+   */
+  void Clear();
+
+  /**
+   * @brief Sets the maximum number of runs kept by the cache.
+   *
+   * Zero disables the cache.
+   *
+   * @param[in] maximumNumberOfRuns The maximum number of runs.
+   */
+  void SetMaximumNumberOfRuns(uint32_t maximumNumberOfRuns);
+
+  /**
+   * @brief Retrieves the maximum number of runs kept by the cache.
+   *
+   * @return The maximum number of runs.
+   */
+  uint32_t GetMaximumNumberOfRuns() const;
+
+  /**
+   * @brief Retrieves the number of cached runs.
+   *
+   * @return The number of runs.
+   */
+  uint32_t GetNumberOfRuns() const;
+
+  /**
+   * @brief Retrieves the number of runs found in the cache.
+   *
+   * @return The number of hits.
+   */
+  uint32_t GetHitCount() const;
+
+  /**
+   * @brief Retrieves the number of runs not found in the cache.
+   *
+   * @return The number of misses.
+   */
+  uint32_t GetMissCount() const;
+
+  /**
+   * @brief Resets the hit and miss counters.
+   */
+  void ResetCounters();
+
+private:
+  ShapingCache();
+
+  // Undefined
+  ShapingCache(const ShapingCache&) = delete;
+
+  // Undefined
+  ShapingCache& operator=(const ShapingCache&) = delete;
+
+  struct Key
+  {
+    uint32_t               generation;
+    FontId                 fontId;
+    Script                 script;
+    uint32_t               styles;
+    std::vector<Character> text;
+
+    bool operator==(const Key& rhs) const
+    {
+      return (generation == rhs.generation) && (fontId == rhs.fontId) && (script == rhs.script) && (styles == rhs.styles) && (text == rhs.text);
+    }
+  };
+
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  struct Entry
+  {
+    Key                    key;
+    Vector<GlyphInfo>      glyphs;
+    Vector<CharacterIndex> glyphToCharacterMap;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  /**
+   * @brief Builds the key of a run. The generation id is set later, under the lock.
+   */
+  static Key MakeKey(const Character* text,
+                     Length           numberOfCharacters,
+                     FontId           fontId,
+                     Script           script,
+                     bool             isItalicRequired,
+                     bool             isBoldRequired);
+
+  /**
+   * @brief Retrieves the generation id of a font client, assigning a new one if it has none. Must be called under the lock.
+   */
+  uint32_t GetGeneration(const TextAbstraction::FontClient& fontClient);
+
+  /**
+   * @brief Discards the runs of a generation id. Must be called under the lock.
+   */
+  void EraseGeneration(uint32_t generation);
+
+  mutable std::mutex                                     mMutex;
+  EntryList                                              mEntries; ///< The most recently used run first.
+  std::unordered_map<Key, EntryList::iterator, KeyHash> mIndex;
+  std::unordered_map<const void*, uint32_t>              mGenerations; ///< The generation id of each font client.
+  uint32_t                                               mNextGeneration{0u};
+  uint32_t                                               mMaximumNumberOfRuns;
+  uint32_t                                               mHitCount{0u};
+  uint32_t                                               mMissCount{0u};
+};
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_SHAPING_CACHE_H
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/texture-manager/animated-image-frame-ring.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+constexpr float DECODE_TIME_WEIGHT = 0.25f; ///< The weight of the latest decoding time in the moving average.
+} // namespace
+
+AnimatedImageFrameRing::AnimatedImageFrameRing(TextureManager& textureManager, const std::string& key)
+: mTextureManager(&textureManager),
+  mKey(key),
+  mResidentCount(0u),
+  mDecodeTime(0.0f)
+{
+}
+
+AnimatedImageFrameRing::~AnimatedImageFrameRing()
+{
+  if(mTextureManager)
+  {
+    if(DALI_LIKELY(Dali::Adaptor::IsAvailable()))
+    {
+      ReleaseFrames();
+    }
+    mTextureManager->UnregisterAnimatedImageFrameRing(mKey);
+  }
+}
+
+bool AnimatedImageFrameRing::Retain(uint32_t frameIndex, uint32_t frameCount, TextureManager::TextureId textureId)
+{
+  if(!mTextureManager || frameIndex >= frameCount)
+  {
+    return false;
+  }
+
+  if(mTextureIds.size() != frameCount)
+  {
+    // The frame count is known after the first frame is loaded. Drop anything kept for another count.
+    ReleaseFrames();
+    mTextureIds.assign(frameCount, TextureManager::INVALID_TEXTURE_ID);
+    mTextureSizes.assign(frameCount, 0u);
+  }
+
+  if(mTextureIds[frameIndex] != TextureManager::INVALID_TEXTURE_ID)
+  {
+    return true;
+  }
+
+  const uint32_t textureSize = mTextureManager->RetainAnimatedImageFrame(textureId);
+  if(textureSize == 0u)
+  {
+    return false;
+  }
+
+  mTextureIds[frameIndex]   = textureId;
+  mTextureSizes[frameIndex] = textureSize;
+  ++mResidentCount;
+  return true;
+}
+
+bool AnimatedImageFrameRing::IsResident(uint32_t frameIndex) const
+{
+  return frameIndex < mTextureIds.size() && mTextureIds[frameIndex] != TextureManager::INVALID_TEXTURE_ID;
+}
+
+bool AnimatedImageFrameRing::IsLoopResident() const
+{
+  return !mTextureIds.empty() && mResidentCount == mTextureIds.size();
+}
+
+void AnimatedImageFrameRing::AddDecodeTime(uint32_t milliseconds)
+{
+  if(mDecodeTime <= 0.0f)
+  {
+    mDecodeTime = static_cast<float>(milliseconds);
+  }
+  else
+  {
+    mDecodeTime += (static_cast<float>(milliseconds) - mDecodeTime) * DECODE_TIME_WEIGHT;
+  }
+}
+
+uint32_t AnimatedImageFrameRing::GetLookAhead(uint32_t interval, uint32_t minimum, uint32_t maximum) const
+{
+  maximum = std::max(minimum, maximum);
+  if(IsLoopResident() || interval == 0u || mDecodeTime <= 0.0f)
+  {
+    return minimum;
+  }
+
+  const uint32_t lookAhead = static_cast<uint32_t>(std::ceil(mDecodeTime / static_cast<float>(interval))) + 1u;
+  return std::clamp(lookAhead, minimum, maximum);
+}
+
+void AnimatedImageFrameRing::ReleaseFramesOverBudget()
+{
+  if(!mTextureManager)
+  {
+    return;
+  }
+
+  for(std::size_t frameIndex = mTextureIds.size(); frameIndex > 0u && mTextureManager->GetAnimatedImageFrameBytes() > mTextureManager->GetAnimatedImageFrameBudget(); --frameIndex)
+  {
+    if(mTextureIds[frameIndex - 1u] != TextureManager::INVALID_TEXTURE_ID)
+    {
+      mTextureManager->ReleaseAnimatedImageFrame(mTextureIds[frameIndex - 1u], mTextureSizes[frameIndex - 1u]);
+      mTextureIds[frameIndex - 1u]   = TextureManager::INVALID_TEXTURE_ID;
+      mTextureSizes[frameIndex - 1u] = 0u;
+      --mResidentCount;
+    }
+  }
+}
+
+void AnimatedImageFrameRing::Detach()
+{
+  mTextureManager = nullptr;
+  mTextureIds.clear();
+  mTextureSizes.clear();
+  mResidentCount = 0u;
+}
+
+void AnimatedImageFrameRing::ReleaseFrames()
+{
+  for(std::size_t frameIndex = 0u; frameIndex < mTextureIds.size(); ++frameIndex)
+  {
+    if(mTextureIds[frameIndex] != TextureManager::INVALID_TEXTURE_ID)
+    {
+      mTextureManager->ReleaseAnimatedImageFrame(mTextureIds[frameIndex], mTextureSizes[frameIndex]);
+      mTextureIds[frameIndex]   = TextureManager::INVALID_TEXTURE_ID;
+      mTextureSizes[frameIndex] = 0u;
+    }
+  }
+  mResidentCount = 0u;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,133 @@
+#ifndef DALI_TOOLKIT_INTERNAL_ANIMATED_IMAGE_FRAME_RING_H
+#define DALI_TOOLKIT_INTERNAL_ANIMATED_IMAGE_FRAME_RING_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/ref-object.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief The decoded frames of an animated image, shared by every RollingAnimatedImageCache which plays
+ * the same url at the same size.
+ *
+ * The ring holds a reference to the uploaded texture of each frame it keeps, so that the frame stays in the
+ * TextureManager cache after the caches have consumed it, and the next loop finds it without decoding it again.
+ * The frames are kept on a first-come basis while they fit in the animated image frame budget of the TextureManager.
+ * If the whole loop doesn't fit, the same frames stay resident on every loop rather than evicting each other.
+ *
+ * The ring also measures how long the frames which are not resident take to decode, so that the caches can
+ * request enough frames ahead to hide the decoding time.
+ */
+class AnimatedImageFrameRing : public RefObject
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] textureManager The texture manager which owns the frames
+   * @param[in] key            The key the ring is registered by in the texture manager
+   */
+  AnimatedImageFrameRing(TextureManager& textureManager, const std::string& key);
+
+  /**
+   * @brief Keeps the uploaded texture of a frame, if it fits in the budget.
+   * @param[in] frameIndex The index of the frame
+   * @param[in] frameCount The number of frames of the animated image
+   * @param[in] textureId  The id of the uploaded texture of the frame
+   * @return True if the frame is resident
+   */
+  bool Retain(uint32_t frameIndex, uint32_t frameCount, TextureManager::TextureId textureId);
+
+  /**
+   * @brief Checks whether a frame is kept by the ring.
+   * @param[in] frameIndex The index of the frame
+   * @return True if the frame is resident
+   */
+  bool IsResident(uint32_t frameIndex) const;
+
+  /**
+   * @brief Checks whether every frame of the loop is kept by the ring.
+   * @return True if the whole loop is resident
+   */
+  bool IsLoopResident() const;
+
+  /**
+   * @brief Adds the time a frame took to decode to the moving average.
+   * @param[in] milliseconds The decoding time, in milliseconds
+   */
+  void AddDecodeTime(uint32_t milliseconds);
+
+  /**
+   * @brief Retrieves the number of frames to keep requested ahead of the displayed one.
+   *
+   * It covers the average decoding time with the frame interval, plus the displayed frame.
+   * @param[in] interval The frame interval, in milliseconds
+   * @param[in] minimum  The minimum number of frames
+   * @param[in] maximum  The maximum number of frames
+   * @return The number of frames, between minimum and maximum
+   */
+  uint32_t GetLookAhead(uint32_t interval, uint32_t minimum, uint32_t maximum) const;
+
+  /**
+   * @brief Releases the frames at the end of the loop until the frames of every ring fit in the budget again.
+   */
+  void ReleaseFramesOverBudget();
+
+  /**
+   * @brief Called by the texture manager when it is destroyed, after which the frames are not released any more.
+   */
+  void Detach();
+
+protected:
+  /**
+   * @brief Destructor. Releases every frame and unregisters the ring from the texture manager.
+   */
+  ~AnimatedImageFrameRing() override;
+
+private:
+  /**
+   * @brief Releases every frame.
+   */
+  void ReleaseFrames();
+
+private:
+  TextureManager*                        mTextureManager;
+  std::string                            mKey;
+  std::vector<TextureManager::TextureId> mTextureIds;    ///< The kept texture of each frame, or INVALID_TEXTURE_ID.
+  std::vector<uint32_t>                  mTextureSizes;  ///< The budget used by each kept frame, in bytes.
+  uint32_t                               mResidentCount; ///< The number of kept frames.
+  float                                  mDecodeTime;    ///< The moving average of the decoding time, in milliseconds.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_ANIMATED_IMAGE_FRAME_RING_H
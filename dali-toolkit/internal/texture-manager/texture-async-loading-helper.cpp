@@ -91,7 +91,8 @@ void TextureAsyncLoadingHelper::Load(const TextureManager::TextureId
                                      const Dali::SamplingMode::Type                 samplingMode,
                                      const bool                                     orientationCorrection,
                                      const DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
-                                     const bool                                     loadYuvPlanes)
+                                     const bool                                     loadYuvPlanes,
+                                     const DevelVisual::LoadingPriority::Type       loadingPriority)
 {
   if(DALI_UNLIKELY(url.IsBufferResource()))
   {
@@ -131,9 +132,37 @@ void TextureAsyncLoadingHelper::Load(const TextureManager::TextureId
 
   // Default: submit directly (Worker Thread will handle download synchronously for curl, or decode for local).
   DALI_LOG_DEBUG_INFO("TextureAsyncLoadingHelper::Load textureId[%d] via AsyncTaskManager url[%s]\n", textureId, url.GetEllipsedUrl().c_str());
-  LoadingTaskPtr loadingTask = new LoadingTask(++mLoadTaskId, url, desiredSize, samplingMode, orientationCorrection, preMultiplyOnLoad, loadYuvPlanes, MakeCallback(this, &TextureAsyncLoadingHelper::AsyncLoadComplete));
+  LoadingTaskPtr loadingTask = new LoadingTask(++mLoadTaskId, url, desiredSize, samplingMode, orientationCorrection, preMultiplyOnLoad, loadYuvPlanes, MakeCallback(this, &TextureAsyncLoadingHelper::AsyncLoadComplete), loadingPriority);
   loadingTask->SetTextureId(textureId);
   Dali::AsyncTaskManager::Get().AddTask(loadingTask);
+  mUrlLoadingTasks[textureId] = std::move(loadingTask);
+}
+
+void TextureAsyncLoadingHelper::SetLoadingPriority(const TextureManager::TextureId textureId, const DevelVisual::LoadingPriority::Type loadingPriority)
+{
+  auto iter = mUrlLoadingTasks.find(textureId);
+  if(iter == mUrlLoadingTasks.end())
+  {
+    return;
+  }
+
+  LoadingTaskPtr& loadingTask = iter->second;
+  if(loadingTask->IsStarted() || loadingTask->GetPriorityType() == GetLoadingTaskPriorityType(loadingTask->url, loadingPriority))
+  {
+    // A running task is left to finish. Restarting it would throw its decoding away.
+    return;
+  }
+
+  DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Verbose, "TextureAsyncLoadingHelper::SetLoadingPriority textureId[%d] loadingPriority[%d]\n", textureId, static_cast<int>(loadingPriority));
+
+  // If the old task starts between the check and the removal, its completion is not notified after removal.
+  LoadingTaskPtr newLoadingTask = new LoadingTask(++mLoadTaskId, loadingTask->url, loadingTask->dimensions, loadingTask->samplingMode, loadingTask->orientationCorrection, loadingTask->preMultiplyOnLoad, loadingTask->loadPlanes, MakeCallback(this, &TextureAsyncLoadingHelper::AsyncLoadComplete), loadingPriority);
+  newLoadingTask->SetTextureId(textureId);
+
+  Dali::AsyncTaskManager asyncTaskManager = Dali::AsyncTaskManager::Get();
+  asyncTaskManager.RemoveTask(loadingTask);
+  asyncTaskManager.AddTask(newLoadingTask);
+  loadingTask = std::move(newLoadingTask);
 }
 
 void TextureAsyncLoadingHelper::ApplyMask(const TextureManager::TextureId                textureId,
@@ -150,6 +179,12 @@ void TextureAsyncLoadingHelper::ApplyMask(const TextureManager::TextureId
 
 void TextureAsyncLoadingHelper::AsyncLoadComplete(LoadingTaskPtr task)
 {
+  auto iter = mUrlLoadingTasks.find(task->textureId);
+  if(iter != mUrlLoadingTasks.end() && iter->second == task)
+  {
+    mUrlLoadingTasks.erase(iter);
+  }
+
   // Call TextureManager::AsyncLoadComplete
   if(task->textureId != TextureManager::INVALID_TEXTURE_ID)
   {
@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/signals/connection-tracker.h>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/image-loader/loading-task.h>
@@ -72,6 +73,7 @@ public:
    *                                  e.g., from portrait to landscape
    * @param[in] preMultiplyOnLoad     if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha or if the image need to be applied alpha mask.
    * @param[in] loadYuvPlanes         True if the image should be loaded as yuv planes
+   * @param[in] loadingPriority       How soon the observers need the texture
    */
   void Load(const TextureManager::TextureId                textureId,
             const VisualUrl&                               url,
@@ -79,7 +81,20 @@ public:
             const Dali::SamplingMode::Type                 samplingMode,
             const bool                                     orientationCorrection,
             const DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
-            const bool                                     loadYuvPlanes);
+            const bool                                     loadYuvPlanes,
+            const DevelVisual::LoadingPriority::Type       loadingPriority);
+
+  /**
+   * @brief Changes the priority of the task loading the texture.
+   *
+   * The priority of a queued task can't be changed, so the task is removed and
+   * an identical one is added with the new priority.
+   * It does nothing if the texture is not being loaded from a url, if the task has already
+   * started, or if the priority is unchanged.
+   * @param[in] textureId       TextureId of the texture being loaded
+   * @param[in] loadingPriority How soon the observers need the texture
+   */
+  void SetLoadingPriority(const TextureManager::TextureId textureId, const DevelVisual::LoadingPriority::Type loadingPriority);
 
   /**
    * @brief Apply mask
@@ -117,6 +132,8 @@ private:
 private: // Member Variables:
   TextureManager& mTextureManager;
   uint32_t        mLoadTaskId;
+
+  std::unordered_map<TextureManager::TextureId, LoadingTaskPtr> mUrlLoadingTasks; ///< The tasks loading urls, which can be re-prioritised
 };
 
 } // namespace Internal
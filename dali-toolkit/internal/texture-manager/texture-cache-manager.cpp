@@ -21,7 +21,9 @@
 // EXTERNAL HEADERS
 #include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel.h>
 #include <algorithm>
+#include <limits>
 #include <string_view>
 #include <unordered_map>
 
@@ -622,6 +624,21 @@ TextureCacheManager::TextureCacheIndex TextureCacheManager::FindCachedTexture(
           if((preMultiplyOnLoad == MultiplyOnLoad::MULTIPLY_ON_LOAD && textureInfo.preMultiplyOnLoad) ||
              (preMultiplyOnLoad == MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY && !textureInfo.preMultiplied))
           {
+            // If the found Texture was released, revive it from the released texture cache.
+            if(textureInfo.referenceCount <= 0)
+            {
+              const auto& releasedIterator = mReleasedTextureIterators.find(textureInfo.textureId);
+              if(releasedIterator != mReleasedTextureIterators.end())
+              {
+                DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::FindCachedTexture() Revive released texture(textureId:%d) url:%s\n", textureInfo.textureId, textureInfo.url.GetUrl().c_str());
+
+                mReleasedTextureBytes -= releasedIterator->second->textureSize;
+                mReleasedTextureList.erase(releasedIterator->second);
+                mReleasedTextureIterators.erase(releasedIterator);
+                ++mReleasedTextureHitCount;
+              }
+            }
+
             // The found Texture is a match.
             return cacheIndex;
           }
@@ -630,6 +647,12 @@ TextureCacheManager::TextureCacheIndex TextureCacheManager::FindCachedTexture(
     }
   }
 
+  // Only the requests which a released texture could have served are misses of the released texture cache.
+  if(mReleasedTextureBudget > 0u && IsRetainableRequest(url, storageType, maskTextureId, isAnimatedImage))
+  {
+    ++mReleasedTextureMissCount;
+  }
+
   // Default to an invalid ID, in case we do not find a match.
   return INVALID_CACHE_INDEX;
 }
@@ -665,10 +688,16 @@ TextureCacheManager::TextureCacheIndex TextureCacheManager::AppendCache(const Te
 
 void TextureCacheManager::RemoveCache(TextureCacheManager::TextureInfo& textureInfo)
 {
-  TextureCacheIndex textureInfoIndex  = GetCacheIndexFromId(textureInfo.textureId);
-  bool              removeTextureInfo = false;
+  bool removeTextureInfo = false;
 
-  DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::Remove(textureId:%d) url:%s\n  cacheIdx:%d loadState:%s reference count = %d\n", textureInfo.textureId, textureInfo.url.GetUrl().c_str(), textureInfoIndex.GetIndex(), GET_LOAD_STATE_STRING(textureInfo.loadState), textureInfo.referenceCount);
+  DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::Remove(textureId:%d) url:%s\n  cacheIdx:%d loadState:%s reference count = %d\n", textureInfo.textureId, textureInfo.url.GetUrl().c_str(), GetCacheIndexFromId(textureInfo.textureId).GetIndex(), GET_LOAD_STATE_STRING(textureInfo.loadState), textureInfo.referenceCount);
+
+  if(IsReleasedTexture(textureInfo.textureId))
+  {
+    // Already released, and kept only until it's reused or evicted.
+    DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::Remove(textureId:%d) Already released\n", textureInfo.textureId);
+    return;
+  }
 
   // Decrement the reference count and check if this is the last user of this Texture.
   if(--textureInfo.referenceCount <= 0)
@@ -699,29 +728,140 @@ void TextureCacheManager::RemoveCache(TextureCacheManager::TextureInfo& textureI
       removeTextureInfo = true;
     }
 
-    // If the state allows us to remove the TextureInfo data, we do so.
-    if(removeTextureInfo)
+    // Keep the released texture if it fits the released texture cache budget.
+    if(removeTextureInfo && mReleasedTextureBudget > 0u)
     {
-      // If url location is BUFFER, decrease reference count of EncodedImageBuffer.
-      if(textureInfo.url.IsBufferResource())
+      const uint32_t textureSize = GetRetainableTextureSize(textureInfo);
+      if(textureSize > 0u && textureSize <= mReleasedTextureBudget)
       {
-        RemoveEncodedImageBuffer(textureInfo.url.GetUrl());
-      }
+        DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::Remove(textureId:%d) Keep as released texture. size:%u\n", textureInfo.textureId, textureSize);
 
-      // Permanently remove the textureInfo struct.
+        mReleasedTextureList.push_front(ReleasedTextureInfo{textureInfo.textureId, textureSize});
+        mReleasedTextureIterators[textureInfo.textureId] = mReleasedTextureList.begin();
+        mReleasedTextureBytes += textureSize;
 
-      // Step 1. remove current textureId information in mTextureHashContainer.
-      RemoveHashId(textureInfo.hash, textureInfo.textureId);
-      // Step 2. make textureId is not using anymore. After this job, we can reuse textureId.
-      mTextureIdConverter.Remove(textureInfo.textureId);
+        removeTextureInfo = false;
+      }
     }
   }
 
-  // Post removal process to avoid mTextureInfoContainer reference problems.
   if(removeTextureInfo)
   {
-    // Step 3. swap last data of TextureInfoContainer, and pop_back.
-    RemoveTextureInfoByIndex(mTextureInfoContainer, textureInfoIndex);
+    // Permanently remove the textureInfo struct.
+    RemoveUnusedTextureInfo(textureInfo);
+  }
+  else
+  {
+    // Released textures might be over the budget now. Note that textureInfo could be invalidated after this call.
+    EvictReleasedTextures();
+  }
+}
+
+void TextureCacheManager::SetReleasedTextureCacheBudget(const uint32_t budgetBytes)
+{
+  mReleasedTextureBudget = budgetBytes;
+  EvictReleasedTextures();
+}
+
+Dali::Toolkit::TextureManager::ReleasedTextureCacheStatistics TextureCacheManager::GetReleasedTextureCacheStatistics() const
+{
+  Dali::Toolkit::TextureManager::ReleasedTextureCacheStatistics statistics;
+  statistics.hitCount      = mReleasedTextureHitCount;
+  statistics.missCount     = mReleasedTextureMissCount;
+  statistics.evictionCount = mReleasedTextureEvictCount;
+  statistics.textureCount  = static_cast<uint32_t>(mReleasedTextureList.size());
+  statistics.usedBytes     = mReleasedTextureBytes;
+  statistics.budgetBytes   = mReleasedTextureBudget;
+  return statistics;
+}
+
+bool TextureCacheManager::IsReleasedTexture(const TextureCacheManager::TextureId textureId) const
+{
+  return mReleasedTextureIterators.find(textureId) != mReleasedTextureIterators.end();
+}
+
+void TextureCacheManager::ResetReleasedTextureCacheStatistics()
+{
+  mReleasedTextureHitCount   = 0u;
+  mReleasedTextureMissCount  = 0u;
+  mReleasedTextureEvictCount = 0u;
+}
+
+uint64_t TextureCacheManager::GetUploadedTextureSize(const TextureCacheManager::TextureInfo& textureInfo)
+{
+  uint64_t textureSize = 0u;
+  for(const auto& texture : textureInfo.textures)
+  {
+    // Assume that uploaded textures use 4 bytes per pixel.
+    if(texture)
+    {
+      textureSize += static_cast<uint64_t>(texture.GetWidth()) * texture.GetHeight() * 4u;
+    }
+  }
+  return textureSize;
+}
+
+void TextureCacheManager::RemoveUnusedTextureInfo(TextureCacheManager::TextureInfo& textureInfo)
+{
+  TextureCacheIndex textureInfoIndex = GetCacheIndexFromId(textureInfo.textureId);
+
+  // If url location is BUFFER, decrease reference count of EncodedImageBuffer.
+  if(textureInfo.url.IsBufferResource())
+  {
+    RemoveEncodedImageBuffer(textureInfo.url.GetUrl());
+  }
+
+  // Step 1. remove current textureId information in mTextureHashContainer.
+  RemoveHashId(textureInfo.hash, textureInfo.textureId);
+  // Step 2. make textureId is not using anymore. After this job, we can reuse textureId.
+  mTextureIdConverter.Remove(textureInfo.textureId);
+  // Step 3. swap last data of TextureInfoContainer, and pop_back. Now, textureInfo is invalidate.
+  RemoveTextureInfoByIndex(mTextureInfoContainer, textureInfoIndex);
+}
+
+uint32_t TextureCacheManager::GetRetainableTextureSize(const TextureCacheManager::TextureInfo& textureInfo) const
+{
+  // Only keep the textures that could be found again by FindCachedTexture without any other resources.
+  if(textureInfo.loadState != LoadState::UPLOADED ||
+     !IsRetainableRequest(textureInfo.url, textureInfo.storageType, textureInfo.maskTextureId, textureInfo.isAnimatedImageFormat))
+  {
+    return 0u;
+  }
+
+  uint64_t textureSize = GetUploadedTextureSize(textureInfo);
+  if(textureInfo.pixelBuffer)
+  {
+    textureSize += static_cast<uint64_t>(textureInfo.pixelBuffer.GetWidth()) * textureInfo.pixelBuffer.GetHeight() * Pixel::GetBytesPerPixel(textureInfo.pixelBuffer.GetPixelFormat());
+  }
+
+  return static_cast<uint32_t>(std::min<uint64_t>(textureSize, std::numeric_limits<uint32_t>::max()));
+}
+
+bool TextureCacheManager::IsRetainableRequest(const VisualUrl& url, const TextureCacheManager::StorageType storageType, const TextureCacheManager::TextureId maskTextureId, const bool isAnimatedImage) const
+{
+  return storageType == StorageType::UPLOAD_TO_TEXTURE &&
+         maskTextureId == INVALID_TEXTURE_ID &&
+         !isAnimatedImage &&
+         !url.IsBufferResource() &&
+         url.GetProtocolType() != VisualUrl::TEXTURE;
+}
+
+void TextureCacheManager::EvictReleasedTextures()
+{
+  while(mReleasedTextureBytes > mReleasedTextureBudget && !mReleasedTextureList.empty())
+  {
+    const ReleasedTextureInfo releasedTexture = mReleasedTextureList.back();
+    mReleasedTextureList.pop_back();
+    mReleasedTextureIterators.erase(releasedTexture.textureId);
+    mReleasedTextureBytes -= releasedTexture.textureSize;
+    ++mReleasedTextureEvictCount;
+
+    TextureCacheIndex cacheIndex = GetCacheIndexFromId(releasedTexture.textureId);
+    if(DALI_LIKELY(cacheIndex != INVALID_CACHE_INDEX))
+    {
+      DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::EvictReleasedTextures() Remove released texture(textureId:%d)\n", releasedTexture.textureId);
+      RemoveUnusedTextureInfo(mTextureInfoContainer[cacheIndex.GetIndex()]);
+    }
   }
 }
 
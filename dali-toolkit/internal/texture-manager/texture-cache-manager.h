@@ -20,9 +20,11 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/free-list.h>
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
+#include <list>
 #include <unordered_map>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-type.h>
 #include <dali-toolkit/internal/texture-manager/texture-upload-observer.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
@@ -55,6 +57,10 @@ namespace Internal
  *                           This container will use TEXTURE_CACHE_INDEX_TYPE_BUFFER
  *                           The bufferId will be used for VisualUrl. ex) enbuf://1
  *                           Note that this bufferId is not equal with textureId in mTextureInfoContainer.
+ *
+ * When the released texture cache budget is not zero, uploaded textures whose reference count becomes zero
+ * are not removed immediately. They stay in mTextureInfoContainer and their ids are kept in a LRU list
+ * until the estimated size of all released textures exceeds the budget. FindCachedTexture can revive them.
  */
 class TextureCacheManager
 {
@@ -259,6 +265,51 @@ public:
    */
   void RemoveCache(TextureCacheManager::TextureInfo& textureInfo);
 
+public:
+  // Released texture cache API.
+
+  /**
+   * @brief Set the memory budget of the released texture cache.
+   * Released textures are evicted from the least recently released one until they fit the new budget.
+   * @param[in] budgetBytes The memory budget in bytes. 0 means that released textures are removed immediately.
+   */
+  void SetReleasedTextureCacheBudget(const uint32_t budgetBytes);
+
+  /**
+   * @brief Get the memory budget of the released texture cache.
+   * @return The memory budget in bytes.
+   */
+  uint32_t GetReleasedTextureCacheBudget() const
+  {
+    return mReleasedTextureBudget;
+  }
+
+  /**
+   * @brief Get the statistics of the released texture cache.
+   * @return The statistics of the released texture cache.
+   */
+  Dali::Toolkit::TextureManager::ReleasedTextureCacheStatistics GetReleasedTextureCacheStatistics() const;
+
+  /**
+   * @brief Check whether the texture is only kept in the released texture cache.
+   * @param[in] textureId The TextureId of the texture.
+   * @return True if the texture has been released, and not been reused yet.
+   */
+  bool IsReleasedTexture(const TextureCacheManager::TextureId textureId) const;
+
+  /**
+   * @brief Reset the hit, miss and eviction counters of the released texture cache.
+   */
+  void ResetReleasedTextureCacheStatistics();
+
+  /**
+   * @brief Estimate the memory used by the uploaded textures of a texture info.
+   * @note Uploaded textures are assumed to use 4 bytes per pixel.
+   * @param[in] textureInfo The texture info.
+   * @return The estimated size of the textures in bytes.
+   */
+  static uint64_t GetUploadedTextureSize(const TextureCacheManager::TextureInfo& textureInfo);
+
 public:
   /**
    * @brief Get TextureInfo as TextureCacheIndex.
@@ -304,6 +355,15 @@ private:
     int32_t                          referenceCount;
   };
 
+  /**
+   * @brief This struct is used to manage the released texture which is kept by the budget.
+   */
+  struct ReleasedTextureInfo
+  {
+    TextureCacheManager::TextureId textureId;   ///< The TextureId of released texture
+    uint32_t                       textureSize; ///< The estimated size of released texture, in bytes
+  };
+
   typedef Dali::FreeList TextureIdConverterType; ///< The converter type from TextureId to index of TextureInfoContainer.
 
   typedef std::unordered_map<TextureCacheManager::TextureHash, std::vector<TextureCacheManager::TextureId>> TextureHashContainerType;            ///< The container type used to fast-find the TextureId by TextureHash.
@@ -311,6 +371,9 @@ private:
   typedef std::vector<TextureCacheManager::ExternalTextureInfo>                                             ExternalTextureInfoContainerType;    ///< The container type used to manage the life-cycle and caching of ExternalTexture url
   typedef std::vector<TextureCacheManager::EncodedImageBufferInfo>                                          EncodedImageBufferInfoContainerType; ///< The container type used to manage the life-cycle and caching of EncodedImageBuffer url
 
+  typedef std::list<TextureCacheManager::ReleasedTextureInfo>                                                      ReleasedTextureListType;     ///< The container type used to order released textures as LRU.
+  typedef std::unordered_map<TextureCacheManager::TextureId, TextureCacheManager::ReleasedTextureListType::iterator> ReleasedTextureIteratorType; ///< The container type used to fast-find the released texture by TextureId.
+
 private:
   // Private API: only used internally
 
@@ -356,6 +419,34 @@ private:
   template<class ContainerType>
   void RemoveTextureInfoByIndex(ContainerType& cacheContainer, const TextureCacheManager::TextureCacheIndex& removeContainerIndex);
 
+  /**
+   * @brief Permanently remove the texture info whose reference count is zero.
+   * @param[in] textureInfo The texture info to remove. It is invalidated after this call.
+   */
+  void RemoveUnusedTextureInfo(TextureCacheManager::TextureInfo& textureInfo);
+
+  /**
+   * @brief Check whether the released texture could be kept in the released texture cache.
+   * @param[in] textureInfo The texture info whose reference count became zero.
+   * @return The estimated size of the texture in bytes, or 0 if the texture should not be kept.
+   */
+  uint32_t GetRetainableTextureSize(const TextureCacheManager::TextureInfo& textureInfo) const;
+
+  /**
+   * @brief Check whether the texture of a request could be kept in the released texture cache, once released.
+   * @param[in] url The url of the texture
+   * @param[in] storageType How the texture is stored
+   * @param[in] maskTextureId The id of the mask texture, or INVALID_TEXTURE_ID
+   * @param[in] isAnimatedImage Whether the texture is a frame of an animated image
+   * @return True if the texture could be kept
+   */
+  bool IsRetainableRequest(const VisualUrl& url, const TextureCacheManager::StorageType storageType, const TextureCacheManager::TextureId maskTextureId, const bool isAnimatedImage) const;
+
+  /**
+   * @brief Remove released textures from the least recently released one until they fit the budget.
+   */
+  void EvictReleasedTextures();
+
 private:
   /**
    * Deleted copy constructor.
@@ -374,6 +465,15 @@ private:                                            // Member Variables:
   TextureInfoContainerType            mTextureInfoContainer{}; ///< Used to manage the life-cycle and caching of Textures
   ExternalTextureInfoContainerType    mExternalTextures{};     ///< Externally provided textures
   EncodedImageBufferInfoContainerType mEncodedImageBuffers{};  ///< Externally encoded image buffer
+
+  ReleasedTextureListType     mReleasedTextureList{};      ///< Released textures. Front is the most recently released one.
+  ReleasedTextureIteratorType mReleasedTextureIterators{}; ///< Used to fast-find the released texture in mReleasedTextureList by TextureId.
+
+  uint32_t mReleasedTextureBudget{0u};    ///< The memory budget of released textures, in bytes.
+  uint32_t mReleasedTextureBytes{0u};     ///< The estimated memory used by released textures, in bytes.
+  uint32_t mReleasedTextureHitCount{0u};  ///< The number of released textures revived by FindCachedTexture.
+  uint32_t mReleasedTextureMissCount{0u}; ///< The number of FindCachedTexture calls which found nothing, while a released texture could have served them.
+  uint32_t mReleasedTextureEvictCount{0u}; ///< The number of released textures evicted by the budget.
 };
 
 } // namespace Internal
@@ -28,8 +28,10 @@
 #include <dali/integration-api/trace.h>
 #include <dali/public-api/rendering/geometry.h>
 #include <algorithm>
+#include <string>
 
 // INTERNAL HEADERS
+#include <dali-toolkit/internal/texture-manager/animated-image-frame-ring.h>
 #include <dali-toolkit/internal/texture-manager/texture-async-loading-helper.h>
 #include <dali-toolkit/internal/texture-manager/texture-cache-manager.h>
 #include <dali-toolkit/internal/visuals/rendering-addon.h>
@@ -112,6 +114,9 @@ TextureManager::TextureManager(bool loadYuvPlanes)
   mLoadQueue(),
   mLoadingQueueTextureId(INVALID_TEXTURE_ID),
   mRemoveQueue(),
+  mAnimatedImageFrameRings(),
+  mAnimatedImageFrameBudget(0u),
+  mAnimatedImageFrameBytes(0u),
   mLoadYuvPlanes(loadYuvPlanes),
   mRemoveProcessorRegistered(false)
 {
@@ -121,6 +126,13 @@ TextureManager::TextureManager(bool loadYuvPlanes)
 
 TextureManager::~TextureManager()
 {
+  // The caches may outlive the texture manager. Their rings must not release the frames any more.
+  for(auto& ring : mAnimatedImageFrameRings)
+  {
+    ring.second->Detach();
+  }
+  mAnimatedImageFrameRings.clear();
+
   if(mRemoveProcessorRegistered && Adaptor::IsAvailable())
   {
     Adaptor::Get().UnregisterProcessorOnce(*this, true);
@@ -472,11 +484,12 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
   // Check if the requested Texture exists in the cache.
   if(cacheIndex != INVALID_CACHE_INDEX)
   {
-    if(TextureManager::ReloadPolicy::CACHED == reloadPolicy || INVALID_TEXTURE_ID == previousTextureId)
+    if(TextureManager::ReloadPolicy::CACHED == reloadPolicy || INVALID_TEXTURE_ID == previousTextureId || mTextureCacheManager[cacheIndex].referenceCount <= 0)
     {
       // Mark this texture being used by another client resource, or Reload forced without request load before.
       // Forced reload which have current texture before, would replace the current texture.
       // without the need for incrementing the reference count.
+      // Texture revived from the released texture cache always need to be referenced.
       ++(mTextureCacheManager[cacheIndex].referenceCount);
     }
     textureId = mTextureCacheManager[cacheIndex].textureId;
@@ -657,6 +670,28 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
   return textureId;
 }
 
+void TextureManager::UpdateLoadingPriority(const TextureManager::TextureId textureId)
+{
+  TextureCacheIndex cacheIndex = mTextureCacheManager.GetCacheIndexFromId(textureId);
+  if(cacheIndex == INVALID_CACHE_INDEX)
+  {
+    return;
+  }
+
+  TextureInfo& textureInfo(mTextureCacheManager[cacheIndex]);
+  if(textureInfo.loadState == TextureManager::LoadState::LOADING && !textureInfo.loadSynchronously && !textureInfo.observerList.Empty())
+  {
+    auto loadingPriority = DevelVisual::LoadingPriority::OFF_SCREEN;
+    for(auto* observer : textureInfo.observerList)
+    {
+      loadingPriority = GetMoreUrgentLoadingPriority(loadingPriority, observer->GetTextureLoadingPriority());
+    }
+
+    DALI_LOG_INFO(gTextureManagerLogFilter, Debug::General, "TextureManager::UpdateLoadingPriority( textureId=%d ) loadingPriority:%d\n", textureId, static_cast<int>(loadingPriority));
+    mAsyncLoader->SetLoadingPriority(textureId, loadingPriority);
+  }
+}
+
 void TextureManager::RequestRemove(const TextureManager::TextureId textureId, TextureUploadObserver* observer)
 {
   DALI_LOG_INFO(gTextureManagerLogFilter, Debug::General, "TextureManager::RequestRemove( textureId=%d observer=%p )\n", textureId, observer);
@@ -697,12 +732,83 @@ void TextureManager::RequestRemoveExternalResourceByUrl(const std::string& url)
   }
 }
 
+void TextureManager::SetAnimatedImageFrameBudget(const uint32_t budgetBytes)
+{
+  mAnimatedImageFrameBudget = budgetBytes;
+  for(auto iter = mAnimatedImageFrameRings.begin(); iter != mAnimatedImageFrameRings.end() && mAnimatedImageFrameBytes > mAnimatedImageFrameBudget; ++iter)
+  {
+    iter->second->ReleaseFramesOverBudget();
+  }
+}
+
+AnimatedImageFrameRingPtr TextureManager::GetAnimatedImageFrameRing(const VisualUrl& url, const Dali::ImageDimensions& desiredSize, const Dali::SamplingMode::Type samplingMode)
+{
+  if(mAnimatedImageFrameBudget == 0u || !url.IsValid())
+  {
+    return AnimatedImageFrameRingPtr();
+  }
+
+  std::string key = url.GetUrl();
+  key += '|' + std::to_string(desiredSize.GetWidth()) + 'x' + std::to_string(desiredSize.GetHeight()) + '|' + std::to_string(static_cast<int>(samplingMode));
+
+  auto iter = mAnimatedImageFrameRings.find(key);
+  if(iter != mAnimatedImageFrameRings.end())
+  {
+    return AnimatedImageFrameRingPtr(iter->second);
+  }
+
+  AnimatedImageFrameRingPtr ring = new AnimatedImageFrameRing(*this, key);
+  mAnimatedImageFrameRings.emplace(std::move(key), ring.Get());
+  return ring;
+}
+
+void TextureManager::UnregisterAnimatedImageFrameRing(const std::string& key)
+{
+  mAnimatedImageFrameRings.erase(key);
+}
+
+uint32_t TextureManager::RetainAnimatedImageFrame(const TextureManager::TextureId textureId)
+{
+  TextureCacheIndex cacheIndex = mTextureCacheManager.GetCacheIndexFromId(textureId);
+  if(mAnimatedImageFrameBudget == 0u || cacheIndex == INVALID_CACHE_INDEX)
+  {
+    return 0u;
+  }
+
+  TextureInfo& textureInfo(mTextureCacheManager[cacheIndex]);
+  // A masked frame releases its mask with each reference, so it is never kept.
+  if(textureInfo.loadState != TextureManager::LoadState::UPLOADED ||
+     !textureInfo.isAnimatedImageFormat ||
+     textureInfo.maskTextureId != INVALID_TEXTURE_ID)
+  {
+    return 0u;
+  }
+
+  const uint64_t textureSize = TextureCacheManager::GetUploadedTextureSize(textureInfo);
+  if(textureSize == 0u || mAnimatedImageFrameBytes + textureSize > mAnimatedImageFrameBudget)
+  {
+    return 0u;
+  }
+
+  ++textureInfo.referenceCount;
+  mAnimatedImageFrameBytes += static_cast<uint32_t>(textureSize);
+  return static_cast<uint32_t>(textureSize);
+}
+
+void TextureManager::ReleaseAnimatedImageFrame(const TextureManager::TextureId textureId, const uint32_t textureSize)
+{
+  mAnimatedImageFrameBytes -= std::min(textureSize, mAnimatedImageFrameBytes);
+  RequestRemove(textureId, nullptr);
+}
+
 void TextureManager::Remove(const TextureManager::TextureId textureId)
 {
   if(textureId != INVALID_TEXTURE_ID)
   {
     TextureCacheIndex textureCacheIndex = mTextureCacheManager.GetCacheIndexFromId(textureId);
-    if(textureCacheIndex != INVALID_CACHE_INDEX)
+
+    // A texture kept in the released texture cache has already been removed, with its mask texture.
+    if(textureCacheIndex != INVALID_CACHE_INDEX && !mTextureCacheManager.IsReleasedTexture(textureId))
     {
       TextureManager::TextureId maskTextureId = INVALID_TEXTURE_ID;
       TextureInfo&              textureInfo(mTextureCacheManager[textureCacheIndex]);
@@ -886,7 +992,12 @@ void TextureManager::LoadTexture(TextureManager::TextureInfo& textureInfo, Textu
     }
     else
     {
-      mAsyncLoader->Load(textureInfo.textureId, textureInfo.url, textureInfo.desiredSize, textureInfo.samplingMode, textureInfo.orientationCorrection, premultiplyOnLoad, textureInfo.loadYuvPlanes);
+      auto loadingPriority = observer ? observer->GetTextureLoadingPriority() : DevelVisual::LoadingPriority::DEFAULT;
+      for(auto* textureObserver : textureInfo.observerList)
+      {
+        loadingPriority = GetMoreUrgentLoadingPriority(loadingPriority, textureObserver->GetTextureLoadingPriority());
+      }
+      mAsyncLoader->Load(textureInfo.textureId, textureInfo.url, textureInfo.desiredSize, textureInfo.samplingMode, textureInfo.orientationCorrection, premultiplyOnLoad, textureInfo.loadYuvPlanes, loadingPriority);
     }
   }
   ObserveTexture(textureInfo, observer);
@@ -23,8 +23,11 @@
 #include <dali/integration-api/processor-interface.h>
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
 #include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/rendering/geometry.h>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/texture-manager/texture-cache-manager.h>
@@ -39,6 +42,8 @@ namespace Toolkit
 namespace Internal
 {
 class TextureAsyncLoadingHelper;
+class AnimatedImageFrameRing;
+using AnimatedImageFrameRingPtr = IntrusivePtr<AnimatedImageFrameRing>;
 
 /**
  * The TextureManager provides a common Image loading API for Visuals.
@@ -285,6 +290,94 @@ public:
     return mTextureCacheManager.AddEncodedImageBuffer(encodedImageBuffer);
   }
 
+  /**
+   * @copydoc TextureCacheManager::SetReleasedTextureCacheBudget
+   */
+  inline void SetReleasedTextureCacheBudget(const uint32_t budgetBytes)
+  {
+    mTextureCacheManager.SetReleasedTextureCacheBudget(budgetBytes);
+  }
+
+  /**
+   * @copydoc TextureCacheManager::GetReleasedTextureCacheBudget
+   */
+  inline uint32_t GetReleasedTextureCacheBudget() const
+  {
+    return mTextureCacheManager.GetReleasedTextureCacheBudget();
+  }
+
+  /**
+   * @copydoc TextureCacheManager::GetReleasedTextureCacheStatistics
+   */
+  inline Dali::Toolkit::TextureManager::ReleasedTextureCacheStatistics GetReleasedTextureCacheStatistics() const
+  {
+    return mTextureCacheManager.GetReleasedTextureCacheStatistics();
+  }
+
+  /**
+   * @copydoc TextureCacheManager::ResetReleasedTextureCacheStatistics
+   */
+  inline void ResetReleasedTextureCacheStatistics()
+  {
+    mTextureCacheManager.ResetReleasedTextureCacheStatistics();
+  }
+
+public: // Animated image frame API
+  /**
+   * @brief Sets the memory budget of the decoded animated image frames kept across loops.
+   *
+   * Frames which don't fit any more are released from the end of their loop.
+   * @param[in] budgetBytes The memory budget, in bytes. 0 disables keeping the frames.
+   */
+  void SetAnimatedImageFrameBudget(const uint32_t budgetBytes);
+
+  /**
+   * @brief Gets the memory budget of the decoded animated image frames kept across loops.
+   * @return The memory budget, in bytes
+   */
+  inline uint32_t GetAnimatedImageFrameBudget() const
+  {
+    return mAnimatedImageFrameBudget;
+  }
+
+  /**
+   * @brief Gets the estimated memory used by the decoded animated image frames kept across loops.
+   * @return The memory used, in bytes
+   */
+  inline uint32_t GetAnimatedImageFrameBytes() const
+  {
+    return mAnimatedImageFrameBytes;
+  }
+
+  /**
+   * @brief Gets the frame ring shared by the animated images of the same url, size and sampling mode.
+   * @param[in] url          The url of the animated image
+   * @param[in] desiredSize  The size the frames are loaded at
+   * @param[in] samplingMode The sampling mode the frames are loaded with
+   * @return The frame ring, or an empty pointer if the animated image frame budget is 0
+   */
+  AnimatedImageFrameRingPtr GetAnimatedImageFrameRing(const VisualUrl& url, const Dali::ImageDimensions& desiredSize, const Dali::SamplingMode::Type samplingMode);
+
+  /**
+   * @brief Called by a frame ring when it is destroyed.
+   * @param[in] key The key of the frame ring
+   */
+  void UnregisterAnimatedImageFrameRing(const std::string& key);
+
+  /**
+   * @brief Adds a reference to an uploaded animated image frame, if it fits in the animated image frame budget.
+   * @param[in] textureId The id of the frame texture
+   * @return The memory charged to the budget, in bytes, or 0 if no reference was added
+   */
+  uint32_t RetainAnimatedImageFrame(const TextureManager::TextureId textureId);
+
+  /**
+   * @brief Removes a reference added by RetainAnimatedImageFrame().
+   * @param[in] textureId   The id of the frame texture
+   * @param[in] textureSize The memory charged to the budget, in bytes
+   */
+  void ReleaseAnimatedImageFrame(const TextureManager::TextureId textureId, const uint32_t textureSize);
+
 public: // Load Request API
   /**
    * @brief Requests an image load of the given URL.
@@ -316,6 +409,16 @@ public: // Load Request API
     TextureManager::MultiplyOnLoad&    preMultiplyOnLoad,
     const bool                         synchronousLoading = false);
 
+  /**
+   * @brief Re-prioritises the loading of a texture, after the loading priority hint of one of its observers changed.
+   *
+   * The texture is needed as soon as its most urgent observer needs it.
+   * It does nothing if the texture is not being loaded.
+   *
+   * @param[in] textureId The ID of the texture
+   */
+  void UpdateLoadingPriority(const TextureManager::TextureId textureId);
+
 private: // Internal Load Request API
   /**
    * @brief Requests an image load of the given URL, when the texture has
@@ -655,6 +758,10 @@ private:                                    // Member Variables:
   Dali::Vector<TextureManager::TextureId> mRemoveQueue;         ///< Queue of textures to remove at PostProcess. It will be cleared after PostProcess.
   std::vector<VisualUrl>                  mRemoveExternalQueue; ///< Queue of external resources to remove at PostProcess. It will be cleared after PostProcess.
 
+  std::unordered_map<std::string, AnimatedImageFrameRing*> mAnimatedImageFrameRings; ///< The frame rings by url, size and sampling mode. The rings unregister themselves.
+  uint32_t                                                 mAnimatedImageFrameBudget; ///< The memory budget of the kept animated image frames, in bytes.
+  uint32_t                                                 mAnimatedImageFrameBytes;  ///< The memory used by the kept animated image frames, in bytes.
+
   const bool mLoadYuvPlanes;             ///< A global flag to specify if the image should be loaded as yuv planes
   bool       mRemoveProcessorRegistered; ///< Flag if remove processor registered or not.
 };
@@ -79,6 +79,11 @@ TextureUploadObserver::~TextureUploadObserver()
   }
 }
 
+DevelVisual::LoadingPriority::Type TextureUploadObserver::GetTextureLoadingPriority() const
+{
+  return DevelVisual::LoadingPriority::DEFAULT;
+}
+
 TextureUploadObserver::DestructionSignalType& TextureUploadObserver::DestructionSignal()
 {
   return mDestructionSignal;
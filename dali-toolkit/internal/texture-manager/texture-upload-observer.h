@@ -24,6 +24,7 @@
 #include <dali/public-api/signals/dali-signal.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/public-api/dali-toolkit-common.h>
 
@@ -89,6 +90,13 @@ public:
    */
   virtual void LoadComplete(bool loadSuccess, TextureInformation textureInformation) = 0;
 
+  /**
+   * @brief Retrieves how soon the observer needs the texture.
+   * The TextureManager uses it to decide the priority of the loading task.
+   * @return The loading priority hint. DEFAULT unless overridden by the deriving class.
+   */
+  virtual DevelVisual::LoadingPriority::Type GetTextureLoadingPriority() const;
+
   /**
    * @brief Returns the destruction signal.
    * This is emitted when the observer is destroyed.
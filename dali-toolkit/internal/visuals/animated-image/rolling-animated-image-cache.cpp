@@ -66,6 +66,12 @@ namespace
 {
 static constexpr uint32_t SINGLE_IMAGE_COUNT = 1u;
 static constexpr uint32_t FIRST_FRAME_INDEX  = 0u;
+static constexpr uint16_t MAXIMUM_LOOK_AHEAD = 8u; ///< The most frames requested ahead when the frames are shared.
+
+uint16_t GetQueueCapacity(const TextureManager& textureManager, uint16_t cacheSize)
+{
+  return textureManager.GetAnimatedImageFrameBudget() > 0u ? Max(cacheSize, MAXIMUM_LOOK_AHEAD) : cacheSize;
+}
 } // namespace
 
 RollingAnimatedImageCache::RollingAnimatedImageCache(TextureManager&                     textureManager,
@@ -86,15 +92,22 @@ RollingAnimatedImageCache::RollingAnimatedImageCache(TextureManager&
   mAnimatedImageLoading(animatedImageLoading),
   mFrameCount(SINGLE_IMAGE_COUNT),
   mCacheSize(cacheSize),
-  mQueue(cacheSize),
+  mQueue(GetQueueCapacity(textureManager, cacheSize)),
   mWrapModeU(wrapModeU),
   mWrapModeV(wrapModeV),
   mIsSynchronousLoading(isSynchronousLoading),
-  mReloadPolicy(reloadPolicy)
+  mReloadPolicy(reloadPolicy),
+  mLoadTimed(false)
 {
   mTextureIds.resize(mFrameCount);
   mTextureIds[0] = TextureManager::INVALID_TEXTURE_ID;
   mIntervals.assign(mFrameCount, 0);
+
+  // The frames of a masked image hold the mask, so they are not shared.
+  if(!mMaskingData || !mMaskingData->mAlphaMaskUrl.IsValid())
+  {
+    mFrameRing = mTextureManager.GetAnimatedImageFrameRing(mImageUrl, mDesiredSize, mSamplingMode);
+  }
 }
 
 RollingAnimatedImageCache::~RollingAnimatedImageCache()
@@ -220,6 +233,8 @@ TextureSet RollingAnimatedImageCache::RequestFrameLoading(uint32_t frameIndex, b
 
   mLoadState = TextureManager::LoadState::LOADING;
 
+  const auto loadStartTime = std::chrono::steady_clock::now();
+
   TextureManager::TextureId loadTextureId = TextureManager::INVALID_TEXTURE_ID;
   TextureSet                textureSet    = mTextureManager.LoadAnimatedImageTexture(mImageUrl,
                                                                                      mAnimatedImageLoading,
@@ -233,6 +248,12 @@ TextureSet RollingAnimatedImageCache::RequestFrameLoading(uint32_t frameIndex, b
                                                                                      preMultiplyOnLoading,
                                                                                      mReloadPolicy);
   mReloadPolicy = TextureManager::ReloadPolicy::CACHED;
+  if(mFrameRing && !synchronousLoading && !textureSet && loadTextureId != TextureManager::INVALID_TEXTURE_ID)
+  {
+    // The frame was not in the cache, so it is being decoded. A cached frame has already completed here.
+    mLoadTimed     = true;
+    mLoadStartTime = loadStartTime;
+  }
   if(textureSet && (mWrapModeU != Dali::WrapMode::DEFAULT || mWrapModeV != Dali::WrapMode::DEFAULT))
   {
     Sampler sampler = Sampler::New();
@@ -250,7 +271,14 @@ void RollingAnimatedImageCache::LoadBatch(uint32_t frameIndex)
   // Try and load up to mBatchSize images, until the cache is filled.
   // Once the cache is filled, as frames progress, the old frame is
   // removed, and another frame is loaded
-  uint32_t minimumSize = Min(mCacheSize, mFrameCount);
+  uint32_t cacheSize = mCacheSize;
+  if(mFrameRing)
+  {
+    // Request as many frames ahead as it takes to decode one within the frame interval.
+    const uint32_t interval = mQueue.IsEmpty() ? 0u : GetFrameInterval(mQueue.Back().mFrameNumber);
+    cacheSize               = mFrameRing->GetLookAhead(interval, mCacheSize, GetQueueCapacity(mTextureManager, mCacheSize));
+  }
+  uint32_t minimumSize = Min(cacheSize, mFrameCount);
   for(uint32_t i = 0; i < mBatchSize && (mQueue.Count() + mLoadWaitingQueue.size()) < minimumSize; ++i)
   {
     if(mLoadState != TextureManager::LoadState::LOADING)
@@ -376,6 +404,18 @@ void RollingAnimatedImageCache::LoadComplete(bool loadSuccess, TextureInformatio
     textureInformation.textureSet.SetSampler(0u, sampler);
   }
 
+  if(mFrameRing && loadSuccess && !mQueue.IsEmpty())
+  {
+    if(mLoadTimed)
+    {
+      const auto decodeTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - mLoadStartTime);
+      mFrameRing->AddDecodeTime(static_cast<uint32_t>(decodeTime.count()));
+    }
+    // Only one frame is loading at a time, so mQueue.Back() is the frame loaded.
+    mFrameRing->Retain(mQueue.Back().mFrameNumber, textureInformation.frameCount, textureInformation.textureId);
+  }
+  mLoadTimed = false;
+
   MakeFrameReady(loadSuccess, textureInformation.textureSet, textureInformation.frameCount, textureInformation.interval, textureInformation.preMultiplied);
 
   // TODO : We need to remove some below logics, since user can remove Visual during ResourceReady callback.
@@ -18,10 +18,12 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali-toolkit/internal/texture-manager/animated-image-frame-ring.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
 #include <dali-toolkit/internal/visuals/animated-image/image-cache.h>
 #include <dali/devel-api/adaptor-framework/animated-image-loading.h>
 #include <dali/devel-api/common/circular-queue.h>
+#include <chrono>
 
 namespace Dali
 {
@@ -35,6 +37,10 @@ namespace Internal
  *
  * Frames are always ready, so the observer.FrameReady callback is never triggered;
  * the FirstFrame and NextFrame APIs will always return a texture.
+ *
+ * If the TextureManager has an animated image frame budget, the decoded frames are kept in an
+ * AnimatedImageFrameRing shared with the other caches playing the same image, and the number of
+ * frames requested ahead follows the measured decoding time.
  */
 class RollingAnimatedImageCache : public ImageCache, public TextureUploadObserver
 {
@@ -208,6 +214,10 @@ private:
   Dali::WrapMode::Type       mWrapModeV : 3;
   bool                       mIsSynchronousLoading;
   TextureManager::ReloadPolicy mReloadPolicy;
+
+  AnimatedImageFrameRingPtr             mFrameRing;     ///< The frames shared with the other caches of the same image, if any.
+  std::chrono::steady_clock::time_point mLoadStartTime; ///< When the frame currently loading was requested.
+  bool                                  mLoadTimed;     ///< Whether the frame currently loading is being decoded, so its loading time is measured.
 };
 
 } // namespace Internal
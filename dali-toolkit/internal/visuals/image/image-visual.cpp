@@ -731,7 +731,7 @@ void ImageVisual::LoadTexture(TextureSet& textures, const Dali::ImageDimensions&
     EnablePreMultipliedAlpha(preMultiplyOnLoad == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD);
 
     // Set new TextureSet with fast track loading task
-    mFastTrackLoadingTask = new FastTrackLoadingTask(mImageUrl, size, mSamplingMode, mOrientationCorrection, preMultiplyOnLoad == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD ? DevelAsyncImageLoader::PreMultiplyOnLoad::ON : DevelAsyncImageLoader::PreMultiplyOnLoad::OFF, mFactoryCache.GetLoadYuvPlanes(), MakeCallback(this, &ImageVisual::FastLoadComplete));
+    mFastTrackLoadingTask = new FastTrackLoadingTask(mImageUrl, size, mSamplingMode, mOrientationCorrection, preMultiplyOnLoad == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD ? DevelAsyncImageLoader::PreMultiplyOnLoad::ON : DevelAsyncImageLoader::PreMultiplyOnLoad::OFF, mFactoryCache.GetLoadYuvPlanes(), MakeCallback(this, &ImageVisual::FastLoadComplete), GetLoadingPriority());
 
     TextureSet textureSet = TextureSet::New();
     if(!mFastTrackLoadingTask->mLoadPlanesAvaliable)
@@ -1405,6 +1405,19 @@ Dali::Property ImageVisual::OnGetPropertyObject(Dali::Property::Key key, bool ch
   return Dali::Property(handle, Property::INVALID_INDEX);
 }
 
+void ImageVisual::OnLoadingPriorityChanged()
+{
+  if(mTextureId != TextureManager::INVALID_TEXTURE_ID)
+  {
+    mFactoryCache.GetTextureManager().UpdateLoadingPriority(mTextureId);
+  }
+}
+
+DevelVisual::LoadingPriority::Type ImageVisual::GetTextureLoadingPriority() const
+{
+  return GetLoadingPriority();
+}
+
 void ImageVisual::CheckMaskTexture()
 {
   if(mMaskingData && !mMaskingData->mPreappliedMasking)
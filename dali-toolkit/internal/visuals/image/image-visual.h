@@ -239,7 +239,17 @@ protected:
    */
   Dali::Property OnGetPropertyObject(Dali::Property::Key key, bool changeProperties) override;
 
+  /**
+   * @copydoc Visual::Base::OnLoadingPriorityChanged
+   */
+  void OnLoadingPriorityChanged() override;
+
 public:
+  /**
+   * @copydoc TextureUploadObserver::GetTextureLoadingPriority
+   */
+  DevelVisual::LoadingPriority::Type GetTextureLoadingPriority() const override;
+
   /**
    * @copydoc TextureUploadObserver::LoadCompleted
    *
@@ -25,6 +25,7 @@
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/trace.h>
+#include <algorithm>
 
 namespace Dali
 {
@@ -35,7 +36,6 @@ namespace Internal
 namespace
 {
 constexpr auto INVALID_CACHE_INDEX = int32_t{-1}; ///< Invalid Cache index
-constexpr auto UNINITIALIZED_ID    = int32_t{0};  ///< uninitialised id, use to initialize ids
 
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_IMAGE_PERFORMANCE_MARKER, false);
 } // Anonymous namespace
@@ -115,17 +115,47 @@ NPatchData::NPatchDataId NPatchLoader::Load(TextureManager& textureManager, Text
 
 int32_t NPatchLoader::GetCacheIndexFromId(const NPatchData::NPatchDataId id)
 {
-  const unsigned int size = mCache.size();
+  const auto iter = mCacheIndices.find(id);
+  if(iter != mCacheIndices.end())
+  {
+    DALI_ASSERT_DEBUG(static_cast<std::size_t>(iter->second) < mCache.size());
+    return iter->second;
+  }
+
+  return INVALID_CACHE_INDEX;
+}
+
+void NPatchLoader::RemoveCacheByIndex(const int32_t cacheIndex)
+{
+  const NPatchData::NPatchDataId id   = mCache[cacheIndex].mData->GetId();
+  const std::size_t              hash = mCache[cacheIndex].mData->GetHash();
 
-  for(unsigned int i = 0; i < size; ++i)
+  // Step 1. remove id from the url hash container. Keep the order of the other ids.
+  auto hashIterator = mUrlHashIds.find(hash);
+  if(hashIterator != mUrlHashIds.end())
   {
-    if(mCache[i].mData->GetId() == id)
+    auto&      hashIdList     = hashIterator->second;
+    const auto hashIdIterator = std::find(hashIdList.cbegin(), hashIdList.cend(), id);
+    if(hashIdIterator != hashIdList.cend())
     {
-      return i;
+      hashIdList.erase(hashIdIterator);
+      if(hashIdList.empty())
+      {
+        mUrlHashIds.erase(hashIterator);
+      }
     }
   }
 
-  return INVALID_CACHE_INDEX;
+  // Step 2. remove id from the index container.
+  mCacheIndices.erase(id);
+
+  // Step 3. swap last data of mCache, and pop_back.
+  if(static_cast<std::size_t>(cacheIndex + 1) < mCache.size())
+  {
+    mCacheIndices[mCache.back().mData->GetId()] = cacheIndex;
+    std::swap(mCache[cacheIndex], mCache.back());
+  }
+  mCache.pop_back();
 }
 
 bool NPatchLoader::GetNPatchData(const NPatchData::NPatchDataId id, NPatchDataPtr& data)
@@ -177,7 +207,7 @@ void NPatchLoader::Remove(NPatchData::NPatchDataId id, TextureUploadObserver* te
 
   if(--info.mReferenceCount <= 0)
   {
-    mCache.erase(mCache.begin() + cacheIndex);
+    RemoveCacheByIndex(cacheIndex);
   }
 }
 
@@ -202,37 +232,43 @@ void NPatchLoader::Process(bool postProcessor)
 
 NPatchDataPtr NPatchLoader::GetNPatchData(const VisualUrl& url, const Dali::Extents& border, bool& preMultiplyOnLoad)
 {
-  std::size_t                              hash  = url.GetUrlHash();
-  std::vector<NPatchInfo>::size_type       index = UNINITIALIZED_ID;
-  const std::vector<NPatchInfo>::size_type count = mCache.size();
+  std::size_t hash = url.GetUrlHash();
 
   NPatchInfo* infoPtr = nullptr;
 
-  for(; index < count; ++index)
+  // Only the data of the same url hash need to be checked, in the order of creation.
+  // The bucket deliberately holds every border of the url, not only the requested one: a data with
+  // another border that has finished loading lends its texture to a new data, instead of loading the
+  // image again. preMultiplyOnLoad isn't part of the key either, as it's an output of the first load.
+  // A bucket holds one entry per border used with the url, so the scan stays short.
+  auto hashIterator = mUrlHashIds.find(hash);
+  if(hashIterator != mUrlHashIds.end())
   {
-    if(mCache[index].mData->GetHash() == hash)
+    for(const auto& id : hashIterator->second)
     {
+      NPatchInfo& info(mCache[GetCacheIndexFromId(id)]);
+
       // hash match, check url as well in case of hash collision
-      if(mCache[index].mData->GetUrl().GetUrl() == url.GetUrl())
+      if(info.mData->GetUrl().GetUrl() == url.GetUrl())
       {
         // Use cached data. Need to fast-out return.
-        if(mCache[index].mData->GetBorder() == border)
+        if(info.mData->GetBorder() == border)
         {
-          mCache[index].mReferenceCount++;
-          return mCache[index].mData;
+          info.mReferenceCount++;
+          return info.mData;
         }
         else
         {
-          if(mCache[index].mData->GetLoadingState() == NPatchData::LoadingState::LOAD_COMPLETE)
+          if(info.mData->GetLoadingState() == NPatchData::LoadingState::LOAD_COMPLETE)
           {
             // If we only found LOAD_FAILED case, replace current data. We can reuse texture
             if(infoPtr == nullptr || infoPtr->mData->GetLoadingState() != NPatchData::LoadingState::LOAD_COMPLETE)
             {
-              infoPtr = &mCache[index];
+              infoPtr = &info;
             }
           }
           // Still loading pixel buffer. We cannot reuse cached texture yet. Skip checking
-          else if(mCache[index].mData->GetLoadingState() == NPatchData::LoadingState::LOADING)
+          else if(info.mData->GetLoadingState() == NPatchData::LoadingState::LOADING)
           {
             continue;
           }
@@ -241,7 +277,7 @@ NPatchDataPtr NPatchLoader::GetNPatchData(const VisualUrl& url, const Dali::Exte
           {
             if(infoPtr == nullptr)
             {
-              infoPtr = &mCache[index];
+              infoPtr = &info;
             }
           }
         }
@@ -259,6 +295,8 @@ NPatchDataPtr NPatchLoader::GetNPatchData(const VisualUrl& url, const Dali::Exte
     info.mData->SetBorder(border);
     info.mData->SetPreMultiplyOnLoad(preMultiplyOnLoad);
 
+    mCacheIndices[info.mData->GetId()] = static_cast<int32_t>(mCache.size());
+    mUrlHashIds[hash].push_back(info.mData->GetId());
     mCache.emplace_back(std::move(info));
     infoPtr = &mCache.back();
   }
@@ -288,6 +326,8 @@ NPatchDataPtr NPatchLoader::GetNPatchData(const VisualUrl& url, const Dali::Exte
 
     info.mData->SetLoadingState(NPatchData::LoadingState::LOAD_COMPLETE);
 
+    mCacheIndices[info.mData->GetId()] = static_cast<int32_t>(mCache.size());
+    mUrlHashIds[hash].push_back(info.mData->GetId());
     mCache.emplace_back(std::move(info));
     infoPtr = &mCache.back();
   }
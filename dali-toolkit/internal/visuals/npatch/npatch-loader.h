@@ -23,6 +23,7 @@
 #include <dali/public-api/common/extents.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <string>
+#include <unordered_map>
 #include <utility> // for std::pair
 
 // INTERNAL INCLUDES
@@ -109,6 +110,14 @@ private:
 
   int32_t GetCacheIndexFromId(const NPatchData::NPatchDataId id);
 
+  /**
+   * @brief Remove the cached data at the index, by swapping it with the last cached data.
+   * The ids of the remaining data are not changed.
+   *
+   * @param [in] cacheIndex The index of the data to remove
+   */
+  void RemoveCacheByIndex(const int32_t cacheIndex);
+
   /**
    * @brief Remove a texture matching id.
    * Erase the observer from the observer list of cache if we need.
@@ -181,8 +190,13 @@ protected:
   NPatchLoader& operator=(const NPatchLoader& rhs);
 
 private:
+  typedef std::unordered_map<NPatchData::NPatchDataId, int32_t>                     CacheIndexContainerType; ///< The container type used to fast-find the cache index by NPatchDataId.
+  typedef std::unordered_map<std::size_t, std::vector<NPatchData::NPatchDataId>> UrlHashContainerType;    ///< The container type used to fast-find the NPatchDataIds by url hash, in the order of creation.
+
   NPatchData::NPatchDataId mCurrentNPatchDataId;
   std::vector<NPatchInfo>  mCache;
+  CacheIndexContainerType  mCacheIndices; ///< The index of each NPatchData in mCache.
+  UrlHashContainerType     mUrlHashIds;   ///< The ids of the NPatchData for each url hash. Keyed by url only, on purpose: see GetNPatchData().
 
   std::vector<std::pair<NPatchData::NPatchDataId, TextureUploadObserver*>> mRemoveQueue; ///< Queue of textures to remove at PostProcess. It will be cleared after PostProcess.
 
@@ -22,6 +22,7 @@
 #include <dali/public-api/rendering/texture-set.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 
 namespace Dali
 {
@@ -87,6 +88,18 @@ public:
    */
   virtual void RasterizeComplete(int32_t rasterizeId, Dali::TextureSet textureSet) = 0;
 
+  /**
+   * Retrieves how soon the observer needs the svg.
+   * The SvgLoader uses it to decide the priority of the loading and rasterizing tasks.
+   * This may be overridden by the deriving class.
+   *
+   * @return The loading priority hint.
+   */
+  virtual DevelVisual::LoadingPriority::Type GetSvgLoadingPriority() const
+  {
+    return DevelVisual::LoadingPriority::DEFAULT;
+  }
+
 private:
   DestructionSignalType mLoadDestructionSignal;      ///< The destruction signal emitted when the observer is destroyed.
   DestructionSignalType mRasterizeDestructionSignal; ///< The destruction signal emitted when the observer is destroyed.
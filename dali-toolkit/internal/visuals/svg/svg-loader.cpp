@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/visuals/svg/svg-loader.h>
 
 // INTERNAL HEADERS
+#include <dali-toolkit/internal/image-loader/loading-task.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-impl.h> ///< for EncodedImageBuffer
 #include <dali-toolkit/internal/visuals/svg/svg-task.h>
 #include <dali-toolkit/internal/visuals/svg/svg-visual.h>
@@ -631,7 +632,7 @@ void SvgLoader::LoadRequest(SvgLoader::SvgLoadInfo& loadInfo, SvgLoaderObserver*
     }
   }
 
-  loadInfo.mTask = new SvgLoadingTask(loadInfo.mVectorImageRenderer, loadInfo.mId, loadInfo.mImageUrl, encodedImageBuffer, MakeCallback(this, &SvgLoader::AsyncLoadComplete));
+  loadInfo.mTask = new SvgLoadingTask(loadInfo.mVectorImageRenderer, loadInfo.mId, loadInfo.mImageUrl, encodedImageBuffer, MakeCallback(this, &SvgLoader::AsyncLoadComplete), GetLoadingPriority(loadInfo.mObservers));
 
   Dali::AsyncTaskManager::Get().AddTask(loadInfo.mTask);
 }
@@ -841,10 +842,15 @@ void SvgLoader::RasterizeRequest(SvgLoader::SvgRasterizeInfo& rasterizeInfo, Svg
   AddRasterizeObserver(rasterizeInfo, svgObserver);
   rasterizeInfo.mRasterizeState = RasterizeState::RASTERIZING;
 
+  AddRasterizingTask(rasterizeInfo);
+}
+
+void SvgLoader::AddRasterizingTask(SvgLoader::SvgRasterizeInfo& rasterizeInfo)
+{
   auto loadCacheIndex      = GetCacheIndexFromLoadCacheById(rasterizeInfo.mLoadId);
   auto vectorImageRenderer = mLoadCache[loadCacheIndex].mVectorImageRenderer;
 
-  SvgRasterizingTaskPtr rasterizingTask = new SvgRasterizingTask(vectorImageRenderer, rasterizeInfo.mId, rasterizeInfo.mWidth, rasterizeInfo.mHeight, MakeCallback(this, &SvgLoader::AsyncRasterizeComplete));
+  SvgRasterizingTaskPtr rasterizingTask = new SvgRasterizingTask(vectorImageRenderer, rasterizeInfo.mId, rasterizeInfo.mWidth, rasterizeInfo.mHeight, MakeCallback(this, &SvgLoader::AsyncRasterizeComplete), GetLoadingPriority(rasterizeInfo.mObservers));
 #ifdef TRACE_ENABLED
   {
     rasterizingTask->SetUrl(mLoadCache[loadCacheIndex].mImageUrl);
@@ -864,6 +870,50 @@ void SvgLoader::RasterizeRequest(SvgLoader::SvgRasterizeInfo& rasterizeInfo, Svg
   Dali::AsyncTaskManager::Get().AddTask(rasterizeInfo.mTask);
 }
 
+void SvgLoader::UpdateRasterizePriority(SvgRasterizeId rasterizeId)
+{
+  auto cacheIndex = GetCacheIndexFromRasterizeCacheById(rasterizeId);
+  if(cacheIndex == SvgLoader::INVALID_SVG_CACHE_INDEX)
+  {
+    return;
+  }
+
+  auto& rasterizeInfo(mRasterizeCache[cacheIndex]);
+  if(rasterizeInfo.mRasterizeState != RasterizeState::RASTERIZING || !rasterizeInfo.mTask || rasterizeInfo.mTask->IsStarted())
+  {
+    return;
+  }
+
+  const auto loadingPriority = GetLoadingPriority(rasterizeInfo.mObservers);
+  if(rasterizeInfo.mTask->GetPriorityType() == GetLoadingTaskPriorityType(loadingPriority, AsyncTask::PriorityType::DEFAULT))
+  {
+    return;
+  }
+
+  DALI_LOG_INFO(gSvgLoaderLogFilter, Debug::Concise, "SvgLoader::UpdateRasterizePriority(): id:%d loadingPriority:%d\n", rasterizeId, static_cast<int>(loadingPriority));
+
+  // The priority of a queued task can't be changed. Replace it by an identical task.
+  // A task which is already running is left to finish, rather than restarted.
+  Dali::AsyncTaskManager::Get().RemoveTask(rasterizeInfo.mTask);
+  rasterizeInfo.mTask.Reset();
+  AddRasterizingTask(rasterizeInfo);
+}
+
+DevelVisual::LoadingPriority::Type SvgLoader::GetLoadingPriority(const ObserverContainer& observers)
+{
+  if(observers.Empty())
+  {
+    return DevelVisual::LoadingPriority::DEFAULT;
+  }
+
+  auto loadingPriority = DevelVisual::LoadingPriority::OFF_SCREEN;
+  for(auto* observer : observers)
+  {
+    loadingPriority = GetMoreUrgentLoadingPriority(loadingPriority, observer->GetSvgLoadingPriority());
+  }
+  return loadingPriority;
+}
+
 void SvgLoader::RasterizeSynchronously(SvgLoader::SvgRasterizeInfo& rasterizeInfo, SvgLoaderObserver* svgObserver)
 {
   DALI_LOG_INFO(gSvgLoaderLogFilter, Debug::Concise, "SvgLoader::RasterizeSynchronously(): id:%d observer:%p\n", rasterizeInfo.mId, svgObserver);
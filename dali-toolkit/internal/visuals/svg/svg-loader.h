@@ -152,6 +152,14 @@ public:
    */
   VectorImageRenderer GetVectorImageRenderer(SvgLoadId loadId) const;
 
+  /**
+   * @brief Re-prioritises the rasterization, after the loading priority hint of one of its observers changed.
+   * It does nothing if the rasterization is not in progress, or if its task has already started.
+   *
+   * @param[in] rasterizeId cache data id
+   */
+  void UpdateRasterizePriority(SvgRasterizeId rasterizeId);
+
 protected: // Implementation of Processor
   /**
    * @copydoc Dali::Integration::Processor::Process()
@@ -394,6 +402,19 @@ private: ///< Internal Methods for rasterize
   void RemoveRasterizeObserver(SvgLoader::SvgRasterizeInfo& rasterizeInfo, SvgLoaderObserver* svgObserver);
   void ProcessRasterizeQueue();
 
+  /**
+   * Create the rasterizing task with the priority of the current observers, and add it to the task manager.
+   * @param[in] rasterizeInfo The rasterize info.
+   */
+  void AddRasterizingTask(SvgLoader::SvgRasterizeInfo& rasterizeInfo);
+
+  /**
+   * Retrieves how soon the observers need the svg, i.e. the most urgent of their loading priority hints.
+   * @param[in] observers The observers of the svg.
+   * @return The loading priority hint, DEFAULT if there is no observer.
+   */
+  static DevelVisual::LoadingPriority::Type GetLoadingPriority(const ObserverContainer& observers);
+
   /**
    * Notify the current observers that the svg rasterize is complete,
    * then remove the observers from the list.
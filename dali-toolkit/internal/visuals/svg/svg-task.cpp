@@ -25,6 +25,7 @@
 #include <dali/integration-api/trace.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/image-loader/loading-task.h>
 #include <dali-toolkit/internal/visuals/svg/svg-visual.h>
 
 #ifdef TRACE_ENABLED
@@ -78,8 +79,8 @@ VectorImageRenderer SvgTask::GetRenderer()
   return mVectorRenderer;
 }
 
-SvgLoadingTask::SvgLoadingTask(VectorImageRenderer vectorRenderer, int32_t id, const VisualUrl& url, EncodedImageBuffer encodedImageBuffer, CallbackBase* callback)
-: SvgTask(vectorRenderer, id, callback, url.GetProtocolType() == VisualUrl::ProtocolType::REMOTE ? AsyncTask::PriorityType::LOW : AsyncTask::PriorityType::HIGH),
+SvgLoadingTask::SvgLoadingTask(VectorImageRenderer vectorRenderer, int32_t id, const VisualUrl& url, EncodedImageBuffer encodedImageBuffer, CallbackBase* callback, DevelVisual::LoadingPriority::Type loadingPriority)
+: SvgTask(vectorRenderer, id, callback, GetLoadingTaskPriorityType(url, loadingPriority)),
   mImageUrl(url),
   mEncodedImageBuffer(encodedImageBuffer),
   mNotifyRequiredTasks()
@@ -194,8 +195,8 @@ void SvgLoadingTask::NotifyTasksReady()
   }
 }
 
-SvgRasterizingTask::SvgRasterizingTask(VectorImageRenderer vectorRenderer, int32_t id, uint32_t width, uint32_t height, CallbackBase* callback)
-: SvgTask(vectorRenderer, id, callback),
+SvgRasterizingTask::SvgRasterizingTask(VectorImageRenderer vectorRenderer, int32_t id, uint32_t width, uint32_t height, CallbackBase* callback, DevelVisual::LoadingPriority::Type loadingPriority)
+: SvgTask(vectorRenderer, id, callback, GetLoadingTaskPriorityType(loadingPriority, AsyncTask::PriorityType::DEFAULT)),
   mWidth(width),
   mHeight(height)
 {
@@ -207,6 +208,8 @@ SvgRasterizingTask::~SvgRasterizingTask()
 
 void SvgRasterizingTask::Process()
 {
+  mStarted = true;
+
   if(!mVectorRenderer.IsLoaded())
   {
     DALI_LOG_ERROR("File is not loaded!\n");
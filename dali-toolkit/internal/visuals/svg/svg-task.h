@@ -24,9 +24,11 @@
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/images/pixel-data.h>
+#include <atomic>
 #include <memory>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali/devel-api/adaptor-framework/async-task-manager.h>
 
@@ -98,6 +100,15 @@ public:
    */
   virtual PixelData GetPixelData() const;
 
+  /**
+   * Whether a worker thread has started to process the task.
+   * @return True if the task has started.
+   */
+  bool IsStarted() const
+  {
+    return mStarted;
+  }
+
 private:
   // Undefined
   SvgTask(const SvgTask& task) = delete;
@@ -109,6 +120,7 @@ protected:
   VectorImageRenderer mVectorRenderer;
   const int32_t       mId;
   bool                mHasSucceeded;
+  std::atomic<bool>   mStarted{false};
 };
 
 class SvgLoadingTask : public SvgTask
@@ -121,8 +133,9 @@ public:
    * @param[in] url The URL to svg resource to use.
    * @param[in] encodedImageBuffer The resource buffer if required.
    * @param[in] callback The callback that is called when the operation is completed.
+   * @param[in] loadingPriority The loading priority hint of the visual that requested the svg.
    */
-  SvgLoadingTask(VectorImageRenderer vectorRenderer, int32_t id, const VisualUrl& url, EncodedImageBuffer encodedImageBuffer, CallbackBase* callback);
+  SvgLoadingTask(VectorImageRenderer vectorRenderer, int32_t id, const VisualUrl& url, EncodedImageBuffer encodedImageBuffer, CallbackBase* callback, DevelVisual::LoadingPriority::Type loadingPriority = DevelVisual::LoadingPriority::DEFAULT);
 
   /**
    * Destructor.
@@ -180,8 +193,9 @@ public:
    * @param[in] width The rasterization width.
    * @param[in] height The rasterization height.
    * @param[in] callback The callback that is called when the operation is completed.
+   * @param[in] loadingPriority The loading priority hint of the visuals that requested the rasterization.
    */
-  SvgRasterizingTask(VectorImageRenderer vectorRenderer, int32_t id, uint32_t width, uint32_t height, CallbackBase* callback);
+  SvgRasterizingTask(VectorImageRenderer vectorRenderer, int32_t id, uint32_t width, uint32_t height, CallbackBase* callback, DevelVisual::LoadingPriority::Type loadingPriority = DevelVisual::LoadingPriority::DEFAULT);
 
   /**
    * Destructor.
@@ -575,6 +575,19 @@ Shader SvgVisual::GenerateShader() const
   return shader;
 }
 
+void SvgVisual::OnLoadingPriorityChanged()
+{
+  if(mSvgRasterizeId != SvgLoader::INVALID_SVG_RASTERIZE_ID)
+  {
+    mSvgLoader.UpdateRasterizePriority(mSvgRasterizeId);
+  }
+}
+
+DevelVisual::LoadingPriority::Type SvgVisual::GetSvgLoadingPriority() const
+{
+  return GetLoadingPriority();
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -153,6 +153,11 @@ protected:
    */
   Shader GenerateShader() const override;
 
+  /**
+   * @copydoc Visual::Base::OnLoadingPriorityChanged
+   */
+  void OnLoadingPriorityChanged() override;
+
 protected: // Implementation of  SvgLoaderObserver
   /**
    * @copydoc Dali::Toolkit::Internal::SvgLoaderObserver::LoadComplete
@@ -164,6 +169,11 @@ protected: // Implementation of  SvgLoaderObserver
    */
   void RasterizeComplete(int32_t rasterizeId, Dali::TextureSet textureSet) override;
 
+  /**
+   * @copydoc Dali::Toolkit::Internal::SvgLoaderObserver::GetSvgLoadingPriority
+   */
+  DevelVisual::LoadingPriority::Type GetSvgLoadingPriority() const override;
+
 private:
   /**
    * @bried Rasterize the svg with the given size, and add it to the visual.
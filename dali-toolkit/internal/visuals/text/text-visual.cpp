@@ -1104,7 +1104,7 @@ void TextVisual::LoadComplete(bool loadingSuccess, const TextInformation& textIn
       mAsyncTextInterface->AsyncSetupAutoScroll(renderInfo);
     }
 
-    if(mAsyncTextInterface && parameters.isTextFitEnabled)
+    if(mAsyncTextInterface && (parameters.isTextFitEnabled || parameters.isTextFitArrayEnabled))
     {
       mAsyncTextInterface->AsyncTextFitChanged(parameters.fontSize);
     }
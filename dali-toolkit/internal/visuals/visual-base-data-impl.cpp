@@ -131,6 +131,7 @@ Internal::Visual::Base::Impl::Impl(FittingMode fittingMode, Toolkit::Visual::Typ
   mFittingMode(fittingMode),
   mFlags(0),
   mResourceStatus(Toolkit::Visual::ResourceStatus::PREPARING),
+  mLoadingPriority(DevelVisual::LoadingPriority::DEFAULT),
   mType(type),
   mAlwaysUsingBorderline(false),
   mAlwaysUsingCornerRadius(false),
@@ -551,6 +551,7 @@ struct Base::Impl
   FittingMode                                mFittingMode; ///< How the contents should fit the view
   int                                        mFlags;
   Toolkit::Visual::ResourceStatus            mResourceStatus;
+  DevelVisual::LoadingPriority::Type         mLoadingPriority; ///< How soon the resources are needed
   const Toolkit::Visual::Type                mType;
 
   bool mAlwaysUsingBorderline : 1;         ///< Whether we need the borderline in shader always.
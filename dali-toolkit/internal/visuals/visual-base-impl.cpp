@@ -924,6 +924,11 @@ void Visual::Base::OnDoActionExtension(const Property::Index actionId, const Dal
   // May be overriden by derived class
 }
 
+void Visual::Base::OnLoadingPriorityChanged()
+{
+  // May be overriden by derived class
+}
+
 Dali::Property Visual::Base::OnGetPropertyObject(Dali::Property::Key key, bool changeProperties)
 {
   // May be overriden by derived class
@@ -1029,6 +1034,20 @@ bool Visual::Base::IsSynchronousLoadingRequired() const
   return (mImpl->mFlags & Impl::IS_SYNCHRONOUS_RESOURCE_LOADING);
 }
 
+void Visual::Base::SetLoadingPriority(DevelVisual::LoadingPriority::Type loadingPriority)
+{
+  if(mImpl->mLoadingPriority != loadingPriority)
+  {
+    mImpl->mLoadingPriority = loadingPriority;
+    OnLoadingPriorityChanged();
+  }
+}
+
+DevelVisual::LoadingPriority::Type Visual::Base::GetLoadingPriority() const
+{
+  return mImpl->mLoadingPriority;
+}
+
 Toolkit::Visual::Type Visual::Base::GetType() const
 {
   return mImpl->mType;
@@ -336,6 +336,18 @@ public:
    */
   bool IsSynchronousLoadingRequired() const;
 
+  /**
+   * @brief Sets the hint of how soon the resources of this visual are needed.
+   * @param[in] loadingPriority The loading priority hint
+   */
+  void SetLoadingPriority(DevelVisual::LoadingPriority::Type loadingPriority);
+
+  /**
+   * @brief Retrieves the hint of how soon the resources of this visual are needed.
+   * @return The loading priority hint
+   */
+  DevelVisual::LoadingPriority::Type GetLoadingPriority() const;
+
   /**
    * @brief Get the type of this visual.
    *
@@ -501,6 +513,11 @@ protected:
    */
   virtual void OnDoActionExtension(const Property::Index actionId, const Dali::Any& attributes);
 
+  /**
+   * @brief Called by SetLoadingPriority() when the hint changes, allowing sub classes to re-prioritise their queued loads.
+   */
+  virtual void OnLoadingPriorityChanged();
+
   /**
    * @brief Update the shader when some properties are changed.
    */
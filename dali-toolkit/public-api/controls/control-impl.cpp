@@ -41,6 +41,7 @@
 #include <dali-toolkit/devel-api/visuals/visual-actions-devel.h>
 #include <dali-toolkit/internal/controls/control/control-internal.h>
 #include <dali-toolkit/internal/controls/control/control-visual-data.h>
+#include <dali-toolkit/internal/focus-manager/keyboard-focus-manager-impl.h>
 #include <dali-toolkit/internal/render-effects/render-effect-impl.h>
 #include <dali-toolkit/internal/styling/default-theme.h>
 #include <dali-toolkit/internal/styling/style-manager-impl.h>
@@ -660,11 +661,21 @@ void ControlImpl::OnSceneConnection(int depth)
 
   // The clipping renderer is only created if required.
   CreateClippingRenderer(*this);
+
+  if(Self().GetProperty<bool>(Actor::Property::FOCUSABLE))
+  {
+    Toolkit::Internal::KeyboardFocusManager::UpdateFocusIndex(Self(), true);
+  }
 }
 
 void ControlImpl::OnSceneDisconnection()
 {
   mInternal->OnSceneDisconnection();
+
+  if(Self().GetProperty<bool>(Actor::Property::FOCUSABLE))
+  {
+    Toolkit::Internal::KeyboardFocusManager::UpdateFocusIndex(Self(), false);
+  }
 }
 
 void ControlImpl::OnKeyInputFocusGained()
@@ -709,6 +720,15 @@ void ControlImpl::OnPropertySet(Property::Index index, const Property::Value& pr
       }
       break;
     }
+    case Actor::Property::FOCUSABLE:
+    {
+      // Only the focusable controls on the scene are kept in the focus index.
+      if(Self().GetProperty<bool>(Actor::Property::CONNECTED_TO_SCENE))
+      {
+        Toolkit::Internal::KeyboardFocusManager::UpdateFocusIndex(Self(), propertyValue.Get<bool>());
+      }
+      break;
+    }
   }
 }
 
@@ -728,6 +748,11 @@ void ControlImpl::OnSizeSet(const Vector3& targetSize)
 
   // Refresh render effects
   RefreshRenderEffects();
+
+  if(Self().GetProperty<bool>(Actor::Property::FOCUSABLE))
+  {
+    Toolkit::Internal::KeyboardFocusManager::MarkFocusIndexDirty(Self());
+  }
 }
 
 void ControlImpl::OnSizeAnimation(Animation& animation, const Vector3& targetSize)
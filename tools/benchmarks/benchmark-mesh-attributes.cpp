@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/internal/common/parallel-job-runner.h>
+#include <dali-scene3d/internal/loader/mesh-attribute-generator.h>
+
+using namespace Dali;
+
+namespace
+{
+/**
+ * @brief A bumpy grid of (size + 1)^2 vertices and 2 * size^2 triangles.
+ */
+struct Grid
+{
+  Grid(uint32_t size)
+  {
+    uint32_t random = 1u;
+    for(uint32_t y = 0u; y <= size; ++y)
+    {
+      for(uint32_t x = 0u; x <= size; ++x)
+      {
+        random = random * 1664525u + 1013904223u;
+        mPositions.push_back(Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(random >> 8) / 16777216.0f));
+        mUvs.push_back(Vector2(static_cast<float>(x) / size, static_cast<float>(y) / size));
+      }
+    }
+
+    for(uint32_t y = 0u; y < size; ++y)
+    {
+      for(uint32_t x = 0u; x < size; ++x)
+      {
+        const uint32_t corner = y * (size + 1u) + x;
+        mIndices.insert(mIndices.end(), {corner, corner + 1u, corner + size + 1u, corner + 1u, corner + size + 2u, corner + size + 1u});
+      }
+    }
+  }
+
+  uint32_t GetNumberOfVertices() const
+  {
+    return static_cast<uint32_t>(mPositions.size());
+  }
+
+  uint32_t GetNumberOfIndices() const
+  {
+    return static_cast<uint32_t>(mIndices.size());
+  }
+
+  std::vector<Vector3>  mPositions;
+  std::vector<Vector2>  mUvs;
+  std::vector<uint32_t> mIndices;
+};
+
+template<typename Function>
+double MeasureMilliseconds(Function function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  function();
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+} // namespace
+
+int main()
+{
+  using namespace Dali::Scene3D::Loader::Internal;
+
+  // A mesh of about 1M triangles.
+  Grid           grid(708u);
+  const uint32_t numVertices     = grid.GetNumberOfVertices();
+  const uint32_t numIndices      = grid.GetNumberOfIndices();
+  const uint32_t numberOfHelpers = Scene3D::Internal::GetDefaultNumberOfJobHelpers();
+
+  std::vector<Vector3> serialNormals(numVertices), parallelNormals(numVertices);
+  std::vector<Vector4> serialTangents(numVertices), parallelTangents(numVertices);
+
+  const double serialNormalsTime    = MeasureMilliseconds([&]() { GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, serialNormals.data(), 0u); });
+  const double parallelNormalsTime  = MeasureMilliseconds([&]() { GenerateNormals(grid.mPositions.data(), numVertices, grid.mIndices.data(), numIndices, parallelNormals.data(), numberOfHelpers); });
+  const double serialTangentsTime   = MeasureMilliseconds([&]() { GenerateTangents(grid.mPositions.data(), serialNormals.data(), grid.mUvs.data(), numVertices, grid.mIndices.data(), numIndices, serialTangents.data(), 0u); });
+  const double parallelTangentsTime = MeasureMilliseconds([&]() { GenerateTangents(grid.mPositions.data(), serialNormals.data(), grid.mUvs.data(), numVertices, grid.mIndices.data(), numIndices, parallelTangents.data(), numberOfHelpers); });
+
+  printf("Mesh attribute generation, %u triangles, %u helpers\n", numIndices / 3u, numberOfHelpers);
+  printf("  normals  : %.2f ms -> %.2f ms\n", serialNormalsTime, parallelNormalsTime);
+  printf("  tangents : %.2f ms -> %.2f ms\n", serialTangentsTime, parallelTangentsTime);
+
+  return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
+#include <dali-toolkit/internal/visuals/npatch/npatch-loader.h>
+#include <toolkit-test-application.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace
+{
+template<typename Function>
+double MeasureMilliseconds(Function function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  function();
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+} // namespace
+
+int main()
+{
+  ToolkitTestApplication application;
+
+  // The n-patch visuals of a theme, with two borders per asset, as the controls of a theme often do.
+  const int numberOfVisuals = 5000;
+  const int numberOfAssets  = 500;
+
+  Internal::TextureManager textureManager;
+  Internal::NPatchLoader   npatchLoader;
+
+  // The files don't exist, so only the cache is measured, not the decoding.
+  std::vector<Internal::VisualUrl> urls;
+  for(int i = 0; i < numberOfAssets; ++i)
+  {
+    urls.emplace_back(std::string("benchmark-invalid-") + std::to_string(i) + ".9.png");
+  }
+
+  std::vector<Internal::NPatchData::NPatchDataId> ids;
+  ids.reserve(numberOfVisuals);
+
+  const double loadTime = MeasureMilliseconds([&]() {
+    bool preMultiplyOnLoad = true;
+    for(int i = 0; i < numberOfVisuals; ++i)
+    {
+      const Extents border = (i / numberOfAssets) % 2 ? Extents(1u, 1u, 1u, 1u) : Extents();
+      ids.push_back(npatchLoader.Load(textureManager, nullptr, urls[i % numberOfAssets], border, preMultiplyOnLoad, true));
+    }
+  });
+
+  int          found      = 0;
+  const double lookupTime = MeasureMilliseconds([&]() {
+    Internal::NPatchDataPtr data;
+    for(const auto& id : ids)
+    {
+      found += npatchLoader.GetNPatchData(id, data) ? 1 : 0;
+    }
+  });
+
+  const double removeTime = MeasureMilliseconds([&]() {
+    for(const auto& id : ids)
+    {
+      npatchLoader.RequestRemove(id, nullptr);
+    }
+    application.SendNotification();
+  });
+
+  printf("N-patch cache for %d visuals of %d assets\n", numberOfVisuals, numberOfAssets);
+  printf("  load    : %.3f ms\n", loadTime);
+  printf("  look-up : %.3f ms, %d found\n", lookupTime, found);
+  printf("  remove  : %.3f ms\n", removeTime);
+
+  return 0;
+}
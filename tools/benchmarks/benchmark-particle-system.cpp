@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/particle-system/particle-list-impl.h>
+#include <dali-toolkit/internal/particle-system/particle-renderer-impl.h>
+#include <dali-toolkit/public-api/particle-system/particle-domain.h>
+#include <dali-toolkit/public-api/particle-system/particle-emitter.h>
+#include <dali-toolkit/public-api/particle-system/particle-list.h>
+#include <dali-toolkit/public-api/particle-system/particle-modifier.h>
+#include <dali-toolkit/public-api/particle-system/particle-renderer.h>
+#include <dali-toolkit/public-api/particle-system/particle-source.h>
+#include <toolkit-environment-variable.h>
+#include <toolkit-test-application.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit::ParticleSystem;
+
+namespace
+{
+/**
+ * @brief A source that emits nothing, the particles are added by the benchmark.
+ */
+class IdleSource : public ParticleSourceInterface
+{
+public:
+  IdleSource(ParticleEmitter* emitter)
+  {
+  }
+
+  uint32_t Update(ParticleList& outList, uint32_t count) override
+  {
+    return 0u;
+  }
+
+  void Init() override
+  {
+  }
+};
+
+/**
+ * @brief A modifier that leaves the particles as they are.
+ */
+struct IdleModifier : public ParticleModifierInterface
+{
+  void Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount) override
+  {
+  }
+};
+
+/**
+ * @brief Creates an initialized renderer for the emitter, and the stream buffer it writes the particles to.
+ */
+ParticleRenderer CreateStreamRenderer(ParticleEmitter& emitter, std::vector<uint8_t>& streamData, bool instancing)
+{
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_PARTICLE_SYSTEM_INSTANCING", instancing ? "1" : "0");
+
+  auto renderer = ParticleRenderer::New();
+  emitter.SetRenderer(renderer);
+
+  auto& rendererImpl = GetImplementation(renderer);
+  rendererImpl.Initialize();
+
+  auto& list = GetImplementation(emitter.GetParticleList());
+  streamData.resize(list.GetParticleCount() * list.GetStreamElementSize(false) * rendererImpl.GetNumberOfRecordsPerParticle());
+  return renderer;
+}
+
+template<typename Function>
+double MeasureMilliseconds(Function function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  function();
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+} // namespace
+
+int main()
+{
+  ToolkitTestApplication application;
+
+  const uint32_t particleCount = 50000u;
+
+  auto emitter = ParticleEmitter::New();
+  emitter.SetSource(ParticleSource::New<IdleSource>(&emitter));
+  emitter.SetRenderer(ParticleRenderer::New());
+  emitter.AddModifier(ParticleModifier::New<IdleModifier>());
+  emitter.SetDomain(ParticleDomain::New());
+  emitter.SetParticleCount(particleCount);
+
+  auto& list = emitter.GetParticleList();
+  for(auto i = 0u; i < particleCount; ++i)
+  {
+    auto particle = list.NewParticle(1.0f);
+    particle.Get<Vector3>(ParticleStream::POSITION_STREAM_BIT) = Vector3(float(i), 1.0f, 2.0f);
+  }
+
+  std::vector<uint8_t> instancedData;
+  std::vector<uint8_t> duplicatedData;
+  auto                 instancedRenderer  = CreateStreamRenderer(emitter, instancedData, true);
+  auto                 duplicatedRenderer = CreateStreamRenderer(emitter, duplicatedData, false);
+  const double         instancedTime      = MeasureMilliseconds([&]() { GetImplementation(instancedRenderer).OnStreamBufferUpdate(instancedData.data(), instancedData.size()); });
+  const double         duplicatedTime     = MeasureMilliseconds([&]() { GetImplementation(duplicatedRenderer).OnStreamBufferUpdate(duplicatedData.data(), duplicatedData.size()); });
+
+  // Release every other particle
+  std::vector<uint32_t> eraseIndices;
+  for(auto i = 0u; i < particleCount; i += 2u)
+  {
+    eraseIndices.push_back(i);
+  }
+  auto&        listImpl    = GetImplementation(list);
+  const double releaseTime = MeasureMilliseconds([&]() { listImpl.ReleaseParticles(eraseIndices); });
+
+  printf("Particle system, %u particles\n", particleCount);
+  printf("  upload  : %.2f ms (%.0f particles/ms) -> instanced %.2f ms (%.0f particles/ms)\n",
+         duplicatedTime,
+         particleCount / std::max(duplicatedTime, 0.001),
+         instancedTime,
+         particleCount / std::max(instancedTime, 0.001));
+  printf("  release : %u particles in %.2f ms (%.0f particles/ms)\n",
+         particleCount / 2u,
+         releaseTime,
+         (particleCount / 2u) / std::max(releaseTime, 0.001));
+
+  return 0;
+}
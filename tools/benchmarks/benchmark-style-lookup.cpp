@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+#include <toolkit-test-application.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace
+{
+std::string CreateStyles(int numberOfStyles)
+{
+  std::ostringstream stream;
+  stream << "{\"styles\":{";
+  for(int i = 0; i < numberOfStyles; ++i)
+  {
+    stream << (i > 0 ? "," : "") << "\"Style" << i << "\":{\"value\":" << i << "}";
+  }
+  stream << "}}";
+  return stream.str();
+}
+
+bool IsSameIgnoringCase(const std::string& a, const std::string& b)
+{
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y)
+  {
+    return std::tolower(x) == std::tolower(y);
+  });
+}
+
+template<typename Function>
+double MeasureMilliseconds(Function function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  function();
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+} // namespace
+
+int main()
+{
+  ToolkitTestApplication application;
+
+  // The style look-ups of 1,000 controls in a theme of 1,000 styles.
+  const int  numberOfStyles = 1000;
+  JsonParser parser         = JsonParser::New();
+  parser.Parse(CreateStyles(numberOfStyles));
+  const TreeNode* styles = parser.GetRoot()->GetChild("styles");
+
+  std::vector<std::string> names;
+  for(int i = 0; i < numberOfStyles; ++i)
+  {
+    names.push_back("style" + std::to_string(i));
+  }
+
+  // Walking the siblings, as the look-up did without the index
+  int          linearFound = 0;
+  const double linearTime  = MeasureMilliseconds([&]() {
+    for(const auto& name : names)
+    {
+      for(TreeNode::ConstIterator iter = styles->CBegin(); iter != styles->CEnd(); ++iter)
+      {
+        if(IsSameIgnoringCase((*iter).first, name))
+        {
+          ++linearFound;
+          break;
+        }
+      }
+    }
+  });
+
+  int          indexedFound = 0;
+  const double indexedTime  = MeasureMilliseconds([&]() {
+    for(const auto& name : names)
+    {
+      indexedFound += styles->GetChildIgnoreCase(name) ? 1 : 0;
+    }
+  });
+
+  printf("Style look-up for %d controls in %d styles\n", numberOfStyles, numberOfStyles);
+  printf("  siblings : %.3f ms, %d found\n", linearTime, linearFound);
+  printf("  indexed  : %.3f ms, %d found\n", indexedTime, indexedFound);
+
+  return 0;
+}
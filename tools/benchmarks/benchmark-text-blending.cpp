@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/rendering/text-typesetter-blending.h>
+
+using namespace Dali::Toolkit::Text::Blending;
+
+namespace
+{
+/**
+ * @brief Creates a pseudo-random pre-multiplied RGBA8888 pixel, with plenty of fully transparent and opaque ones.
+ */
+uint32_t CreatePremultipliedPixel(uint32_t& seed)
+{
+  seed = seed * 1664525u + 1013904223u;
+
+  const uint32_t alphaType = (seed >> 8) & 3u;
+  const uint32_t alpha     = (alphaType == 0u) ? 0u : (alphaType == 1u) ? 255u
+                                                                       : (seed >> 24);
+
+  uint32_t pixel = alpha << 24;
+  for(uint32_t channel = 0u; channel < 3u; ++channel)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    pixel |= ((seed >> 16) % (alpha + 1u)) << (8u * channel);
+  }
+  return pixel;
+}
+
+/**
+ * @brief Runs a kernel a number of times and returns the throughput in megapixels per second.
+ */
+template<typename Kernel>
+double MeasureMegapixelsPerSecond(uint32_t numberOfPixels, uint32_t iterations, Kernel kernel)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for(uint32_t iteration = 0u; iteration < iterations; ++iteration)
+  {
+    kernel();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  return (static_cast<double>(numberOfPixels) * iterations) / (std::max(elapsed.count(), 1e-9) * 1000000.0);
+}
+} // namespace
+
+int main()
+{
+  // A 1024x1024 text buffer.
+  const uint32_t numberOfPixels = 1024u * 1024u;
+  const uint32_t iterations     = 50u;
+
+  uint32_t              seed = 7u;
+  std::vector<uint32_t> top(numberOfPixels);
+  std::vector<uint32_t> bottom(numberOfPixels);
+  std::vector<uint8_t>  coverage(numberOfPixels);
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    top[index]    = CreatePremultipliedPixel(seed);
+    bottom[index] = CreatePremultipliedPixel(seed);
+  }
+  for(uint8_t& alpha : coverage)
+  {
+    alpha = static_cast<uint8_t>(CreatePremultipliedPixel(seed) >> 24);
+  }
+  const uint32_t color = 0xC0803010;
+
+  printf("Blending kernels, %u pixels, SIMD %s\n", numberOfPixels, IsSimdAvailable() ? "available" : "not available");
+
+  std::vector<uint32_t> result(numberOfPixels);
+  for(const KernelType type : {KernelType::SCALAR, KernelType::SIMD})
+  {
+    SetKernelType(type);
+    const char* name = (KernelType::SCALAR == type) ? "scalar" : "simd";
+
+    const double combine = MeasureMegapixelsPerSecond(numberOfPixels, iterations, [&]() { CombinePixels(top.data(), bottom.data(), result.data(), numberOfPixels); });
+    const double mask    = MeasureMegapixelsPerSecond(numberOfPixels, iterations, [&]() { MaskPixels(top.data(), result.data(), numberOfPixels, 200u); });
+    const double blit    = MeasureMegapixelsPerSecond(numberOfPixels, iterations, [&]() { BlitGlyphRow(coverage.data(), 1u, result.data(), numberOfPixels, color); });
+
+    printf("  %-6s : combine %.1f MP/s, mask %.1f MP/s, glyph blit %.1f MP/s\n", name, combine, mask, blit);
+  }
+
+  return 0;
+}